@@ -198,6 +198,154 @@ class AurivoAudioEngine {
         }
     }
 
+    /**
+     * Dosyayı worker thread'de aç; main thread decode/açılış beklemez.
+     * Native async API yoksa senkron loadFile'a düşer.
+     * @param {string} filePath
+     * @returns {Promise<{success:boolean,superseded?:boolean,error?:string,duration?:number,rate?:number,channels?:number,codec?:string}>}
+     */
+    async loadFileAsync(filePath) {
+        if (!isNativeAvailable || !this.initialized) {
+            return { success: false, error: 'Native audio yok' };
+        }
+        if (typeof nativeAudio.loadFileAsync !== 'function') {
+            return { success: !!this.loadFile(filePath) };
+        }
+
+        try {
+            const info = await nativeAudio.loadFileAsync(filePath);
+            console.log('✓ Dosya yüklendi:', path.basename(filePath));
+            return info;
+        } catch (error) {
+            return this._asyncLoadError(error, 'Dosya yükleme hatası:');
+        }
+    }
+
+    /**
+     * crossfadeTo'nun async hali; dosya açılışı worker thread'de yapılır.
+     * @param {string} filePath
+     * @param {number} durationMs
+     * @returns {Promise<{success:boolean,superseded?:boolean,error?:string|null}>}
+     */
+    async crossfadeToAsync(filePath, durationMs = 2000) {
+        if (!isNativeAvailable || !this.initialized) {
+            return { success: false, error: 'Native audio yok' };
+        }
+        if (typeof nativeAudio.crossfadeToAsync !== 'function') {
+            const res = this.crossfadeTo(filePath, durationMs);
+            const ok = (res === true) || (res && res.success);
+            return { success: !!ok, error: ok ? null : ((res && res.error) || 'Crossfade başarısız') };
+        }
+
+        try {
+            const info = await nativeAudio.crossfadeToAsync(filePath, durationMs);
+            this.startPositionUpdates();
+            return info;
+        } catch (error) {
+            return this._asyncLoadError(error, 'Crossfade hatası:');
+        }
+    }
+
+    /**
+     * Sıradaki parçayı arka planda hazırla (stream + FX zinciri + ilk ~300 ms).
+     * Aynı yol için sonraki loadFile/crossfadeTo hazır zinciri devralır.
+     * @param {string} filePath
+     * @param {{gapless?:boolean}} options - gapless: parça bitince native taraf kendisi geçer
+     * @returns {boolean}
+     */
+    preloadNext(filePath, options = {}) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.preloadNext !== 'function') return false;
+        return nativeAudio.preloadNext(filePath, { gapless: !!options.gapless });
+    }
+
+    cancelPreload() {
+        if (!isNativeAvailable || !this.initialized) return;
+        if (typeof nativeAudio.cancelPreload === 'function') nativeAudio.cancelPreload();
+    }
+
+    /**
+     * Preload edilen parçaya geç ve çal
+     * @param {number} crossfadeMs - 0 = doğrudan geçiş
+     * @returns {{success:boolean,path?:string|null,error?:string}}
+     */
+    playNext(crossfadeMs = 0) {
+        if (!isNativeAvailable || !this.initialized) return { success: false, error: 'Native audio yok' };
+        if (typeof nativeAudio.playNext !== 'function') return { success: false, error: 'Preload API yok' };
+        const res = nativeAudio.playNext(crossfadeMs);
+        if (res && res.success) this.startPositionUpdates();
+        return res;
+    }
+
+    /**
+     * @returns {{state:string,path:string|null,bufferedMs:number,duration:number,rate:number,gapless:boolean,autoAdvances:number}|null}
+     */
+    getPreloadState() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getPreloadState !== 'function') return null;
+        return nativeAudio.getPreloadState();
+    }
+
+    /**
+     * Crossfade eğrisi
+     * @param {'equal-power'|'linear'|'s-curve'|number} curve
+     */
+    setCrossfadeCurve(curve) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setCrossfadeCurve !== 'function') return false;
+        return nativeAudio.setCrossfadeCurve(curve);
+    }
+
+    /**
+     * @returns {{sources:number,fading:number,queued:boolean,ended:boolean,retired:number,forcedRetires:number,advances:number,rate:number,curve:string}|null}
+     */
+    getMixerStats() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getMixerStats !== 'function') return null;
+        return nativeAudio.getMixerStats();
+    }
+
+    /**
+     * Çıkış gecikme profili (BASS buffer). Küçük değer = efektler daha hızlı
+     * duyulur, visualizer hoparlöre daha yakın; underrun riski artar.
+     * @param {40|100|250|500} ms
+     */
+    setLatencyProfile(ms) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setLatencyProfile !== 'function') return false;
+        return nativeAudio.setLatencyProfile(Number(ms) || 0);
+    }
+
+    /**
+     * Bit-transparent çıkış: cihaz her parçada parçanın örnekleme hızına
+     * geçirilir. Kapalıyken cihaz kendi hızında kalır, mikser dönüştürür.
+     * @param {boolean} enabled
+     */
+    setBitTransparent(enabled) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setBitTransparent !== 'function') return false;
+        return nativeAudio.setBitTransparent(!!enabled);
+    }
+
+    /**
+     * @returns {{profileMs:number,profiles:number[],bufferMs:number,updatePeriodMs:number,deviceLatencyMs:number,minBufferMs:number,bufferedMs:number,totalMs:number,blockFrames:number,maxBlockFrames:number,sampleRate:number,deviceRate:number,bitTransparent:boolean,underruns:number,underrunsByProfile:Object<string,number>}|null}
+     */
+    getLatencyInfo() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getLatencyInfo !== 'function') return null;
+        return nativeAudio.getLatencyInfo();
+    }
+
+    _asyncLoadError(error, label) {
+        const message = (error && error.message) || String(error);
+        // Daha yeni bir yükleme isteği bu isteği geçersiz kıldı; hata değil
+        if (error && error.code === 'SUPERSEDED') {
+            return { success: false, superseded: true, error: message };
+        }
+        console.error(label, message);
+        return { success: false, error: message };
+    }
+
     /**
      * Oynat
      */
@@ -323,6 +471,124 @@ class AurivoAudioEngine {
         nativeAudio.setEQBands(gains);
     }
 
+    /**
+     * Birden çok parametreyi tek native çağrıyla uygula. DSP tarafı bir sonraki
+     * ses bloğunun başında, tek katsayı güncellemesiyle devreye girer.
+     * @param {Float32Array|number[]} ops - [paramId, value, paramId, value, ...]
+     * @returns {number} uygulanan işlem sayısı (native yoksa -1)
+     */
+    applyParamBatch(ops) {
+        if (!isNativeAvailable || !this.initialized) return -1;
+        if (typeof nativeAudio.applyParamBatch !== 'function') return -1;
+        return nativeAudio.applyParamBatch(ops);
+    }
+
+    /**
+     * applyParamBatch için parametre kimlikleri (native `paramIds`)
+     * @returns {Object|null}
+     */
+    getParamIds() {
+        if (!isNativeAvailable || !nativeAudio.paramIds) return null;
+        return nativeAudio.paramIds;
+    }
+
+    /**
+     * Tüm metreler tek native çağrıda (audio thread'in blok başına yayınladığı
+     * snapshot). Peak/RMS/korelasyon son okumadan bu yana biriken pencereyi kapsar.
+     * @param {Float32Array} [target] - yeniden kullanılacak hedef (>= meterFields.COUNT)
+     * @returns {Float32Array|null} alan sırası getMeterFields()
+     */
+    getMeters(target) {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getMeters !== 'function') return null;
+        if (!target) {
+            const count = nativeAudio.meterFields?.COUNT || 0;
+            if (!this._meterBuffer || this._meterBuffer.length < count) this._meterBuffer = new Float32Array(count);
+            target = this._meterBuffer;
+        }
+        return nativeAudio.getMeters(target);
+    }
+
+    /**
+     * getMeters dizisinin alan indeksleri (native `meterFields`)
+     * @returns {Object|null}
+     */
+    getMeterFields() {
+        if (!isNativeAvailable || !nativeAudio.meterFields) return null;
+        return nativeAudio.meterFields;
+    }
+
+    resetMeterCounters() {
+        if (!isNativeAvailable || !this.initialized) return;
+        if (typeof nativeAudio.resetMeterCounters === 'function') nativeAudio.resetMeterCounters();
+    }
+
+    // ============================================
+    // CALLBACK PROFİLİ
+    // ============================================
+    /**
+     * DSP callback zamanlama istatistikleri (blok süresi histogramı, deadline kaçırma sayısı)
+     * @returns {Object|null}
+     */
+    getDspStats() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getDspStats !== 'function') return null;
+        return nativeAudio.getDspStats();
+    }
+
+    resetDspStats() {
+        if (!isNativeAvailable || !this.initialized) return;
+        if (typeof nativeAudio.resetDspStats === 'function') nativeAudio.resetDspStats();
+    }
+
+    /** @param {{enabled?: boolean, perStage?: boolean, thresholdPercent?: number, windowSeconds?: number}} options */
+    setDspStatsOptions(options) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setDspStatsOptions !== 'function') return false;
+        return nativeAudio.setDspStatsOptions(options || {});
+    }
+
+    // ============================================
+    // KORELASYON / GONİOMETRE
+    // ============================================
+    /** @param {number} ms - korelasyon entegrasyon penceresi (10-10000 ms) */
+    setCorrelationWindow(ms) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setCorrelationWindow !== 'function') return false;
+        return nativeAudio.setCorrelationWindow(Number(ms) || 300);
+    }
+
+    /**
+     * @returns {{correlation:number,minimum:number,balance:number,width:number,midLevel:number,sideLevel:number,windowMs:number,live:boolean}|null}
+     */
+    getCorrelation() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getCorrelation !== 'function') return null;
+        return nativeAudio.getCorrelation();
+    }
+
+    /**
+     * Goniometre nokta akışı (audio thread M/S ring'i)
+     * @param {boolean} enabled
+     * @param {number} [decimation=4] - her N. örnek (1-64)
+     */
+    setGoniometer(enabled, decimation = 4) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setGoniometer !== 'function') return false;
+        return nativeAudio.setGoniometer(!!enabled, Number(decimation) || 4);
+    }
+
+    /**
+     * Son okumadan bu yana gelen M/S noktaları
+     * @param {Float32Array} [target] - verilirse doldurulur, nokta sayısı döner
+     * @returns {Float32Array|number|null} [m, s, m, s, ...]
+     */
+    readGoniometer(target) {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.readGoniometer !== 'function') return null;
+        return target ? nativeAudio.readGoniometer(target) : nativeAudio.readGoniometer();
+    }
+
     /**
      * Stereo genişliği ayarla
      * @param {number} width - 0.0 (mono) - 2.0 (extra wide)
@@ -1217,6 +1483,18 @@ class AurivoAudioEngine {
         return [];
     }
 
+    /**
+     * Convolution Reverb durumu (yüklü IR, bölüm sayıları, kuyruk gecikmeleri)
+     * @returns {Object}
+     */
+    GetConvolutionInfo() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.GetConvolutionInfo === 'function') {
+            return nativeAudio.GetConvolutionInfo();
+        }
+        return null;
+    }
+
     /**
      * Convolution Reverb ayarlarını sıfırla
      */
@@ -1323,13 +1601,6 @@ class AurivoAudioEngine {
         }
     }
 
-    updateAutoGain() {
-        if (!isNativeAvailable || !this.initialized) return;
-        if (typeof nativeAudio.updateAutoGain === 'function') {
-            nativeAudio.updateAutoGain();
-        }
-    }
-
     normalizeAudio(targetDB) {
         if (!isNativeAvailable || !this.initialized) return 0;
         if (typeof nativeAudio.normalizeAudio === 'function') {
@@ -1369,6 +1640,107 @@ class AurivoAudioEngine {
         return 0;
     }
 
+    // EBU R128 loudness (momentary/short-term/integrated/LRA) + AGC durumu
+    getLoudness() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getLoudness === 'function') {
+            return nativeAudio.getLoudness();
+        }
+        return null;
+    }
+
+    // ============================================
+    // LOUDNESS TARAMASI / REPLAYGAIN
+    // ============================================
+    /**
+     * Kütüphane taraması: arka plan thread havuzunda EBU R128 + true-peak.
+     * Sonuçlar path+boyut+mtime anahtarıyla diskte cache'lenir.
+     * @param {string[]} paths
+     * @param {{threads?:number,album?:boolean,force?:boolean}} [options]
+     * @param {(p:{done:number,total:number,result:Object}) => void} [onProgress]
+     * @returns {Promise<{cancelled:boolean,results:Object[]}>}
+     */
+    scanLoudness(paths, options = {}, onProgress) {
+        if (!isNativeAvailable || !this.initialized) return Promise.reject(new Error('Native audio not available'));
+        if (typeof nativeAudio.scanLoudness !== 'function') return Promise.reject(new Error('scanLoudness not supported'));
+        const list = Array.isArray(paths) ? paths.filter((p) => typeof p === 'string' && p) : [];
+        return nativeAudio.scanLoudness(list, options || {}, typeof onProgress === 'function' ? onProgress : undefined);
+    }
+
+    cancelLoudnessScan() {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.cancelLoudnessScan !== 'function') return false;
+        return nativeAudio.cancelLoudnessScan();
+    }
+
+    /**
+     * @param {{mode?:'off'|'track'|'album',preamp?:number,preventClipping?:boolean}} options
+     */
+    setReplayGain(options) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setReplayGain !== 'function') return false;
+        return nativeAudio.setReplayGain(options || {});
+    }
+
+    getReplayGainInfo() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getReplayGainInfo !== 'function') return null;
+        return nativeAudio.getReplayGainInfo();
+    }
+
+    /**
+     * Seek bar önizlemesi: min/max/RMS piramidinden `width` sütun.
+     * İlk istekte parça arka planda analiz edilir, sonrakiler önbellekten (mmap).
+     * @param {string} filePath
+     * @param {number} width
+     * @param {{start?:number,end?:number}} [range] saniye; verilmezse tüm parça
+     * @returns {Promise<{width:number,duration:number,start:number,end:number,level:number,binFrames:number,mapped:boolean,built:boolean,min:Float32Array,max:Float32Array,rms:Float32Array}>}
+     */
+    getWaveformOverview(filePath, width, range) {
+        if (!isNativeAvailable || !this.initialized) return Promise.reject(new Error('Native audio not available'));
+        if (typeof nativeAudio.getWaveformOverview !== 'function') return Promise.reject(new Error('getWaveformOverview not supported'));
+        return nativeAudio.getWaveformOverview(String(filePath || ''), Math.max(1, Math.floor(Number(width) || 0)), range || {});
+    }
+
+    /**
+     * Offline render: decode -> canlı DSP zinciri -> WAV, gerçek zamandan hızlı.
+     * @param {{bitDepth?:16|24|32,dither?:boolean,limiter?:boolean,replayGain?:boolean}} [options]
+     * @returns {Promise<{input:string,output:string,ok:boolean,duration?:number,renderSeconds?:number,realtimeFactor?:number,truePeak?:number,stages?:string[],skippedStages?:string[],message?:string}>}
+     */
+    renderFile(input, output, options = {}) {
+        if (!isNativeAvailable || !this.initialized) return Promise.reject(new Error('Native audio not available'));
+        if (typeof nativeAudio.renderFile !== 'function') return Promise.reject(new Error('renderFile not supported'));
+        return nativeAudio.renderFile(String(input || ''), String(output || ''), options || {});
+    }
+
+    /**
+     * Toplu render (işçi havuzu, thread başına bir DSP örneği).
+     * @param {Array<{input:string,output:string}>} jobs
+     * @param {{threads?:number,bitDepth?:16|24|32,dither?:boolean,limiter?:boolean,replayGain?:boolean}} [options]
+     * @param {(progress:{done:number,total:number,result:object}) => void} [onProgress]
+     */
+    renderFiles(jobs, options = {}, onProgress) {
+        if (!isNativeAvailable || !this.initialized) return Promise.reject(new Error('Native audio not available'));
+        if (typeof nativeAudio.renderFiles !== 'function') return Promise.reject(new Error('renderFiles not supported'));
+        const list = Array.isArray(jobs)
+            ? jobs.filter((j) => j && typeof j.input === 'string' && typeof j.output === 'string')
+            : [];
+        return nativeAudio.renderFiles(list, options || {}, typeof onProgress === 'function' ? onProgress : undefined);
+    }
+
+    cancelRender() {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.cancelRender !== 'function') return false;
+        return nativeAudio.cancelRender();
+    }
+
+    // Analiz cache'lerinin (loudness, waveform) tutulacağı dizin
+    setCacheDirectory(dir) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setCacheDirectory !== 'function') return false;
+        return nativeAudio.setCacheDirectory(String(dir || ''));
+    }
+
     // ============================================
     // TRUE PEAK LIMITER
     // ============================================
@@ -1606,6 +1978,159 @@ class AurivoAudioEngine {
         return { channels, data: floatArray };
     }
 
+    /**
+     * PCM'i verilen Float32Array'e yerinde yaz (zero-copy, stereo interleaved)
+     * @param {Float32Array} target - SharedArrayBuffer üzerindeki view de olabilir
+     * @returns {number} yazılan frame sayısı (kanal başına)
+     */
+    getPCMDataInto(target) {
+        if (!isNativeAvailable || !this.initialized) return 0;
+        if (!(target instanceof Float32Array)) return 0;
+        return nativeAudio.getPCMData(target) || 0;
+    }
+
+    /**
+     * FFT magnitude'larını verilen Float32Array'e yaz (en fazla 1024 bin)
+     * @param {Float32Array} target
+     * @returns {number} yazılan bin sayısı
+     */
+    getFFTDataInto(target) {
+        if (!isNativeAvailable || !this.initialized) return 0;
+        if (!(target instanceof Float32Array)) return 0;
+        return nativeAudio.getFFTData(target) || 0;
+    }
+
+    /**
+     * Spektrum bantlarını verilen Float32Array'e yaz (bant sayısı = dizi uzunluğu)
+     * @param {Float32Array} target
+     * @returns {number} yazılan bant sayısı
+     */
+    getSpectrumBandsInto(target) {
+        if (!isNativeAvailable || !this.initialized) return 0;
+        if (!(target instanceof Float32Array)) return 0;
+        return nativeAudio.getSpectrumBands(target) || 0;
+    }
+
+    /**
+     * Kalıcı analiz buffer'ı oluştur (bir kez map edilir, updateAnalysisBuffer ile dolar)
+     * Düzen: [seq, channels, pcmFrames, fftBins, numBands, sampleRate, -, -] | PCM | FFT(1024) | bands
+     * @param {number} framesPerChannel
+     * @param {number} numBands
+     * @returns {Float32Array|null}
+     */
+    createAnalysisBuffer(framesPerChannel = 1024, numBands = 64) {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.createAnalysisBuffer !== 'function') return null;
+        return nativeAudio.createAnalysisBuffer(framesPerChannel, numBands);
+    }
+
+    /**
+     * Kalıcı analiz buffer'ını güncelle
+     * @returns {number} sequence numarası (buffer yoksa -1)
+     */
+    updateAnalysisBuffer() {
+        if (!isNativeAvailable || !this.initialized) return -1;
+        if (typeof nativeAudio.updateAnalysisBuffer !== 'function') return -1;
+        return nativeAudio.updateAnalysisBuffer();
+    }
+
+    releaseAnalysisBuffer() {
+        if (!isNativeAvailable) return;
+        if (typeof nativeAudio.releaseAnalysisBuffer === 'function') {
+            nativeAudio.releaseAnalysisBuffer();
+        }
+    }
+
+    /**
+     * Native visualizer feeder: v2 paketlerini doğrudan verilen pipe fd'sine yazar
+     * (JS setInterval pompasına gerek kalmaz). Windows'ta false döner.
+     * @param {number} fd - visualizer stdin pipe fd'si
+     * @param {number} framesPerPacket
+     * @returns {boolean}
+     */
+    attachVisualizerFd(fd, framesPerPacket = 1024) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.attachVisualizerFd !== 'function') return false;
+        if (typeof fd !== 'number' || fd < 0) return false;
+        return !!nativeAudio.attachVisualizerFd(fd, framesPerPacket);
+    }
+
+    detachVisualizerFd() {
+        if (!isNativeAvailable) return;
+        if (typeof nativeAudio.detachVisualizerFd === 'function') {
+            nativeAudio.detachVisualizerFd();
+        }
+    }
+
+    getVisualizerFeedStats() {
+        if (!isNativeAvailable) return null;
+        if (typeof nativeAudio.getVisualizerFeedStats !== 'function') return null;
+        return nativeAudio.getVisualizerFeedStats();
+    }
+
+    /**
+     * Visualizer için paylaşımlı bellek PCM ring'i oluşturur. Dönen isim
+     * visualizer'a `--pcm-shm <isim>` olarak verilir.
+     * @param {number} capacityFrames - ring kapasitesi (2'nin kuvvetine yuvarlanır)
+     * @returns {string|null}
+     */
+    createVisualizerShm(capacityFrames = 32768) {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.createVisualizerShm !== 'function') return null;
+        return nativeAudio.createVisualizerShm(capacityFrames) || null;
+    }
+
+    closeVisualizerShm() {
+        if (!isNativeAvailable) return;
+        if (typeof nativeAudio.closeVisualizerShm === 'function') {
+            nativeAudio.closeVisualizerShm();
+        }
+    }
+
+    getVisualizerShmStats() {
+        if (!isNativeAvailable) return null;
+        if (typeof nativeAudio.getVisualizerShmStats !== 'function') return null;
+        return nativeAudio.getVisualizerShmStats();
+    }
+
+    /**
+     * Legacy analiz decoder'ı (parça başına ikinci BASS decoder) aç/kapat.
+     * Varsayılan kapalı: analiz post-DSP tap'ten okunur.
+     * @param {boolean} enabled
+     */
+    setAnalysisDecoderEnabled(enabled) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setAnalysisDecoderEnabled !== 'function') return false;
+        return nativeAudio.setAnalysisDecoderEnabled(!!enabled);
+    }
+
+    /**
+     * Master-bus modu: parçalar önce toplanır, EQ/dinamik/limiter/reverb
+     * zinciri toplam üzerinde bir kez çalışır (crossfade'de tek limiter).
+     * @param {boolean} enabled
+     */
+    setBusMode(enabled) {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.setBusMode !== 'function') return false;
+        return nativeAudio.setBusMode(!!enabled);
+    }
+
+    getBusMode() {
+        if (!isNativeAvailable || !this.initialized) return false;
+        if (typeof nativeAudio.getBusMode !== 'function') return false;
+        return nativeAudio.getBusMode();
+    }
+
+    /**
+     * Engine istatistikleri (açık decoder sayısı vb.)
+     * @returns {{openDecoders:number, analysisDecoders:number, analysisDecoderEnabled:boolean, analysisTapActive:boolean, busMode:boolean}|null}
+     */
+    getEngineStats() {
+        if (!isNativeAvailable || !this.initialized) return null;
+        if (typeof nativeAudio.getEngineStats !== 'function') return null;
+        return nativeAudio.getEngineStats();
+    }
+
     // ============================================
     // BASS MONO CONTROLS
     // ============================================
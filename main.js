@@ -413,6 +413,13 @@ function initNativeAudioEngineSafe({ force = false } = {}) {
                 console.log('[NativeAudio] addon:', audioEngineModule?.loadedAddonPath || '(unknown)');
             }
             wireNativeAudioIpcOnce();
+            try {
+                const cacheDir = path.join(app.getPath('userData'), 'audio-analysis-cache');
+                fs.mkdirSync(cacheDir, { recursive: true });
+                audioEngine.setCacheDirectory?.(cacheDir);
+            } catch (e) {
+                console.warn('[NativeAudio] Analiz cache dizini oluşturulamadı:', e?.message || e);
+            }
         } else {
             console.warn('⚠ Native audio başlatılamadı, HTML5 Audio kullanılacak');
             const err = audioEngineModule?.lastNativeLoadError;
@@ -1401,6 +1408,22 @@ function normalizeEq32BandsForEngine(bands) {
     return out;
 }
 
+// EQ32 durumunu tek applyParamBatch çağrısıyla uygular (preset geçişi aynı DSP
+// bloğunda olur). module: { balance, bass, mid, treble, stereoExpander } (isteğe bağlı).
+// Batch API yoksa false döner; çağıran tek tek setter'lara düşer.
+function applyEq32ParamBatch(bands, module = {}) {
+    const ids = audioEngine?.getParamIds?.();
+    if (!ids || typeof audioEngine.applyParamBatch !== 'function') return false;
+    const ops = [];
+    bands.forEach((v, i) => ops.push(ids.EQ_BAND_0 + i, v));
+    if (Number.isFinite(module.balance)) ops.push(ids.BALANCE, module.balance);
+    if (Number.isFinite(module.bass)) ops.push(ids.TONE_BASS, module.bass);
+    if (Number.isFinite(module.mid)) ops.push(ids.TONE_MID, module.mid);
+    if (Number.isFinite(module.treble)) ops.push(ids.TONE_TREBLE, module.treble);
+    if (Number.isFinite(module.stereoExpander)) ops.push(ids.STEREO_EXPANDER, module.stereoExpander);
+    return audioEngine.applyParamBatch(Float32Array.from(ops)) >= 0;
+}
+
 async function applyPersistedEq32SfxFromSettings() {
     if (!audioEngine || !isNativeAudioAvailable) return;
 
@@ -1411,6 +1434,14 @@ async function applyPersistedEq32SfxFromSettings() {
         if (!eq32) return;
 
         const bands = normalizeEq32BandsForEngine(eq32.bands);
+
+        // Tek native çağrı: 32 bant + balance + ton + stereo genişlik
+        if (applyEq32ParamBatch(bands, eq32)) {
+            const name = eq32?.lastPreset?.name;
+            console.log(`[SFX] EQ32 ayarları yüklendi${name ? `: ${name}` : ''}`);
+            return;
+        }
+
         if (typeof audioEngine.setEQBands === 'function') {
             audioEngine.setEQBands(bands);
         } else if (typeof audioEngine.setEQBand === 'function') {
@@ -2130,7 +2161,57 @@ function focusVisualizerWindow() {
     }
 }
 
+let visualizerNativeFeed = false;
+let visualizerShmName = null;
+let visualizerShmConfirmTimer = null;
+
+// Visualizer shm'i map edip doğrulayınca başlıktaki consumerAttached'ı 1 yapar.
+// O zamana kadar (ya da map hiç olmazsa) stdin beslemesi sürer.
+const VISUALIZER_SHM_CONFIRM_MS = 5000;
+
+// Paylaşımlı bellek PCM ring'i: addon post-DSP sample'ları doğrudan yazar,
+// visualizer `--pcm-shm <isim>` ile salt-okunur map eder (pipe/paket yok).
+function openVisualizerShm() {
+    closeVisualizerShm();
+    if (!audioEngine || typeof audioEngine.createVisualizerShm !== 'function') return null;
+    try {
+        visualizerShmName = audioEngine.createVisualizerShm() || null;
+    } catch (e) {
+        console.warn('[Visualizer] shm oluşturulamadı, stdin beslemesine dönülüyor:', e?.message || e);
+        visualizerShmName = null;
+    }
+    return visualizerShmName;
+}
+
+function closeVisualizerShm() {
+    if (!visualizerShmName) return;
+    visualizerShmName = null;
+    try {
+        audioEngine?.closeVisualizerShm?.();
+    } catch {
+        // en iyi çaba
+    }
+}
+
 function stopVisualizerFeed() {
+    if (visualizerShmConfirmTimer) {
+        clearInterval(visualizerShmConfirmTimer);
+        visualizerShmConfirmTimer = null;
+    }
+    stopVisualizerStdinFeed();
+}
+
+function stopVisualizerStdinFeed() {
+    if (visualizerNativeFeed) {
+        visualizerNativeFeed = false;
+        try {
+            const stats = audioEngine?.getVisualizerFeedStats?.();
+            if (stats) console.log('[Visualizer] native feed stats', stats);
+            audioEngine?.detachVisualizerFd?.();
+        } catch {
+            // en iyi çaba
+        }
+    }
     if (visualizerFeedTimer) {
         clearInterval(visualizerFeedTimer);
         visualizerFeedTimer = null;
@@ -2138,15 +2219,63 @@ function stopVisualizerFeed() {
     visualizerFeedStats = null;
 }
 
+// Native feeder: addon kendi thread'inde v2 paketlerini doğrudan pipe'a yazar.
+// Pipe fd'si yalnızca POSIX'te açığa çıkıyor; Windows'ta JS pompasına düşülür.
+function tryStartNativeVisualizerFeed(framesPerChannel) {
+    if (process.platform === 'win32') return false;
+    if (!audioEngine || typeof audioEngine.attachVisualizerFd !== 'function') return false;
+    try {
+        const fd = visualizerProc?.stdin?._handle?.fd;
+        if (typeof fd !== 'number' || fd < 0) return false;
+        if (!audioEngine.attachVisualizerFd(fd, framesPerChannel)) return false;
+        visualizerNativeFeed = true;
+        console.log('[Visualizer] PCM feed: native thread (fd=' + fd + ')');
+        return true;
+    } catch (e) {
+        console.warn('[Visualizer] native feed başlatılamadı, JS pompasına dönülüyor:', e?.message || e);
+        return false;
+    }
+}
+
+// shm onayını bekler; onay gelince stdin beslemesini durdurur
+function waitForVisualizerShm() {
+    const shmName = visualizerShmName;
+    const startedAt = Date.now();
+    visualizerShmConfirmTimer = setInterval(() => {
+        let attached = false;
+        try {
+            attached = !!audioEngine?.getVisualizerShmStats?.()?.consumerAttached;
+        } catch {
+            attached = false;
+        }
+        if (attached) {
+            clearInterval(visualizerShmConfirmTimer);
+            visualizerShmConfirmTimer = null;
+            stopVisualizerStdinFeed();
+            console.log('[Visualizer] PCM feed: shared memory (' + shmName + ')');
+        } else if (Date.now() - startedAt > VISUALIZER_SHM_CONFIRM_MS) {
+            clearInterval(visualizerShmConfirmTimer);
+            visualizerShmConfirmTimer = null;
+            console.warn('[Visualizer] shm eşlemesi doğrulanmadı, stdin beslemesi sürüyor');
+        }
+    }, 100);
+}
+
 function startVisualizerFeed() {
     stopVisualizerFeed();
     if (!visualizerProc || !visualizerProc.stdin) return;
+
+    // shm varsa bile visualizer map ettiğini onaylayana kadar stdin'i besle
+    if (visualizerShmName) waitForVisualizerShm();
+
+    const requestedFramesPerChannel = 1024;
+    if (tryStartNativeVisualizerFeed(requestedFramesPerChannel)) return;
+
     if (!audioEngine || typeof audioEngine.getPCMData !== 'function') {
         console.warn('[Visualizer] PCM feed yok: audioEngine.getPCMData bulunamadı');
         return;
     }
 
-    const requestedFramesPerChannel = 1024;
     visualizerFeedStats = {
         startedAt: Date.now(),
         lastLogAt: 0,
@@ -2491,7 +2620,9 @@ function startVisualizer() {
         // Hata ayıklama: strace ile çalıştır
         const useStrace = false; // hata ayıklama için true yap
         const actualExe = useStrace ? 'strace' : exePath;
-        const actualArgs = useStrace ? ['-o', '/tmp/visualizer-strace.log', '-ff', exePath, '--presets', presetsPath] : ['--presets', presetsPath];
+        const shmName = openVisualizerShm();
+        const visArgs = shmName ? ['--presets', presetsPath, '--pcm-shm', shmName] : ['--presets', presetsPath];
+        const actualArgs = useStrace ? ['-o', '/tmp/visualizer-strace.log', '-ff', exePath, ...visArgs] : visArgs;
 
         const visualizerCwd = (() => {
             try { return path.dirname(exePath); } catch { return undefined; }
@@ -2524,6 +2655,7 @@ function startVisualizer() {
         visualizerProc.on('exit', (code, signal) => {
             console.log(`[Visualizer] kapandı (code=${code}, signal=${signal})`);
             stopVisualizerFeed();
+            closeVisualizerShm();
             const wasStopRequested = visualizerStopRequested || signal === 'SIGTERM';
             visualizerStopRequested = false;
             visualizerProc = null;
@@ -2576,6 +2708,7 @@ function startVisualizer() {
         visualizerProc.on('error', (err) => {
             console.error('[Visualizer] spawn error:', err);
             stopVisualizerFeed();
+            closeVisualizerShm();
             visualizerProc = null;
 
             try {
@@ -2608,11 +2741,18 @@ function startVisualizer() {
                 }
                 stopVisualizerFeed();
             });
+            // Node pipe'ı kapatınca fd numarası yeniden kullanılabilir; native
+            // feeder kendi dup()'ını tutsa da beslemeyi burada bitir
+            const feedProc = visualizerProc;
+            visualizerProc.stdin.on('close', () => {
+                if (visualizerProc === feedProc) stopVisualizerFeed();
+            });
         }
 
         return true;
     } catch (e) {
         console.error('[Visualizer] startVisualizer exception:', e);
+        closeVisualizerShm();
         visualizerProc = null;
         return false;
     }
@@ -2625,6 +2765,7 @@ function stopVisualizer() {
         console.log('[Visualizer] stopping...');
         visualizerStopRequested = true;
         stopVisualizerFeed();
+        closeVisualizerShm();
         visualizerProc.kill('SIGTERM');
     } catch (e) {
         // en iyi çaba
@@ -3743,7 +3884,9 @@ ipcMain.handle('audio:loadFile', async (event, filePath) => {
         try {
             const cached = await transcodeAudioToFlacCached(src);
             if (cached) {
-                const okOpus = audioEngine.loadFile(cached);
+                const resOpus = await audioEngine.loadFileAsync(cached);
+                if (resOpus.superseded) return { success: false, superseded: true, error: resOpus.error };
+                const okOpus = resOpus.success;
                 console.log('[MAIN] loadFile (opus->flac):', okOpus ? 'ok' : 'fail', cached);
                 if (okOpus) {
                     applyPersistedEq32SfxFromSettings().catch(() => { /* yoksay */ });
@@ -3755,7 +3898,11 @@ ipcMain.handle('audio:loadFile', async (event, filePath) => {
         }
     }
 
-    const ok = audioEngine.loadFile(src);
+    // Dosya açılışı native worker thread'de; main process bloklanmaz
+    const res = await audioEngine.loadFileAsync(src);
+    // Kullanıcı bu arada başka parçaya geçti; transcode fallback ile yenisini ezme
+    if (res.superseded) return { success: false, superseded: true, error: res.error };
+    const ok = res.success;
     console.log('[MAIN] loadFile:', ok ? 'ok' : 'fail', src);
     if (ok) {
         // Some formats can return "ok" but still have an unusable duration (0) because decoder/plugin is missing.
@@ -3783,7 +3930,9 @@ ipcMain.handle('audio:loadFile', async (event, filePath) => {
     try {
         const cached = await transcodeAudioToFlacCached(src);
         if (cached) {
-            const ok2 = audioEngine.loadFile(cached);
+            const res2 = await audioEngine.loadFileAsync(cached);
+            if (res2.superseded) return { success: false, superseded: true, error: res2.error };
+            const ok2 = res2.success;
             console.log('[MAIN] loadFile (transcoded):', ok2 ? 'ok' : 'fail', cached);
             if (ok2) {
                 applyPersistedEq32SfxFromSettings().catch(() => { /* yoksay */ });
@@ -3802,17 +3951,18 @@ ipcMain.handle('audio:crossfadeTo', async (event, filePath, durationMs) => {
     if (!audioEngine || !isNativeAudioAvailable) {
         return { success: false, error: 'Native audio yok' };
     }
-    if (typeof audioEngine.crossfadeTo !== 'function') {
+    if (typeof audioEngine.crossfadeToAsync !== 'function') {
         return { success: false, error: 'Crossfade API yok' };
     }
     const ms = Math.max(0, Number(durationMs) || 0);
-    const res = audioEngine.crossfadeTo(filePath, ms);
-    const ok = (res === true) || (res && res.success);
-    console.log('[MAIN] crossfadeTo:', ok ? 'ok' : 'fail', 'ms=', ms, filePath);
+    const res = await audioEngine.crossfadeToAsync(filePath, ms);
+    const ok = !!(res && res.success);
+    console.log('[MAIN] crossfadeTo:', ok ? 'ok' : (res && res.superseded ? 'superseded' : 'fail'), 'ms=', ms, filePath);
     if (ok) {
         applyPersistedEq32SfxFromSettings().catch(() => { /* yoksay */ });
+        return { success: true };
     }
-    return ok ? { success: true } : { success: false, error: (res && res.error) || 'Crossfade başarısız' };
+    return { success: false, superseded: !!(res && res.superseded), error: (res && res.error) || 'Crossfade başarısız' };
 });
 
 // Oynat
@@ -4002,6 +4152,144 @@ ipcMain.handle('audio:setEQBand', (event, band, gainDB) => {
     }
 });
 
+// Batch'teki EQ / balance değişikliklerini tek tek setter'lar gibi ana pencereye yansıt
+function broadcastParamBatch(data) {
+    const ids = audioEngine?.getParamIds?.();
+    if (!ids) return;
+    const bands = new Map();
+    for (let i = 0; i + 1 < data.length; i += 2) {
+        const id = data[i];
+        const value = data[i + 1];
+        if (id >= ids.EQ_BAND_0 && id < ids.EQ_BAND_0 + 32) {
+            bands.set(id - ids.EQ_BAND_0, value);
+        } else if (id === ids.BALANCE) {
+            broadcastSfxUpdate({ type: 'balance', balance: value });
+        }
+    }
+    if (bands.size === 32) {
+        broadcastSfxUpdate({ type: 'eqBands', gains: Array.from({ length: 32 }, (_, i) => bands.get(i)) });
+    } else {
+        bands.forEach((gainDB, band) => broadcastSfxUpdate({ type: 'eqBand', band, gainDB }));
+    }
+}
+
+// Toplu parametre güncelleme (tek native çağrı)
+ipcMain.handle('audio:applyParamBatch', (event, ops) => {
+    try {
+        if (!audioEngine || !isNativeAudioAvailable) return { success: false, error: 'Native audio yok' };
+        const data = ops instanceof Float32Array ? ops : Float32Array.from(Array.isArray(ops) ? ops : []);
+        const applied = audioEngine.applyParamBatch(data);
+        if (applied >= 0) broadcastParamBatch(data);
+        return { success: applied >= 0, applied };
+    } catch (error) {
+        return { success: false, error: error.message };
+    }
+});
+
+ipcMain.handle('audio:getParamIds', () => {
+    return audioEngine?.getParamIds?.() || null;
+});
+
+// Tüm metreler tek çağrıda (IPC dönüşünde kopyalanır, paylaşılan buffer güvenli)
+ipcMain.handle('audio:getMeters', () => {
+    return audioEngine?.getMeters?.() || null;
+});
+
+ipcMain.handle('audio:getMeterFields', () => {
+    return audioEngine?.getMeterFields?.() || null;
+});
+
+ipcMain.handle('audio:resetMeterCounters', () => {
+    audioEngine?.resetMeterCounters?.();
+    return true;
+});
+
+// DSP callback profili (blok süreleri, deadline kaçırmaları)
+ipcMain.handle('audio:getDspStats', () => {
+    return audioEngine?.getDspStats?.() || null;
+});
+
+ipcMain.handle('audio:resetDspStats', () => {
+    audioEngine?.resetDspStats?.();
+    return true;
+});
+
+ipcMain.handle('audio:setDspStatsOptions', (_event, options) => {
+    return audioEngine?.setDspStatsOptions?.(options) || false;
+});
+
+// Stereo korelasyon (seçilebilir pencere) ve goniometre M/S noktaları
+ipcMain.handle('audio:setCorrelationWindow', (_event, ms) => {
+    return audioEngine?.setCorrelationWindow?.(ms) || false;
+});
+
+ipcMain.handle('audio:getCorrelation', () => {
+    return audioEngine?.getCorrelation?.() || null;
+});
+
+ipcMain.handle('audio:setGoniometer', (_event, enabled, decimation) => {
+    return audioEngine?.setGoniometer?.(enabled, decimation) || false;
+});
+
+ipcMain.handle('audio:readGoniometer', () => {
+    return audioEngine?.readGoniometer?.() || null;
+});
+
+// Sıradaki parçayı önceden hazırla (geçişte dosya I/O'su olmasın)
+ipcMain.handle('audio:preloadNext', (event, filePath, options) => {
+    if (!audioEngine || !isNativeAudioAvailable) return false;
+    const src = String(filePath || '').trim();
+    // .opus loadFile'da FLAC'a dönüştürülerek açılıyor; ham yol eşleşmez
+    if (!src || path.extname(src).toLowerCase() === '.opus') return false;
+    return !!audioEngine.preloadNext?.(src, options || {});
+});
+
+ipcMain.handle('audio:cancelPreload', () => {
+    audioEngine?.cancelPreload?.();
+    return true;
+});
+
+ipcMain.handle('audio:playNext', (event, crossfadeMs) => {
+    if (!audioEngine || !isNativeAudioAvailable) return { success: false, error: 'Native audio yok' };
+    const res = audioEngine.playNext?.(Math.max(0, Number(crossfadeMs) || 0)) || { success: false };
+    if (res.success) {
+        applyPersistedEq32SfxFromSettings().catch(() => { /* yoksay */ });
+    }
+    return res;
+});
+
+ipcMain.handle('audio:getPreloadState', () => {
+    return audioEngine?.getPreloadState?.() || null;
+});
+
+ipcMain.handle('audio:setCrossfadeCurve', (event, curve) => {
+    return !!audioEngine?.setCrossfadeCurve?.(curve);
+});
+
+ipcMain.handle('audio:getMixerStats', () => {
+    return audioEngine?.getMixerStats?.() || null;
+});
+
+ipcMain.handle('audio:setLatencyProfile', (event, ms) => {
+    return !!audioEngine?.setLatencyProfile?.(ms);
+});
+
+ipcMain.handle('audio:setBitTransparent', (event, enabled) => {
+    return !!audioEngine?.setBitTransparent?.(!!enabled);
+});
+
+ipcMain.handle('audio:getLatencyInfo', () => {
+    return audioEngine?.getLatencyInfo?.() || null;
+});
+
+ipcMain.handle('audio:setBusMode', (event, enabled) => {
+    return !!audioEngine?.setBusMode?.(!!enabled);
+});
+
+ipcMain.handle('audio:getBusMode', () => {
+    return !!audioEngine?.getBusMode?.();
+});
+
 // Tüm EQ bantlarını ayarla
 ipcMain.handle('audio:setEQBands', (event, gains) => {
     try {
@@ -4225,16 +4513,6 @@ ipcMain.handle('audio:setAutoGainMode', (event, mode) => {
     return { success: false };
 });
 
-ipcMain.handle('audio:updateAutoGain', () => {
-    console.log('[MAIN] audio:updateAutoGain called');
-    if (audioEngine && isNativeAudioAvailable && typeof audioEngine.updateAutoGain === 'function') {
-        audioEngine.updateAutoGain();
-        return { success: true };
-    }
-    console.log('[MAIN] updateAutoGain not available');
-    return { success: false };
-});
-
 ipcMain.handle('audio:normalizeAudio', (event, targetDB) => {
     if (audioEngine && isNativeAudioAvailable && typeof audioEngine.normalizeAudio === 'function') {
         const gain = audioEngine.normalizeAudio(targetDB);
@@ -4265,6 +4543,79 @@ ipcMain.handle('audio:getPeakLevel', () => {
     return -96;
 });
 
+ipcMain.handle('audio:getLoudness', () => {
+    return audioEngine?.getLoudness?.() || null;
+});
+
+// Kütüphane loudness taraması: ilerleme 'audio:loudnessScanProgress' ile gönderilir
+ipcMain.handle('audio:scanLoudness', async (event, paths, options) => {
+    if (!audioEngine || !isNativeAudioAvailable || typeof audioEngine.scanLoudness !== 'function') {
+        return { cancelled: false, results: [], error: 'Native audio not available' };
+    }
+    const sender = event.sender;
+    try {
+        return await audioEngine.scanLoudness(paths, options, (progress) => {
+            if (!sender.isDestroyed()) sender.send('audio:loudnessScanProgress', progress);
+        });
+    } catch (e) {
+        return { cancelled: false, results: [], error: e?.message || String(e) };
+    }
+});
+
+ipcMain.handle('audio:cancelLoudnessScan', () => {
+    return audioEngine?.cancelLoudnessScan?.() || false;
+});
+
+ipcMain.handle('audio:setReplayGain', (_event, options) => {
+    return audioEngine?.setReplayGain?.(options) || false;
+});
+
+ipcMain.handle('audio:getReplayGainInfo', () => {
+    return audioEngine?.getReplayGainInfo?.() || null;
+});
+
+ipcMain.handle('audio:getWaveformOverview', async (_event, filePath, width, range) => {
+    if (!audioEngine || !isNativeAudioAvailable || typeof audioEngine.getWaveformOverview !== 'function') {
+        return null;
+    }
+    try {
+        return await audioEngine.getWaveformOverview(filePath, width, range);
+    } catch (e) {
+        console.warn('[Waveform]', e?.message || e);
+        return null;
+    }
+});
+
+ipcMain.handle('audio:renderFile', async (_event, input, output, options) => {
+    if (!audioEngine || !isNativeAudioAvailable || typeof audioEngine.renderFile !== 'function') {
+        return { input, output, ok: false, message: 'Native audio not available' };
+    }
+    try {
+        return await audioEngine.renderFile(input, output, options);
+    } catch (e) {
+        return { input, output, ok: false, message: e?.message || String(e) };
+    }
+});
+
+// Toplu render: ilerleme 'audio:renderProgress' ile gönderilir
+ipcMain.handle('audio:renderFiles', async (event, jobs, options) => {
+    if (!audioEngine || !isNativeAudioAvailable || typeof audioEngine.renderFiles !== 'function') {
+        return { cancelled: false, results: [], error: 'Native audio not available' };
+    }
+    const sender = event.sender;
+    try {
+        return await audioEngine.renderFiles(jobs, options, (progress) => {
+            if (!sender.isDestroyed()) sender.send('audio:renderProgress', progress);
+        });
+    } catch (e) {
+        return { cancelled: false, results: [], error: e?.message || String(e) };
+    }
+});
+
+ipcMain.handle('audio:cancelRender', () => {
+    return audioEngine?.cancelRender?.() || false;
+});
+
 ipcMain.handle('audio:getGainReduction', () => {
     if (audioEngine && isNativeAudioAvailable && typeof audioEngine.getAutoGainReduction === 'function') {
         return audioEngine.getAutoGainReduction();
@@ -5038,6 +5389,13 @@ ipcMain.handle('audio:getIRPresets', (event) => {
     return [];
 });
 
+ipcMain.handle('audio:getConvolutionInfo', (event) => {
+    if (audioEngine && isNativeAudioAvailable && typeof audioEngine.GetConvolutionInfo === 'function') {
+        return audioEngine.GetConvolutionInfo();
+    }
+    return null;
+});
+
 ipcMain.handle('audio:resetConvolutionReverb', (event) => {
     if (audioEngine && isNativeAudioAvailable && typeof audioEngine.ResetConvolutionReverb === 'function') {
         return audioEngine.ResetConvolutionReverb();
@@ -5648,10 +6006,13 @@ ipcMain.handle('eqPresets:select', async (event, filename) => {
         // Engine'e uygula (Ses Efektleri penceresi kapalı olsa bile geçerli olsun)
         if (audioEngine && isNativeAudioAvailable) {
             try {
-                if (typeof audioEngine.setEQBands === 'function') {
-                    audioEngine.setEQBands(bands);
-                } else if (typeof audioEngine.setEQBand === 'function') {
-                    bands.forEach((v, i) => audioEngine.setEQBand(i, v));
+                // Tek native çağrı: tüm bantlar aynı DSP bloğunda
+                if (!applyEq32ParamBatch(bands)) {
+                    if (typeof audioEngine.setEQBands === 'function') {
+                        audioEngine.setEQBands(bands);
+                    } else if (typeof audioEngine.setEQBand === 'function') {
+                        bands.forEach((v, i) => audioEngine.setEQBand(i, v));
+                    }
                 }
             } catch {
                 // en iyi çaba
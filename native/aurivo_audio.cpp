@@ -4,9 +4,14 @@
 // Sürüm 2.0 - Clipping Yok, Derin Bass
 // ============================================
 
+#ifndef AURIVO_RENDER_CLI
 #include <napi.h>
+#endif
 #include <string>
 #include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <cctype>
 #include <cmath>
 #include <mutex>
 #include <vector>
@@ -14,13 +19,39 @@
 #include <array>
 #include <algorithm>
 #include <chrono>
+#include <new>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <sys/stat.h>
 
 // BASS headers
 #include "bass.h"
 #include "bass_fx.h"
 
+#include "aurivo_log.h"
+
 #include <thread>
 #include <chrono>
+#include <condition_variable>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define AURIVO_HAS_SSE 1
+#else
+#define AURIVO_HAS_SSE 0
+#endif
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -33,6 +64,8 @@ extern "C" {
     void process_dsp(void* dsp, float* buffer, int numFrames, int channels);
     void set_eq_band(void* dsp, int band, float gain);
     void set_eq_bands(void* dsp, const float* gains, int numBands);
+    void stage_eq_band(void* dsp, int band, float gain);
+    void commit_eq_bands(void* dsp);
     void set_tone_params(void* dsp, float bass, float mid, float treble);
     void set_stereo_width(void* dsp, float width);
     void set_dsp_enabled(void* dsp, int enabled);
@@ -48,13 +81,16 @@ extern "C" {
     void set_crossfeed_params(void *dsp, int enabled, float level, float delay, float lowCut, float highCut);
     void set_bass_mono_params(void *dsp, int enabled, float cutoff, float slope, float width);
     void set_dynamic_eq_params(void *dsp, int enabled, float freq, float q, float thr, float gain, float rng, float atk, float rel);
+    void get_dynamics_state(void *dsp, float *compressorGrDb, float *gateGain, float *limiterGrDb);
+    void reset_dsp_state(void *dsp);
 }
 
 // ============================================
 // SABİTLER
 // ============================================
 static const int NUM_EQ_BANDS = 32;
-static const int SAMPLE_RATE = 44100;
+// Cihaz hızı öğrenilene kadar kullanılan varsayılan; gerçek hız BASS_GetInfo'dan
+static const int FALLBACK_SAMPLE_RATE = 48000;
 static const int FFT_SIZE = 2048;
 
 // Logaritmik frekans dağılımı - 32 bant (20Hz - 20kHz)
@@ -84,6 +120,299 @@ static inline float linearTodB(float linear) {
     return 20.0f * std::log10(linear);
 }
 
+// ============================================
+// PARAMETRE SNAPSHOT'LARI (RCU, audio thread için wait-free)
+// ============================================
+// Setter'lar mevcut bloğun kopyasını değiştirip atomic pointer swap ile yayınlar;
+// BASS DSP callback'leri buffer başına bir kez ReadGuard ile en yeni bloğu alır
+// ve buffer boyunca o değişmez kopyayı kullanır (yarım yazılmış struct görmez).
+// Eski bloklar audio thread'de değil, bir sonraki update()/reclaim() sırasında
+// okuyucu kalmadığı görüldüğünde silinir.
+template <typename T>
+class ParamSnapshot {
+public:
+    ParamSnapshot() : m_current(new T()), m_readers(0) {}
+
+    ~ParamSnapshot() {
+        delete m_current.load();
+        for (T* old : m_retired) delete old;
+    }
+
+    ParamSnapshot(const ParamSnapshot&) = delete;
+    ParamSnapshot& operator=(const ParamSnapshot&) = delete;
+
+    // Audio thread: guard yaşadığı sürece blok geçerli kalır
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const ParamSnapshot& owner) : m_owner(owner) {
+            m_owner.m_readers.fetch_add(1);
+            m_params = m_owner.m_current.load();
+        }
+        ~ReadGuard() { m_owner.m_readers.fetch_sub(1); }
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const T& operator*() const { return *m_params; }
+        const T* operator->() const { return m_params; }
+
+    private:
+        const ParamSnapshot& m_owner;
+        const T* m_params;
+    };
+
+    // Yazıcı (JS) thread: blok yalnızca update()/reclaim() ile silinir, o yüzden
+    // aynı thread'den referansla okumak güvenli.
+    const T& current() const { return *m_current.load(std::memory_order_acquire); }
+
+    template <typename Fn>
+    void update(Fn&& fn) {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        T* next = new T(*m_current.load(std::memory_order_relaxed));
+        fn(*next);
+        m_retired.push_back(m_current.exchange(next));
+        reclaimLocked();
+    }
+
+    void reclaim() {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        reclaimLocked();
+    }
+
+private:
+    void reclaimLocked() {
+        // Swap'tan sonra okuyucu sayısı sıfır görüldüyse eski pointer'ı tutan kimse kalmadı
+        if (m_retired.empty() || m_readers.load() != 0) return;
+        for (T* old : m_retired) delete old;
+        m_retired.clear();
+    }
+
+    std::atomic<T*> m_current;
+    mutable std::atomic<int> m_readers;
+    std::mutex m_writeMutex;
+    std::vector<T*> m_retired;
+};
+
+// ============================================
+// KOMUT KUYRUĞU (SPSC)
+// ============================================
+// Tek üretici / tek tüketici (mikser komutları ve olayları, konvolüsyon
+// kernel'leri). Sabit kapasiteli ring; push/pop allocation yapmaz.
+template <typename T, int CAPACITY>
+class SpscQueue {
+public:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "kapasite 2'nin kuvveti olmalı");
+
+    SpscQueue() : m_head(0), m_tail(0) {}
+
+    bool push(const T& item) {
+        const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) >= (uint32_t)CAPACITY) return false;
+        m_items[tail & (CAPACITY - 1)] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& item) {
+        const uint32_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) return false;
+        item = m_items[head & (CAPACITY - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    int freeSlots() const {
+        return CAPACITY - (int)(m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_acquire));
+    }
+
+    bool empty() const {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+private:
+    T m_items[CAPACITY];
+    std::atomic<uint32_t> m_head;
+    std::atomic<uint32_t> m_tail;
+};
+
+// applyParamBatch(Float32Array [id, value, id, value, ...]) parametre kimlikleri.
+// JS tarafı bu tabloyu `paramIds` export'undan okur; numaralar sabit kalmalı.
+enum ParamId {
+    PARAM_EQ_BAND_0 = 0,                 // 0..31: EQ bantları (dB)
+    PARAM_PREAMP = 32,                   // dB
+    PARAM_BASS_BOOST = 33,               // 0-100
+    PARAM_TONE_BASS = 34,                // dB
+    PARAM_TONE_MID = 35,                 // dB
+    PARAM_TONE_TREBLE = 36,              // dB
+    PARAM_STEREO_EXPANDER = 37,          // %
+    PARAM_BALANCE = 38,                  // -100..100
+    PARAM_MASTER_VOLUME = 39,            // 0-100
+    PARAM_COMPRESSOR_THRESHOLD = 40,     // dB
+    PARAM_COMPRESSOR_RATIO = 41,
+    PARAM_COMPRESSOR_ATTACK = 42,        // ms
+    PARAM_COMPRESSOR_RELEASE = 43,       // ms
+    PARAM_COMPRESSOR_MAKEUP = 44,        // dB
+    PARAM_COUNT
+};
+
+// ============================================
+// MASTERDSP PARAMETRE BLOĞU
+// ============================================
+// Setter'lar MasterDSP'ye doğrudan yazmaz: her set_* çağrısının son değeri bu
+// blokta tutulur ve g_masterDsp ile yayınlanır. Her MasterDSP örneği (parça
+// zinciri, bus) kendi callback'inde blok başında bloğu okur, en son uyguladığı
+// kopyayla karşılaştırıp yalnızca değişen grupların setter'ını çağırır. Böylece
+// MasterDSP alanlarına yalnızca onu işleyen thread yazar.
+struct MasterDspParams {
+    static const int PEQ_BANDS = 6;
+
+    // Açma bayrağı + setter argümanları. set: en az bir kez yazıldı; yazılmamış
+    // gruplar yeni örnekte MasterDSP varsayılanında kalır.
+    struct Group {
+        bool set = false;
+        bool on = false;
+        float v[8] = {};
+
+        void assign(bool enabled, std::initializer_list<float> values) {
+            set = true;
+            on = enabled;
+            int i = 0;
+            for (float x : values) v[i++] = x;
+        }
+        bool operator!=(const Group& o) const {
+            if (set != o.set || on != o.on) return true;
+            for (int i = 0; i < 8; ++i) {
+                if (v[i] != o.v[i]) return true;
+            }
+            return false;
+        }
+    };
+
+    uint64_t serial = 0;        // her yayında artar; callback eşitse bloğu atlar
+    uint32_t resetSerial = 0;   // reset_dsp_state isteği (çıkış yeniden açılışı)
+
+    Group enabled;
+    bool eqSet = false;
+    float eq[NUM_EQ_BANDS] = {};
+    Group tone;                 // bass, mid, treble
+    Group width;
+    Group compressor;           // thresh, ratio, att, rel, makeup
+    Group gate;                 // thresh, att, rel
+    Group limiter;              // ceiling, rel
+    Group echo;                 // delay, feedback, mix
+    Group bassBoost;            // gain, freq
+    bool peqOn = false;         // set_peq_band'in son enabled argümanı (PEQ geneli)
+    Group peqBand[PEQ_BANDS];   // freq, gain, Q
+    Group peqType[PEQ_BANDS];   // filtre tipi
+    Group crossfeed;            // level, delay, lowCut, highCut
+    Group bassMono;             // cutoff, slope, width
+    Group dynamicEq;            // freq, q, thr, gain, range, attack, release
+
+    // Yalnızca metre etiketi (MasterDSP'ye gitmez): DSP compressor'ını açan
+    // modül. Kazanç azaltması bunlara göre compressorGr / deEsserGr'ye yazılır.
+    bool compressorMeter = false;
+    bool deEsserMeter = false;
+
+    void setEqBand(int band, float gain) {
+        if (band < 0 || band >= NUM_EQ_BANDS) return;
+        eqSet = true;
+        eq[band] = gain;
+    }
+    void setPeqBand(int band, bool on, float freq, float gain, float Q) {
+        if (band < 0 || band >= PEQ_BANDS) return;
+        peqOn = on;
+        peqBand[band].assign(on, {freq, gain, Q});
+    }
+};
+
+// Bir MasterDSP örneğine en son uygulanan blok (sahibi: o örneği işleyen thread)
+struct MasterDspState {
+    MasterDspParams applied;
+    bool synced = false;
+};
+
+static ParamSnapshot<MasterDspParams> g_masterDsp;
+
+template <typename Fn>
+static void publishMasterDsp(Fn&& fn) {
+    g_masterDsp.update([&](MasterDspParams& p) {
+        fn(p);
+        ++p.serial;
+    });
+}
+
+// dsp'yi p'ye getir: ilk çağrıda yazılmış tüm gruplar, sonra yalnızca değişenler.
+// Allocation yapmaz; MasterDSP'yi işleyen thread'den çağrılır.
+static void syncMasterDsp(void* dsp, const MasterDspParams& p, MasterDspState& state) {
+    const bool full = !state.synced;
+    const MasterDspParams& a = state.applied;
+    auto changed = [full](const MasterDspParams::Group& now, const MasterDspParams::Group& was) {
+        return now.set && (full || now != was);
+    };
+
+    if (!full && p.resetSerial != a.resetSerial) reset_dsp_state(dsp);
+    if (changed(p.enabled, a.enabled)) set_dsp_enabled(dsp, p.enabled.on ? 1 : 0);
+    if (p.eqSet) {
+        bool eq = false;
+        for (int band = 0; band < NUM_EQ_BANDS; ++band) {
+            if (!full && p.eq[band] == a.eq[band]) continue;
+            stage_eq_band(dsp, band, p.eq[band]);
+            eq = true;
+        }
+        if (eq) commit_eq_bands(dsp);
+    }
+    if (changed(p.tone, a.tone)) set_tone_params(dsp, p.tone.v[0], p.tone.v[1], p.tone.v[2]);
+    if (changed(p.width, a.width)) set_stereo_width(dsp, p.width.v[0]);
+    if (changed(p.compressor, a.compressor)) {
+        const float* v = p.compressor.v;
+        set_compressor_params(dsp, p.compressor.on ? 1 : 0, v[0], v[1], v[2], v[3], v[4]);
+    }
+    if (changed(p.gate, a.gate)) {
+        set_gate_params(dsp, p.gate.on ? 1 : 0, p.gate.v[0], p.gate.v[1], p.gate.v[2]);
+    }
+    if (changed(p.limiter, a.limiter)) {
+        set_limiter_params(dsp, p.limiter.on ? 1 : 0, p.limiter.v[0], p.limiter.v[1]);
+    }
+    if (changed(p.echo, a.echo)) {
+        set_echo_params(dsp, p.echo.on ? 1 : 0, p.echo.v[0], p.echo.v[1], p.echo.v[2]);
+    }
+    if (changed(p.bassBoost, a.bassBoost)) {
+        set_bass_boost(dsp, p.bassBoost.on ? 1 : 0, p.bassBoost.v[0], p.bassBoost.v[1]);
+    }
+
+    // PEQ açma bayrağı bantlar arasında ortak: grup bütün olarak yeniden yazılır
+    bool peq = full || p.peqOn != a.peqOn;
+    for (int band = 0; band < MasterDspParams::PEQ_BANDS && !peq; ++band) {
+        peq = p.peqBand[band] != a.peqBand[band];
+    }
+    if (peq) {
+        for (int band = 0; band < MasterDspParams::PEQ_BANDS; ++band) {
+            const MasterDspParams::Group& b = p.peqBand[band];
+            if (b.set) set_peq_band(dsp, band, p.peqOn ? 1 : 0, b.v[0], b.v[1], b.v[2]);
+        }
+    }
+    for (int band = 0; band < MasterDspParams::PEQ_BANDS; ++band) {
+        if (changed(p.peqType[band], a.peqType[band])) {
+            set_peq_filter_type(dsp, band, (int)p.peqType[band].v[0]);
+        }
+    }
+
+    if (changed(p.crossfeed, a.crossfeed)) {
+        const float* v = p.crossfeed.v;
+        set_crossfeed_params(dsp, p.crossfeed.on ? 1 : 0, v[0], v[1], v[2], v[3]);
+    }
+    if (changed(p.bassMono, a.bassMono)) {
+        const float* v = p.bassMono.v;
+        set_bass_mono_params(dsp, p.bassMono.on ? 1 : 0, v[0], v[1], v[2]);
+    }
+    if (changed(p.dynamicEq, a.dynamicEq)) {
+        const float* v = p.dynamicEq.v;
+        set_dynamic_eq_params(dsp, p.dynamicEq.on ? 1 : 0, v[0], v[1], v[2], v[3], v[4], v[5], v[6]);
+    }
+
+    state.applied = p;
+    state.synced = true;
+}
+
 // ============================================
 // KOMPRESÖR (BASS_FX)
 // ============================================
@@ -218,19 +547,17 @@ static ConvolutionReverbParams g_convReverb;
 // ============================================
 // AUTO GAIN / NORMALIZE PARAMETRELERİ
 // ============================================
+// Seviye ve uygulanan kazanç audio thread'de (LoudnessMeter / AutoGainStage)
 struct AutoGainParams {
-    float targetLevel = -14.0f;    // dBFS (hedef seviye, -30 ile -3 arası)
+    float targetLevel = -14.0f;    // dBFS / LUFS (mode'a göre, -30 ile -3 arası)
     float maxGain = 12.0f;         // dB (maksimum uygulanacak gain)
     float attackTime = 100.0f;     // ms (yükselme hızı)
     float releaseTime = 500.0f;    // ms (düşme hızı)
-    int mode = 1;                  // 0=Peak, 1=RMS, 2=LUFS
-    float currentGain = 0.0f;      // Gerçek zamanlı uygulanan gain
-    float peakLevel = -96.0f;      // Mevcut peak seviye
-    float rmsLevel = -96.0f;       // Mevcut RMS seviye
+    int mode = 1;                  // 0=Peak, 1=RMS, 2=LUFS (son 3 s)
     bool enabled = false;
 };
 
-static AutoGainParams g_autoGain;
+static ParamSnapshot<AutoGainParams> g_autoGain;
 
 // ============================================
 // TRUE PEAK LIMITER + METER PARAMETRELERİ
@@ -246,7 +573,7 @@ struct TruePeakLimiterParams {
     bool enabled = false;
 };
 
-static TruePeakLimiterParams g_truePeakLimiter;
+static ParamSnapshot<TruePeakLimiterParams> g_truePeakLimiter;
 
 // True Peak Ölçümü
 struct TruePeakMeter {
@@ -258,22 +585,32 @@ struct TruePeakMeter {
     float peakHoldR = -96.0f;       // Peak hold right
     float inputPeakL = -96.0f;      // Input peak left (limiter öncesi)
     float inputPeakR = -96.0f;      // Input peak right (limiter öncesi)
-    float gainReduction = 0.0f;     // Gain reduction dB (ne kadar kesiliyor)
+    std::atomic<float> gainReduction{0.0f};     // Gain reduction dB (audio thread yazar)
     unsigned long peakHoldTimeL = 0;        // Hold timer
     unsigned long peakHoldTimeR = 0;        // Hold timer
-    int clippingCount = 0;          // Clipping olayı sayısı (input ceiling'i aştı)
+    // Clipping olayı sayısı (limiter öncesi ceiling'i aşan blok). Audio thread
+    // artırır, UI sıfırlar; getMeters'ta truePeakOvers olarak da okunur.
+    std::atomic<int> clippingCount{0};
     unsigned long lastUpdate = 0;
+    // Audio thread'in son okumadan beri biriktirdiği lineer tepeler
+    // (-1 = yeni blok yok). updateTruePeakMeter okurken sıfırlar.
+    std::atomic<float> pendingPeak[2] = { {-1.0f}, {-1.0f} };
+    std::atomic<float> pendingTruePeak[2] = { {-1.0f}, {-1.0f} };
+    std::atomic<float> pendingInputPeak[2] = { {-1.0f}, {-1.0f} };
 };
 
-static TruePeakMeter g_truePeakMeter;
+static inline void atomicMaxFloat(std::atomic<float>& target, float value) {
+    float current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
 
-// Convolution Reverb FX handle'ları
-static HFX fxConvReverb = 0;
-static HFX fxConvPreDelay = 0;
+static TruePeakMeter g_truePeakMeter;
 
-// IR presetleri (dahili simülasyonlar)
+// IR presetleri (dahili, sentezlenen IR'ler)
 struct IRPreset {
     const char* name;
+    const char* id;             // "builtin:<id>" IR yolu
     float roomSize;
     float decay;
     float damping;
@@ -281,14 +618,14 @@ struct IRPreset {
 };
 
 static const IRPreset IR_PRESETS[] = {
-    {"Small Room",    20.0f, 0.8f,  0.7f, 0.5f},
-    {"Medium Room",   50.0f, 1.5f,  0.6f, 0.6f},
-    {"Large Room",    80.0f, 2.5f,  0.5f, 0.7f},
-    {"Concert Hall", 100.0f, 3.5f,  0.4f, 0.8f},
-    {"Cathedral",    150.0f, 5.0f,  0.3f, 0.9f},
-    {"Plate",         60.0f, 2.0f,  0.8f, 0.4f},
-    {"Spring",        40.0f, 1.2f,  0.9f, 0.3f},
-    {"Chamber",       70.0f, 2.2f,  0.5f, 0.7f}
+    {"Small Room",   "small-room",    20.0f, 0.8f,  0.7f, 0.5f},
+    {"Medium Room",  "medium-room",   50.0f, 1.5f,  0.6f, 0.6f},
+    {"Large Room",   "large-room",    80.0f, 2.5f,  0.5f, 0.7f},
+    {"Concert Hall", "concert-hall", 100.0f, 3.5f,  0.4f, 0.8f},
+    {"Cathedral",    "cathedral",    150.0f, 5.0f,  0.3f, 0.9f},
+    {"Plate",        "plate",         60.0f, 2.0f,  0.8f, 0.4f},
+    {"Spring",       "spring",        40.0f, 1.2f,  0.9f, 0.3f},
+    {"Chamber",      "chamber",       70.0f, 2.2f,  0.5f, 0.7f}
 };
 
 // ============================================
@@ -322,8 +659,6 @@ static BassMonoParams g_bassMono;
 // ============================================
 // TAPE SATURATION PARAMETRELERİ
 // ============================================
-HDSP g_tapeSatDSP = 0;
-
 struct TapeSatParams {
     float driveDb = 6.0f;     // 0..24 dB
     float mix = 50.0f;        // 0..100 %
@@ -332,14 +667,16 @@ struct TapeSatParams {
     int mode = 0;             // 0=Tape, 1=Warm, 2=Hot
     float hiss = 0.0f;        // 0..100 (opsiyonel)
     bool enabled = false;
-} g_tapeSat;
+};
+
+ParamSnapshot<TapeSatParams> g_tapeSat;
 
 struct TapeSatState {
     float sr = 48000.0f;
     float lpfL = 0.0f;
     float lpfR = 0.0f;
     uint32_t rng = 22222;
-} g_tapeSatState;
+};
 
 static inline float fastTanh(float x) {
     const float x2 = x * x;
@@ -349,7 +686,9 @@ static inline float fastTanh(float x) {
 static inline float randFloatSigned(uint32_t& s) {
     s = 1664525u * s + 1013904223u;
     uint32_t v = (s >> 9) | 0x3F800000u;
-    float f = (*(float*)&v) - 1.0f;
+    float f;
+    memcpy(&f, &v, sizeof(f));   // tip kelimesi: strict-aliasing güvenli
+    f -= 1.0f;
     return (f * 2.0f) - 1.0f;
 }
 
@@ -365,8 +704,6 @@ void CALLBACK BitDither_DSP(HDSP handle, DWORD channel, void* buffer, DWORD leng
 // ============================================
 // BIT-DEPTH / DITHER PARAMETRELERİ
 // ============================================
-HDSP g_bitDitherDSP = 0;
-
 enum DitherType {
     DITHER_OFF = 0,
     DITHER_RPDF = 1,  // rectangular
@@ -386,7 +723,10 @@ struct BitDitherParams {
     float mix = 100.0f;        // % (lofi tamamen)
     float outputDb = 0.0f;     // dB
     bool enabled = false;
-} g_bitDither;
+};
+
+ParamSnapshot<BitDitherParams> g_bitDither;
+static std::atomic<uint32_t> g_bitDitherReset{0};   // ResetBitDepthDither: tüm sahiplerin durumu sıfırlanır
 
 struct BitDitherState {
     float sr = 48000.0f;
@@ -402,12 +742,28 @@ struct BitDitherState {
 
     // RNG
     uint32_t rng = 1234567;
-} g_bitDitherState;
+};
+
+class CallbackProfiler;
+
+// Tape saturation ve bit/dither DSP'lerinin sahibi (callback'lerin user
+// pointer'ı). Zincir modunda her parça zinciri, bus modunda mikser çıkışı bir
+// tane taşır: crossfade'de iki parça kendi filtre/hata durumlarıyla işlenir.
+struct ColorFx {
+    CallbackProfiler* profiler = nullptr;
+    HDSP tapeDsp = 0;
+    HDSP ditherDsp = 0;
+    TapeSatState tape;
+    BitDitherState dither;
+    uint32_t ditherReset = 0;       // uygulanan g_bitDitherReset
+};
 
 static inline float rand01(uint32_t& s) {
     s = 1664525u * s + 1013904223u;
     uint32_t v = (s >> 9) | 0x3F800000u;
-    return (*(float*)&v) - 1.0f;
+    float f;
+    memcpy(&f, &v, sizeof(f));
+    return f - 1.0f;
 }
 
 static inline float randSigned(uint32_t& s) {
@@ -420,6 +776,10 @@ static inline float quantize(float x, int bits) {
     return roundf(x * (float)levels) / (float)levels;
 }
 
+// Tape / bit-dither işleme çekirdekleri (canlı callback'ler ve offline render)
+static void processTapeSat(const TapeSatParams& tp, TapeSatState& st, float* s, int n);
+static void processBitDither(const BitDitherParams& bp, BitDitherState& st, float* s, int n);
+
 // ============================================
 // DYNAMIC EQ İLERİ BİLDİRİMLER
 void UpdateDynamicEQOnDSP();
@@ -439,6 +799,20 @@ struct DynamicEQParams {
 
 static DynamicEQParams g_dynamicEq;
 
+// Global modül ayarlarını MasterDSP bloğuna taşı (N-API setter'ları + constructor)
+static void publishCrossfeedParams() {
+    publishMasterDsp([](MasterDspParams& p) {
+        p.crossfeed.assign(g_crossfeed.enabled, {g_crossfeed.crossfeedLevel, g_crossfeed.delay,
+                                                 g_crossfeed.lowCut, g_crossfeed.highCut});
+    });
+}
+
+static void publishBassMonoParams() {
+    publishMasterDsp([](MasterDspParams& p) {
+        p.bassMono.assign(g_bassMono.enabled, {g_bassMono.cutoff, g_bassMono.slope, g_bassMono.stereoWidth});
+    });
+}
+
 // Crossfeed presetleri
 struct CrossfeedPreset {
     const char* name;
@@ -470,249 +844,5412 @@ static inline float softClip(float sample) {
 // Gereksiz callback kaldırıldı. Crossfeed artık aurivo_dsp.cpp içinde entegre
 
 // ============================================
-// AURIVO AUDIO ENGINE SINIFI
+// DECODER SAYACI (engine stats)
 // ============================================
-class AurivoAudioEngine {
-private:
-    // Stream handles
-    HSTREAM m_stream;
-    HSTREAM m_decodeStream;
-    HSTREAM m_analysisStream;
+// Açık BASS decode stream sayısı. Tempo stream kaynağını FREESOURCE ile
+// kendisi bıraktığı için azaltma BASS_SYNC_FREE üzerinden yapılır.
+static std::atomic<int> g_openDecoders(0);
+
+static void CALLBACK decoderFreeSync(HSYNC handle, DWORD channel, DWORD data, void* user) {
+    (void)handle; (void)channel; (void)data; (void)user;
+    g_openDecoders.fetch_sub(1, std::memory_order_relaxed);
+}
+
+static HSTREAM createDecodeStream(const std::string& filePath) {
+    HSTREAM stream = BASS_StreamCreateFile(
+        FALSE,
+        filePath.c_str(),
+        0, 0,
+        BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT
+    );
+    if (stream) {
+        g_openDecoders.fetch_add(1, std::memory_order_relaxed);
+        BASS_ChannelSetSync(stream, BASS_SYNC_FREE | BASS_SYNC_MIXTIME, 0, decoderFreeSync, nullptr);
+    }
+    return stream;
+}
+
+// BASS_CHANNELINFO.ctype -> kısa codec adı (plugin tipleri bass.h'de yok)
+static const char* codecName(DWORD ctype) {
+    if (ctype & BASS_CTYPE_STREAM_WAV) {
+        return (ctype == BASS_CTYPE_STREAM_WAV_FLOAT) ? "wav-float" : "wav";
+    }
+    switch (ctype) {
+        case BASS_CTYPE_STREAM_OGG:  return "vorbis";
+        case BASS_CTYPE_STREAM_MP1:  return "mp1";
+        case BASS_CTYPE_STREAM_MP2:  return "mp2";
+        case BASS_CTYPE_STREAM_MP3:  return "mp3";
+        case BASS_CTYPE_STREAM_AIFF: return "aiff";
+        case BASS_CTYPE_STREAM_CA:   return "coreaudio";
+        case BASS_CTYPE_STREAM_MF:   return "mediafoundation";
+        case 0x10500:                return "wavpack";   // bass_wv
+        case 0x10700:                return "ape";       // bass_ape
+        case 0x10900:                return "flac";      // bassflac
+        case 0x10901:                return "flac-ogg";
+        case 0x10b00:                return "aac";       // bass_aac
+        case 0x10b01:                return "mp4";
+        default:                     return "unknown";
+    }
+}
 
-    // Overlap crossfade (previous stream fades out while new stream fades in)
-    HSTREAM m_prevStream;
-    HSTREAM m_prevAnalysisStream;
-    
-    // Effect handles - SADECE 32 BANT EQ + PREAMP + REVERB
-    HFX m_eqFx[NUM_EQ_BANDS];
-    HFX m_preampFx;
-    HFX m_reverbFx;  // Reverb effect handle
+// ============================================
+// POST-DSP ANALİZ TAP (lock-free SPMC ring)
+// ============================================
+// dspCallback işlenmiş (duyulan) sample'ları buraya yazar. FFT / spectrum / PCM
+// getter'ları ikinci decoder'ı seek + decode etmek yerine buradan kopya alır.
+// Tek yazar (BASS mixer thread'i), çok okuyucu; okuyucu, kopyaladığı bölgenin
+// o sırada ezilmediğini write sayacını tekrar okuyarak doğrular.
+class AnalysisTap {
+public:
+    static const int CHANNELS = 2;
+    static const int CAPACITY_FRAMES = 1 << 17;   // ~2.7 sn @ 48 kHz (500 ms BASS buffer'ı + pay)
+    static const int CAPACITY_MASK = CAPACITY_FRAMES - 1;
+
+    AnalysisTap()
+        : m_buffer((size_t)CAPACITY_FRAMES * CHANNELS, 0.0f)
+        , m_writeFrames(0)
+        , m_writingTo(0)
+        , m_validFrom(0)
+        , m_sampleRate(FALLBACK_SAMPLE_RATE)
+    {}
+
+    // Yalnızca audio thread'den çağrılır (wait-free, allocation yok)
+    void write(const float* interleaved, int frames) {
+        if (!interleaved || frames <= 0) return;
+        if (frames > CAPACITY_FRAMES) {
+            interleaved += (size_t)(frames - CAPACITY_FRAMES) * CHANNELS;
+            frames = CAPACITY_FRAMES;
+        }
 
-    // Prev stream effect handles
-    HFX m_prevPreampFx;
-    HFX m_prevReverbFx;
+        const uint64_t w = m_writeFrames.load(std::memory_order_relaxed);
+        // Önce ezilecek aralığın sonu: okuyucu, kopyası sırasında yayınlanmamış
+        // bir bloğun da slot ezdiğini buradan görür
+        m_writingTo.store(w + (uint64_t)frames, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        const int start = (int)(w & CAPACITY_MASK);
+        const int first = std::min(frames, CAPACITY_FRAMES - start);
+        std::memcpy(&m_buffer[(size_t)start * CHANNELS], interleaved, (size_t)first * CHANNELS * sizeof(float));
+        if (first < frames) {
+            std::memcpy(&m_buffer[0], interleaved + (size_t)first * CHANNELS,
+                        (size_t)(frames - first) * CHANNELS * sizeof(float));
+        }
+        m_writeFrames.store(w + (uint64_t)frames, std::memory_order_release);
+    }
 
-    // Aurivo DSP
-    void* m_aurivoDSP;
-    HDSP m_dspHandle;
+    // Yeni parça yüklendiğinde eski sample'ları geçersiz say (writer'ı durdurmadan)
+    void reset() {
+        m_validFrom.store(m_writeFrames.load(std::memory_order_acquire), std::memory_order_release);
+    }
 
-    // Prev stream DSP
-    void* m_prevAurivoDSP;
-    HDSP m_prevDspHandle;
+    bool hasData() const {
+        return m_writeFrames.load(std::memory_order_acquire) > m_validFrom.load(std::memory_order_acquire);
+    }
 
-    struct TruePeakLimiterState {
-        float gainL = 1.0f;
-        float gainR = 1.0f;
-        float peakL = 0.0f;
-        float peakR = 0.0f;
-    };
+    void setSampleRate(int sampleRate) {
+        if (sampleRate > 0) m_sampleRate.store(sampleRate, std::memory_order_relaxed);
+    }
 
-    TruePeakLimiterState m_limiterStateCurrent;
-    TruePeakLimiterState m_limiterStatePrev;
+    int getSampleRate() const {
+        return m_sampleRate.load(std::memory_order_relaxed);
+    }
 
-    std::atomic<bool> m_overlapCrossfadeActive;
-    std::atomic<uint64_t> m_crossfadeGeneration;
-    
-    // Ses parameters
-    float m_masterVolume;      // 0-100
-    float m_preampGain;        // -12dB to +12dB
-    float m_eqGains[NUM_EQ_BANDS];  // -15dB to +15dB per band
-    float m_bassBoost;         // 0-100
-    float m_balance;           // -100 (left) to +100 (right)
-    
-    // Aurivo Module parameters - SADECE DEĞER SAKLA
-    float m_bassGain;          // -15dB to +15dB (100Hz)
-    float m_midGain;           // -15dB to +15dB (500Hz-2kHz)
-    float m_trebleGain;        // -15dB to +15dB (10kHz)
-    float m_stereoExpander;    // 0-200%
-    
-    // Reverb parameters
-    bool m_reverbEnabled;
-    float m_reverbRoomSize;    // 0-3000ms
-    float m_reverbDamping;     // 0-1
-    float m_reverbWetDry;      // -96 to 0 dB
-    float m_reverbHFRatio;     // 0.001-0.999
-    float m_reverbInputGain;   // -96 to +12 dB
-    
-    // DSP Master Etkinleştir
-    bool m_dspEnabled;                       // Master DSP on/off switch
-    
-    // Durum
-    bool m_initialized;
-    std::mutex m_mutex;
-    
-    // FFT data
-    float m_fftData[FFT_SIZE];
-    std::atomic<bool> m_fftReady;
-    
-    // Singleton
-    static AurivoAudioEngine* s_instance;
+    // En yeni `frames` frame'i (delayFrames kadar geriden) dest'e kopyalar.
+    // Henüz yazılmamış kısım sıfırla doldurulur. Kopyalanan gerçek frame sayısını döner.
+    // Kopya, tam olarak kopyalanan [begin, end) aralığına karşı doğrulanır: writer
+    // (yayınlanmamış blok dahil) begin + CAPACITY'ye ulaştıysa en eski frame'ler
+    // ezilmiştir. Denemeler tükenirse ezilen kısım sıfırlanır, kalan döner.
+    int snapshot(float* dest, int frames, uint64_t delayFrames = 0) const {
+        if (!dest || frames <= 0) return 0;
+        frames = std::min(frames, CAPACITY_FRAMES / 2);
+
+        static const int ATTEMPTS = 4;
+        for (int attempt = 0; attempt < ATTEMPTS; ++attempt) {
+            const uint64_t validFrom = m_validFrom.load(std::memory_order_acquire);
+            const uint64_t w = m_writeFrames.load(std::memory_order_acquire);
+            if (w <= validFrom) break;
+            const uint64_t writing = std::max(w, m_writingTo.load(std::memory_order_relaxed));
+
+            // Gecikme en fazla ring'in güvenli kısmı kadar olabilir (sürmekte olan
+            // yazmanın ezeceği slotlar hariç)
+            const uint64_t safe = (uint64_t)(CAPACITY_FRAMES - frames);
+            const uint64_t maxDelay = safe > writing - w ? safe - (writing - w) : 0;
+            uint64_t delay = std::min(delayFrames, maxDelay);
+            delay = std::min(delay, w - validFrom - 1);
+
+            const uint64_t end = w - delay;
+            const int count = (int)std::min<uint64_t>((uint64_t)frames, end - validFrom);
+            const uint64_t begin = end - (uint64_t)count;
+            const int pad = frames - count;
+
+            if (pad > 0) std::fill(dest, dest + (size_t)pad * CHANNELS, 0.0f);
+            float* out = dest + (size_t)pad * CHANNELS;
+
+            const int start = (int)(begin & CAPACITY_MASK);
+            const int first = std::min(count, CAPACITY_FRAMES - start);
+            std::memcpy(out, &m_buffer[(size_t)start * CHANNELS], (size_t)first * CHANNELS * sizeof(float));
+            if (first < count) {
+                std::memcpy(out + (size_t)first * CHANNELS, &m_buffer[0],
+                            (size_t)(count - first) * CHANNELS * sizeof(float));
+            }
+
+            // Kopyalama sırasında writer bu bölgenin başını ezdiyse tekrar dene
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t reached = m_writingTo.load(std::memory_order_relaxed);
+            const uint64_t limit = begin + (uint64_t)CAPACITY_FRAMES;
+            if (reached <= limit) return count;
+            if (attempt + 1 < ATTEMPTS) continue;
+
+            // Son deneme: ezilen en eski frame'ler sıfır dolgunun parçası olur
+            const int lost = (int)std::min<uint64_t>(reached - limit, (uint64_t)count);
+            std::fill(out, out + (size_t)lost * CHANNELS, 0.0f);
+            return count - lost;
+        }
 
+        std::fill(dest, dest + (size_t)frames * CHANNELS, 0.0f);
+        return 0;
+    }
+
+private:
+    std::vector<float> m_buffer;
+    std::atomic<uint64_t> m_writeFrames;
+    std::atomic<uint64_t> m_writingTo;     // yazılmakta olan bloğun sonu (>= m_writeFrames)
+    std::atomic<uint64_t> m_validFrom;
+    std::atomic<int> m_sampleRate;
+};
+
+// ============================================
+// ANALİZ FFT (Hann + radix-2, BASS_DATA_FFT2048 ölçeğinde)
+// ============================================
+// Stereo frame'leri mono'ya indirger, Hann penceresi uygular ve FFT_SIZE/2
+// magnitude döner. Ölçek BASS'in FFT çıktısıyla uyumlu tutuldu (tam ölçek sinüs ~0.5).
+class AnalysisFFT {
 public:
-    AurivoAudioEngine() 
-        : m_stream(0)
-        , m_decodeStream(0)
-        , m_analysisStream(0)
-        , m_prevStream(0)
-        , m_prevAnalysisStream(0)
-        , m_preampFx(0)
-        , m_reverbFx(0)
-        , m_prevPreampFx(0)
-        , m_prevReverbFx(0)
-        , m_aurivoDSP(nullptr)
-        , m_dspHandle(0)
-        , m_prevAurivoDSP(nullptr)
-        , m_prevDspHandle(0)
-        , m_masterVolume(100.0f)
-        , m_preampGain(0.0f)
-        , m_bassBoost(0.0f)
-        , m_balance(0.0f)
-        , m_bassGain(0.0f)
-        , m_midGain(0.0f)
-        , m_trebleGain(0.0f)
-        , m_stereoExpander(100.0f)
-        , m_reverbEnabled(false)
-        , m_reverbRoomSize(1000.0f)
-        , m_reverbDamping(0.5f)
-        , m_reverbWetDry(-6.0f)
-        , m_reverbHFRatio(0.5f)
-        , m_reverbInputGain(0.0f)
-        , m_dspEnabled(true)         // DSP varsayılan açık
-        , m_initialized(false)
-        , m_fftReady(false)
-        , m_overlapCrossfadeActive(false)
-        , m_crossfadeGeneration(0)
-    {
-        // EQ handles ve gains sıfırla
-        for (int i = 0; i < NUM_EQ_BANDS; ++i) {
-            m_eqFx[i] = 0;
-            m_eqGains[i] = 0.0f;
+    static const AnalysisFFT& instance() {
+        static const AnalysisFFT fft;
+        return fft;
+    }
+
+    void magnitudes(const float* stereo, float* out) const {
+        float re[FFT_SIZE];
+        float im[FFT_SIZE];
+        for (int i = 0; i < FFT_SIZE; ++i) {
+            const float mono = 0.5f * (stereo[i * 2] + stereo[i * 2 + 1]);
+            re[m_bitReverse[i]] = mono * m_window[i];
+            im[m_bitReverse[i]] = 0.0f;
         }
 
-        // Aurivo DSP oluştur
-        m_aurivoDSP = create_dsp();
-        if (m_aurivoDSP) {
-            set_sample_rate(m_aurivoDSP, SAMPLE_RATE);
-            set_dsp_enabled(m_aurivoDSP, 1);
+        for (int size = 2; size <= FFT_SIZE; size <<= 1) {
+            const int half = size >> 1;
+            const int step = FFT_SIZE / size;
+            for (int start = 0; start < FFT_SIZE; start += size) {
+                for (int k = 0; k < half; ++k) {
+                    const float wr = m_cos[k * step];
+                    const float wi = -m_sin[k * step];
+                    const int a = start + k;
+                    const int b = a + half;
+                    const float tr = re[b] * wr - im[b] * wi;
+                    const float ti = re[b] * wi + im[b] * wr;
+                    re[b] = re[a] - tr;
+                    im[b] = im[a] - ti;
+                    re[a] += tr;
+                    im[a] += ti;
+                }
+            }
+        }
+
+        const float scale = 2.0f / FFT_SIZE;
+        for (int i = 0; i < FFT_SIZE / 2; ++i) {
+            out[i] = std::sqrt(re[i] * re[i] + im[i] * im[i]) * scale;
         }
-        
-        memset(m_fftData, 0, sizeof(m_fftData));
-        s_instance = this;
-    }
-    
-    ~AurivoAudioEngine() {
-        cleanup();
-        s_instance = nullptr;
     }
-    
-    // ============================================
-    // INITIALIZATION
-    // ============================================
-    bool initialize(int deviceIndex = -1) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        if (m_initialized) return true;
-        
-        // BASS'ı başlat (44100 Hz, stereo)
-        // deviceIndex: -1 = default device
-        if (!BASS_Init(deviceIndex, SAMPLE_RATE, 0, nullptr, nullptr)) {
-            int error = BASS_ErrorGetCode();
-            if (error != BASS_ERROR_ALREADY) {
-                return false;
+
+private:
+    AnalysisFFT() {
+        int bits = 0;
+        while ((1 << bits) < FFT_SIZE) ++bits;
+        for (int i = 0; i < FFT_SIZE; ++i) {
+            int r = 0;
+            for (int b = 0; b < bits; ++b) {
+                if (i & (1 << b)) r |= 1 << (bits - 1 - b);
             }
+            m_bitReverse[i] = r;
+            m_window[i] = 0.5f - 0.5f * std::cos(2.0f * (float)M_PI * i / (FFT_SIZE - 1));
         }
-        
-        // BASS_FX version kontrolü
-        DWORD fxVersion = BASS_FX_GetVersion();
-        if (fxVersion == 0) {
-            BASS_Free();
-            return false;
+        for (int i = 0; i < FFT_SIZE / 2; ++i) {
+            m_cos[i] = std::cos(2.0f * (float)M_PI * i / FFT_SIZE);
+            m_sin[i] = std::sin(2.0f * (float)M_PI * i / FFT_SIZE);
         }
-        
-        // Format plugins'ini yükle
-        // AAC/M4A support için bass_aac plugin
-        HPLUGIN aacPlugin = BASS_PluginLoad("libbass_aac.so", 0);
-        if (aacPlugin) {
-            printf("✓ BASS AAC Plugin loaded (M4A/AAC support enabled)\n");
+    }
+
+    int m_bitReverse[FFT_SIZE];
+    float m_window[FFT_SIZE];
+    float m_cos[FFT_SIZE / 2];
+    float m_sin[FFT_SIZE / 2];
+};
+
+// ============================================
+// VISUALIZER PAYLAŞIMLI BELLEK PCM RING'İ
+// ============================================
+// aurivo-projectm-visualizer'a pipe yerine paylaşımlı bellekten PCM verir.
+// Tek üretici dspCallback'tir (post-DSP, tap ile aynı sample'lar); paket başına
+// syscall yoktur. Visualizer bölgeyi okuma-yazma map eder (--pcm-shm <isim>)
+// ama yalnızca header'daki consumerAttached'a yazar: düzeni doğrulayınca 1,
+// kapanırken 0. Electron bunu getVisualizerShmStats ile görür ve stdin PCM
+// beslemesini ancak o zaman durdurur; map başarısızsa stdin yedeği sürer.
+// Düzen visualizer/main_imgui.cpp içindeki PcmShmHeader ile birebir aynı olmalı.
+class PcmShmRing {
+public:
+    static const uint32_t MAGIC = 0x52505541;   // "AUPR"
+    static const uint32_t VERSION = 2;
+    static const uint32_t CHANNELS = 2;
+    static const uint32_t DATA_OFFSET = 128;    // header sonrası float verisi
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t channels;
+        uint32_t capacityFrames;                 // 2'nin kuvveti
+        uint32_t dataOffset;
+        std::atomic<uint32_t> sampleRate;
+        std::atomic<uint32_t> latencyFrames;     // DSP çıkışı ile hoparlör arası
+        std::atomic<uint32_t> producerAlive;
+        alignas(64) std::atomic<uint64_t> writeFrames;   // monoton, yazılan frame sayısı
+        std::atomic<uint64_t> sequence;          // yazılan blok sayısı
+        std::atomic<uint64_t> writeTimeNs;       // son yazım (steady_clock)
+        std::atomic<uint32_t> consumerAttached;  // visualizer map edip doğruladı (tüketici yazar)
+    };
+    static_assert(sizeof(Header) <= DATA_OFFSET, "PcmShmRing header taşıyor");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "süreçler arası atomic gerekli");
+
+    struct Stats {
+        bool open = false;
+        std::string name;
+        uint32_t capacityFrames = 0;
+        uint32_t latencyFrames = 0;
+        uint64_t writeFrames = 0;
+        uint64_t sequence = 0;
+        bool consumerAttached = false;
+    };
+
+    ~PcmShmRing() { close(); }
+
+    // Bölgeyi oluşturur ve visualizer'a verilecek ismi döner (boş: başarısız)
+    std::string create(uint32_t capacityFrames, int sampleRate) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        closeLocked();
+
+        uint32_t cap = 1024;
+        while (cap < capacityFrames && cap < (1u << 20)) cap <<= 1;
+        const size_t bytes = DATA_OFFSET + (size_t)cap * CHANNELS * sizeof(float);
+
+        void* base = nullptr;
+#ifdef _WIN32
+        std::string name = "Local\\aurivo-pcm-" + std::to_string((unsigned long)GetCurrentProcessId());
+        HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                            0, (DWORD)bytes, name.c_str());
+        if (!mapping) {
+            AURIVO_LOG_ERROR("[PCM SHM] CreateFileMapping failed (%lu)", (unsigned long)GetLastError());
+            return std::string();
+        }
+        base = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, bytes);
+        if (!base) {
+            AURIVO_LOG_ERROR("[PCM SHM] MapViewOfFile failed (%lu)", (unsigned long)GetLastError());
+            CloseHandle(mapping);
+            return std::string();
+        }
+        m_mapping = mapping;
+#else
+        std::string name = "/aurivo-pcm-" + std::to_string((long)getpid());
+        shm_unlink(name.c_str());
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            AURIVO_LOG_ERROR("[PCM SHM] shm_open failed: %s", strerror(errno));
+            return std::string();
+        }
+        if (ftruncate(fd, (off_t)bytes) != 0) {
+            AURIVO_LOG_ERROR("[PCM SHM] ftruncate failed: %s", strerror(errno));
+            ::close(fd);
+            shm_unlink(name.c_str());
+            return std::string();
+        }
+        base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            AURIVO_LOG_ERROR("[PCM SHM] mmap failed: %s", strerror(errno));
+            shm_unlink(name.c_str());
+            return std::string();
+        }
+#endif
+        std::memset(base, 0, bytes);
+        Header* h = new (base) Header();
+        h->magic = MAGIC;
+        h->version = VERSION;
+        h->channels = CHANNELS;
+        h->capacityFrames = cap;
+        h->dataOffset = DATA_OFFSET;
+        h->sampleRate.store((uint32_t)(sampleRate > 0 ? sampleRate : FALLBACK_SAMPLE_RATE), std::memory_order_relaxed);
+        h->latencyFrames.store(msToFrames(m_latencyMs, h->sampleRate.load(std::memory_order_relaxed)),
+                               std::memory_order_relaxed);
+        h->producerAlive.store(1, std::memory_order_release);
+
+        m_base = base;
+        m_bytes = bytes;
+        m_name = name;
+        m_data = reinterpret_cast<float*>(static_cast<uint8_t*>(base) + DATA_OFFSET);
+        m_capacity = cap;
+        m_header.store(h);
+
+        AURIVO_LOG_INFO("[PCM SHM] Created %s (%u frames)", name.c_str(), cap);
+        return name;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        closeLocked();
+    }
+
+    bool isOpen() const { return m_header.load(std::memory_order_acquire) != nullptr; }
+
+    // Yalnızca audio thread'den çağrılır (wait-free, syscall yok)
+    void write(const float* interleaved, int frames) {
+        if (!interleaved || frames <= 0) return;
+        m_writers.fetch_add(1);
+        Header* h = m_header.load();
+        if (h) {
+            const int cap = (int)m_capacity;
+            if (frames > cap) {
+                interleaved += (size_t)(frames - cap) * CHANNELS;
+                frames = cap;
+            }
+            const uint64_t w = h->writeFrames.load(std::memory_order_relaxed);
+            const int start = (int)(w & (uint64_t)(cap - 1));
+            const int first = std::min(frames, cap - start);
+            std::memcpy(m_data + (size_t)start * CHANNELS, interleaved, (size_t)first * CHANNELS * sizeof(float));
+            if (first < frames) {
+                std::memcpy(m_data, interleaved + (size_t)first * CHANNELS,
+                            (size_t)(frames - first) * CHANNELS * sizeof(float));
+            }
+            const uint64_t nowNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+            h->writeTimeNs.store(nowNs, std::memory_order_relaxed);
+            h->sequence.fetch_add(1, std::memory_order_relaxed);
+            h->writeFrames.store(w + (uint64_t)frames, std::memory_order_release);
+        }
+        m_writers.fetch_sub(1);
+    }
+
+    void setSampleRate(int sampleRate) {
+        if (sampleRate <= 0) return;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Header* h = m_header.load();
+        if (!h) return;
+        h->sampleRate.store((uint32_t)sampleRate, std::memory_order_relaxed);
+        h->latencyFrames.store(msToFrames(m_latencyMs, (uint32_t)sampleRate), std::memory_order_relaxed);
+    }
+
+    // Visualizer, en yeni sample'ların bu kadar gerisinden okur (duyulanla hizalı)
+    void setLatencyMs(int latencyMs) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_latencyMs = std::max(0, latencyMs);
+        Header* h = m_header.load();
+        if (!h) return;
+        h->latencyFrames.store(msToFrames(m_latencyMs, h->sampleRate.load(std::memory_order_relaxed)),
+                               std::memory_order_relaxed);
+    }
+
+    Stats getStats() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Stats stats;
+        Header* h = m_header.load();
+        if (!h) return stats;
+        stats.open = true;
+        stats.name = m_name;
+        stats.capacityFrames = m_capacity;
+        stats.latencyFrames = h->latencyFrames.load(std::memory_order_relaxed);
+        stats.writeFrames = h->writeFrames.load(std::memory_order_acquire);
+        stats.sequence = h->sequence.load(std::memory_order_relaxed);
+        stats.consumerAttached = h->consumerAttached.load(std::memory_order_acquire) != 0;
+        return stats;
+    }
+
+private:
+    static uint32_t msToFrames(int ms, uint32_t sampleRate) {
+        return (uint32_t)((uint64_t)std::max(0, ms) * sampleRate / 1000);
+    }
+
+    void closeLocked() {
+        Header* h = m_header.exchange(nullptr);
+        if (!h) return;
+        // Audio thread eski pointer ile yazıyor olabilir; bitmesini bekle
+        while (m_writers.load() > 0) std::this_thread::yield();
+        h->producerAlive.store(0, std::memory_order_release);
+
+#ifdef _WIN32
+        UnmapViewOfFile(m_base);
+        if (m_mapping) CloseHandle(m_mapping);
+        m_mapping = nullptr;
+#else
+        munmap(m_base, m_bytes);
+        shm_unlink(m_name.c_str());
+#endif
+        AURIVO_LOG_INFO("[PCM SHM] Closed %s", m_name.c_str());
+        m_base = nullptr;
+        m_bytes = 0;
+        m_data = nullptr;
+        m_capacity = 0;
+        m_name.clear();
+    }
+
+    std::atomic<Header*> m_header{nullptr};
+    std::atomic<int> m_writers{0};
+    void* m_base = nullptr;
+    size_t m_bytes = 0;
+    float* m_data = nullptr;
+    uint32_t m_capacity = 0;
+    int m_latencyMs = 0;
+    std::string m_name;
+#ifdef _WIN32
+    HANDLE m_mapping = nullptr;
+#endif
+    mutable std::mutex m_mutex;
+};
+
+static PcmShmRing g_pcmShmRing;
+
+// ============================================
+// ENGINE ARKA PLAN İŞ KUYRUĞU
+// ============================================
+// Tek bir worker thread; preload (dosya açma + buffer doldurma) ve BASS sync
+// callback'lerinden ertelenen handle takası gibi işleri sırayla çalıştırır.
+// Sync/DSP callback'leri m_mutex alamaz; işi buraya bırakırlar.
+class EngineTaskQueue {
+public:
+    EngineTaskQueue() : m_stop(false), m_running(false) {}
+    ~EngineTaskQueue() { stop(); }
+
+    void start() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_running) return;
+        m_stop = false;
+        m_running = true;
+        m_thread = std::thread(&EngineTaskQueue::run, this);
+    }
+
+    // Bekleyen işler atılır; çalışan iş bitene kadar beklenir.
+    // Görevler engine m_mutex'ini aldığı için bu kilit tutulurken çağrılmamalı.
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_running) return;
+            m_stop = true;
+            m_tasks.clear();
+        }
+        m_cv.notify_all();
+        if (m_thread.joinable()) m_thread.join();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+
+    bool post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_running || m_stop) return false;
+            m_tasks.push_back(std::move(task));
+        }
+        m_cv.notify_one();
+        return true;
+    }
+
+private:
+    void run() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+                if (m_stop) return;
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::function<void()>> m_tasks;
+    std::thread m_thread;
+    bool m_stop;
+    bool m_running;
+};
+
+// ============================================
+// TRUE-PEAK DEDEKTÖRÜ (ITU-R BS.1770-4 Ek 2)
+// ============================================
+// Sinyal FACTOR kat polyphase FIR ile yukarı örneklenir; DAC'ın örnekler
+// arasında yeniden kuracağı tepeler dahil en büyük |y| döner. Faz başına 12
+// tap (4x'te standarttaki 48 tap'lık filtre), Kaiser pencereli sinc, her faz
+// DC kazancı 1. Katsayılar tap-major saklanır: bir tap tüm fazlarla tek SSE
+// vektöründe çarpılır (4x bir, 8x iki vektör). Grup gecikmesi ~TAPS/2 örnek.
+class TruePeakDetector {
+public:
+    static constexpr int TAPS = 12;
+    static constexpr int MAX_FACTOR = 8;
+
+    TruePeakDetector() : m_factor(0), m_write(0) { configure(4); }
+
+    void configure(int factor) {
+        factor = (factor == 2 || factor == 8) ? factor : 4;
+        if (factor != m_factor) {
+            m_factor = factor;
+            buildTable();
+        }
+        reset();
+    }
+
+    int factor() const { return m_factor; }
+
+    void reset() {
+        std::fill(m_hist, m_hist + TAPS * 2, 0.0f);
+        m_write = 0;
+    }
+
+    // Bir giriş örneği iter; son aralıktaki FACTOR ara değerin en büyük mutlak değeri
+    float push(float x) {
+        m_hist[m_write] = m_hist[m_write + TAPS] = x;
+        m_write = (m_write + 1) % TAPS;
+        const float* h = m_hist + m_write;   // en eski -> en yeni
+#if AURIVO_HAS_SSE
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        if (m_factor <= 4) {
+            for (int k = 0; k < TAPS; ++k) {
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_set1_ps(h[k]), _mm_load_ps(m_table + k * MAX_FACTOR)));
+            }
+        } else {
+            for (int k = 0; k < TAPS; ++k) {
+                const __m128 v = _mm_set1_ps(h[k]);
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(v, _mm_load_ps(m_table + k * MAX_FACTOR)));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(v, _mm_load_ps(m_table + k * MAX_FACTOR + 4)));
+            }
+        }
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 m = _mm_max_ps(_mm_andnot_ps(signMask, acc0), _mm_andnot_ps(signMask, acc1));
+        m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+        m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+        return _mm_cvtss_f32(m);
+#else
+        float peak = 0.0f;
+        for (int p = 0; p < m_factor; ++p) {
+            float acc = 0.0f;
+            for (int k = 0; k < TAPS; ++k) acc += h[k] * m_table[k * MAX_FACTOR + p];
+            peak = std::max(peak, std::fabs(acc));
+        }
+        return peak;
+#endif
+    }
+
+private:
+    static double besselI0(double x) {
+        double sum = 1.0;
+        double term = 1.0;
+        const double q = x * x * 0.25;
+        for (int k = 1; k < 32; ++k) {
+            term *= q / ((double)k * (double)k);
+            sum += term;
+            if (term < sum * 1e-12) break;
+        }
+        return sum;
+    }
+
+    // m_table[k][p] = prototip[(TAPS - 1 - k) * FACTOR + p]; kullanılmayan fazlar 0
+    void buildTable() {
+        std::fill(m_table, m_table + TAPS * MAX_FACTOR, 0.0f);
+        const int n = TAPS * m_factor;
+        const double center = (n - 1) * 0.5;
+        const double beta = 7.0;
+        const double i0Beta = besselI0(beta);
+        std::vector<double> proto(n);
+        for (int i = 0; i < n; ++i) {
+            const double x = (i - center) / m_factor;
+            const double sinc = (std::fabs(x) < 1e-9) ? 1.0 : std::sin(M_PI * x) / (M_PI * x);
+            const double r = (i - center) / (center + 0.5);
+            const double w = besselI0(beta * std::sqrt(std::max(0.0, 1.0 - r * r))) / i0Beta;
+            proto[i] = sinc * w;
+        }
+        for (int p = 0; p < m_factor; ++p) {
+            double sum = 0.0;
+            for (int k = 0; k < TAPS; ++k) sum += proto[(TAPS - 1 - k) * m_factor + p];
+            for (int k = 0; k < TAPS; ++k) {
+                m_table[k * MAX_FACTOR + p] = (float)(proto[(TAPS - 1 - k) * m_factor + p] / sum);
+            }
+        }
+    }
+
+    int m_factor;
+    int m_write;
+    float m_hist[TAPS * 2];
+    alignas(16) float m_table[TAPS * MAX_FACTOR];
+};
+
+// ============================================
+// LOOKAHEAD TRUE-PEAK LİMİTER
+// ============================================
+// Her örneğin true-peak'inden gereken kazanç (ceiling / tp) hesaplanır:
+//  1. L+1 örneklik kayan pencere minimumu (monoton kuyruk, amortize O(1)),
+//  2. L örneklik kayan ortalama (çalışan toplam, O(1)) -> kazanç tepeye L
+//     örnekte doğrusal iner, tık/pompalama olmaz,
+//  3. release: artışlar tek kutuplu yumuşatılır, düşüşler hemen izlenir.
+// Ses L - 1 + TAPS/2 örnek (lookahead + dedektör gecikmesi) geciktirilir;
+// böylece kazanç tepe çıkışa vardığında hedefe inmiş olur ve örnekler arası
+// tepeler de tavanın altında kalır. Gecikme latencyFrames() ile raporlanır.
+// Tüm buffer'lar sabit boyutlu; audio thread ayırma yapmaz.
+class TruePeakLimiter {
+public:
+    static constexpr int RING = 4096;                                  // 2'nin kuvveti
+    static constexpr int MAX_WINDOW = RING - TruePeakDetector::TAPS - 2;
+
+    struct BlockStats {
+        float inTruePeak[2] = { 0.0f, 0.0f };     // limiter öncesi (lineer)
+        float outTruePeak[2] = { 0.0f, 0.0f };    // limiter sonrası (lineer)
+        float outPeak[2] = { 0.0f, 0.0f };        // limiter sonrası örnek tepesi
+        float minGain = 1.0f;
+    };
+
+    TruePeakLimiter()
+        : m_window(0), m_delay(0), m_rate(0.0f), m_factor(0), m_link(true), m_primed(false),
+          m_pos(0), m_releaseCoef(0.0f), m_latency(0) {}
+
+    uint32_t latencyFrames() const { return m_latency.load(std::memory_order_relaxed); }
+
+    // Gecikme hattı ve dedektörler bir sonraki blokta (audio thread) sıfırlanır;
+    // seek/çıkış yeniden açılışında eski pozisyonun sesi çalınmasın diye
+    void requestReset() { m_resetRequested.store(true, std::memory_order_release); }
+
+    void process(const TruePeakLimiterParams& p, float sampleRate, float* samples, int frames, BlockStats& stats) {
+        if (sampleRate <= 0.0f) sampleRate = (float)FALLBACK_SAMPLE_RATE;
+        if (m_resetRequested.exchange(false, std::memory_order_acq_rel)) m_primed = false;
+        const int window = std::max(1, std::min(MAX_WINDOW, (int)std::lround(p.lookahead * 0.001f * sampleRate)));
+        if (!m_primed || window != m_window || sampleRate != m_rate || p.oversamplingRate != m_factor ||
+            p.linkChannels != m_link) {
+            configure(window, sampleRate, p.oversamplingRate, p.linkChannels);
+        }
+        m_releaseCoef = expf(-1.0f / std::max(1.0f, p.release * 0.001f * sampleRate));
+
+        const float ceiling = powf(10.0f, p.ceiling / 20.0f);
+        const int lanes = m_link ? 1 : 2;
+        for (int i = 0; i < frames; ++i) {
+            float* s = samples + (size_t)i * 2;
+            const float tpL = m_inDet[0].push(s[0]);
+            const float tpR = m_inDet[1].push(s[1]);
+            stats.inTruePeak[0] = std::max(stats.inTruePeak[0], tpL);
+            stats.inTruePeak[1] = std::max(stats.inTruePeak[1], tpR);
+
+            const float tp[2] = { m_link ? std::max(tpL, tpR) : tpL, tpR };
+            for (int c = 0; c < lanes; ++c) {
+                const float target = tp[c] > ceiling ? ceiling / tp[c] : 1.0f;
+                const float smooth = (float)m_avg[c].push(m_min[c].push(target, m_pos, m_window + 1), m_window);
+                float& g = m_gain[c];
+                g = (smooth < g) ? smooth : g * m_releaseCoef + smooth * (1.0f - m_releaseCoef);
+            }
+            const float gL = m_gain[0];
+            const float gR = m_link ? m_gain[0] : m_gain[1];
+
+            const uint32_t w = m_pos & (RING - 1);
+            const uint32_t r = (m_pos - (uint32_t)m_delay) & (RING - 1);
+            m_line[w * 2] = s[0];
+            m_line[w * 2 + 1] = s[1];
+            const float outL = clampf(m_line[r * 2] * gL, -ceiling, ceiling);
+            const float outR = clampf(m_line[r * 2 + 1] * gR, -ceiling, ceiling);
+            s[0] = outL;
+            s[1] = outR;
+            ++m_pos;
+
+            stats.outPeak[0] = std::max(stats.outPeak[0], std::fabs(outL));
+            stats.outPeak[1] = std::max(stats.outPeak[1], std::fabs(outR));
+            stats.outTruePeak[0] = std::max(stats.outTruePeak[0], m_outDet[0].push(outL));
+            stats.outTruePeak[1] = std::max(stats.outTruePeak[1], m_outDet[1].push(outR));
+            stats.minGain = std::min(stats.minGain, std::min(gL, gR));
+        }
+    }
+
+    // Limiter kapalı/atlandı: gecikme hattı bırakılır, tekrar açılınca temiz
+    // (sessiz) hatla başlar; eski ses parçası çalınmaz.
+    void bypass() {
+        if (!m_primed) return;
+        m_primed = false;
+        m_latency.store(0, std::memory_order_relaxed);
+    }
+
+    // Limiter kapalıyken sinyale dokunmadan yalnızca true-peak ölçer
+    void measure(int oversamplingRate, const float* samples, int frames, BlockStats& stats) {
+        const bool reset = m_resetRequested.exchange(false, std::memory_order_acq_rel);
+        if (reset || m_primed || m_outDet[0].factor() != oversamplingRate) {
+            bypass();
+            for (int c = 0; c < 2; ++c) m_outDet[c].configure(oversamplingRate);
+        }
+        for (int i = 0; i < frames; ++i) {
+            for (int c = 0; c < 2; ++c) {
+                const float x = samples[(size_t)i * 2 + c];
+                const float tp = m_outDet[c].push(x);
+                stats.inTruePeak[c] = std::max(stats.inTruePeak[c], tp);
+                stats.outTruePeak[c] = std::max(stats.outTruePeak[c], tp);
+                stats.outPeak[c] = std::max(stats.outPeak[c], std::fabs(x));
+            }
+        }
+    }
+
+private:
+    // Kayan pencere minimumu: değerler artan sırada tutulur, ön = minimum
+    struct WindowMin {
+        float values[RING];
+        uint32_t stamps[RING];
+        uint32_t head = 0;
+        uint32_t tail = 0;
+
+        void reset() { head = tail = 0; }
+
+        float push(float v, uint32_t stamp, int window) {
+            while (tail != head && values[(tail - 1) & (RING - 1)] >= v) --tail;
+            values[tail & (RING - 1)] = v;
+            stamps[tail & (RING - 1)] = stamp;
+            ++tail;
+            while (stamp - stamps[head & (RING - 1)] >= (uint32_t)window) ++head;
+            return values[head & (RING - 1)];
+        }
+    };
+
+    // Kayan ortalama (çalışan toplam double: uzun oturumlarda kayma birikmez)
+    struct WindowAverage {
+        float values[RING];
+        double sum = 0.0;
+        uint32_t pos = 0;
+
+        void reset(int window) {
+            std::fill(values, values + window, 1.0f);
+            sum = (double)window;
+            pos = 0;
+        }
+
+        double push(float v, int window) {
+            const uint32_t idx = pos % (uint32_t)window;
+            sum += (double)v - values[idx];
+            values[idx] = v;
+            ++pos;
+            if (pos == (uint32_t)window) pos = 0;
+            return sum / window;
+        }
+    };
+
+    void configure(int window, float rate, int factor, bool link) {
+        m_window = window;
+        m_rate = rate;
+        m_factor = factor;
+        m_link = link;
+        m_delay = window - 1 + TruePeakDetector::TAPS / 2;
+        for (int c = 0; c < 2; ++c) {
+            m_inDet[c].configure(factor);
+            m_outDet[c].configure(factor);
+            m_min[c].reset();
+            m_avg[c].reset(window);
+            m_gain[c] = 1.0f;
+        }
+        std::fill(m_line, m_line + RING * 2, 0.0f);
+        m_pos = 0;
+        m_primed = true;
+        m_latency.store((uint32_t)m_delay, std::memory_order_relaxed);
+    }
+
+    int m_window;
+    int m_delay;
+    float m_rate;
+    int m_factor;
+    bool m_link;
+    bool m_primed;
+    uint32_t m_pos;
+    float m_releaseCoef;
+    float m_gain[2] = { 1.0f, 1.0f };
+    std::atomic<uint32_t> m_latency;
+    std::atomic<bool> m_resetRequested{false};
+    TruePeakDetector m_inDet[2];
+    TruePeakDetector m_outDet[2];
+    WindowMin m_min[2];
+    WindowAverage m_avg[2];
+    float m_line[RING * 2];
+};
+
+// ============================================
+// LOUDNESS METRESİ (EBU R128 / ITU-R BS.1770-4)
+// ============================================
+// K-ağırlıklı (shelving + RLB high-pass) kare toplamları 100 ms'lik alt
+// bloklarda biriktirilir. Her alt blok sonunda:
+//  - momentary: son 4 alt blok (400 ms), short-term: son 30 alt blok (3 s),
+//  - integrated: 400 ms'lik bloklar (%75 örtüşme) 0.1 LU'luk histogramda,
+//    -70 LUFS mutlak ve -10 LU göreli kapı,
+//  - LRA (EBU Tech 3342): short-term değerler ikinci histogramda, -20 LU
+//    göreli kapı, %10-%95 yüzdelik farkı.
+// Histogramlar sabit boyutlu, alt blok başına hesap ~2 x BINS adım; audio
+// thread ayırma yapmaz. Sonuçlar sıra sayaçlı atomiklerle (seqlock) yayınlanır,
+// read() tutarlı bir anlık görüntü döner.
+class LoudnessMeter {
+public:
+    enum Field {
+        MOMENTARY, SHORT_TERM, INTEGRATED, LRA, MOMENTARY_MAX, SHORT_TERM_MAX,
+        SAMPLE_PEAK, SAMPLE_PEAK_MAX, RMS, DURATION, FIELD_COUNT
+    };
+
+    struct Snapshot {
+        float values[FIELD_COUNT];
+        int64_t updatedMs;          // steady_clock ms (son alt blok)
+        float sampleRate;
+    };
+
+    static constexpr float FLOOR_DB = -96.0f;
+    static constexpr float ABSOLUTE_GATE = -70.0f;
+    static constexpr int BINS = 750;                 // -70 .. +5 LUFS, 0.1 LU
+    static constexpr int SHORT_TERM_BLOCKS = 30;
+
+    // Mutlak kapıyı geçen 400 ms blokların dağılımı. Albüm loudness'ı için
+    // parçaların histogramları birleştirilir (göreli kapı tüm albüme uygulanır).
+    struct GatingHistogram {
+        uint32_t bins[BINS];
+        double powerSum;
+        uint64_t count;
+
+        GatingHistogram() { clear(); }
+
+        void clear() {
+            std::fill(bins, bins + BINS, 0u);
+            powerSum = 0.0;
+            count = 0;
+        }
+
+        void add(float lufs, double power) {
+            ++bins[binIndex(lufs)];
+            powerSum += power;
+            ++count;
+        }
+
+        void merge(const GatingHistogram& other) {
+            for (int i = 0; i < BINS; ++i) bins[i] += other.bins[i];
+            powerSum += other.powerSum;
+            count += other.count;
+        }
+
+        // -10 LU göreli kapı sonrası ortalama (LUFS)
+        float integrated() const {
+            if (count == 0) return FLOOR_DB;
+            const float relativeGate = powerToLufs(powerSum / count) - 10.0f;
+            const double* power = binPowers();
+            double sum = 0.0;
+            uint64_t gated = 0;
+            for (int i = binIndex(relativeGate); i < BINS; ++i) {
+                sum += bins[i] * power[i];
+                gated += bins[i];
+            }
+            return gated ? powerToLufs(sum / gated) : FLOOR_DB;
+        }
+    };
+
+    LoudnessMeter() : m_rate(0.0f), m_subBlockFrames(0), m_resetRequested(false), m_seq(0), m_updatedMs(0) {
+        binPowers();    // tabloyu audio thread'den önce kur
+        resetState();
+        for (auto& v : m_published) v.store(FLOOR_DB, std::memory_order_relaxed);
+        m_published[LRA].store(0.0f, std::memory_order_relaxed);
+        m_published[DURATION].store(0.0f, std::memory_order_relaxed);
+    }
+
+    // Herhangi bir thread: ölçüm bir sonraki blokta sıfırlanır (yeni parça)
+    void requestReset() { m_resetRequested.store(true, std::memory_order_release); }
+
+    void process(float sampleRate, const float* samples, int frames) {
+        if (sampleRate <= 0.0f) sampleRate = (float)FALLBACK_SAMPLE_RATE;
+        if (sampleRate != m_rate) {
+            configure(sampleRate);
+        } else if (m_resetRequested.exchange(false, std::memory_order_acq_rel)) {
+            resetState();
+        }
+
+        for (int i = 0; i < frames; ++i) {
+            const float l = samples[(size_t)i * 2];
+            const float r = samples[(size_t)i * 2 + 1];
+            const double kl = m_filter[0].push(l);
+            const double kr = m_filter[1].push(r);
+            m_kSum += kl * kl + kr * kr;
+            m_rawSum += (double)l * l + (double)r * r;
+            m_blockPeak = std::max(m_blockPeak, std::max(std::fabs(l), std::fabs(r)));
+            if (++m_subFrames == m_subBlockFrames) finishSubBlock();
+        }
+    }
+
+    // Audio thread (AGC): son 3 s'lik seviye. mode 0=peak dBFS, 1=RMS dBFS,
+    // 2=short-term LUFS. Henüz alt blok yoksa FLOOR_DB.
+    float levelForMode(int mode) const {
+        switch (mode) {
+            case 0: return m_peak3s;
+            case 2: return m_shortTerm;
+            default: return m_rms3s;
+        }
+    }
+
+    // Sahibi olan thread (audio thread ya da çevrimdışı tarayıcı)
+    const GatingHistogram& gatingBlocks() const { return m_blocks; }
+
+    bool read(Snapshot& out) const {
+        for (int attempt = 0; attempt < 64; ++attempt) {
+            const uint32_t before = m_seq.load(std::memory_order_acquire);
+            if (before & 1u) continue;
+            for (int f = 0; f < FIELD_COUNT; ++f) out.values[f] = m_published[f].load(std::memory_order_relaxed);
+            out.updatedMs = m_updatedMs.load(std::memory_order_relaxed);
+            out.sampleRate = m_publishedRate.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_seq.load(std::memory_order_relaxed) == before) return true;
+        }
+        return false;
+    }
+
+private:
+    // Transposed direct form II, double durum (38 Hz high-pass float'ta kayar)
+    struct KWeighting {
+        double b[2][3];
+        double a[2][2];
+        double z[2][2];
+
+        void design(double rate) {
+            // Stage 1: high-shelf (+4 dB, ~1.68 kHz)
+            double f0 = 1681.974450955533;
+            const double gain = 3.999843853973347;
+            double q = 0.7071752369554196;
+            double k = std::tan(M_PI * f0 / rate);
+            const double vh = std::pow(10.0, gain / 20.0);
+            const double vb = std::pow(vh, 0.4996667741545416);
+            double a0 = 1.0 + k / q + k * k;
+            b[0][0] = (vh + vb * k / q + k * k) / a0;
+            b[0][1] = 2.0 * (k * k - vh) / a0;
+            b[0][2] = (vh - vb * k / q + k * k) / a0;
+            a[0][0] = 2.0 * (k * k - 1.0) / a0;
+            a[0][1] = (1.0 - k / q + k * k) / a0;
+
+            // Stage 2: RLB high-pass (~38 Hz)
+            f0 = 38.13547087602444;
+            q = 0.5003270373238773;
+            k = std::tan(M_PI * f0 / rate);
+            a0 = 1.0 + k / q + k * k;
+            b[1][0] = 1.0;
+            b[1][1] = -2.0;
+            b[1][2] = 1.0;
+            a[1][0] = 2.0 * (k * k - 1.0) / a0;
+            a[1][1] = (1.0 - k / q + k * k) / a0;
+            reset();
+        }
+
+        void reset() { z[0][0] = z[0][1] = z[1][0] = z[1][1] = 0.0; }
+
+        double push(double x) {
+            for (int s = 0; s < 2; ++s) {
+                const double y = b[s][0] * x + z[s][0];
+                z[s][0] = b[s][1] * x - a[s][0] * y + z[s][1];
+                z[s][1] = b[s][2] * x - a[s][1] * y;
+                x = y;
+            }
+            return x;
+        }
+    };
+
+    // Kutu merkezinin gücü: L = -0.691 + 10 log10(P)
+    static const double* binPowers() {
+        static const std::vector<double> table = [] {
+            std::vector<double> t(BINS);
+            for (int i = 0; i < BINS; ++i) {
+                t[i] = std::pow(10.0, (ABSOLUTE_GATE + 0.1 * (i + 0.5) + 0.691) / 10.0);
+            }
+            return t;
+        }();
+        return table.data();
+    }
+
+    static float powerToLufs(double power) {
+        return power > 1e-12 ? (float)(-0.691 + 10.0 * std::log10(power)) : FLOOR_DB;
+    }
+
+    static int binIndex(float lufs) {
+        return std::max(0, std::min(BINS - 1, (int)((lufs - ABSOLUTE_GATE) * 10.0f)));
+    }
+
+    static float binLufs(int bin) { return ABSOLUTE_GATE + 0.1f * (bin + 0.5f); }
+
+    void configure(float rate) {
+        m_rate = rate;
+        m_subBlockFrames = std::max(1, (int)std::lround(rate / 10.0f));
+        for (auto& f : m_filter) f.design(rate);
+        m_resetRequested.store(false, std::memory_order_relaxed);
+        resetState();
+    }
+
+    void resetState() {
+        for (auto& f : m_filter) f.reset();
+        m_kSum = m_rawSum = 0.0;
+        m_blockPeak = 0.0f;
+        m_subFrames = 0;
+        m_subCount = 0;
+        m_frames = 0;
+        std::fill(m_kPower, m_kPower + SHORT_TERM_BLOCKS, 0.0);
+        std::fill(m_rawPower, m_rawPower + SHORT_TERM_BLOCKS, 0.0);
+        std::fill(m_peaks, m_peaks + SHORT_TERM_BLOCKS, 0.0f);
+        m_blocks.clear();
+        std::fill(m_shortHist, m_shortHist + BINS, 0u);
+        m_shortSum = 0.0;
+        m_shortCount = 0;
+        m_momentaryMax = m_shortTermMax = FLOOR_DB;
+        m_peakMax = 0.0f;
+        m_shortTerm = m_peak3s = m_rms3s = FLOOR_DB;
+        if (m_rate > 0.0f) {
+            float values[FIELD_COUNT];
+            std::fill(values, values + FIELD_COUNT, FLOOR_DB);
+            values[LRA] = 0.0f;
+            values[DURATION] = 0.0f;
+            publish(values);
+        }
+    }
+
+    void finishSubBlock() {
+        const int slot = (int)(m_subCount % SHORT_TERM_BLOCKS);
+        m_kPower[slot] = m_kSum / m_subFrames;                 // kanal ağırlıkları G = 1
+        m_rawPower[slot] = m_rawSum / (2.0 * m_subFrames);
+        m_peaks[slot] = m_blockPeak;
+        m_frames += (uint64_t)m_subFrames;
+        ++m_subCount;
+        m_kSum = m_rawSum = 0.0;
+        m_blockPeak = 0.0f;
+        m_subFrames = 0;
+
+        // Son n alt bloğun ortalaması (halka en yeni bloktan geriye okunur)
+        auto windowMean = [this](const double* ring, int n) {
+            double sum = 0.0;
+            for (int k = 0; k < n; ++k) sum += ring[(m_subCount - 1 - k) % SHORT_TERM_BLOCKS];
+            return sum / n;
+        };
+        const int momentaryBlocks = (int)std::min<uint64_t>(4, m_subCount);
+        const int shortBlocks = (int)std::min<uint64_t>(SHORT_TERM_BLOCKS, m_subCount);
+
+        const double momentaryPower = windowMean(m_kPower, momentaryBlocks);
+        const double shortPower = windowMean(m_kPower, shortBlocks);
+        const float momentary = powerToLufs(momentaryPower);
+        m_shortTerm = powerToLufs(shortPower);
+
+        float peak400 = 0.0f;
+        float peak3s = 0.0f;
+        for (int k = 0; k < shortBlocks; ++k) {
+            const float p = m_peaks[(m_subCount - 1 - k) % SHORT_TERM_BLOCKS];
+            if (k < momentaryBlocks) peak400 = std::max(peak400, p);
+            peak3s = std::max(peak3s, p);
+        }
+        m_peakMax = std::max(m_peakMax, peak400);
+        m_peak3s = linearTodB(peak3s);
+        m_rms3s = powerToDb(windowMean(m_rawPower, shortBlocks));
+
+        // Kapılı 400 ms blok (her 100 ms'de bir, %75 örtüşme)
+        if (momentaryBlocks == 4) {
+            m_momentaryMax = std::max(m_momentaryMax, momentary);
+            if (momentary >= ABSOLUTE_GATE) m_blocks.add(momentary, momentaryPower);
+        }
+        if (shortBlocks == SHORT_TERM_BLOCKS) {
+            m_shortTermMax = std::max(m_shortTermMax, m_shortTerm);
+            if (m_shortTerm >= ABSOLUTE_GATE) {
+                ++m_shortHist[binIndex(m_shortTerm)];
+                m_shortSum += shortPower;
+                ++m_shortCount;
+            }
+        }
+
+        float values[FIELD_COUNT];
+        values[MOMENTARY] = momentary;
+        values[SHORT_TERM] = m_shortTerm;
+        values[INTEGRATED] = m_blocks.integrated();
+        values[LRA] = loudnessRange();
+        values[MOMENTARY_MAX] = m_momentaryMax;
+        values[SHORT_TERM_MAX] = m_shortTermMax;
+        values[SAMPLE_PEAK] = linearTodB(peak400);
+        values[SAMPLE_PEAK_MAX] = linearTodB(m_peakMax);
+        values[RMS] = powerToDb(windowMean(m_rawPower, momentaryBlocks));
+        values[DURATION] = (float)((double)m_frames / m_rate);
+        publish(values);
+    }
+
+    static float powerToDb(double power) {
+        return power > 1e-12 ? (float)(10.0 * std::log10(power)) : FLOOR_DB;
+    }
+
+    float loudnessRange() const {
+        if (m_shortCount == 0) return 0.0f;
+        const float relativeGate = powerToLufs(m_shortSum / m_shortCount) - 20.0f;
+        const int first = binIndex(relativeGate);
+        uint64_t total = 0;
+        for (int i = first; i < BINS; ++i) total += m_shortHist[i];
+        if (total == 0) return 0.0f;
+
+        // %10 ve %95 yüzdelikleri (EBU Tech 3342)
+        const uint64_t lowRank = (uint64_t)((total - 1) * 0.10 + 0.5);
+        const uint64_t highRank = (uint64_t)((total - 1) * 0.95 + 0.5);
+        int lowBin = -1;
+        int highBin = -1;
+        uint64_t seen = 0;
+        for (int i = first; i < BINS && highBin < 0; ++i) {
+            seen += m_shortHist[i];
+            if (lowBin < 0 && seen > lowRank) lowBin = i;
+            if (seen > highRank) highBin = i;
+        }
+        return (lowBin >= 0 && highBin >= 0) ? binLufs(highBin) - binLufs(lowBin) : 0.0f;
+    }
+
+    void publish(const float* values) {
+        const uint32_t seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (int f = 0; f < FIELD_COUNT; ++f) m_published[f].store(values[f], std::memory_order_relaxed);
+        m_publishedRate.store(m_rate, std::memory_order_relaxed);
+        m_updatedMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+        m_seq.store(seq + 2, std::memory_order_release);
+    }
+
+    float m_rate;
+    int m_subBlockFrames;
+    int m_subFrames = 0;
+    uint64_t m_subCount = 0;
+    uint64_t m_frames = 0;
+    KWeighting m_filter[2];
+    double m_kSum = 0.0;
+    double m_rawSum = 0.0;
+    float m_blockPeak = 0.0f;
+
+    double m_kPower[SHORT_TERM_BLOCKS];
+    double m_rawPower[SHORT_TERM_BLOCKS];
+    float m_peaks[SHORT_TERM_BLOCKS];
+
+    GatingHistogram m_blocks;
+    uint32_t m_shortHist[BINS];
+    double m_shortSum = 0.0;
+    uint64_t m_shortCount = 0;
+
+    float m_momentaryMax = FLOOR_DB;
+    float m_shortTermMax = FLOOR_DB;
+    float m_peakMax = 0.0f;
+    float m_shortTerm = FLOOR_DB;
+    float m_peak3s = FLOOR_DB;
+    float m_rms3s = FLOOR_DB;
+
+    std::atomic<bool> m_resetRequested;
+    std::atomic<uint32_t> m_seq;
+    std::atomic<float> m_published[FIELD_COUNT];
+    std::atomic<float> m_publishedRate{0.0f};
+    std::atomic<int64_t> m_updatedMs;
+};
+
+// ============================================
+// AUTO GAIN KATI (loudness metresiyle sürülür)
+// ============================================
+// İleri beslemeli: metre AGC'den önce ölçer, hedef kazanç = hedef seviye -
+// son 3 s'lik seviye (mode'a göre peak/RMS/LUFS), ±maxGain ile sınırlı. Hedef
+// alt blok başına (100 ms) değişir; kazanç örnek başına tek kutuplu yumuşatılır
+// (yükselme attack, düşme release). Sessizlikte hedef korunur, parça arası
+// boşluklar pompalanmaz. Zincirde true-peak limiter'dan önce çalışır.
+class AutoGainStage {
+public:
+    static constexpr float SILENCE_GATE_DB = -60.0f;
+
+    AutoGainStage() : m_gain(1.0f), m_target(1.0f), m_resetRequested(false), m_applied(1.0f), m_normalize(1.0f) {}
+
+    // Birincil sinyal (aktif parça ya da bus)
+    void process(const AutoGainParams& p, float sampleRate, float levelDb, float* samples, int frames) {
+        if (m_resetRequested.exchange(false, std::memory_order_acq_rel)) {
+            m_gain = m_target = 1.0f;
+        }
+        if (!p.enabled) {
+            m_target = 1.0f;
+        } else if (levelDb > SILENCE_GATE_DB) {
+            m_target = dBToLinear(clampf(p.targetLevel - levelDb, -p.maxGain, p.maxGain));
+        }
+
+        const float normalize = m_normalize.load(std::memory_order_relaxed);
+        if (m_gain == m_target) {
+            applyConstant(m_gain * normalize, samples, frames);
+        } else {
+            if (sampleRate <= 0.0f) sampleRate = (float)FALLBACK_SAMPLE_RATE;
+            const float attack = 1.0f - expf(-1000.0f / (std::max(1.0f, p.attackTime) * sampleRate));
+            const float release = 1.0f - expf(-1000.0f / (std::max(1.0f, p.releaseTime) * sampleRate));
+            const float coef = (m_target > m_gain) ? attack : release;
+            float g = m_gain;
+            for (int i = 0; i < frames; ++i) {
+                g += (m_target - g) * coef;
+                samples[(size_t)i * 2] *= g * normalize;
+                samples[(size_t)i * 2 + 1] *= g * normalize;
+            }
+            // Hedefe 0.001 dB kala oturt (sonraki bloklar sabit kazançla geçer)
+            m_gain = (std::fabs(g - m_target) < 1e-4f * m_target) ? m_target : g;
+        }
+        m_applied.store(m_gain * normalize, std::memory_order_relaxed);
+    }
+
+    // Sönen parçalar: birincilin son kazancı sabit uygulanır
+    void applyHeld(float* samples, int frames) const {
+        applyConstant(m_applied.load(std::memory_order_relaxed), samples, frames);
+    }
+
+    // Zincir atlandı (DSP kapalı): tekrar açılınca eski kazançla başlamaz
+    void bypass() {
+        m_gain = m_target = 1.0f;
+        m_applied.store(1.0f, std::memory_order_relaxed);
+    }
+
+    // JS thread
+    void requestReset() {
+        m_normalize.store(1.0f, std::memory_order_relaxed);
+        m_resetRequested.store(true, std::memory_order_release);
+    }
+    void setNormalizeGain(float linear) { m_normalize.store(linear, std::memory_order_relaxed); }
+    float normalizeGain() const { return m_normalize.load(std::memory_order_relaxed); }
+    float appliedGain() const { return m_applied.load(std::memory_order_relaxed); }
+
+private:
+    static void applyConstant(float gain, float* samples, int frames) {
+        if (gain == 1.0f) return;
+        for (int i = 0; i < frames * 2; ++i) samples[i] *= gain;
+    }
+
+    float m_gain;
+    float m_target;
+    std::atomic<bool> m_resetRequested;
+    std::atomic<float> m_applied;       // AGC x normalize (lineer)
+    std::atomic<float> m_normalize;     // normalizeAudio() tek seferlik kazancı
+};
+
+// ============================================
+// METRE BANKASI (getMeters)
+// ============================================
+// Audio thread her blokta (runMasterChain, birincil sinyal) tüm metreleri bir
+// kez biriktirir ve seqlock ile yayınlar; UI tek çağrıda hepsini okur, kilit
+// ya da BASS_ChannelGetLevel gerekmez. Peak/RMS/korelasyon son okumadan bu
+// yana biriken pencereyi kapsar (okuma arası bloklar kaçmaz); okuma pencereyi
+// "tüketildi" işaretler, bir sonraki blok yeni pencere açar. Kazanç azaltmaları
+// blok sonundaki anlık durumdur.
+class MeterBank {
+public:
+    enum Field {
+        PEAK_L = 0,         // dBFS, çıkış (limiter sonrası)
+        PEAK_R,
+        RMS_L,              // dBFS
+        RMS_R,
+        TRUE_PEAK_L,        // dBTP, çıkış
+        TRUE_PEAK_R,
+        COMPRESSOR_GR,      // dB (pozitif)
+        LIMITER_GR,         // dB, DSP limiter
+        TRUE_PEAK_GR,       // dB, true-peak limiter
+        DEESSER_GR,         // dB (de-esser DSP compressor'ını kullanır)
+        GATE_GAIN,          // 0..1 (1 = açık)
+        AGC_GAIN,           // dB
+        CORRELATION,        // -1..+1 (sessizlikte 0)
+        OUTPUT_CLIPS,       // |x| >= 1.0 çıkış örneği (toplam)
+        TRUE_PEAK_OVERS,    // limiter öncesi tavan aşımı olan blok (toplam, = clippingCount)
+        BLOCK_FRAMES,       // son blok
+        WINDOW_FRAMES,      // bu okumanın kapsadığı frame
+        BLOCKS,             // yayınlanan blok sayısı (2^24'te sarar)
+        SAMPLE_RATE,
+        BLOCK_TIME,         // saniye, motor başlangıcından (son blok)
+        AGE_MS,             // okuma anında son bloğun yaşı
+        FIELD_COUNT
+    };
+
+    static const char* fieldName(int f) {
+        static const char* names[FIELD_COUNT] = {
+            "peakL", "peakR", "rmsL", "rmsR", "truePeakL", "truePeakR",
+            "compressorGr", "limiterGr", "truePeakGr", "deEsserGr", "gateGain", "agcGain",
+            "correlation", "outputClips", "truePeakOvers", "blockFrames", "windowFrames",
+            "blocks", "sampleRate", "blockTime", "ageMs"
+        };
+        return (f >= 0 && f < FIELD_COUNT) ? names[f] : "";
+    }
+
+    // Blok sonundaki dinamik durumu (audio thread doldurur)
+    struct Dynamics {
+        float compressorGr = 0.0f;
+        float limiterGr = 0.0f;
+        float truePeakGr = 0.0f;
+        float deEsserGr = 0.0f;
+        float gateGain = 1.0f;
+        float agcGain = 0.0f;
+        float truePeak[2] = { 0.0f, 0.0f };     // lineer
+    };
+
+    MeterBank() : m_seq(0), m_consumed(true), m_start(std::chrono::steady_clock::now()) {
+        for (auto& v : m_published) v.store(0.0f, std::memory_order_relaxed);
+        m_published[PEAK_L].store(-96.0f, std::memory_order_relaxed);
+        m_published[PEAK_R].store(-96.0f, std::memory_order_relaxed);
+        m_published[RMS_L].store(-96.0f, std::memory_order_relaxed);
+        m_published[RMS_R].store(-96.0f, std::memory_order_relaxed);
+        m_published[TRUE_PEAK_L].store(-96.0f, std::memory_order_relaxed);
+        m_published[TRUE_PEAK_R].store(-96.0f, std::memory_order_relaxed);
+        m_published[GATE_GAIN].store(1.0f, std::memory_order_relaxed);
+    }
+
+    // Audio thread: stereo interleaved çıkış bloğu
+    void process(float rate, const float* samples, int frames, const Dynamics& d) {
+        if (frames <= 0) return;
+        if (m_counterReset.exchange(false, std::memory_order_acq_rel)) {
+            m_clips = 0;
+        }
+        if (m_consumed.exchange(false, std::memory_order_acq_rel)) {
+            m_peak[0] = m_peak[1] = 0.0f;
+            m_truePeak[0] = m_truePeak[1] = 0.0f;
+            m_sumSq[0] = m_sumSq[1] = m_sumLR = 0.0;
+            m_windowFrames = 0;
+        }
+
+        float peakL = m_peak[0], peakR = m_peak[1];
+        double sl = 0.0, sr = 0.0, slr = 0.0;
+        uint32_t clips = 0;
+        for (int i = 0; i < frames; ++i) {
+            const float l = samples[i * 2];
+            const float r = samples[i * 2 + 1];
+            const float al = fabsf(l);
+            const float ar = fabsf(r);
+            peakL = std::max(peakL, al);
+            peakR = std::max(peakR, ar);
+            clips += (al >= 1.0f) + (ar >= 1.0f);
+            sl += (double)l * l;
+            sr += (double)r * r;
+            slr += (double)l * r;
+        }
+        m_peak[0] = peakL;
+        m_peak[1] = peakR;
+        m_sumSq[0] += sl;
+        m_sumSq[1] += sr;
+        m_sumLR += slr;
+        m_windowFrames += (uint64_t)frames;
+        m_truePeak[0] = std::max(m_truePeak[0], d.truePeak[0]);
+        m_truePeak[1] = std::max(m_truePeak[1], d.truePeak[1]);
+        m_clips += clips;
+        ++m_blocks;
+
+        float v[FIELD_COUNT];
+        const double n = (double)m_windowFrames;
+        v[PEAK_L] = linearTodB(m_peak[0]);
+        v[PEAK_R] = linearTodB(m_peak[1]);
+        v[RMS_L] = linearTodB((float)std::sqrt(m_sumSq[0] / n));
+        v[RMS_R] = linearTodB((float)std::sqrt(m_sumSq[1] / n));
+        v[TRUE_PEAK_L] = linearTodB(m_truePeak[0]);
+        v[TRUE_PEAK_R] = linearTodB(m_truePeak[1]);
+        v[COMPRESSOR_GR] = d.compressorGr;
+        v[LIMITER_GR] = d.limiterGr;
+        v[TRUE_PEAK_GR] = d.truePeakGr;
+        v[DEESSER_GR] = d.deEsserGr;
+        v[GATE_GAIN] = d.gateGain;
+        v[AGC_GAIN] = d.agcGain;
+        const double energy = m_sumSq[0] * m_sumSq[1];
+        v[CORRELATION] = energy > 1e-20 ? clampf((float)(m_sumLR / std::sqrt(energy)), -1.0f, 1.0f) : 0.0f;
+        v[OUTPUT_CLIPS] = (float)m_clips;
+        // Sayaç getTruePeakMeter ile ortak (resetTruePeakClipping ikisini de sıfırlar)
+        v[TRUE_PEAK_OVERS] = (float)g_truePeakMeter.clippingCount.load(std::memory_order_relaxed);
+        v[BLOCK_FRAMES] = (float)frames;
+        v[WINDOW_FRAMES] = (float)m_windowFrames;
+        v[BLOCKS] = (float)(m_blocks & 0xFFFFFFu);
+        v[SAMPLE_RATE] = rate;
+        const auto now = std::chrono::steady_clock::now();
+        v[BLOCK_TIME] = (float)std::chrono::duration<double>(now - m_start).count();
+        v[AGE_MS] = 0.0f;
+
+        const uint32_t seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (int f = 0; f < FIELD_COUNT; ++f) m_published[f].store(v[f], std::memory_order_relaxed);
+        m_updatedNs.store((int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            now.time_since_epoch()).count(), std::memory_order_relaxed);
+        m_seq.store(seq + 2, std::memory_order_release);
+    }
+
+    // Herhangi bir thread: out[0..FIELD_COUNT). consume: pencereyi kapatır
+    // (getMeters); tekil eski getter'lar pencereye dokunmadan okur.
+    bool read(float* out, bool consume = true) {
+        for (int attempt = 0; attempt < 64; ++attempt) {
+            const uint32_t before = m_seq.load(std::memory_order_acquire);
+            if (before & 1u) continue;
+            for (int f = 0; f < FIELD_COUNT; ++f) out[f] = m_published[f].load(std::memory_order_relaxed);
+            const int64_t updatedNs = m_updatedNs.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_seq.load(std::memory_order_relaxed) != before) continue;
+
+            const int64_t nowNs = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+            out[AGE_MS] = updatedNs ? (float)((nowNs - updatedNs) / 1e6) : -1.0f;
+            if (consume) m_consumed.store(true, std::memory_order_release);
+            return true;
+        }
+        return false;
+    }
+
+    // Çıkış clip sayacı bir sonraki blokta audio thread'de sıfırlanır (aşım
+    // sayacı g_truePeakMeter'dadır, çağıran sıfırlar)
+    void requestCounterReset() { m_counterReset.store(true, std::memory_order_release); }
+
+private:
+    // Audio thread durumu
+    float m_peak[2] = { 0.0f, 0.0f };
+    float m_truePeak[2] = { 0.0f, 0.0f };
+    double m_sumSq[2] = { 0.0, 0.0 };
+    double m_sumLR = 0.0;
+    uint64_t m_windowFrames = 0;
+    uint64_t m_clips = 0;
+    uint64_t m_blocks = 0;
+
+    std::atomic<uint32_t> m_seq;
+    std::atomic<bool> m_consumed;
+    std::atomic<bool> m_counterReset{false};
+    std::atomic<int64_t> m_updatedNs{0};
+    std::atomic<float> m_published[FIELD_COUNT];
+    const std::chrono::steady_clock::time_point m_start;
+};
+
+// ============================================
+// STEREO ANALİZİ (korelasyon + goniometre)
+// ============================================
+// Korelasyon katsayısı r = Σ(L·R) / sqrt(Σ(L²)·Σ(R²)), seçilebilir pencereyle
+// üstel ağırlıklı toplamlardan (blok başına bir güncelleme). +1 mono, 0
+// ilişkisiz, <0 faz sorunu (mono toplamda iptal). Pencerenin en düşük değeri
+// HOLD_MS boyunca tutulur; kısa faz sorunları kaçmaz. Goniometre için çıkışın
+// her `decimation`. örneği M/S'ye döndürülüp (45°) nokta ring'ine yazılır;
+// UI yeni noktaları toplu okur (tek okuyucu).
+class StereoAnalyzer {
+public:
+    static constexpr int RING_POINTS = 1 << 15;
+    static constexpr int RING_MASK = RING_POINTS - 1;
+    static constexpr int MIN_WINDOW_MS = 10;
+    static constexpr int MAX_WINDOW_MS = 10000;
+    static constexpr int MAX_DECIMATION = 64;
+    static constexpr int HOLD_MS = 1500;
+    static constexpr float SILENCE = 1e-10f;    // pencere enerjisi bunun altındaysa r = 0
+
+    struct Correlation {
+        float correlation = 0.0f;   // seçili pencere
+        float minimum = 0.0f;       // son HOLD_MS içindeki en düşük
+        float balance = 0.0f;       // dB, R - L enerjisi (+: sağ baskın)
+        float width = 0.0f;         // S/M enerji oranı (0 mono, 1 ilişkisiz, >1 faz dışı)
+        float midLevel = -96.0f;    // dBFS (RMS, pencere)
+        float sideLevel = -96.0f;
+        int windowMs = 0;
+        bool live = false;
+    };
+
+    StereoAnalyzer()
+        : m_windowMs(300), m_decimation(4), m_goniometer(false), m_seq(0), m_updatedMs(0),
+          m_write(0), m_read(0), m_points((size_t)RING_POINTS * 2, 0.0f) {
+        for (auto& v : m_published) v.store(0.0f, std::memory_order_relaxed);
+    }
+
+    void setWindowMs(int ms) { m_windowMs.store(std::max(MIN_WINDOW_MS, std::min(MAX_WINDOW_MS, ms))); }
+    int windowMs() const { return m_windowMs.load(); }
+
+    void setGoniometer(bool enabled, int decimation) {
+        m_decimation.store(std::max(1, std::min(MAX_DECIMATION, decimation)));
+        m_goniometer.store(enabled, std::memory_order_release);
+    }
+    bool goniometerEnabled() const { return m_goniometer.load(std::memory_order_acquire); }
+    int decimation() const { return m_decimation.load(); }
+
+    // Audio thread: stereo interleaved çıkış bloğu
+    void process(float rate, const float* samples, int frames) {
+        if (frames <= 0 || rate <= 0.0f) return;
+
+        double ll = 0.0, rr = 0.0, lr = 0.0;
+        for (int i = 0; i < frames; ++i) {
+            const double l = samples[i * 2];
+            const double r = samples[i * 2 + 1];
+            ll += l * l;
+            rr += r * r;
+            lr += l * r;
+        }
+
+        // Üstel pencere: τ = windowMs; blok boyundan bağımsız
+        const double tau = m_windowMs.load(std::memory_order_relaxed) * 0.001 * rate;
+        const double keep = std::exp(-(double)frames / tau);
+        m_ll = m_ll * keep + ll;
+        m_rr = m_rr * keep + rr;
+        m_lr = m_lr * keep + lr;
+        m_norm = m_norm * keep + frames;                     // penceredeki etkin frame sayısı
+
+        const double energy = m_ll * m_rr;
+        const float corr = energy > SILENCE ? clampf((float)(m_lr / std::sqrt(energy)), -1.0f, 1.0f) : 0.0f;
+
+        // En düşük değer tutma (sessizlik sayılmaz)
+        m_holdFrames += frames;
+        if (energy > SILENCE && (corr < m_hold || m_holdFrames > (int64_t)(HOLD_MS * 0.001f * rate))) {
+            m_hold = corr;
+            m_holdFrames = 0;
+        }
+
+        // M = (L+R)/√2, S = (L-R)/√2: M² + S² = L² + R²
+        const double mid = 0.5 * (m_ll + m_rr) + m_lr;
+        const double side = 0.5 * (m_ll + m_rr) - m_lr;
+        const double n = std::max(1.0, m_norm);
+
+        float v[FIELD_COUNT];
+        v[F_CORRELATION] = corr;
+        v[F_MINIMUM] = m_hold;
+        v[F_BALANCE] = (m_ll > SILENCE && m_rr > SILENCE) ? (float)(10.0 * std::log10(m_rr / m_ll)) : 0.0f;
+        v[F_WIDTH] = mid > SILENCE ? (float)(std::max(0.0, side) / mid) : 0.0f;
+        v[F_MID] = linearTodB((float)std::sqrt(std::max(0.0, mid) / n));
+        v[F_SIDE] = linearTodB((float)std::sqrt(std::max(0.0, side) / n));
+
+        const uint32_t seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (int f = 0; f < FIELD_COUNT; ++f) m_published[f].store(v[f], std::memory_order_relaxed);
+        m_updatedMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+        m_seq.store(seq + 2, std::memory_order_release);
+
+        if (m_goniometer.load(std::memory_order_relaxed)) writePoints(samples, frames);
+    }
+
+    bool read(Correlation& out) const {
+        for (int attempt = 0; attempt < 64; ++attempt) {
+            const uint32_t before = m_seq.load(std::memory_order_acquire);
+            if (before & 1u) continue;
+            float v[FIELD_COUNT];
+            for (int f = 0; f < FIELD_COUNT; ++f) v[f] = m_published[f].load(std::memory_order_relaxed);
+            const int64_t updatedMs = m_updatedMs.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_seq.load(std::memory_order_relaxed) != before) continue;
+
+            const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+            out.correlation = v[F_CORRELATION];
+            out.minimum = v[F_MINIMUM];
+            out.balance = v[F_BALANCE];
+            out.width = v[F_WIDTH];
+            out.midLevel = v[F_MID];
+            out.sideLevel = v[F_SIDE];
+            out.windowMs = m_windowMs.load(std::memory_order_relaxed);
+            out.live = updatedMs != 0 && nowMs - updatedMs < 500;
+            return true;
+        }
+        return false;
+    }
+
+    // Tek okuyucu (JS thread): son okumadan bu yana yazılan en yeni en fazla
+    // maxPoints noktayı [m, s, m, s, ...] olarak kopyalar, nokta sayısını döner.
+    // Okuyucu geride kaldıysa eski noktalar atlanır.
+    int readPoints(float* dest, int maxPoints) {
+        if (!dest || maxPoints <= 0) return 0;
+        maxPoints = std::min(maxPoints, RING_POINTS);
+        const uint64_t w = m_write.load(std::memory_order_acquire);
+        uint64_t r = m_read;
+        if (w - r > (uint64_t)maxPoints) r = w - (uint64_t)maxPoints;
+        const int count = (int)(w - r);
+
+        const int start = (int)(r & RING_MASK);
+        const int first = std::min(count, RING_POINTS - start);
+        std::memcpy(dest, &m_points[(size_t)start * 2], (size_t)first * 2 * sizeof(float));
+        if (first < count) {
+            std::memcpy(dest + (size_t)first * 2, &m_points[0], (size_t)(count - first) * 2 * sizeof(float));
+        }
+        m_read = w;
+
+        // Kopyalama sırasında writer ring'i turladıysa ezilmiş baştaki noktaları at
+        const uint64_t after = m_write.load(std::memory_order_acquire);
+        if (after - r > (uint64_t)RING_POINTS) {
+            const int lost = (int)std::min<uint64_t>((uint64_t)count, after - r - RING_POINTS);
+            std::memmove(dest, dest + (size_t)lost * 2, (size_t)(count - lost) * 2 * sizeof(float));
+            return count - lost;
+        }
+        return count;
+    }
+
+private:
+    enum { F_CORRELATION = 0, F_MINIMUM, F_BALANCE, F_WIDTH, F_MID, F_SIDE, FIELD_COUNT };
+
+    void writePoints(const float* samples, int frames) {
+        const int decimation = m_decimation.load(std::memory_order_relaxed);
+        uint64_t w = m_write.load(std::memory_order_relaxed);
+        int i = m_phase;
+        for (; i < frames; i += decimation) {
+            const float l = samples[i * 2];
+            const float r = samples[i * 2 + 1];
+            float* p = &m_points[(size_t)(w & RING_MASK) * 2];
+            p[0] = (l + r) * 0.70710678f;
+            p[1] = (l - r) * 0.70710678f;
+            ++w;
+        }
+        m_phase = i - frames;
+        m_write.store(w, std::memory_order_release);
+    }
+
+    std::atomic<int> m_windowMs;
+    std::atomic<int> m_decimation;
+    std::atomic<bool> m_goniometer;
+
+    // Audio thread durumu
+    double m_ll = 0.0, m_rr = 0.0, m_lr = 0.0, m_norm = 0.0;
+    float m_hold = 0.0f;
+    int64_t m_holdFrames = 0;
+    int m_phase = 0;
+
+    std::atomic<uint32_t> m_seq;
+    std::atomic<int64_t> m_updatedMs;
+    std::atomic<float> m_published[FIELD_COUNT];
+
+    std::atomic<uint64_t> m_write;
+    uint64_t m_read;                // yalnızca okuyucu
+    std::vector<float> m_points;
+};
+
+// ============================================
+// CALLBACK PROFİLLEYİCİ (getDspStats)
+// ============================================
+// Çıkış callback'inin gerçek zaman bütçesine ne kadar yaklaştığını ölçer.
+// Blok = mikser çıkışının bir bloğu: STREAMPROC'un başından çıkıştaki en düşük
+// öncelikli DSP'ye kadar (parça zincirleri, resample, konvolüsyon, bus zinciri,
+// tape/dither dahil). Sönen parçalar aynı bloğun içindedir, ayrıca sayılmaz.
+// steady_clock (Linux/Windows'ta TSC tabanlı, çağrı başına ~20-30 ns). Bütçe =
+// frames / sampleRate. Audio thread yalnızca sabit boyutlu atomik sayaçlara
+// yazar: kilit ve bellek ayırma yok. Blok açık değilken (preload thread'inin
+// preroll'u, offline render) ne blok ne aşama kaydedilir.
+// - Histogram: yarım oktav kovalar, 1 µs'den başlar (son kova açık uçlu)
+// - Son N saniyenin en kötüsü: saniye başına maksimum tutan halka
+// - Eşik sayacı: bütçenin %X'ini aşan bloklar; >%100 = deadline kaçırma
+// Aşama kırılımı (perStage) isteğe bağlı; kapalıyken aşama başına saat okunmaz.
+// Aşamalar iç içedir: mixer, parça zincirlerinin aşamalarını ve resample'ı
+// kapsar (bus modunda parça zinciri MasterDSP çalıştırmaz).
+class CallbackProfiler {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    enum Stage {
+        STAGE_PARAMS = 0,   // syncMasterDsp
+        STAGE_DSP,          // process_dsp (MasterDSP)
+        STAGE_LOUDNESS,     // loudness + AGC
+        STAGE_TRUE_PEAK,    // true-peak limiter / ölçüm
+        STAGE_METERS,       // MeterBank + StereoAnalyzer
+        STAGE_ANALYSIS,     // analiz tap'i / visualizer ring
+        STAGE_CONVOLUTION,  // konvolüsyon reverb (mikser çıkışı, ayrı callback)
+        STAGE_MIXER,        // mikser STREAMPROC'u (zincir okuma + parça DSP'leri + fade)
+        STAGE_RESAMPLE,     // polyphase dönüştürücü (zincir okuması hariç)
+        STAGE_TAPE_DITHER,  // tape saturation + bit/dither
+        STAGE_COUNT
+    };
+
+    static constexpr int BUCKETS = 32;
+    static constexpr int WINDOW_SLOTS = 64;     // saniye
+    static constexpr int MAX_WINDOW_SECONDS = 60;
+
+    static const char* stageName(int s) {
+        static const char* names[STAGE_COUNT] = {
+            "params", "dsp", "loudness", "truePeak", "meters", "analysis", "convolution",
+            "mixer", "resample", "tapeDither"
+        };
+        return (s >= 0 && s < STAGE_COUNT) ? names[s] : "";
+    }
+
+    // Kova b'nin alt sınırı (µs); kova 0 = 1 µs altı
+    static double bucketLowerUs(int b) {
+        return b <= 0 ? 0.0 : std::pow(2.0, (b - 1) * 0.5);
+    }
+
+    struct StageStats {
+        uint64_t calls = 0;
+        double totalUs = 0.0;
+        double meanUs = 0.0;
+        double maxUs = 0.0;
+    };
+
+    struct Stats {
+        bool enabled = false;
+        bool perStage = false;
+        double thresholdPercent = 0.0;
+        int windowSeconds = 0;
+        uint64_t blocks = 0;
+        uint64_t frames = 0;
+        uint64_t overThreshold = 0;
+        uint64_t deadlineMisses = 0;
+        float sampleRate = 0.0f;
+        double lastUs = 0.0;
+        double lastBudgetUs = 0.0;
+        double meanUs = 0.0;
+        double maxUs = 0.0;
+        double meanLoad = 0.0;          // toplam süre / toplam bütçe
+        double maxLoad = 0.0;
+        double worstUs = 0.0;           // son windowSeconds
+        double worstLoad = 0.0;
+        double p50Us = 0.0;             // histogram kovasının üst sınırı
+        double p99Us = 0.0;
+        double sinceResetSec = 0.0;
+        uint64_t histogram[BUCKETS] = {};
+        StageStats stages[STAGE_COUNT];
+    };
+
+    // Aşama süresi (yalnızca perStage açıkken ve bu thread'de blok açıkken saat
+    // okur). exclude: iç içe ölçülmüş, bu aşamaya sayılmayacak süre.
+    class StageTimer {
+    public:
+        StageTimer(CallbackProfiler& p, Stage stage) : StageTimer(&p, stage) {}
+        StageTimer(CallbackProfiler* p, Stage stage)
+            : m_profiler(p && p->stageActive() ? p : nullptr), m_stage(stage), m_excluded(0) {
+            if (m_profiler) m_start = Clock::now();
+        }
+        ~StageTimer() {
+            if (m_profiler) m_profiler->recordStage(m_stage, Clock::now() - m_start - m_excluded);
+        }
+
+        bool active() const { return m_profiler != nullptr; }
+        void exclude(Clock::duration d) { m_excluded += d; }
+
+    private:
+        CallbackProfiler* m_profiler;
+        Stage m_stage;
+        Clock::time_point m_start;
+        Clock::duration m_excluded;
+    };
+
+    CallbackProfiler() : m_origin(Clock::now()) {
+        reset();
+    }
+
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+    bool perStage() const { return m_enabled.load(std::memory_order_relaxed) && m_perStage.load(std::memory_order_relaxed); }
+
+    // Çıkış bloğu: STREAMPROC başında açılır, çıkışın son DSP'sinde kaydedilir.
+    // İkisi aynı thread'de sırayla çalışır; başlangıç thread'e özeldir, böylece
+    // aynı zincirden okuyan başka bir thread (preload) ölçüme karışmaz.
+    void beginBlock() {
+        t_block.owner = enabled() ? this : nullptr;
+        if (t_block.owner) t_block.start = Clock::now();
+    }
+
+    void endBlock(int frames, float rate) {
+        if (t_block.owner != this) return;
+        t_block.owner = nullptr;
+        recordBlock(t_block.start, Clock::now(), frames, rate);
+    }
+
+    bool stageActive() const { return t_block.owner == this && perStage(); }
+
+    void configure(bool enabled, bool perStage, double thresholdPercent, int windowSeconds) {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+        m_perStage.store(perStage, std::memory_order_relaxed);
+        m_thresholdPercent.store((float)clampf((float)thresholdPercent, 1.0f, 1000.0f), std::memory_order_relaxed);
+        m_windowSeconds.store(std::max(1, std::min(windowSeconds, MAX_WINDOW_SECONDS)), std::memory_order_relaxed);
+    }
+
+    // Herhangi bir thread. Eşzamanlı bir blok sayaçlardan birine sıfırlamadan
+    // hemen sonra yazabilir; izleme verisi için kabul edilebilir.
+    void reset() {
+        m_blocks.store(0, std::memory_order_relaxed);
+        m_frames.store(0, std::memory_order_relaxed);
+        m_totalNs.store(0, std::memory_order_relaxed);
+        m_budgetNs.store(0, std::memory_order_relaxed);
+        m_maxNs.store(0, std::memory_order_relaxed);
+        m_maxLoadPpm.store(0, std::memory_order_relaxed);
+        m_overThreshold.store(0, std::memory_order_relaxed);
+        m_deadlineMisses.store(0, std::memory_order_relaxed);
+        for (auto& h : m_histogram) h.store(0, std::memory_order_relaxed);
+        for (int s = 0; s < STAGE_COUNT; ++s) {
+            m_stageCalls[s].store(0, std::memory_order_relaxed);
+            m_stageNs[s].store(0, std::memory_order_relaxed);
+            m_stageMaxNs[s].store(0, std::memory_order_relaxed);
+        }
+        for (auto& w : m_window) {
+            w.second.store(0, std::memory_order_relaxed);
+            w.maxNs.store(0, std::memory_order_relaxed);
+            w.maxLoadPpm.store(0, std::memory_order_relaxed);
+        }
+        m_resetNs.store(sinceOriginNs(Clock::now()), std::memory_order_relaxed);
+    }
+
+    // Audio thread
+    void recordBlock(Clock::time_point start, Clock::time_point end, int frames, float rate) {
+        if (frames <= 0 || rate <= 0.0f) return;
+        const uint64_t ns = (uint64_t)std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        const uint64_t budgetNs = (uint64_t)((double)frames * 1e9 / rate);
+        const double load = budgetNs ? (double)ns / (double)budgetNs : 0.0;
+        const uint64_t loadPpm = (uint64_t)(load * 1e6);
+
+        m_blocks.fetch_add(1, std::memory_order_relaxed);
+        m_frames.fetch_add((uint64_t)frames, std::memory_order_relaxed);
+        m_totalNs.fetch_add(ns, std::memory_order_relaxed);
+        m_budgetNs.fetch_add(budgetNs, std::memory_order_relaxed);
+        atomicMax(m_maxNs, ns);
+        atomicMax(m_maxLoadPpm, loadPpm);
+        m_histogram[bucketFor(ns)].fetch_add(1, std::memory_order_relaxed);
+        if (load * 100.0 >= m_thresholdPercent.load(std::memory_order_relaxed)) {
+            m_overThreshold.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (load >= 1.0) m_deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+        m_lastNs.store(ns, std::memory_order_relaxed);
+        m_lastBudgetNs.store(budgetNs, std::memory_order_relaxed);
+        m_lastRate.store(rate, std::memory_order_relaxed);
+
+        // Saniye halkası: slot başka bir saniyeye aitse önce temizlenir
+        const uint64_t second = (uint64_t)(sinceOriginNs(end) / 1000000000LL) + 1;   // 0 = boş slot
+        WindowSlot& slot = m_window[second % WINDOW_SLOTS];
+        if (slot.second.load(std::memory_order_relaxed) != second) {
+            slot.maxNs.store(0, std::memory_order_relaxed);
+            slot.maxLoadPpm.store(0, std::memory_order_relaxed);
+            slot.second.store(second, std::memory_order_relaxed);
+        }
+        atomicMax(slot.maxNs, ns);
+        atomicMax(slot.maxLoadPpm, loadPpm);
+    }
+
+    void recordStage(Stage stage, Clock::duration elapsed) {
+        const uint64_t ns = (uint64_t)std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        m_stageCalls[stage].fetch_add(1, std::memory_order_relaxed);
+        m_stageNs[stage].fetch_add(ns, std::memory_order_relaxed);
+        atomicMax(m_stageMaxNs[stage], ns);
+    }
+
+    // Herhangi bir thread
+    void read(Stats& out) const {
+        out = Stats();
+        out.enabled = m_enabled.load(std::memory_order_relaxed);
+        out.perStage = m_perStage.load(std::memory_order_relaxed);
+        out.thresholdPercent = m_thresholdPercent.load(std::memory_order_relaxed);
+        out.windowSeconds = m_windowSeconds.load(std::memory_order_relaxed);
+        out.blocks = m_blocks.load(std::memory_order_relaxed);
+        out.frames = m_frames.load(std::memory_order_relaxed);
+        out.overThreshold = m_overThreshold.load(std::memory_order_relaxed);
+        out.deadlineMisses = m_deadlineMisses.load(std::memory_order_relaxed);
+        out.sampleRate = m_lastRate.load(std::memory_order_relaxed);
+        out.lastUs = m_lastNs.load(std::memory_order_relaxed) / 1000.0;
+        out.lastBudgetUs = m_lastBudgetNs.load(std::memory_order_relaxed) / 1000.0;
+        const uint64_t totalNs = m_totalNs.load(std::memory_order_relaxed);
+        const uint64_t budgetNs = m_budgetNs.load(std::memory_order_relaxed);
+        out.meanUs = out.blocks ? totalNs / 1000.0 / (double)out.blocks : 0.0;
+        out.maxUs = m_maxNs.load(std::memory_order_relaxed) / 1000.0;
+        out.meanLoad = budgetNs ? (double)totalNs / (double)budgetNs : 0.0;
+        out.maxLoad = m_maxLoadPpm.load(std::memory_order_relaxed) / 1e6;
+
+        const Clock::time_point now = Clock::now();
+        const uint64_t current = (uint64_t)(sinceOriginNs(now) / 1000000000LL) + 1;
+        for (const WindowSlot& w : m_window) {
+            const uint64_t second = w.second.load(std::memory_order_relaxed);
+            if (second == 0 || second > current || current - second >= (uint64_t)out.windowSeconds) continue;
+            out.worstUs = std::max(out.worstUs, w.maxNs.load(std::memory_order_relaxed) / 1000.0);
+            out.worstLoad = std::max(out.worstLoad, w.maxLoadPpm.load(std::memory_order_relaxed) / 1e6);
+        }
+
+        uint64_t counted = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            out.histogram[b] = m_histogram[b].load(std::memory_order_relaxed);
+            counted += out.histogram[b];
+        }
+        out.p50Us = percentileUs(out.histogram, counted, 0.50);
+        out.p99Us = percentileUs(out.histogram, counted, 0.99);
+        out.sinceResetSec = (sinceOriginNs(now) - m_resetNs.load(std::memory_order_relaxed)) / 1e9;
+
+        for (int s = 0; s < STAGE_COUNT; ++s) {
+            StageStats& st = out.stages[s];
+            st.calls = m_stageCalls[s].load(std::memory_order_relaxed);
+            st.totalUs = m_stageNs[s].load(std::memory_order_relaxed) / 1000.0;
+            st.meanUs = st.calls ? st.totalUs / (double)st.calls : 0.0;
+            st.maxUs = m_stageMaxNs[s].load(std::memory_order_relaxed) / 1000.0;
+        }
+    }
+
+private:
+    struct OpenBlock {
+        const CallbackProfiler* owner = nullptr;
+        Clock::time_point start;
+    };
+    static thread_local OpenBlock t_block;
+
+    struct WindowSlot {
+        std::atomic<uint64_t> second{0};
+        std::atomic<uint64_t> maxNs{0};
+        std::atomic<uint64_t> maxLoadPpm{0};
+    };
+
+    static void atomicMax(std::atomic<uint64_t>& target, uint64_t value) {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    static int bucketFor(uint64_t ns) {
+        if (ns < 1000) return 0;
+        const int b = 1 + (int)(2.0 * std::log2((double)ns / 1000.0));
+        return std::min(b, BUCKETS - 1);
+    }
+
+    // Sıralı p'inci bloğun bulunduğu kovanın üst sınırı (son kovada alt sınır)
+    static double percentileUs(const uint64_t* histogram, uint64_t total, double p) {
+        if (total == 0) return 0.0;
+        const uint64_t rank = (uint64_t)std::ceil(p * (double)total);
+        uint64_t seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += histogram[b];
+            if (seen >= rank) return b + 1 < BUCKETS ? bucketLowerUs(b + 1) : bucketLowerUs(b);
+        }
+        return bucketLowerUs(BUCKETS - 1);
+    }
+
+    int64_t sinceOriginNs(Clock::time_point t) const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t - m_origin).count();
+    }
+
+    const Clock::time_point m_origin;
+    std::atomic<bool> m_enabled{true};
+    std::atomic<bool> m_perStage{false};
+    std::atomic<float> m_thresholdPercent{80.0f};
+    std::atomic<int> m_windowSeconds{10};
+    std::atomic<int64_t> m_resetNs{0};
+
+    std::atomic<uint64_t> m_blocks{0};
+    std::atomic<uint64_t> m_frames{0};
+    std::atomic<uint64_t> m_totalNs{0};
+    std::atomic<uint64_t> m_budgetNs{0};
+    std::atomic<uint64_t> m_maxNs{0};
+    std::atomic<uint64_t> m_maxLoadPpm{0};
+    std::atomic<uint64_t> m_overThreshold{0};
+    std::atomic<uint64_t> m_deadlineMisses{0};
+    std::atomic<uint64_t> m_lastNs{0};
+    std::atomic<uint64_t> m_lastBudgetNs{0};
+    std::atomic<float> m_lastRate{0.0f};
+    std::atomic<uint64_t> m_histogram[BUCKETS];
+    std::atomic<uint64_t> m_stageCalls[STAGE_COUNT];
+    std::atomic<uint64_t> m_stageNs[STAGE_COUNT];
+    std::atomic<uint64_t> m_stageMaxNs[STAGE_COUNT];
+    WindowSlot m_window[WINDOW_SLOTS];
+};
+
+thread_local CallbackProfiler::OpenBlock CallbackProfiler::t_block;
+
+// ============================================
+// LOUDNESS / REPLAYGAIN ÖNBELLEĞİ
+// ============================================
+// Anahtar: yol + boyut + mtime (dosya değişince kayıt geçersiz olur). Disk
+// formatı satır başına bir kayıt, sekmeyle ayrılmış metin; yeni sonuçlar sona
+// eklenir, aynı yolun son satırı geçerlidir. Yüklemede tekrarlı satırlar
+// kayıt sayısını belirgin aşarsa dosya sıkıştırılarak yeniden yazılır.
+struct LoudnessCacheEntry {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    float trackLufs = LoudnessMeter::FLOOR_DB;
+    float trackPeak = 0.0f;        // lineer true-peak (4x)
+    float albumLufs = NAN;         // albüm olarak taranmadıysa NaN
+    float albumPeak = NAN;
+    float lra = 0.0f;
+    double duration = 0.0;
+
+    bool hasAlbum() const { return !std::isnan(albumLufs); }
+};
+
+static bool statFile(const std::string& path, uint64_t& size, int64_t& mtime) {
+#ifdef _WIN32
+    struct _stat64 st;
+    if (_stat64(path.c_str(), &st) != 0) return false;
+#else
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return false;
+#endif
+    size = (uint64_t)st.st_size;
+    mtime = (int64_t)st.st_mtime;
+    return true;
+}
+
+static std::string joinPath(const std::string& dir, const char* name) {
+    if (dir.empty()) return name;
+    const char last = dir.back();
+    return (last == '/' || last == '\\') ? dir + name : dir + "/" + name;
+}
+
+// Arka plan işçileri (tarama, analiz) çalma thread'leriyle yarışmasın
+static void lowerCurrentThreadPriority() {
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#elif defined(__linux__)
+    // Linux'ta nice değeri thread başınadır
+    if (nice(10) == -1) {
+        // Önemsiz: varsayılan öncelikle devam
+    }
+#endif
+}
+
+class LoudnessCache {
+public:
+    static constexpr const char* FILE_NAME = "loudness-cache.tsv";
+
+    // Dizin boşsa kayıtlar yalnızca bellekte tutulur
+    void setDirectory(const std::string& dir) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const std::string file = dir.empty() ? std::string() : joinPath(dir, FILE_NAME);
+        if (file == m_file) return;
+        m_file = file;
+        m_entries.clear();
+        m_loaded = false;
+    }
+
+    bool lookup(const std::string& path, LoudnessCacheEntry& out) {
+        uint64_t size = 0;
+        int64_t mtime = 0;
+        if (!statFile(path, size, mtime)) return false;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        loadLocked();
+        auto it = m_entries.find(path);
+        if (it == m_entries.end() || it->second.size != size || it->second.mtime != mtime) return false;
+        out = it->second;
+        return true;
+    }
+
+    void store(const std::string& path, const LoudnessCacheEntry& entry) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        loadLocked();
+        m_entries[path] = entry;
+        if (m_file.empty()) return;
+        FILE* f = fopen(m_file.c_str(), "ab");
+        if (!f) {
+            AURIVO_LOG_ERROR("[LOUDNESS CACHE] Yazılamadı: %s", m_file.c_str());
+            return;
+        }
+        writeLine(f, path, entry);
+        fclose(f);
+    }
+
+private:
+    void loadLocked() {
+        if (m_loaded) return;
+        m_loaded = true;
+        if (m_file.empty()) return;
+        FILE* f = fopen(m_file.c_str(), "rb");
+        if (!f) return;
+
+        size_t lines = 0;
+        char line[8192];
+        while (fgets(line, sizeof(line), f)) {
+            std::string path;
+            LoudnessCacheEntry entry;
+            if (parseLine(line, path, entry)) {
+                m_entries[path] = entry;
+                ++lines;
+            }
+        }
+        fclose(f);
+        AURIVO_LOG_INFO("[LOUDNESS CACHE] %zu kayıt yüklendi (%s)", m_entries.size(), m_file.c_str());
+        if (lines > m_entries.size() * 2 + 64) rewriteLocked();
+    }
+
+    void rewriteLocked() {
+        const std::string tmp = m_file + ".tmp";
+        FILE* f = fopen(tmp.c_str(), "wb");
+        if (!f) return;
+        for (const auto& kv : m_entries) writeLine(f, kv.first, kv.second);
+        fclose(f);
+        std::remove(m_file.c_str());
+        if (std::rename(tmp.c_str(), m_file.c_str()) != 0) {
+            AURIVO_LOG_ERROR("[LOUDNESS CACHE] Sıkıştırma başarısız: %s", m_file.c_str());
+        }
+    }
+
+    // 1 \t size \t mtime \t trackLufs \t trackPeak \t albumLufs \t albumPeak \t lra \t duration \t path
+    static void writeLine(FILE* f, const std::string& path, const LoudnessCacheEntry& e) {
+        char album[64] = "-\t-";
+        if (e.hasAlbum()) snprintf(album, sizeof(album), "%.2f\t%.6f", e.albumLufs, e.albumPeak);
+        fprintf(f, "1\t%llu\t%lld\t%.2f\t%.6f\t%s\t%.2f\t%.3f\t%s\n",
+                (unsigned long long)e.size, (long long)e.mtime, e.trackLufs, e.trackPeak,
+                album, e.lra, e.duration, path.c_str());
+    }
+
+    static bool parseLine(char* line, std::string& path, LoudnessCacheEntry& e) {
+        const char* fields[9];
+        char* p = line;
+        for (int i = 0; i < 9; ++i) {
+            char* tab = strchr(p, '\t');
+            if (!tab) return false;
+            *tab = '\0';
+            fields[i] = p;
+            p = tab + 1;
+        }
+        if (strcmp(fields[0], "1") != 0) return false;
+        size_t len = strlen(p);
+        while (len > 0 && (p[len - 1] == '\n' || p[len - 1] == '\r')) p[--len] = '\0';
+        if (len == 0) return false;
+
+        e.size = strtoull(fields[1], nullptr, 10);
+        e.mtime = strtoll(fields[2], nullptr, 10);
+        e.trackLufs = strtof(fields[3], nullptr);
+        e.trackPeak = strtof(fields[4], nullptr);
+        e.albumLufs = (fields[5][0] == '-' && fields[5][1] == '\0') ? NAN : strtof(fields[5], nullptr);
+        e.albumPeak = (fields[6][0] == '-' && fields[6][1] == '\0') ? NAN : strtof(fields[6], nullptr);
+        e.lra = strtof(fields[7], nullptr);
+        e.duration = strtod(fields[8], nullptr);
+        path.assign(p, len);
+        return true;
+    }
+
+    std::mutex m_mutex;
+    std::string m_file;
+    bool m_loaded = false;
+    std::unordered_map<std::string, LoudnessCacheEntry> m_entries;
+};
+
+// ============================================
+// KÜTÜPHANE LOUDNESS TARAYICISI (ReplayGain)
+// ============================================
+// Her işçi kendi decode stream'ini (BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT)
+// açar ve çalma yolundaki stereo düzenle (mono çoğaltılır, >2 kanalda ilk iki
+// kanal) LoudnessMeter + 4x true-peak dedektöründen geçirir; ölçüm duyulan
+// sinyalle aynıdır. İşçiler yalnızca atomik dosya indeksini ve dosya sonunda
+// önbellek kilidini paylaşır, verim çekirdek sayısıyla ölçeklenir. Albüm
+// modunda parçaların kapılı blok histogramları birleştirilir.
+class LoudnessScanner {
+public:
+    static constexpr int MAX_THREADS = 16;
+    static constexpr int BLOCK_FRAMES = 8192;
+
+    struct Options {
+        int threads = 0;        // 0 = çekirdek sayısı - 1
+        bool album = false;     // tüm liste tek albüm (önbellek okunmaz)
+        bool force = false;     // önbelleği yok say, yeniden tara
+    };
+
+    struct Result {
+        std::string path;
+        bool ok = false;
+        bool cached = false;
+        int error = BASS_OK;
+        LoudnessCacheEntry entry;
+        double seconds = 0.0;   // analiz süresi (duvar saati)
+    };
+
+    using ProgressFn = std::function<void(const Result&, size_t done, size_t total)>;
+    using DoneFn = std::function<void(std::vector<Result>&, bool cancelled)>;
+
+    explicit LoudnessScanner(LoudnessCache& cache) : m_cache(cache), m_running(false), m_cancel(false) {}
+    ~LoudnessScanner() { stop(); }
+
+    static int defaultThreads() {
+        const unsigned hw = std::thread::hardware_concurrency();
+        return (int)std::max(1u, hw > 1 ? hw - 1 : 1u);
+    }
+
+    bool start(std::vector<std::string> paths, const Options& options, ProgressFn onProgress, DoneFn onDone) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_running.load()) return false;
+        if (m_coordinator.joinable()) m_coordinator.join();   // önceki taramanın bitmiş thread'i
+        m_cancel = false;
+        m_running = true;
+        m_coordinator = std::thread(&LoudnessScanner::run, this, std::move(paths), options,
+                                    std::move(onProgress), std::move(onDone));
+        return true;
+    }
+
+    void cancel() { m_cancel.store(true); }
+    bool running() const { return m_running.load(); }
+
+    // İptal eder ve bitmesini bekler (BASS_Free'den önce)
+    void stop() {
+        cancel();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_coordinator.joinable()) m_coordinator.join();
+    }
+
+private:
+    using Histogram = LoudnessMeter::GatingHistogram;
+
+    void run(std::vector<std::string> paths, Options options, ProgressFn onProgress, DoneFn onDone) {
+        const auto started = std::chrono::steady_clock::now();
+        const size_t total = paths.size();
+        std::vector<Result> results(total);
+        std::vector<std::unique_ptr<Histogram>> albumBlocks(options.album ? total : 0);
+        std::atomic<size_t> next(0);
+        std::atomic<size_t> done(0);
+
+        auto worker = [&]() {
+            lowerCurrentThreadPriority();
+            std::unique_ptr<LoudnessMeter> meter(new LoudnessMeter());
+            std::vector<float> raw;
+            std::vector<float> stereo((size_t)BLOCK_FRAMES * 2);
+            for (;;) {
+                if (m_cancel.load()) break;
+                const size_t i = next.fetch_add(1);
+                if (i >= total) break;
+
+                Result& r = results[i];
+                r.path = paths[i];
+                if (!options.force && !options.album && m_cache.lookup(r.path, r.entry)) {
+                    r.ok = r.cached = true;
+                } else {
+                    analyze(r, *meter, raw, stereo, options.album ? &albumBlocks[i] : nullptr);
+                    if (r.ok) m_cache.store(r.path, r.entry);
+                }
+                const size_t n = done.fetch_add(1) + 1;
+                if (onProgress) onProgress(r, n, total);
+            }
+        };
+
+        const int threads = (int)std::min<size_t>(
+            std::max<size_t>(1, total),
+            (size_t)std::max(1, std::min(MAX_THREADS, options.threads > 0 ? options.threads : defaultThreads())));
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool) t.join();
+
+        const bool cancelled = m_cancel.load();
+        if (options.album && !cancelled) applyAlbum(results, albumBlocks);
+
+        // İptalde hiç işlenmeyen dosyalar sonuçta yer almaz
+        results.erase(std::remove_if(results.begin(), results.end(),
+                                     [](const Result& r) { return r.path.empty(); }),
+                      results.end());
+
+        double audioSeconds = 0.0;
+        for (const Result& r : results) {
+            if (r.ok && !r.cached) audioSeconds += r.entry.duration;
+        }
+        const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        AURIVO_LOG_INFO("[LOUDNESS SCAN] %zu/%zu dosya, %d thread, %.1f s (%.0fx gerçek zaman)%s",
+               results.size(), total, threads, wall, wall > 0.0 ? audioSeconds / wall : 0.0,
+               cancelled ? " - iptal edildi" : "");
+
+        m_running = false;
+        if (onDone) onDone(results, cancelled);
+    }
+
+    void analyze(Result& r, LoudnessMeter& meter, std::vector<float>& raw, std::vector<float>& stereo,
+                 std::unique_ptr<Histogram>* albumOut) {
+        const auto started = std::chrono::steady_clock::now();
+        HSTREAM stream = createDecodeStream(r.path);
+        if (!stream) {
+            r.error = BASS_ErrorGetCode();
+            return;
+        }
+        BASS_CHANNELINFO info;
+        if (!BASS_ChannelGetInfo(stream, &info) || info.freq == 0 || info.chans == 0) {
+            r.error = BASS_ErrorGetCode();
+            BASS_StreamFree(stream);
+            return;
+        }
+
+        const int chans = (int)info.chans;
+        const float rate = (float)info.freq;
+        raw.resize((size_t)BLOCK_FRAMES * chans);
+        meter.requestReset();
+        TruePeakDetector detector[2];
+        detector[0].configure(4);
+        detector[1].configure(4);
+
+        float peak = 0.0f;
+        uint64_t frames = 0;
+        while (!m_cancel.load(std::memory_order_relaxed)) {
+            const DWORD got = BASS_ChannelGetData(stream, raw.data(), (DWORD)(raw.size() * sizeof(float)) | BASS_DATA_FLOAT);
+            if (got == (DWORD)-1 || got == 0) break;
+            const int n = (int)(got / (sizeof(float) * chans));
+            for (int i = 0; i < n; ++i) {
+                const float l = raw[(size_t)i * chans];
+                const float rr = chans > 1 ? raw[(size_t)i * chans + 1] : l;
+                stereo[(size_t)i * 2] = l;
+                stereo[(size_t)i * 2 + 1] = rr;
+                peak = std::max(peak, std::max(detector[0].push(l), detector[1].push(rr)));
+            }
+            meter.process(rate, stereo.data(), n);
+            frames += (uint64_t)n;
+        }
+        BASS_StreamFree(stream);
+        if (m_cancel.load()) {
+            r.error = BASS_ERROR_ENDED;
+            return;
+        }
+        // Dedektör gecikmesindeki son örnekler
+        for (int i = 0; i < TruePeakDetector::TAPS; ++i) {
+            peak = std::max(peak, std::max(detector[0].push(0.0f), detector[1].push(0.0f)));
+        }
+
+        LoudnessMeter::Snapshot snap;
+        meter.read(snap);
+        r.entry.trackLufs = snap.values[LoudnessMeter::INTEGRATED];
+        r.entry.lra = snap.values[LoudnessMeter::LRA];
+        r.entry.trackPeak = peak;
+        r.entry.duration = (double)frames / rate;
+        statFile(r.path, r.entry.size, r.entry.mtime);
+        if (albumOut) albumOut->reset(new Histogram(meter.gatingBlocks()));
+        r.ok = true;
+        r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    }
+
+    void applyAlbum(std::vector<Result>& results, const std::vector<std::unique_ptr<Histogram>>& blocks) {
+        std::unique_ptr<Histogram> album(new Histogram());
+        float peak = 0.0f;
+        size_t tracks = 0;
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (!results[i].ok || !blocks[i]) continue;
+            album->merge(*blocks[i]);
+            peak = std::max(peak, results[i].entry.trackPeak);
+            ++tracks;
+        }
+        if (tracks == 0) return;
+        const float albumLufs = album->integrated();
+        for (Result& r : results) {
+            if (!r.ok) continue;
+            r.entry.albumLufs = albumLufs;
+            r.entry.albumPeak = peak;
+            m_cache.store(r.path, r.entry);
+        }
+        AURIVO_LOG_INFO("[LOUDNESS SCAN] Albüm: %zu parça, %.2f LUFS, tepe %.2f dBTP", tracks, albumLufs, linearTodB(peak));
+    }
+
+    LoudnessCache& m_cache;
+    std::mutex m_mutex;
+    std::thread m_coordinator;
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_cancel;
+};
+
+// ============================================
+// WAVEFORM PİRAMİDİ (seek bar önizlemesi)
+// ============================================
+// Parça bir kez arka planda decode edilir ve min/max/RMS piramidi kurulur:
+// seviye 0'da bin başına BASE_BIN_FRAMES frame, her üst seviyede bin boyu iki
+// katı (bin sayısı yarısı). Kanallar birleştirilir (min/max tüm kanallar,
+// RMS tüm örnekler). Piramit önbellek dizininde kompakt bir ikili dosyaya
+// yazılır; sonraki isteklerde dosya memory-map edilir ve her zoom seviyesi,
+// sütun başına 1-2 bin okuyan uygun seviyeden O(width) ile cevaplanır.
+// Ses dosyasına tekrar dokunulmaz. Dizin yoksa piramit yalnızca bellekte tutulur.
+class WaveformCache {
+public:
+    static constexpr uint32_t MAGIC = 0x59505741;      // "AWPY"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t BASE_BIN_FRAMES = 256;
+    static constexpr int MAX_LEVELS = 24;
+    static constexpr uint32_t MIN_TOP_BINS = 64;       // en kaba seviye
+    static constexpr size_t MAPPED_SLOTS = 8;          // açık tutulan piramitler
+    static constexpr int MAX_THREADS = 2;
+    static constexpr int BLOCK_FRAMES = 16384;
+
+    // Disk formatı: Header + seviyeler art arda (Bin dizileri)
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceSize;
+        int64_t sourceMtime;
+        uint32_t sampleRate;
+        uint32_t channels;
+        uint64_t totalFrames;
+        uint32_t baseBinFrames;
+        uint32_t levels;
+        uint64_t levelOffset[MAX_LEVELS];
+        uint32_t levelBins[MAX_LEVELS];
+    };
+
+    // Genlikler int16'ya ölçekli (±1.0 -> ±32767), RMS 0..65535
+    struct Bin {
+        int16_t min;
+        int16_t max;
+        uint16_t rms;
+    };
+    static_assert(sizeof(Bin) == 6, "WaveformCache::Bin paketli olmalı");
+
+    struct Overview {
+        uint32_t width = 0;
+        uint32_t sampleRate = 0;
+        uint32_t channels = 0;
+        double duration = 0.0;
+        double start = 0.0;             // saniye, istenen aralık
+        double end = 0.0;
+        int level = 0;
+        uint32_t binFrames = 0;
+        bool mapped = false;            // disk önbelleğinden (mmap)
+        std::vector<float> min, max, rms;
+    };
+
+    using DoneFn = std::function<void(bool ok, int error)>;
+
+    WaveformCache() : m_stop(false), m_useCounter(0) {}
+    ~WaveformCache() { stop(); }
+
+    WaveformCache(const WaveformCache&) = delete;
+    WaveformCache& operator=(const WaveformCache&) = delete;
+
+    void setDirectory(const std::string& dir) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_dir = dir;
+        m_pyramids.clear();
+    }
+
+    // Hazır piramitten (bellek/mmap) cevaplar; yoksa veya kaynak değiştiyse false
+    bool query(const std::string& path, uint32_t width, double startSec, double endSec, Overview& out) {
+        std::shared_ptr<Pyramid> p = findPyramid(path);
+        if (!p) return false;
+        p->render(width, startSec, endSec, out);
+        return true;
+    }
+
+    // Düşük öncelikli havuzda kurar; aynı dosya için bekleyen istekler birleşir.
+    // done, işçi thread'inde çağrılır.
+    void build(const std::string& path, DoneFn done) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stop) {
+            if (done) done(false, BASS_ERROR_INIT);
+            return;
+        }
+        auto it = m_pending.find(path);
+        if (it != m_pending.end()) {
+            it->second.push_back(std::move(done));
+            return;
+        }
+        m_pending[path].push_back(std::move(done));
+        m_jobs.push_back(path);
+        if (m_workers.size() < (size_t)MAX_THREADS && m_workers.size() < m_jobs.size() + m_busy) {
+            m_workers.emplace_back(&WaveformCache::workerLoop, this);
+        }
+        m_cv.notify_one();
+    }
+
+    // BASS_Free'den önce: bekleyen işler iptal, çalışan decode'lar bitirilir
+    void stop() {
+        std::vector<std::thread> workers;
+        std::unordered_map<std::string, std::vector<DoneFn>> pending;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+            m_jobs.clear();
+            workers.swap(m_workers);
+        }
+        m_cv.notify_all();
+        for (auto& t : workers) t.join();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            pending.swap(m_pending);
+            m_pyramids.clear();
+            m_stop = false;
+        }
+        for (auto& kv : pending) {
+            for (auto& fn : kv.second) if (fn) fn(false, BASS_ERROR_ENDED);
+        }
+    }
+
+private:
+    // Salt okunur piramit: mmap edilmiş dosya ya da bellekteki buffer
+    class Pyramid {
+    public:
+        ~Pyramid() {
+#ifdef _WIN32
+            if (m_view) UnmapViewOfFile(m_view);
+            if (m_mapping) CloseHandle(m_mapping);
+#else
+            if (m_view) munmap(m_view, m_bytes);
+#endif
+        }
+
+        static std::shared_ptr<Pyramid> fromMemory(std::vector<uint8_t> data) {
+            std::shared_ptr<Pyramid> p(new Pyramid());
+            p->m_memory = std::move(data);
+            p->m_base = p->m_memory.data();
+            p->m_bytes = p->m_memory.size();
+            return p->validate() ? p : nullptr;
+        }
+
+        static std::shared_ptr<Pyramid> fromFile(const std::string& file) {
+            std::shared_ptr<Pyramid> p(new Pyramid());
+#ifdef _WIN32
+            HANDLE h = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                                   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (h == INVALID_HANDLE_VALUE) return nullptr;
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(h, &size) || size.QuadPart < (LONGLONG)sizeof(Header)) {
+                CloseHandle(h);
+                return nullptr;
+            }
+            p->m_mapping = CreateFileMappingA(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(h);
+            if (!p->m_mapping) return nullptr;
+            p->m_view = MapViewOfFile(p->m_mapping, FILE_MAP_READ, 0, 0, 0);
+            if (!p->m_view) return nullptr;
+            p->m_bytes = (size_t)size.QuadPart;
+#else
+            int fd = ::open(file.c_str(), O_RDONLY);
+            if (fd < 0) return nullptr;
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Header)) {
+                ::close(fd);
+                return nullptr;
+            }
+            void* view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (view == MAP_FAILED) return nullptr;
+            p->m_view = view;
+            p->m_bytes = (size_t)st.st_size;
+#endif
+            p->m_base = static_cast<const uint8_t*>(p->m_view);
+            p->m_mapped = true;
+            return p->validate() ? p : nullptr;
+        }
+
+        const Header& header() const { return *reinterpret_cast<const Header*>(m_base); }
+
+        // Sütun başına bin boyu <= frame/sütun olan en kaba seviye: her sütun 1-3 bin okur
+        void render(uint32_t width, double startSec, double endSec, Overview& out) const {
+            const Header& h = header();
+            const double rate = (double)h.sampleRate;
+            const double duration = (double)h.totalFrames / rate;
+            startSec = std::max(0.0, std::min(startSec, duration));
+            endSec = (endSec <= 0.0) ? duration : std::max(startSec, std::min(endSec, duration));
+            width = std::max(1u, width);
+
+            const double first = startSec * rate;
+            const double span = std::max(1.0, (endSec - startSec) * rate);
+            const double framesPerColumn = span / width;
+
+            int level = 0;
+            while (level + 1 < (int)h.levels &&
+                   (double)((uint64_t)h.baseBinFrames << (level + 1)) <= framesPerColumn) {
+                ++level;
+            }
+            const uint64_t binFrames = (uint64_t)h.baseBinFrames << level;
+            const uint32_t bins = h.levelBins[level];
+            const Bin* data = reinterpret_cast<const Bin*>(m_base + h.levelOffset[level]);
+
+            out.width = width;
+            out.sampleRate = h.sampleRate;
+            out.channels = h.channels;
+            out.duration = duration;
+            out.start = startSec;
+            out.end = endSec;
+            out.level = level;
+            out.binFrames = (uint32_t)binFrames;
+            out.mapped = m_mapped;
+            out.min.assign(width, 0.0f);
+            out.max.assign(width, 0.0f);
+            out.rms.assign(width, 0.0f);
+            if (bins == 0) return;
+
+            for (uint32_t x = 0; x < width; ++x) {
+                const double a = first + framesPerColumn * x;
+                const double b = a + framesPerColumn;
+                uint32_t i0 = (uint32_t)std::min<double>(bins - 1, std::floor(a / (double)binFrames));
+                uint32_t i1 = (uint32_t)std::min<double>(bins, std::ceil(b / (double)binFrames));
+                if (i1 <= i0) i1 = i0 + 1;
+
+                int lo = 32767;
+                int hi = -32768;
+                double sq = 0.0;
+                for (uint32_t i = i0; i < i1; ++i) {
+                    lo = std::min(lo, (int)data[i].min);
+                    hi = std::max(hi, (int)data[i].max);
+                    const double r = data[i].rms / 65535.0;
+                    sq += r * r;
+                }
+                out.min[x] = lo / 32767.0f;
+                out.max[x] = hi / 32767.0f;
+                out.rms[x] = (float)std::sqrt(sq / (i1 - i0));
+            }
+        }
+
+    private:
+        Pyramid() = default;
+
+        bool validate() const {
+            if (m_bytes < sizeof(Header)) return false;
+            const Header& h = header();
+            if (h.magic != MAGIC || h.version != VERSION || h.sampleRate == 0 ||
+                h.levels == 0 || h.levels > (uint32_t)MAX_LEVELS || h.baseBinFrames == 0) {
+                return false;
+            }
+            for (uint32_t l = 0; l < h.levels; ++l) {
+                if (h.levelOffset[l] + (uint64_t)h.levelBins[l] * sizeof(Bin) > m_bytes) return false;
+            }
+            return true;
+        }
+
+        std::vector<uint8_t> m_memory;
+        const uint8_t* m_base = nullptr;
+        size_t m_bytes = 0;
+        bool m_mapped = false;
+        void* m_view = nullptr;
+#ifdef _WIN32
+        HANDLE m_mapping = nullptr;
+#endif
+    };
+
+    struct Slot {
+        std::shared_ptr<Pyramid> pyramid;
+        uint64_t lastUse;
+    };
+
+    // FNV-1a: yol -> önbellek dosya adı
+    static std::string cacheFileName(const std::string& path) {
+        uint64_t h = 1469598103934665603ull;
+        for (unsigned char c : path) {
+            h ^= c;
+            h *= 1099511628211ull;
+        }
+        char name[40];
+        snprintf(name, sizeof(name), "waveform-%016llx.awp", (unsigned long long)h);
+        return name;
+    }
+
+    std::shared_ptr<Pyramid> findPyramid(const std::string& path) {
+        uint64_t size = 0;
+        int64_t mtime = 0;
+        if (!statFile(path, size, mtime)) return nullptr;
+
+        std::string file;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_pyramids.find(path);
+            if (it != m_pyramids.end()) {
+                const Header& h = it->second.pyramid->header();
+                if (h.sourceSize == size && h.sourceMtime == mtime) {
+                    it->second.lastUse = ++m_useCounter;
+                    return it->second.pyramid;
+                }
+                m_pyramids.erase(it);
+            }
+            if (m_dir.empty()) return nullptr;
+            file = joinPath(m_dir, cacheFileName(path).c_str());
+        }
+
+        std::shared_ptr<Pyramid> p = Pyramid::fromFile(file);
+        if (!p) return nullptr;
+        const Header& h = p->header();
+        if (h.sourceSize != size || h.sourceMtime != mtime) return nullptr;
+        remember(path, p);
+        return p;
+    }
+
+    void remember(const std::string& path, std::shared_ptr<Pyramid> p) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pyramids.size() >= MAPPED_SLOTS && m_pyramids.find(path) == m_pyramids.end()) {
+            auto oldest = m_pyramids.begin();
+            for (auto it = m_pyramids.begin(); it != m_pyramids.end(); ++it) {
+                if (it->second.lastUse < oldest->second.lastUse) oldest = it;
+            }
+            m_pyramids.erase(oldest);
+        }
+        m_pyramids[path] = Slot{ std::move(p), ++m_useCounter };
+    }
+
+    void workerLoop() {
+        lowerCurrentThreadPriority();
+        for (;;) {
+            std::string path;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+                if (m_stop) return;
+                path = std::move(m_jobs.front());
+                m_jobs.pop_front();
+                ++m_busy;
+            }
+
+            int error = BASS_OK;
+            const bool ok = findPyramid(path) != nullptr || buildPyramid(path, error);
+
+            std::vector<DoneFn> waiters;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_busy;
+                auto it = m_pending.find(path);
+                if (it != m_pending.end()) {
+                    waiters.swap(it->second);
+                    m_pending.erase(it);
+                }
+            }
+            for (auto& fn : waiters) if (fn) fn(ok, error);
+        }
+    }
+
+    bool buildPyramid(const std::string& path, int& error) {
+        const auto started = std::chrono::steady_clock::now();
+        HSTREAM stream = createDecodeStream(path);
+        if (!stream) {
+            error = BASS_ErrorGetCode();
+            return false;
+        }
+        BASS_CHANNELINFO info;
+        if (!BASS_ChannelGetInfo(stream, &info) || info.freq == 0 || info.chans == 0) {
+            error = BASS_ErrorGetCode();
+            BASS_StreamFree(stream);
+            return false;
+        }
+
+        // Seviye 0: BASE_BIN_FRAMES frame'lik binler
+        const int chans = (int)info.chans;
+        std::vector<float> raw((size_t)BLOCK_FRAMES * chans);
+        std::vector<Bin> base;
+        const QWORD lengthBytes = BASS_ChannelGetLength(stream, BASS_POS_BYTE);
+        if (lengthBytes != (QWORD)-1) {
+            base.reserve((size_t)(lengthBytes / (sizeof(float) * chans) / BASE_BIN_FRAMES) + 1);
+        }
+
+        uint64_t totalFrames = 0;
+        uint32_t binFill = 0;
+        float lo = 0.0f, hi = 0.0f;
+        double sq = 0.0;
+        bool stopped = false;
+        auto flushBin = [&]() {
+            const double rms = std::sqrt(sq / ((double)binFill * chans));
+            base.push_back(Bin{ toInt16(lo), toInt16(hi), (uint16_t)std::lround(std::min(1.0, rms) * 65535.0) });
+            binFill = 0;
+            lo = hi = 0.0f;
+            sq = 0.0;
+        };
+
+        for (;;) {
+            if (m_stop.load(std::memory_order_relaxed)) {
+                stopped = true;
+                break;
+            }
+            const DWORD got = BASS_ChannelGetData(stream, raw.data(), (DWORD)(raw.size() * sizeof(float)) | BASS_DATA_FLOAT);
+            if (got == (DWORD)-1 || got == 0) break;
+            const int n = (int)(got / (sizeof(float) * chans));
+            const float* s = raw.data();
+            for (int i = 0; i < n; ++i, s += chans) {
+                if (binFill == 0) lo = hi = s[0];
+                for (int c = 0; c < chans; ++c) {
+                    lo = std::min(lo, s[c]);
+                    hi = std::max(hi, s[c]);
+                    sq += (double)s[c] * s[c];
+                }
+                if (++binFill == BASE_BIN_FRAMES) flushBin();
+            }
+            totalFrames += (uint64_t)n;
+        }
+        BASS_StreamFree(stream);
+        if (stopped) {
+            error = BASS_ERROR_ENDED;
+            return false;
+        }
+        if (binFill > 0) flushBin();
+
+        // Üst seviyeler: komşu bin çiftleri birleşir (tek kalan son bin kendisiyle)
+        std::vector<std::vector<Bin>> levels;
+        levels.push_back(std::move(base));
+        while ((int)levels.size() < MAX_LEVELS && levels.back().size() > MIN_TOP_BINS) {
+            const std::vector<Bin>& below = levels.back();
+            std::vector<Bin> up((below.size() + 1) / 2);
+            for (size_t i = 0; i < up.size(); ++i) {
+                const Bin& a = below[i * 2];
+                const Bin& b = (i * 2 + 1 < below.size()) ? below[i * 2 + 1] : a;
+                const double ra = a.rms / 65535.0;
+                const double rb = b.rms / 65535.0;
+                up[i].min = std::min(a.min, b.min);
+                up[i].max = std::max(a.max, b.max);
+                up[i].rms = (uint16_t)std::lround(std::sqrt((ra * ra + rb * rb) * 0.5) * 65535.0);
+            }
+            levels.push_back(std::move(up));
+        }
+
+        std::vector<uint8_t> data(sizeof(Header));
+        Header h;
+        std::memset(&h, 0, sizeof(h));
+        h.magic = MAGIC;
+        h.version = VERSION;
+        statFile(path, h.sourceSize, h.sourceMtime);
+        h.sampleRate = info.freq;
+        h.channels = info.chans;
+        h.totalFrames = totalFrames;
+        h.baseBinFrames = BASE_BIN_FRAMES;
+        h.levels = (uint32_t)levels.size();
+        for (size_t l = 0; l < levels.size(); ++l) {
+            h.levelOffset[l] = data.size();
+            h.levelBins[l] = (uint32_t)levels[l].size();
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(levels[l].data());
+            data.insert(data.end(), bytes, bytes + levels[l].size() * sizeof(Bin));
+        }
+        std::memcpy(data.data(), &h, sizeof(h));
+
+        const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        const double seconds = (double)totalFrames / info.freq;
+        AURIVO_LOG_INFO("[WAVEFORM] %s: %u seviye, %.1f KB, %.2f s (%.0fx gerçek zaman)",
+               path.c_str(), h.levels, data.size() / 1024.0, wall, wall > 0.0 ? seconds / wall : 0.0);
+
+        // Dosyaya yazılabildiyse mmap ile, yazılamadıysa bellekten sunulur
+        std::string dir;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            dir = m_dir;
+        }
+        if (!dir.empty()) {
+            const std::string file = joinPath(dir, cacheFileName(path).c_str());
+            if (writeFileAtomic(file, data)) {
+                std::shared_ptr<Pyramid> mapped = Pyramid::fromFile(file);
+                if (mapped) {
+                    remember(path, mapped);
+                    return true;
+                }
+            } else {
+                AURIVO_LOG_ERROR("[WAVEFORM] Önbellek yazılamadı: %s", file.c_str());
+            }
+        }
+        std::shared_ptr<Pyramid> memory = Pyramid::fromMemory(std::move(data));
+        if (!memory) {
+            error = BASS_ERROR_UNKNOWN;
+            return false;
+        }
+        remember(path, memory);
+        return true;
+    }
+
+    static int16_t toInt16(float v) {
+        return (int16_t)std::lround(clampf(v, -1.0f, 1.0f) * 32767.0f);
+    }
+
+    static bool writeFileAtomic(const std::string& file, const std::vector<uint8_t>& data) {
+        const std::string tmp = file + ".tmp";
+        FILE* f = fopen(tmp.c_str(), "wb");
+        if (!f) return false;
+        const bool written = fwrite(data.data(), 1, data.size(), f) == data.size();
+        fclose(f);
+        if (!written) {
+            std::remove(tmp.c_str());
+            return false;
+        }
+        std::remove(file.c_str());
+        return std::rename(tmp.c_str(), file.c_str()) == 0;
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::string m_dir;
+    std::deque<std::string> m_jobs;
+    std::unordered_map<std::string, std::vector<DoneFn>> m_pending;
+    std::unordered_map<std::string, Slot> m_pyramids;
+    std::vector<std::thread> m_workers;
+    std::atomic<bool> m_stop;
+    size_t m_busy = 0;
+    uint64_t m_useCounter;
+};
+
+// ============================================
+// PARÇA ZİNCİRİ (decode stream + FX + MasterDSP)
+// ============================================
+
+class AurivoAudioEngine;
+
+// Bir parçanın decode-mode tempo stream'i, FX'leri ve kendi MasterDSP örneği.
+// dspCallback zinciri user pointer olarak alır. Mikser'e verildikten sonra
+// sahibi mikserdir; kaynak bitince/sönünce reclaimer thread'i serbest bırakır.
+struct TrackChain {
+    AurivoAudioEngine* engine = nullptr;
+    HSTREAM stream = 0;
+    HSTREAM analysisStream = 0;
+    void* dsp = nullptr;
+    HDSP dspHandle = 0;
+    HFX preampFx = 0;
+    HFX reverbFx = 0;
+    ColorFx color;                           // tape saturation + bit/dither (zincir modu)
+    TruePeakLimiter limiter;
+    MasterDspState dspState;                 // dsp'ye uygulanan parametreler (zincirin callback'i)
+    DWORD freq = 0;
+    DWORD chans = 2;
+    std::string path;
+    std::atomic<float> replayGain{1.0f};     // önbellekteki track/album kazancı (lineer)
+    std::vector<float> preroll;              // preload'da decode edilen ilk blok (kaynak kanal düzeni)
+    std::atomic<uint32_t> prerollPos{0};     // tüketilen float sayısı (mikser ilerletir)
+
+    uint32_t prerollFramesLeft() const {
+        const uint32_t pos = prerollPos.load(std::memory_order_relaxed);
+        const uint32_t total = (uint32_t)preroll.size();
+        return (pos < total && chans > 0) ? (total - pos) / chans : 0;
+    }
+};
+
+static void freeTrackChain(TrackChain* chain) {
+    if (!chain) return;
+    // FX/DSP handle'ları stream ile birlikte gider; MasterDSP stream'den sonra
+    if (chain->stream) BASS_StreamFree(chain->stream);
+    if (chain->analysisStream) BASS_StreamFree(chain->analysisStream);
+    if (chain->dsp) destroy_dsp(chain->dsp);
+    delete chain;
+}
+
+// ============================================
+// POLYPHASE RESAMPLER
+// ============================================
+// Kaiser pencereli sinc, PHASES faz x TAPS katsayı; fazlar arası lineer
+// interpolasyon. Mikser, çıkış hızından farklı hızdaki kaynaklar için kullanır
+// (ör. 44.1 kHz parça, 48 kHz cihaz). Kesim frekansı düşürmede (in > out)
+// çıkış Nyquist'ine iner, aliasing olmaz. Tablo configure()'da kurulur; oran
+// değişmedikçe yeniden hesaplanmaz. Tüm bellek nesnenin içinde, audio thread
+// ayırma yapmaz. İç çarpım SSE ile (yoksa derleyicinin vektörleştirdiği döngü).
+class PolyphaseResampler {
+public:
+    static constexpr int TAPS = 32;
+    static constexpr int PHASES = 128;
+
+    PolyphaseResampler() : m_inRate(0), m_outRate(0), m_step(1.0), m_pos(0.0), m_write(0), m_tail(0), m_fed(false) {}
+
+    void configure(uint32_t inRate, uint32_t outRate) {
+        if (!inRate || !outRate) inRate = outRate = 1;
+        if (inRate != m_inRate || outRate != m_outRate) {
+            m_inRate = inRate;
+            m_outRate = outRate;
+            m_step = (double)inRate / (double)outRate;
+            buildTable(std::min(1.0, 1.0 / m_step) * 0.96);
+        }
+        reset();
+    }
+
+    void reset() {
+        std::fill(m_histL, m_histL + TAPS * 2, 0.0f);
+        std::fill(m_histR, m_histR + TAPS * 2, 0.0f);
+        m_write = 0;
+        // Okuma noktası pencerenin ortasında (TAPS/2 - 1): ilk çıkış ilk giriş
+        // örneğine denk gelsin diye önce TAPS/2 + 1 örnek itilir
+        m_pos = (double)(TAPS / 2 + 1);
+        m_tail = TAPS / 2;
+        m_fed = false;
+    }
+
+    bool active() const { return m_inRate != m_outRate; }
+
+    // next(float* lr) -> bool: bir stereo giriş frame'i verir, bitince false.
+    // Giriş bitince pencerede kalan örnekler sıfırla itilerek boşaltılır.
+    template <typename NextFrame>
+    int process(float* dst, int frames, NextFrame&& next) {
+        int produced = 0;
+        while (produced < frames) {
+            while (m_pos >= 1.0) {
+                float f[2];
+                if (!next(f)) {
+                    if (!m_fed || m_tail <= 0) return produced;
+                    f[0] = f[1] = 0.0f;
+                    --m_tail;
+                } else {
+                    m_fed = true;
+                }
+                push(f[0], f[1]);
+                m_pos -= 1.0;
+            }
+            const float* hL = m_histL + m_write;
+            const float* hR = m_histR + m_write;
+            const double fp = m_pos * PHASES;
+            const int ph = std::min(PHASES - 1, (int)fp);
+            const float frac = (float)(fp - ph);
+            const float* c0 = m_table + (size_t)ph * TAPS;
+            const float* c1 = c0 + TAPS;
+            dot2(hL, hR, c0, c1, frac, dst + produced * 2);
+            ++produced;
+            m_pos += m_step;
+        }
+        return produced;
+    }
+
+private:
+    void push(float l, float r) {
+        // Çift yazma: pencere her zaman bitişik [m_write, m_write + TAPS)
+        m_histL[m_write] = m_histL[m_write + TAPS] = l;
+        m_histR[m_write] = m_histR[m_write + TAPS] = r;
+        m_write = (m_write + 1) % TAPS;
+    }
+
+    static double besselI0(double x) {
+        double sum = 1.0;
+        double term = 1.0;
+        const double q = x * x * 0.25;
+        for (int k = 1; k < 32; ++k) {
+            term *= q / ((double)k * (double)k);
+            sum += term;
+            if (term < sum * 1e-12) break;
+        }
+        return sum;
+    }
+
+    // m_table[p][k]: kesirli gecikme p / PHASES için katsayılar (DC kazancı 1)
+    void buildTable(double cutoff) {
+        const double beta = 8.6;
+        const double i0Beta = besselI0(beta);
+        const double half = TAPS / 2.0;
+        for (int p = 0; p <= PHASES; ++p) {
+            const double frac = (double)p / PHASES;
+            double sum = 0.0;
+            float* row = m_table + (size_t)p * TAPS;
+            for (int k = 0; k < TAPS; ++k) {
+                const double x = (double)k - (half - 1.0) - frac;
+                const double arg = M_PI * cutoff * x;
+                const double sinc = (std::fabs(x) < 1e-9) ? 1.0 : std::sin(arg) / arg;
+                const double r = x / half;
+                const double w = (std::fabs(r) >= 1.0) ? 0.0 : besselI0(beta * std::sqrt(1.0 - r * r)) / i0Beta;
+                row[k] = (float)(cutoff * sinc * w);
+                sum += row[k];
+            }
+            if (sum > 1e-9) {
+                for (int k = 0; k < TAPS; ++k) row[k] = (float)(row[k] / sum);
+            }
+        }
+    }
+
+    static void dot2(const float* hL, const float* hR, const float* c0, const float* c1, float frac, float* out) {
+#if AURIVO_HAS_SSE
+        const __m128 vf = _mm_set1_ps(frac);
+        __m128 accL = _mm_setzero_ps();
+        __m128 accR = _mm_setzero_ps();
+        for (int k = 0; k < TAPS; k += 4) {
+            const __m128 a = _mm_loadu_ps(c0 + k);
+            const __m128 c = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(c1 + k), a), vf));
+            accL = _mm_add_ps(accL, _mm_mul_ps(_mm_loadu_ps(hL + k), c));
+            accR = _mm_add_ps(accR, _mm_mul_ps(_mm_loadu_ps(hR + k), c));
+        }
+        alignas(16) float l[4];
+        alignas(16) float r[4];
+        _mm_store_ps(l, accL);
+        _mm_store_ps(r, accR);
+        out[0] = (l[0] + l[1]) + (l[2] + l[3]);
+        out[1] = (r[0] + r[1]) + (r[2] + r[3]);
+#else
+        float accL = 0.0f;
+        float accR = 0.0f;
+        for (int k = 0; k < TAPS; ++k) {
+            const float c = c0[k] + (c1[k] - c0[k]) * frac;
+            accL += hL[k] * c;
+            accR += hR[k] * c;
+        }
+        out[0] = accL;
+        out[1] = accR;
+#endif
+    }
+
+    uint32_t m_inRate;
+    uint32_t m_outRate;
+    double m_step;
+    double m_pos;       // pencere[TAPS/2 - 1]'den itibaren kesirli okuma konumu (>= 1: yeni giriş gerekir)
+    int m_write;
+    int m_tail;
+    bool m_fed;
+    float m_histL[TAPS * 2];
+    float m_histR[TAPS * 2];
+    float m_table[(PHASES + 1) * TAPS];
+};
+
+// ============================================
+// GERÇEK FFT (radix-2, konvolüsyon reverb için)
+// ============================================
+// N gerçek örnek -> N/2 + 1 karmaşık bin (re/im ayrı diziler). N/2 noktalı
+// karmaşık FFT + ayrıştırma adımı. Tablolar init()'te kurulur; forward/inverse
+// ayırma yapmaz. Çalışma buffer'ı nesnenin içinde olduğu için her thread kendi
+// örneğini kullanır. inverse ölçeksizdir: inverse(forward(x)) = N/2 * x.
+class RealFft {
+public:
+    RealFft() : m_n(0), m_half(0) {}
+
+    void init(int n) {
+        m_n = n;
+        m_half = n / 2;
+        int bits = 0;
+        while ((1 << bits) < m_half) ++bits;
+        m_bitrev.assign(m_half, 0);
+        for (int i = 0; i < m_half; ++i) {
+            int r = 0;
+            for (int b = 0; b < bits; ++b) {
+                if (i & (1 << b)) r |= 1 << (bits - 1 - b);
+            }
+            m_bitrev[i] = r;
+        }
+        // Karmaşık FFT twiddle'ları: exp(-2πik / (N/2))
+        m_cos.assign(std::max(1, m_half / 2), 1.0f);
+        m_sin.assign(std::max(1, m_half / 2), 0.0f);
+        for (int k = 0; k < m_half / 2; ++k) {
+            const double a = 2.0 * M_PI * k / m_half;
+            m_cos[k] = (float)std::cos(a);
+            m_sin[k] = (float)-std::sin(a);
+        }
+        // Ayrıştırma twiddle'ları: exp(-2πik / N)
+        m_splitCos.assign(m_half + 1, 1.0f);
+        m_splitSin.assign(m_half + 1, 0.0f);
+        for (int k = 0; k <= m_half; ++k) {
+            const double a = 2.0 * M_PI * k / m_n;
+            m_splitCos[k] = (float)std::cos(a);
+            m_splitSin[k] = (float)-std::sin(a);
+        }
+        m_workRe.assign(m_half, 0.0f);
+        m_workIm.assign(m_half, 0.0f);
+    }
+
+    int size() const { return m_n; }
+    int bins() const { return m_half + 1; }
+
+    void forward(const float* in, float* re, float* im) {
+        // Çift/tek örnekler tek karmaşık dizide: z[k] = x[2k] + i x[2k+1]
+        for (int k = 0; k < m_half; ++k) {
+            const int r = m_bitrev[k];
+            m_workRe[r] = in[2 * k];
+            m_workIm[r] = in[2 * k + 1];
+        }
+        transform(false);
+
+        re[0] = m_workRe[0] + m_workIm[0];
+        im[0] = 0.0f;
+        re[m_half] = m_workRe[0] - m_workIm[0];
+        im[m_half] = 0.0f;
+        for (int k = 1; k < m_half; ++k) {
+            const float zr = m_workRe[k];
+            const float zi = m_workIm[k];
+            const float cr = m_workRe[m_half - k];
+            const float ci = -m_workIm[m_half - k];
+            // Çift kısım E = (Z + Z*)/2, tek kısım O = (Z - Z*)/2i
+            const float er = 0.5f * (zr + cr);
+            const float ei = 0.5f * (zi + ci);
+            const float orr = 0.5f * (zi - ci);
+            const float oi = -0.5f * (zr - cr);
+            const float wr = m_splitCos[k];
+            const float wi = m_splitSin[k];
+            re[k] = er + (orr * wr - oi * wi);
+            im[k] = ei + (orr * wi + oi * wr);
+        }
+    }
+
+    void inverse(const float* re, const float* im, float* out) {
+        for (int k = 0; k < m_half; ++k) {
+            const float xr = re[k];
+            const float xi = im[k];
+            const float cr = re[m_half - k];
+            const float ci = -im[m_half - k];
+            const float er = 0.5f * (xr + cr);
+            const float ei = 0.5f * (xi + ci);
+            const float dr = 0.5f * (xr - cr);
+            const float di = 0.5f * (xi - ci);
+            // O = D * exp(+2πik / N)
+            const float wr = m_splitCos[k];
+            const float wi = -m_splitSin[k];
+            const float orr = dr * wr - di * wi;
+            const float oi = dr * wi + di * wr;
+            const int r = m_bitrev[k];
+            m_workRe[r] = er - oi;
+            m_workIm[r] = ei + orr;
+        }
+        transform(true);
+        for (int k = 0; k < m_half; ++k) {
+            out[2 * k] = m_workRe[k];
+            out[2 * k + 1] = m_workIm[k];
+        }
+    }
+
+private:
+    // Bit-ters sıralı girişte yerinde iteratif radix-2 (DIT)
+    void transform(bool inverse) {
+        float* wrk = m_workRe.data();
+        float* wik = m_workIm.data();
+        for (int len = 2; len <= m_half; len <<= 1) {
+            const int half = len / 2;
+            const int step = m_half / len;
+            for (int i = 0; i < m_half; i += len) {
+                for (int j = 0; j < half; ++j) {
+                    const float wr = m_cos[j * step];
+                    const float wi = inverse ? -m_sin[j * step] : m_sin[j * step];
+                    const int a = i + j;
+                    const int b = a + half;
+                    const float tr = wrk[b] * wr - wik[b] * wi;
+                    const float ti = wrk[b] * wi + wik[b] * wr;
+                    wrk[b] = wrk[a] - tr;
+                    wik[b] = wik[a] - ti;
+                    wrk[a] += tr;
+                    wik[a] += ti;
+                }
+            }
+        }
+    }
+
+    int m_n;
+    int m_half;
+    std::vector<int> m_bitrev;
+    std::vector<float> m_cos;
+    std::vector<float> m_sin;
+    std::vector<float> m_splitCos;
+    std::vector<float> m_splitSin;
+    std::vector<float> m_workRe;
+    std::vector<float> m_workIm;
+};
+
+// acc += a * b (karmaşık, re/im ayrı diziler)
+static inline void complexMultiplyAdd(const float* ar, const float* ai, const float* br, const float* bi,
+                                      float* accR, float* accI, int n) {
+    int k = 0;
+#if AURIVO_HAS_SSE
+    for (; k + 4 <= n; k += 4) {
+        const __m128 xr = _mm_loadu_ps(ar + k);
+        const __m128 xi = _mm_loadu_ps(ai + k);
+        const __m128 hr = _mm_loadu_ps(br + k);
+        const __m128 hi = _mm_loadu_ps(bi + k);
+        const __m128 yr = _mm_sub_ps(_mm_mul_ps(xr, hr), _mm_mul_ps(xi, hi));
+        const __m128 yi = _mm_add_ps(_mm_mul_ps(xr, hi), _mm_mul_ps(xi, hr));
+        _mm_storeu_ps(accR + k, _mm_add_ps(_mm_loadu_ps(accR + k), yr));
+        _mm_storeu_ps(accI + k, _mm_add_ps(_mm_loadu_ps(accI + k), yi));
+    }
+#endif
+    for (; k < n; ++k) {
+        accR[k] += ar[k] * br[k] - ai[k] * bi[k];
+        accI[k] += ar[k] * bi[k] + ai[k] * br[k];
+    }
+}
+
+// ============================================
+// KONVOLÜSYON REVERB (bölümlenmiş FFT)
+// ============================================
+// IR iki bölgeye ayrılır:
+//  - Ön kısım [0, HEAD_LENGTH): HEAD_BLOCK'luk eşit bölümler, uniform
+//    partitioned overlap-save. Audio thread'de, her HEAD_BLOCK örnekte bir
+//    küçük FFT + frekans-domeni gecikme hattı (FDL) çarpımı.
+//  - Kuyruk [HEAD_LENGTH, son): TAIL_BLOCK'luk büyük bölümler. Audio thread
+//    her TAIL_BLOCK girişte bir iş yayınlar; worker thread hesaplar. İşin
+//    sonucu TAIL_LAG blok sonra gerektiği için worker'ın en az
+//    (TAIL_LAG - 1) * TAIL_BLOCK örneklik süresi vardır; 5-10 sn'lik IR'lerde
+//    callback'in maliyeti yalnızca ön kısım kadardır. Audio thread worker'ı
+//    hiç beklemez: sonuç zamanında hazır değilse o bloğun kuyruk katkısı
+//    atlanır (tailMisses).
+// Islak yol HEAD_BLOCK örnek gecikir (kuru yol gecikmez); pre-delay bu kadarını
+// IR'den düşerek telafi eder. Kernel (spektrumlar + işleme durumu) arka planda
+// kurulur, audio thread worker boştayken devralır; eskisini worker siler.
+class ConvolutionReverb {
+public:
+    static constexpr int HEAD_BLOCK = 256;
+    static constexpr int HEAD_FFT = HEAD_BLOCK * 2;
+    static constexpr int HEAD_BINS = HEAD_BLOCK + 1;
+    static constexpr int TAIL_BLOCK = 4096;
+    static constexpr int TAIL_FFT = TAIL_BLOCK * 2;
+    static constexpr int TAIL_BINS = TAIL_BLOCK + 1;
+    static constexpr int TAIL_LAG = 4;                          // kuyruk IR'de TAIL_LAG blok sonra başlar
+    static constexpr int HEAD_LENGTH = TAIL_LAG * TAIL_BLOCK;
+    static constexpr int SLOTS = 8;                             // audio <-> worker iş slotları
+    static constexpr float MAX_IR_SECONDS = 10.0f;
+
+    struct Kernel {
+        uint32_t rate = 0;
+        uint32_t irFrames = 0;
+        int headParts = 0;
+        int tailParts = 0;
+        // IR spektrumları [kanal][bölüm * bins], 1/(N/2) ölçekli
+        std::vector<float> headRe[2], headIm[2];
+        std::vector<float> tailRe[2], tailIm[2];
+        std::vector<uint8_t> headLive, tailLive;     // tamamen sessiz bölümler atlanır
+        // Ön kısım durumu (audio thread)
+        std::vector<float> headFdlRe[2], headFdlIm[2];
+        std::vector<float> headIn[2];                // [önceki blok | mevcut blok]
+        std::vector<float> headOut[2];
+        int headFdlPos = 0;
+        // Kuyruk durumu (worker; audio thread yalnızca worker boştayken sıfırlar)
+        std::vector<float> tailFdlRe[2], tailFdlIm[2];
+        std::vector<float> tailIn[2];
+        int tailFdlPos = 0;
+        std::vector<float> jobIn[2], jobOut[2];      // SLOTS * TAIL_BLOCK
+    };
+
+    struct Info {
+        bool loaded = false;
+        uint32_t rate = 0;
+        uint32_t irFrames = 0;
+        int headParts = 0;
+        int tailParts = 0;
+        uint64_t tailMisses = 0;
+        uint64_t resyncs = 0;
+    };
+
+    ConvolutionReverb()
+        : m_active(nullptr), m_pending(nullptr), m_posted(0), m_done(0),
+          m_enabled(false), m_wet(0.3f), m_dry(1.0f),
+          m_tailMisses(0), m_resyncs(0), m_infoRate(0), m_infoFrames(0), m_infoHeadParts(0), m_infoTailParts(0),
+          m_headPos(0), m_tailFill(0), m_fillJob(0), m_jobBase(0), m_tailStalled(false),
+          m_stop(false), m_running(false), m_inline(false) {
+        m_headFft.init(HEAD_FFT);
+        m_tailFft.init(TAIL_FFT);
+    }
+
+    ~ConvolutionReverb() { stop(); }
+
+    ConvolutionReverb(const ConvolutionReverb&) = delete;
+    ConvolutionReverb& operator=(const ConvolutionReverb&) = delete;
+
+    void start() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_running) return;
+        m_stop = false;
+        m_running = true;
+        m_worker = std::thread(&ConvolutionReverb::run, this);
+    }
+
+    // Offline render: worker thread başlatılmaz, kuyruk işleri process() içinde
+    // hesaplanır. Gerçek zaman sınırı olmadığından hiçbir kuyruk katkısı atlanmaz.
+    void runInline() { m_inline = true; }
+
+    // Audio callback'leri durduktan sonra (BASS_Free) çağrılmalı. Worker hiç
+    // başlamadıysa (inline) yalnızca kernel'ler bırakılır.
+    void stop() {
+        bool running;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            running = m_running;
+            m_stop = true;
+        }
+        if (running) {
+            m_cv.notify_all();
+            if (m_worker.joinable()) m_worker.join();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running = false;
+        }
+        Kernel* old = nullptr;
+        while (m_retired.pop(old)) delete old;
+        delete m_active.exchange(nullptr);
+        delete m_pending.exchange(nullptr);
+        m_infoFrames.store(0);
+    }
+
+    // IR'den kernel kurar (arka plan thread'i; ayırma burada yapılır)
+    static Kernel* buildKernel(const float* irL, const float* irR, uint32_t frames, uint32_t rate) {
+        Kernel* k = new Kernel();
+        k->rate = rate;
+        k->irFrames = frames;
+        const uint32_t headFrames = std::min<uint32_t>(frames, HEAD_LENGTH);
+        const uint32_t tailFrames = frames > (uint32_t)HEAD_LENGTH ? frames - HEAD_LENGTH : 0;
+        k->headParts = std::max(1, (int)((headFrames + HEAD_BLOCK - 1) / HEAD_BLOCK));
+        k->tailParts = (int)((tailFrames + TAIL_BLOCK - 1) / TAIL_BLOCK);
+
+        buildPartitions(irL, irR, frames, 0, HEAD_BLOCK, k->headParts, k->headRe, k->headIm, k->headLive);
+        buildPartitions(irL, irR, frames, HEAD_LENGTH, TAIL_BLOCK, k->tailParts, k->tailRe, k->tailIm, k->tailLive);
+
+        for (int c = 0; c < 2; ++c) {
+            k->headFdlRe[c].assign((size_t)k->headParts * HEAD_BINS, 0.0f);
+            k->headFdlIm[c].assign((size_t)k->headParts * HEAD_BINS, 0.0f);
+            k->headIn[c].assign(HEAD_FFT, 0.0f);
+            k->headOut[c].assign(HEAD_BLOCK, 0.0f);
+            if (k->tailParts > 0) {
+                k->tailFdlRe[c].assign((size_t)k->tailParts * TAIL_BINS, 0.0f);
+                k->tailFdlIm[c].assign((size_t)k->tailParts * TAIL_BINS, 0.0f);
+                k->tailIn[c].assign(TAIL_FFT, 0.0f);
+                k->jobIn[c].assign((size_t)SLOTS * TAIL_BLOCK, 0.0f);
+                k->jobOut[c].assign((size_t)SLOTS * TAIL_BLOCK, 0.0f);
+            }
+        }
+        return k;
+    }
+
+    // Kontrol thread'i: yeni kernel'i yayınla (audio thread bir sonraki blokta alır).
+    // Henüz alınmamış önceki kernel burada silinir.
+    void setKernel(Kernel* kernel) {
+        delete m_pending.exchange(kernel, std::memory_order_acq_rel);
+    }
+
+    void setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    void setMix(float wet, float dry) {
+        m_wet.store(wet, std::memory_order_relaxed);
+        m_dry.store(dry, std::memory_order_relaxed);
+    }
+
+    Info info() const {
+        Info out;
+        out.irFrames = m_infoFrames.load(std::memory_order_relaxed);
+        out.loaded = out.irFrames > 0;
+        out.rate = m_infoRate.load(std::memory_order_relaxed);
+        out.headParts = m_infoHeadParts.load(std::memory_order_relaxed);
+        out.tailParts = m_infoTailParts.load(std::memory_order_relaxed);
+        out.tailMisses = m_tailMisses.load(std::memory_order_relaxed);
+        out.resyncs = m_resyncs.load(std::memory_order_relaxed);
+        return out;
+    }
+
+    // Audio thread: stereo interleaved, yerinde (kuru * dry + ıslak * wet)
+    void process(float* samples, int frames) {
+        adoptPending();
+        Kernel* k = m_active.load(std::memory_order_relaxed);
+        if (!k) return;
+
+        const float wet = m_wet.load(std::memory_order_relaxed);
+        const float dry = m_dry.load(std::memory_order_relaxed);
+        const bool tail = k->tailParts > 0;
+
+        int i = 0;
+        while (i < frames) {
+            const int n = std::min(frames - i, HEAD_BLOCK - m_headPos);
+            float* s = samples + (size_t)i * 2;
+            float* inL = k->headIn[0].data() + HEAD_BLOCK + m_headPos;
+            float* inR = k->headIn[1].data() + HEAD_BLOCK + m_headPos;
+            const float* outL = k->headOut[0].data() + m_headPos;
+            const float* outR = k->headOut[1].data() + m_headPos;
+            float* jobL = nullptr;
+            float* jobR = nullptr;
+            if (tail && !m_tailStalled) {
+                const size_t off = (size_t)(m_fillJob % SLOTS) * TAIL_BLOCK + m_tailFill + m_headPos;
+                jobL = k->jobIn[0].data() + off;
+                jobR = k->jobIn[1].data() + off;
+            }
+            for (int j = 0; j < n; ++j) {
+                const float l = s[j * 2];
+                const float r = s[j * 2 + 1];
+                inL[j] = l;
+                inR[j] = r;
+                if (jobL) {
+                    jobL[j] = l;
+                    jobR[j] = r;
+                }
+                s[j * 2] = l * dry + outL[j] * wet;
+                s[j * 2 + 1] = r * dry + outR[j] * wet;
+            }
+            m_headPos += n;
+            i += n;
+            if (m_headPos == HEAD_BLOCK) {
+                processHeadBlock(*k);
+                if (tail) processTailStep(*k);
+                m_headPos = 0;
+            }
+        }
+    }
+
+private:
+    static void buildPartitions(const float* irL, const float* irR, uint32_t frames, uint32_t offset, int block,
+                                int parts, std::vector<float>* re, std::vector<float>* im,
+                                std::vector<uint8_t>& live) {
+        const int bins = block + 1;
+        live.assign(parts, 0);
+        if (parts <= 0) return;
+        RealFft fft;
+        fft.init(block * 2);
+        std::vector<float> pad(block * 2);
+        const float scale = 2.0f / (float)(block * 2);   // inverse'ün N/2 kazancı
+        const float* ir[2] = { irL, irR };
+        for (int c = 0; c < 2; ++c) {
+            re[c].assign((size_t)parts * bins, 0.0f);
+            im[c].assign((size_t)parts * bins, 0.0f);
+            for (int p = 0; p < parts; ++p) {
+                std::fill(pad.begin(), pad.end(), 0.0f);
+                const uint32_t start = offset + (uint32_t)p * block;
+                bool any = false;
+                for (int j = 0; j < block && start + j < frames; ++j) {
+                    pad[j] = ir[c][start + j] * scale;
+                    if (pad[j] != 0.0f) any = true;
+                }
+                if (!any) continue;
+                live[p] = 1;
+                fft.forward(pad.data(), re[c].data() + (size_t)p * bins, im[c].data() + (size_t)p * bins);
+            }
+        }
+    }
+
+    // Worker boştaysa bekleyen kernel'i devral; eski kernel worker'da silinir
+    void adoptPending() {
+        if (!m_pending.load(std::memory_order_relaxed)) return;
+        if (m_done.load(std::memory_order_acquire) != m_fillJob) return;
+        if (m_retired.freeSlots() <= 0) return;
+        Kernel* next = m_pending.exchange(nullptr, std::memory_order_acq_rel);
+        if (!next) return;
+        Kernel* old = m_active.load(std::memory_order_relaxed);
+        if (old) m_retired.push(old);
+        m_active.store(next, std::memory_order_release);
+        m_headPos = 0;
+        m_tailFill = 0;
+        m_jobBase = m_fillJob;
+        m_tailStalled = false;
+        m_infoRate.store(next->rate, std::memory_order_relaxed);
+        m_infoFrames.store(next->irFrames, std::memory_order_relaxed);
+        m_infoHeadParts.store(next->headParts, std::memory_order_relaxed);
+        m_infoTailParts.store(next->tailParts, std::memory_order_relaxed);
+    }
+
+    // Biten HEAD_BLOCK: FFT -> FDL'ye yaz -> bölümlerle çarp-topla -> IFFT
+    void processHeadBlock(Kernel& k) {
+        const int parts = k.headParts;
+        for (int c = 0; c < 2; ++c) {
+            float* fdlRe = k.headFdlRe[c].data();
+            float* fdlIm = k.headFdlIm[c].data();
+            m_headFft.forward(k.headIn[c].data(), fdlRe + (size_t)k.headFdlPos * HEAD_BINS,
+                              fdlIm + (size_t)k.headFdlPos * HEAD_BINS);
+            std::fill(m_headAccRe, m_headAccRe + HEAD_BINS, 0.0f);
+            std::fill(m_headAccIm, m_headAccIm + HEAD_BINS, 0.0f);
+            for (int p = 0; p < parts; ++p) {
+                if (!k.headLive[p]) continue;
+                const int slot = (k.headFdlPos - p + parts) % parts;
+                complexMultiplyAdd(fdlRe + (size_t)slot * HEAD_BINS, fdlIm + (size_t)slot * HEAD_BINS,
+                                   k.headRe[c].data() + (size_t)p * HEAD_BINS, k.headIm[c].data() + (size_t)p * HEAD_BINS,
+                                   m_headAccRe, m_headAccIm, HEAD_BINS);
+            }
+            m_headFft.inverse(m_headAccRe, m_headAccIm, m_headTime);
+            std::memcpy(k.headOut[c].data(), m_headTime + HEAD_BLOCK, sizeof(float) * HEAD_BLOCK);
+            std::memcpy(k.headIn[c].data(), k.headIn[c].data() + HEAD_BLOCK, sizeof(float) * HEAD_BLOCK);
+        }
+        k.headFdlPos = (k.headFdlPos + 1) % parts;
+    }
+
+    // Kuyruk: TAIL_LAG iş önceki sonucu ekle; TAIL_BLOCK dolunca işi yayınla
+    void processTailStep(Kernel& k) {
+        if (m_tailStalled) {
+            // Worker çok geride kaldı: boşalınca kuyruk durumunu sıfırla ve yeniden başla
+            if (m_done.load(std::memory_order_acquire) != m_fillJob) return;
+            for (int c = 0; c < 2; ++c) {
+                std::fill(k.tailFdlRe[c].begin(), k.tailFdlRe[c].end(), 0.0f);
+                std::fill(k.tailFdlIm[c].begin(), k.tailFdlIm[c].end(), 0.0f);
+                std::fill(k.tailIn[c].begin(), k.tailIn[c].end(), 0.0f);
+            }
+            k.tailFdlPos = 0;
+            m_jobBase = m_fillJob;
+            m_tailFill = 0;
+            m_tailStalled = false;
+            return;
+        }
+
+        if (m_fillJob >= m_jobBase + TAIL_LAG) {
+            const uint64_t need = m_fillJob - TAIL_LAG;
+            if (jobDone(need + 1)) {
+                const size_t off = (size_t)(need % SLOTS) * TAIL_BLOCK + m_tailFill;
+                for (int c = 0; c < 2; ++c) {
+                    const float* src = k.jobOut[c].data() + off;
+                    float* dst = k.headOut[c].data();
+                    for (int j = 0; j < HEAD_BLOCK; ++j) dst[j] += src[j];
+                }
+            } else {
+                m_tailMisses.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        m_tailFill += HEAD_BLOCK;
+        if (m_tailFill < TAIL_BLOCK) return;
+        m_tailFill = 0;
+        ++m_fillJob;
+        m_posted.store(m_fillJob, std::memory_order_release);
+        if (m_inline) {
+            runTailJob(k, m_fillJob - 1);
+            m_done.store(m_fillJob, std::memory_order_release);
+            return;
+        }
+        m_cv.notify_one();
+
+        // Sıradaki slot hâlâ worker'daysa kuyruğu beklet (yazarsak işi bozarız)
+        if (m_fillJob >= m_jobBase + SLOTS && !jobDone(m_fillJob - SLOTS + 1)) {
+            m_tailStalled = true;
+            m_resyncs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Audio thread: beklemeden yoklar; geride kalan worker'ı yalnızca uyandırır
+    bool jobDone(uint64_t target) {
+        if (m_done.load(std::memory_order_acquire) >= target) return true;
+        m_cv.notify_one();
+        return false;
+    }
+
+    // ---- Worker thread ----
+    void run() {
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                // notify audio thread'den kilitsiz gelir; kaçan uyandırmayı zaman aşımı yakalar
+                const auto period = std::chrono::milliseconds(m_active.load() ? 2 : 50);
+                m_cv.wait_for(lock, period, [this]() {
+                    return m_stop || m_done.load(std::memory_order_relaxed) < m_posted.load(std::memory_order_relaxed);
+                });
+                if (m_stop) return;
+            }
+            Kernel* old = nullptr;
+            while (m_retired.pop(old)) delete old;
+
+            uint64_t done = m_done.load(std::memory_order_relaxed);
+            while (done < m_posted.load(std::memory_order_acquire)) {
+                Kernel* k = m_active.load(std::memory_order_acquire);
+                if (k && k->tailParts > 0) runTailJob(*k, done);
+                m_done.store(++done, std::memory_order_release);
+            }
+        }
+    }
+
+    void runTailJob(Kernel& k, uint64_t job) {
+        const size_t slot = (size_t)(job % SLOTS) * TAIL_BLOCK;
+        const int parts = k.tailParts;
+        for (int c = 0; c < 2; ++c) {
+            float* in = k.tailIn[c].data();
+            float* fdlRe = k.tailFdlRe[c].data();
+            float* fdlIm = k.tailFdlIm[c].data();
+            std::memcpy(in + TAIL_BLOCK, k.jobIn[c].data() + slot, sizeof(float) * TAIL_BLOCK);
+            m_tailFft.forward(in, fdlRe + (size_t)k.tailFdlPos * TAIL_BINS, fdlIm + (size_t)k.tailFdlPos * TAIL_BINS);
+            std::fill(m_tailAccRe, m_tailAccRe + TAIL_BINS, 0.0f);
+            std::fill(m_tailAccIm, m_tailAccIm + TAIL_BINS, 0.0f);
+            for (int p = 0; p < parts; ++p) {
+                if (!k.tailLive[p]) continue;
+                const int idx = (k.tailFdlPos - p + parts) % parts;
+                complexMultiplyAdd(fdlRe + (size_t)idx * TAIL_BINS, fdlIm + (size_t)idx * TAIL_BINS,
+                                   k.tailRe[c].data() + (size_t)p * TAIL_BINS, k.tailIm[c].data() + (size_t)p * TAIL_BINS,
+                                   m_tailAccRe, m_tailAccIm, TAIL_BINS);
+            }
+            m_tailFft.inverse(m_tailAccRe, m_tailAccIm, m_tailTime);
+            std::memcpy(k.jobOut[c].data() + slot, m_tailTime + TAIL_BLOCK, sizeof(float) * TAIL_BLOCK);
+            std::memcpy(in, in + TAIL_BLOCK, sizeof(float) * TAIL_BLOCK);
+        }
+        k.tailFdlPos = (k.tailFdlPos + 1) % parts;
+    }
+
+    std::atomic<Kernel*> m_active;     // audio thread yazar, worker okur
+    std::atomic<Kernel*> m_pending;
+    SpscQueue<Kernel*, 16> m_retired;  // audio thread -> worker (silme)
+    std::atomic<uint64_t> m_posted;    // yayınlanan kuyruk işi sayısı
+    std::atomic<uint64_t> m_done;      // worker'ın bitirdiği iş sayısı
+
+    std::atomic<bool> m_enabled;
+    std::atomic<float> m_wet;
+    std::atomic<float> m_dry;
+    std::atomic<uint64_t> m_tailMisses;
+    std::atomic<uint64_t> m_resyncs;
+    std::atomic<uint32_t> m_infoRate;
+    std::atomic<uint32_t> m_infoFrames;
+    std::atomic<int> m_infoHeadParts;
+    std::atomic<int> m_infoTailParts;
+
+    // Audio thread durumu
+    int m_headPos;
+    int m_tailFill;
+    uint64_t m_fillJob;                // doldurulan iş (= yayınlanan iş sayısı)
+    uint64_t m_jobBase;                // kernel devri / yeniden başlatmadaki iş numarası
+    bool m_tailStalled;
+    RealFft m_headFft;
+    float m_headAccRe[HEAD_BINS];
+    float m_headAccIm[HEAD_BINS];
+    float m_headTime[HEAD_FFT];
+
+    // Worker durumu
+    RealFft m_tailFft;
+    float m_tailAccRe[TAIL_BINS];
+    float m_tailAccIm[TAIL_BINS];
+    float m_tailTime[TAIL_FFT];
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_worker;
+    bool m_stop;
+    bool m_running;
+    bool m_inline;
+};
+
+// ============================================
+// IMPULSE RESPONSE KAYNAKLARI
+// ============================================
+// Dahili presetler "builtin:<ad>" ile adreslenir ve istenen hızda sentezlenir
+// (pakete IR dosyası konmaz); diğer yollar BASS ile decode edilir. Hepsi
+// engine'in arka plan iş kuyruğunda çalışır, audio thread'e yalnızca hazır
+// kernel gider.
+struct IrBuildRequest {
+    std::string path;           // boş ya da "builtin:..." = preset
+    int preset = 1;
+    float roomSize = 50.0f;
+    float decay = 1.5f;
+    float damping = 0.5f;
+    float preDelay = 0.0f;      // ms
+    uint32_t rate = 0;
+};
+
+static const char* const BUILTIN_IR_PREFIX = "builtin:";
+
+// -1: dosya yolu
+static int builtinIrIndex(const std::string& path, int fallbackPreset) {
+    if (path.empty()) return fallbackPreset;
+    const size_t prefixLen = strlen(BUILTIN_IR_PREFIX);
+    if (path.compare(0, prefixLen, BUILTIN_IR_PREFIX) != 0) return -1;
+    const std::string id = path.substr(prefixLen);
+    for (int i = 0; i < (int)(sizeof(IR_PRESETS) / sizeof(IR_PRESETS[0])); ++i) {
+        if (id == IR_PRESETS[i].id) return i;
+    }
+    return -1;
+}
+
+// Dekoreleli gürültü kuyruğu + erken yansımalar. decay = RT60, damping yüksek
+// frekansların ne kadar hızlı söndüğü, roomSize erken yansımaların yayıldığı süre.
+static void synthesizeImpulseResponse(int presetIndex, float roomSize, float decay, float damping, uint32_t rate,
+                                      std::vector<float>& outL, std::vector<float>& outR) {
+    const IRPreset& preset = IR_PRESETS[presetIndex];
+    const float rt60 = std::max(0.1f, decay);
+    const uint32_t frames = (uint32_t)(std::min(rt60 * 1.1f, ConvolutionReverb::MAX_IR_SECONDS) * rate);
+    outL.assign(frames, 0.0f);
+    outR.assign(frames, 0.0f);
+
+    uint32_t state = 0x9E3779B9u ^ (uint32_t)(presetIndex * 7919 + 1);
+    auto noise = [&state]() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return (float)(int32_t)state / 2147483648.0f;
+    };
+
+    const float earlySec = 0.004f + roomSize * 0.0006f;
+    const uint32_t onset = std::max<uint32_t>(1, (uint32_t)(earlySec * 0.5f * rate));
+    const float k = 6.9078f / (rt60 * (float)rate);          // -60 dB / RT60 (genlik)
+    const float nyquistCut = 0.45f * (float)rate;
+    float lpL = 0.0f;
+    float lpR = 0.0f;
+    float a = 0.0f;
+    for (uint32_t i = 0; i < frames; ++i) {
+        if ((i & 63) == 0) {
+            // Damping: tek kutuplu alçak geçirenin kesimi zamanla iner
+            const float t = (float)i / (float)rate;
+            const float fc = clampf(16000.0f * expf(-damping * 4.0f * t / rt60), 300.0f, nyquistCut);
+            a = expf(-2.0f * (float)M_PI * fc / (float)rate);
+        }
+        lpL = (1.0f - a) * noise() + a * lpL;
+        lpR = (1.0f - a) * noise() + a * lpR;
+        const float env = expf(-k * (float)i) * (i < onset ? (float)i / (float)onset : 1.0f);
+        outL[i] = lpL * env;
+        outR[i] = lpR * env;
+    }
+
+    // Erken yansımalar: difüzyon arttıkça daha çok ve daha küçük tap
+    const int taps = 4 + (int)(preset.diffusion * 12.0f);
+    const float tapGain = 1.0f - 0.5f * preset.diffusion;
+    for (int t = 0; t < taps; ++t) {
+        const float pos = ((float)t + 0.5f + 0.5f * noise()) / (float)taps;
+        const uint32_t idxL = std::min(frames - 1, (uint32_t)(pos * earlySec * rate));
+        const uint32_t idxR = std::min(frames - 1, idxL + (uint32_t)(fabsf(noise()) * 0.0015f * rate));
+        const float g = tapGain * (0.6f + 0.4f * noise());
+        outL[idxL] += g * expf(-k * (float)idxL);
+        outR[idxR] -= g * expf(-k * (float)idxR);
+    }
+}
+
+// IR dosyasını stereo olarak decode eder (mono -> iki kanal) ve rate'e çevirir
+static bool decodeImpulseResponse(const std::string& path, uint32_t rate, std::vector<float>& outL, std::vector<float>& outR) {
+    HSTREAM stream = createDecodeStream(path);
+    if (!stream) return false;
+    BASS_CHANNELINFO info;
+    if (!BASS_ChannelGetInfo(stream, &info) || info.chans == 0 || info.freq == 0) {
+        BASS_StreamFree(stream);
+        return false;
+    }
+
+    const uint32_t chans = info.chans;
+    const uint32_t maxFrames = (uint32_t)(ConvolutionReverb::MAX_IR_SECONDS * info.freq);
+    std::vector<float> stereo;
+    std::vector<float> block(4096 * chans);
+    while (stereo.size() / 2 < maxFrames) {
+        const DWORD got = BASS_ChannelGetData(stream, block.data(), (DWORD)(block.size() * sizeof(float)) | BASS_DATA_FLOAT);
+        if (got == (DWORD)-1 || got == 0) break;
+        const uint32_t frames = got / (sizeof(float) * chans);
+        for (uint32_t i = 0; i < frames && stereo.size() / 2 < maxFrames; ++i) {
+            const float* f = block.data() + (size_t)i * chans;
+            stereo.push_back(f[0]);
+            stereo.push_back(chans > 1 ? f[1] : f[0]);
+        }
+    }
+    BASS_StreamFree(stream);
+    if (stereo.empty()) return false;
+
+    if (info.freq != rate) {
+        std::unique_ptr<PolyphaseResampler> resampler(new PolyphaseResampler());
+        resampler->configure(info.freq, rate);
+        std::vector<float> converted;
+        converted.reserve((size_t)((double)stereo.size() * rate / info.freq) + 64);
+        size_t readPos = 0;
+        float chunk[2048];
+        for (;;) {
+            const int produced = resampler->process(chunk, 1024, [&](float* lr) {
+                if (readPos >= stereo.size()) return false;
+                lr[0] = stereo[readPos];
+                lr[1] = stereo[readPos + 1];
+                readPos += 2;
+                return true;
+            });
+            converted.insert(converted.end(), chunk, chunk + produced * 2);
+            if (produced < 1024) break;
+        }
+        stereo.swap(converted);
+    }
+
+    const size_t frames = stereo.size() / 2;
+    outL.resize(frames);
+    outR.resize(frames);
+    for (size_t i = 0; i < frames; ++i) {
+        outL[i] = stereo[i * 2];
+        outR[i] = stereo[i * 2 + 1];
+    }
+    return true;
+}
+
+// Pre-delay (ıslak yolun HEAD_BLOCK gecikmesi düşülerek), uzunluk sınırı ve
+// enerji normalizasyonu: wetMix %100 iken ıslak sinyal girişle aynı RMS'te
+static void shapeImpulseResponse(std::vector<float>& irL, std::vector<float>& irR, uint32_t rate, float preDelayMs) {
+    const uint32_t preDelay = (uint32_t)(preDelayMs * 0.001f * rate);
+    const uint32_t shift = preDelay > (uint32_t)ConvolutionReverb::HEAD_BLOCK ? preDelay - ConvolutionReverb::HEAD_BLOCK : 0;
+    if (shift > 0) {
+        irL.insert(irL.begin(), shift, 0.0f);
+        irR.insert(irR.begin(), shift, 0.0f);
+    }
+    const size_t maxFrames = (size_t)(ConvolutionReverb::MAX_IR_SECONDS * rate);
+    if (irL.size() > maxFrames) {
+        irL.resize(maxFrames);
+        irR.resize(maxFrames);
+    }
+
+    double energy = 0.0;
+    for (size_t i = 0; i < irL.size(); ++i) energy += (double)irL[i] * irL[i] + (double)irR[i] * irR[i];
+    energy *= 0.5;
+    if (energy > 1e-12) {
+        const float g = (float)(1.0 / std::sqrt(energy));
+        for (size_t i = 0; i < irL.size(); ++i) {
+            irL[i] *= g;
+            irR[i] *= g;
+        }
+    }
+}
+
+// ============================================
+// OFFLINE RENDER (dosyaya dışa aktarım)
+// ============================================
+// Canlı zincirin çıkış cihazından bağımsız kopyası, gerçek zamandan hızlı:
+// decode -> bit/dither -> tape saturation -> ReplayGain + preamp -> MasterDSP
+// -> AGC -> true-peak limiter -> konvolüsyon reverb -> WAV. Sıra canlı DSP
+// önceliklerini izler (parçada 20, 12, 0; mikser çıkışında konvolüsyon). Bus
+// modunda konvolüsyon canlıdaki gibi MasterDSP'den önce çalışır.
+// Her işçi thread'in kendi MasterDSP, loudness/AGC, limiter ve konvolüsyon
+// örnekleri vardır; canlı çalma ve diğer işçilerle hiçbir durum paylaşılmaz.
+// Konvolüsyonun kuyruk işleri işçide senkron hesaplanır (hiçbiri atlanmaz).
+// Limiter lookahead gecikmesi telafi edilir: çıktı girdiyle örnek hizalı ve
+// aynı uzunluktadır (reverb kuyruğu dosya sonunda kesilir). Çevrimdışı
+// çalışamayan açık katlar (BASS DX8 reverb) loglanır ve sonuçta raporlanır.
+class OfflineRenderer {
+public:
+    static constexpr int BLOCK_FRAMES = 4096;
+    static constexpr int MAX_THREADS = 16;
+
+    struct Job {
+        std::string input;
+        std::string output;     // yalnızca .wav
+    };
+
+    // Render başında alınan zincir ayarları
+    struct Chain {
+        bool dspEnabled = true;
+        bool busMode = false;
+        float preampDb = 0.0f;
+        TapeSatParams tape;
+        BitDitherParams bitDither;
+        AutoGainParams autoGain;
+        TruePeakLimiterParams limiter;
+        bool convolution = false;
+        IrBuildRequest ir;                                      // rate yok sayılır: IR her dosyanın hızında kurulur
+        float convWet = 0.3f;
+        float convDry = 1.0f;
+        std::vector<std::string> unsupported;                   // açık ama çevrimdışı çalışamayan katlar
+        std::function<void(void* dsp, float rate)> configure;   // MasterDSP ayarları (işçi thread'inde)
+        std::function<float(const std::string&)> gainFor;       // ReplayGain (opsiyonel, lineer)
+    };
+
+    struct Options {
+        int threads = 0;        // 0 = çekirdek sayısı - 1
+        int bitDepth = 24;      // 16 | 24 tamsayı PCM, 32 = float
+        bool dither = true;     // tamsayı çıktıda TPDF dither (1 LSB)
+        int limiter = -1;       // -1 = canlı ayar, 0 = kapalı, 1 = açık
+    };
+
+    struct Result {
+        std::string input;
+        std::string output;
+        bool ok = false;
+        int error = BASS_OK;    // decode hatası (BASS kodu)
+        std::string message;    // okunabilir hata
+        uint32_t sampleRate = 0;
+        uint64_t frames = 0;
+        double duration = 0.0;  // ses süresi (s)
+        double seconds = 0.0;   // render süresi (duvar saati)
+        float gain = 1.0f;      // uygulanan ReplayGain + preamp (lineer)
+        float truePeak = 0.0f;  // çıktı true-peak (lineer)
+        std::vector<std::string> stages;    // uygulanan katlar, zincir sırasıyla
+        std::vector<std::string> skipped;   // açık olup uygulanamayan katlar
+
+        double realtimeFactor() const { return seconds > 0.0 ? duration / seconds : 0.0; }
+    };
+
+    using ProgressFn = std::function<void(const Result&, size_t done, size_t total)>;
+    using DoneFn = std::function<void(std::vector<Result>&, bool cancelled)>;
+
+    OfflineRenderer() : m_running(false), m_cancel(false) {}
+    ~OfflineRenderer() { stop(); }
+
+    bool start(std::vector<Job> jobs, Chain chain, const Options& options, ProgressFn onProgress, DoneFn onDone) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_running.load()) return false;
+        if (m_coordinator.joinable()) m_coordinator.join();   // önceki render'ın bitmiş thread'i
+        m_cancel = false;
+        m_running = true;
+        m_coordinator = std::thread(&OfflineRenderer::run, this, std::move(jobs), std::move(chain), options,
+                                    std::move(onProgress), std::move(onDone));
+        return true;
+    }
+
+    void cancel() { m_cancel.store(true); }
+    bool running() const { return m_running.load(); }
+
+    // Bitmesini bekler (CLI)
+    void wait() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_coordinator.joinable()) m_coordinator.join();
+    }
+
+    // İptal eder ve bitmesini bekler (BASS_Free'den önce)
+    void stop() {
+        cancel();
+        wait();
+    }
+
+    static bool isSupportedOutput(const std::string& path) {
+        if (path.size() < 4) return false;
+        std::string ext = path.substr(path.size() - 4);
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return (char)tolower(c); });
+        return ext == ".wav";
+    }
+
+private:
+    // RIFF/WAVE yazıcı: 16/24-bit PCM ya da 32-bit float, boyutlar kapanışta
+    class WavWriter {
+    public:
+        ~WavWriter() { close(); }
+
+        bool open(const std::string& path, uint32_t rate, int bits) {
+            m_file = fopen(path.c_str(), "wb");
+            if (!m_file) return false;
+            m_bits = bits;
+            m_rate = rate;
+            m_dataBytes = 0;
+            return writeHeader();
+        }
+
+        // samples: stereo interleaved float; tamsayı çıktıda isteğe bağlı TPDF dither
+        bool write(const float* samples, int frames, bool dither, uint32_t& rng) {
+            const size_t count = (size_t)frames * 2;
+            const size_t bytesPer = (size_t)m_bits / 8;
+            if (m_dataBytes + count * bytesPer > MAX_DATA_BYTES) return false;
+            m_buffer.resize(count * bytesPer);
+            unsigned char* out = m_buffer.data();
+            if (m_bits == 32) {
+                memcpy(out, samples, count * sizeof(float));
+            } else {
+                const float scale = (m_bits == 16) ? 32767.0f : 8388607.0f;
+                for (size_t i = 0; i < count; ++i) {
+                    float v = clampf(samples[i], -1.0f, 1.0f) * scale;
+                    if (dither) v += rand01(rng) - rand01(rng);
+                    const int32_t q = (int32_t)lrintf(clampf(v, -scale - 1.0f, scale));
+                    out[0] = (unsigned char)(q & 0xFF);
+                    out[1] = (unsigned char)((q >> 8) & 0xFF);
+                    if (m_bits == 24) out[2] = (unsigned char)((q >> 16) & 0xFF);
+                    out += bytesPer;
+                }
+            }
+            if (fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size()) return false;
+            m_dataBytes += m_buffer.size();
+            return true;
+        }
+
+        bool close() {
+            if (!m_file) return true;
+            const bool ok = fseek(m_file, 0, SEEK_SET) == 0 && writeHeader();
+            const bool closed = fclose(m_file) == 0;
+            m_file = nullptr;
+            return ok && closed;
+        }
+
+    private:
+        static constexpr uint64_t MAX_DATA_BYTES = 0xFFFFFFFFull - 64;   // RIFF 32-bit boyut sınırı
+
+        static void put16(unsigned char*& p, uint32_t v) { p[0] = (unsigned char)v; p[1] = (unsigned char)(v >> 8); p += 2; }
+        static void put32(unsigned char*& p, uint32_t v) { put16(p, v & 0xFFFF); put16(p, v >> 16); }
+
+        bool writeHeader() {
+            unsigned char header[44];
+            unsigned char* p = header;
+            const uint32_t blockAlign = 2 * (uint32_t)m_bits / 8;
+            memcpy(p, "RIFF", 4); p += 4;
+            put32(p, (uint32_t)(36 + m_dataBytes));
+            memcpy(p, "WAVEfmt ", 8); p += 8;
+            put32(p, 16);
+            put16(p, m_bits == 32 ? 3 : 1);     // WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM
+            put16(p, 2);
+            put32(p, m_rate);
+            put32(p, m_rate * blockAlign);
+            put16(p, blockAlign);
+            put16(p, (uint32_t)m_bits);
+            memcpy(p, "data", 4); p += 4;
+            put32(p, (uint32_t)m_dataBytes);
+            return fwrite(header, 1, sizeof(header), m_file) == sizeof(header);
+        }
+
+        FILE* m_file = nullptr;
+        int m_bits = 24;
+        uint32_t m_rate = 0;
+        uint64_t m_dataBytes = 0;
+        std::vector<unsigned char> m_buffer;
+    };
+
+    // İşçi başına tamponlar (dosyalar arasında yeniden kullanılır). IR, aynı
+    // hızdaki dosyalar için bir kez hazırlanır; kernel durumu dosya başına tazedir.
+    struct WorkerBuffers {
+        std::vector<float> raw;
+        std::vector<float> stereo = std::vector<float>((size_t)BLOCK_FRAMES * 2);
+        uint32_t rng = 0x9E3779B9u;
+        std::vector<float> irL, irR;
+        uint32_t irRate = 0;
+        bool irOk = false;
+    };
+
+    // Dosyanın zinciri (render() başında kurulur, sonunda bırakılır)
+    struct FileChain {
+        void* dsp = nullptr;
+        TapeSatState tape;
+        BitDitherState dither;
+        std::unique_ptr<LoudnessMeter> loudness;
+        AutoGainStage autoGain;
+        std::unique_ptr<TruePeakLimiter> limiter;
+        std::unique_ptr<ConvolutionReverb> convolver;
+        TruePeakDetector outMeter[2];       // konvolüsyon limiter'dan sonraysa çıkış tepesi
+
+        ~FileChain() { if (dsp) destroy_dsp(dsp); }
+        bool convolutionLast(const Chain& chain) const { return convolver && !chain.busMode; }
+    };
+
+    void run(std::vector<Job> jobs, Chain chain, Options options, ProgressFn onProgress, DoneFn onDone) {
+        const auto started = std::chrono::steady_clock::now();
+        const size_t total = jobs.size();
+        std::vector<Result> results(total);
+        std::atomic<size_t> next(0);
+        std::atomic<size_t> done(0);
+
+        if (options.limiter >= 0) chain.limiter.enabled = options.limiter != 0;
+        if (options.bitDepth != 16 && options.bitDepth != 32) options.bitDepth = 24;
+        for (const std::string& stage : chain.unsupported) {
+            AURIVO_LOG_WARN("[RENDER] '%s' açık ama çevrimdışı çalışamaz; render'a dahil edilmedi", stage.c_str());
+        }
+
+        auto worker = [&](int index) {
+            lowerCurrentThreadPriority();
+            WorkerBuffers buffers;
+            buffers.rng += (uint32_t)index * 7919u;
+            for (;;) {
+                if (m_cancel.load()) break;
+                const size_t i = next.fetch_add(1);
+                if (i >= total) break;
+
+                Result& r = results[i];
+                r.input = jobs[i].input;
+                r.output = jobs[i].output;
+                render(r, chain, options, buffers);
+                const size_t n = done.fetch_add(1) + 1;
+                if (onProgress) onProgress(r, n, total);
+            }
+        };
+
+        const int threads = (int)std::min<size_t>(
+            std::max<size_t>(1, total),
+            (size_t)std::max(1, std::min(MAX_THREADS, options.threads > 0 ? options.threads : LoudnessScanner::defaultThreads())));
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+        worker(0);
+        for (auto& t : pool) t.join();
+
+        const bool cancelled = m_cancel.load();
+        results.erase(std::remove_if(results.begin(), results.end(),
+                                     [](const Result& r) { return r.input.empty(); }),
+                      results.end());
+
+        double audioSeconds = 0.0;
+        size_t ok = 0;
+        for (const Result& r : results) {
+            if (!r.ok) continue;
+            audioSeconds += r.duration;
+            ++ok;
+        }
+        const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        AURIVO_LOG_INFO("[RENDER] %zu/%zu dosya, %d thread, %.1f s (%.0fx gerçek zaman)%s",
+               ok, total, threads, wall, wall > 0.0 ? audioSeconds / wall : 0.0,
+               cancelled ? " - iptal edildi" : "");
+
+        m_running = false;
+        if (onDone) onDone(results, cancelled);
+    }
+
+    void render(Result& r, const Chain& chain, const Options& options, WorkerBuffers& buffers) {
+        const auto started = std::chrono::steady_clock::now();
+        if (!isSupportedOutput(r.output)) {
+            r.message = "Unsupported output format (only .wav)";
+            return;
+        }
+        if (r.output == r.input) {
+            r.message = "Output must differ from input";
+            return;
+        }
+
+        HSTREAM stream = createDecodeStream(r.input);
+        if (!stream) {
+            r.error = BASS_ErrorGetCode();
+            r.message = "Decode failed";
+            return;
+        }
+        BASS_CHANNELINFO info;
+        if (!BASS_ChannelGetInfo(stream, &info) || info.freq == 0 || info.chans == 0) {
+            r.error = BASS_ErrorGetCode();
+            r.message = "Decode failed";
+            BASS_StreamFree(stream);
+            return;
+        }
+
+        const int chans = (int)info.chans;
+        const float rate = (float)info.freq;
+        r.sampleRate = info.freq;
+
+        WavWriter writer;
+        if (!writer.open(r.output, info.freq, options.bitDepth)) {
+            r.message = std::string("Cannot open output: ") + strerror(errno);
+            BASS_StreamFree(stream);
+            return;
+        }
+
+        // Dosya başına temiz durum: önceki dosyanın kuyrukları (echo, limiter, reverb) sızmaz
+        FileChain fc;
+        fc.dsp = chain.dspEnabled ? create_dsp() : nullptr;
+        if (fc.dsp) {
+            set_sample_rate(fc.dsp, rate);
+            if (chain.configure) chain.configure(fc.dsp, rate);
+            if (chain.autoGain.enabled) fc.loudness.reset(new LoudnessMeter());
+        }
+        fc.tape.sr = rate;
+        fc.dither.sr = rate;
+        fc.limiter.reset(new TruePeakLimiter());
+        for (int c = 0; c < 2; ++c) fc.outMeter[c].configure(chain.limiter.oversamplingRate);
+        if (chain.convolution) {
+            fc.convolver = createConvolver(chain, info.freq, buffers);
+            if (!fc.convolver) r.skipped.push_back("convolution");
+        }
+        r.skipped.insert(r.skipped.end(), chain.unsupported.begin(), chain.unsupported.end());
+
+        r.gain = dBToLinear(chain.preampDb) * (chain.gainFor ? chain.gainFor(r.input) : 1.0f);
+
+        if (chain.bitDither.enabled) r.stages.push_back("bitDither");
+        if (chain.tape.enabled) r.stages.push_back("tapeSaturation");
+        if (fc.convolver && chain.busMode) r.stages.push_back("convolution");
+        if (r.gain != 1.0f) r.stages.push_back("gain");
+        if (fc.dsp) r.stages.push_back("masterDsp");
+        if (fc.loudness) r.stages.push_back("autoGain");
+        if (chain.limiter.enabled) r.stages.push_back("truePeakLimiter");
+        if (fc.convolutionLast(chain)) r.stages.push_back("convolution");
+
+        float* stereo = buffers.stereo.data();
+        buffers.raw.resize((size_t)BLOCK_FRAMES * chans);
+        uint64_t latency = 0;       // limiter gecikmesi: baştan atılacak frame
+        bool writeOk = true;
+        while (writeOk && !m_cancel.load(std::memory_order_relaxed)) {
+            const DWORD got = BASS_ChannelGetData(stream, buffers.raw.data(),
+                                                  (DWORD)(buffers.raw.size() * sizeof(float)) | BASS_DATA_FLOAT);
+            if (got == (DWORD)-1 || got == 0) break;
+            const int n = (int)(got / (sizeof(float) * chans));
+            for (int i = 0; i < n; ++i) {
+                const float l = buffers.raw[(size_t)i * chans];
+                stereo[(size_t)i * 2] = l;
+                stereo[(size_t)i * 2 + 1] = chans > 1 ? buffers.raw[(size_t)i * chans + 1] : l;
+            }
+
+            if (chain.bitDither.enabled) processBitDither(chain.bitDither, fc.dither, stereo, n * 2);
+            if (chain.tape.enabled) processTapeSat(chain.tape, fc.tape, stereo, n * 2);
+            if (fc.convolver && chain.busMode) fc.convolver->process(stereo, n);
+            if (r.gain != 1.0f) {
+                for (int i = 0; i < n * 2; ++i) stereo[i] *= r.gain;
+            }
+            if (fc.dsp) {
+                process_dsp(fc.dsp, stereo, n, 2);
+                // Canlıdaki gibi: loudness AGC'den önce ölçer
+                if (fc.loudness) {
+                    fc.loudness->process(rate, stereo, n);
+                    fc.autoGain.process(chain.autoGain, rate, fc.loudness->levelForMode(chain.autoGain.mode), stereo, n);
+                }
+            }
+
+            writeOk = limitAndWrite(r, chain, fc, rate, stereo, n, latency, writer, options, buffers.rng);
+            r.frames += (uint64_t)n;
+        }
+        BASS_StreamFree(stream);
+
+        // Limiter gecikme hattındaki son örnekler (sessizlikle itilir)
+        uint64_t tail = chain.limiter.enabled ? fc.limiter->latencyFrames() : 0;
+        while (writeOk && tail > 0 && !m_cancel.load()) {
+            const int n = (int)std::min<uint64_t>(tail, BLOCK_FRAMES);
+            std::fill(stereo, stereo + (size_t)n * 2, 0.0f);
+            writeOk = limitAndWrite(r, chain, fc, rate, stereo, n, latency, writer, options, buffers.rng);
+            tail -= (uint64_t)n;
+        }
+
+        const bool closed = writer.close();
+        if (m_cancel.load()) {
+            r.error = BASS_ERROR_ENDED;
+            r.message = "Cancelled";
+            remove(r.output.c_str());
+            return;
+        }
+        if (!writeOk || !closed) {
+            r.message = "Write failed (disk full or file larger than 4 GB)";
+            remove(r.output.c_str());
+            return;
+        }
+
+        r.duration = (double)r.frames / rate;
+        r.ok = true;
+        r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        AURIVO_LOG_INFO("[RENDER] %s -> %s: %.1f s ses, %.2f s (%.0fx gerçek zaman), tepe %.2f dBTP",
+               r.input.c_str(), r.output.c_str(), r.duration, r.seconds, r.realtimeFactor(), linearTodB(r.truePeak));
+    }
+
+    // İşçinin konvolüsyonu: IR dosyanın hızında hazırlanır (aynı hızdaki
+    // dosyalar önbellekteki IR'yi kullanır), kernel her dosyada yeniden kurulur
+    static std::unique_ptr<ConvolutionReverb> createConvolver(const Chain& chain, uint32_t rate, WorkerBuffers& buffers) {
+        if (buffers.irRate != rate) {
+            buffers.irRate = rate;
+            buffers.irOk = true;
+            const int preset = builtinIrIndex(chain.ir.path, chain.ir.preset);
+            if (preset >= 0) {
+                synthesizeImpulseResponse(preset, chain.ir.roomSize, chain.ir.decay, chain.ir.damping, rate,
+                                          buffers.irL, buffers.irR);
+            } else if (!decodeImpulseResponse(chain.ir.path, rate, buffers.irL, buffers.irR)) {
+                AURIVO_LOG_ERROR("[RENDER] IR decode hatası (%d): %s", BASS_ErrorGetCode(), chain.ir.path.c_str());
+                buffers.irOk = false;
+            }
+            if (buffers.irOk) shapeImpulseResponse(buffers.irL, buffers.irR, rate, chain.ir.preDelay);
+        }
+        if (!buffers.irOk || buffers.irL.empty()) return nullptr;
+
+        std::unique_ptr<ConvolutionReverb> convolver(new ConvolutionReverb());
+        convolver->runInline();
+        convolver->setMix(chain.convWet, chain.convDry);
+        convolver->setEnabled(true);
+        convolver->setKernel(ConvolutionReverb::buildKernel(buffers.irL.data(), buffers.irR.data(),
+                                                            (uint32_t)buffers.irL.size(), rate));
+        return convolver;
+    }
+
+    // True-peak limiter (canlıda parça zincirinin sonu) + mikser çıkışındaki
+    // konvolüsyon + gecikme telafisi + yazma
+    bool limitAndWrite(Result& r, const Chain& chain, FileChain& fc, float rate, float* samples,
+                       int frames, uint64_t& skipped, WavWriter& writer, const Options& options, uint32_t& rng) {
+        TruePeakLimiter::BlockStats stats;
+        if (chain.limiter.enabled) {
+            fc.limiter->process(chain.limiter, rate, samples, frames, stats);
+        } else {
+            fc.limiter->measure(chain.limiter.oversamplingRate, samples, frames, stats);
+        }
+        if (fc.convolutionLast(chain)) {
+            // Reverb limiter'dan sonra: tepe yazılan sinyalden ölçülür
+            fc.convolver->process(samples, frames);
+            for (int i = 0; i < frames; ++i) {
+                r.truePeak = std::max(r.truePeak, fc.outMeter[0].push(samples[(size_t)i * 2]));
+                r.truePeak = std::max(r.truePeak, fc.outMeter[1].push(samples[(size_t)i * 2 + 1]));
+            }
+        } else {
+            r.truePeak = std::max(r.truePeak, std::max(stats.outTruePeak[0], stats.outTruePeak[1]));
+        }
+
+        int offset = 0;
+        const uint64_t latency = chain.limiter.enabled ? fc.limiter->latencyFrames() : 0;
+        if (skipped < latency) {
+            offset = (int)std::min<uint64_t>(latency - skipped, (uint64_t)frames);
+            skipped += (uint64_t)offset;
+        }
+        if (offset >= frames) return true;
+        return writer.write(samples + (size_t)offset * 2, frames - offset,
+                            options.dither && options.bitDepth != 32, rng);
+    }
+
+    std::mutex m_mutex;
+    std::thread m_coordinator;
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_cancel;
+};
+
+// ============================================
+// CROSSFADE MİKSER (STREAMPROC)
+// ============================================
+// Çıkışa giden tek BASS stream'i. Parça zincirleri decode-mode'dadır; mikser
+// her blokta aktif kaynaklardan BASS_ChannelGetData ile çeker (FX + dspCallback
+// o sırada çalışır), örnek başına fade eğrisi uygular ve toplar. İki fade aynı
+// sayaçtan ilerlediği için faz kilitlidir.
+//
+// Kontrol tarafı (engine m_mutex altında) komutları SPSC kuyruğa yazar; mixer
+// thread'i blok başında uygular. Bitmiş/sönmüş kaynaklar olay kuyruğu ile tek
+// bir reclaimer thread'ine gider; stream/DSP serbest bırakma orada yapılır.
+// Kaynak sayısı sabit (MAX_SOURCES); üst üste crossfade'lerde yer kalmazsa en
+// sessiz sönen kaynak hemen bırakılır, yani maliyet sınırlıdır.
+class CrossfadeMixer {
+public:
+    enum Curve { CURVE_EQUAL_POWER = 0, CURVE_LINEAR = 1, CURVE_SCURVE = 2 };
+
+    static constexpr int MAX_SOURCES = 4;     // 1 aktif + en fazla 3 sönen kaynak
+    static constexpr int CHUNK_FRAMES = 1024;
+    static constexpr int IN_FRAMES = 1024;
+    static constexpr int MAX_CHANNELS = 8;
+    // Olay kuyruğu doluyken bekleyen olaylar (audio thread'de büyümez, bkz. drainCommands)
+    static constexpr int PENDING_CAPACITY = 128;
+    // Tek blokta üretilebilecek en fazla olay: sahip olunan her zincir (kaynaklar
+    // + kuyruk + komuttaki yeni zincir) bir RETIRED, kuyruk geçişi bir ADVANCED
+    static constexpr int PENDING_HEADROOM = 2 * (MAX_SOURCES + 2);
+
+    struct Stats {
+        int sources = 0;
+        int fading = 0;
+        bool queued = false;
+        bool ended = false;
+        uint64_t retired = 0;
+        uint64_t forcedRetires = 0;
+        uint64_t advances = 0;
+        uint64_t underruns = 0;      // BASS_SYNC_STALL (çıkış buffer'ı boşaldı)
+        uint32_t blockFrames = 0;    // son STREAMPROC isteği
+        uint32_t maxBlockFrames = 0;
+        DWORD freq = 0;
+    };
+
+    CrossfadeMixer()
+        : m_output(0), m_freq(0), m_primary(-1), m_queued(nullptr)
+        , m_flushRequested(false), m_ended(false), m_epoch(0), m_appliedEpoch(0)
+        , m_retired(0), m_forcedRetires(0), m_advances(0)
+        , m_reclaimerStop(false), m_reclaimerRunning(false)
+    {
+        for (int i = 0; i < MAX_SOURCES; ++i) m_sources[i].chain = nullptr;
+        m_pending.reserve(PENDING_CAPACITY);
+    }
+
+    ~CrossfadeMixer() {
+        close(nullptr);
+        stopReclaimer();
+    }
+
+    // Çıkış bloğu STREAMPROC'ta açılır (bkz. CallbackProfiler); open()'dan önce
+    void setProfiler(CallbackProfiler* profiler) { m_profiler = profiler; }
+
+    // Gapless geçiş bildirimi; reclaimer thread'inde çağrılır
+    void setAdvanceHandler(std::function<void(TrackChain*, uint32_t)> handler) {
+        m_onAdvance = std::move(handler);
+    }
+
+    void startReclaimer() {
+        std::lock_guard<std::mutex> lock(m_reclaimMutex);
+        if (m_reclaimerRunning) return;
+        m_reclaimerStop = false;
+        m_reclaimerRunning = true;
+        m_reclaimer = std::thread(&CrossfadeMixer::reclaimLoop, this);
+    }
+
+    // Bekleyen zincirleri serbest bırakıp thread'i durdurur (BASS_Free'den önce)
+    void stopReclaimer() {
+        {
+            std::lock_guard<std::mutex> lock(m_reclaimMutex);
+            if (!m_reclaimerRunning) return;
+            m_reclaimerStop = true;
+        }
+        m_reclaimCv.notify_all();
+        if (m_reclaimer.joinable()) m_reclaimer.join();
+        std::lock_guard<std::mutex> lock(m_reclaimMutex);
+        m_reclaimerRunning = false;
+    }
+
+    bool open(DWORD freq) {
+        if (m_output) return true;
+        m_freq = freq ? freq : (DWORD)FALLBACK_SAMPLE_RATE;
+        m_ended = false;
+        m_output = BASS_StreamCreate(m_freq, 2, BASS_SAMPLE_FLOAT, &CrossfadeMixer::streamProc, this);
+        if (!m_output) {
+            AURIVO_LOG_ERROR("[MIXER] BASS_StreamCreate error: %d", BASS_ErrorGetCode());
+            return false;
+        }
+        // STREAMPROC zamanında buffer dolduramazsa BASS çalmayı durdurur (stall)
+        BASS_ChannelSetSync(m_output, BASS_SYNC_STALL, 0, &CrossfadeMixer::stallSync, this);
+        return true;
+    }
+
+    // Çıkışı kapatır; keep dışındaki kaynaklar reclaimer'a gider. Kuyruktaki
+    // (gapless) zincir retire edilmez, çağırana geri verilir. primaryOut
+    // verilirse birincil kaynağın zinciri de korunur ve oraya yazılır (engine
+    // henüz işlemediği bir gapless geçişi böylece kaçırmaz).
+    TrackChain* close(TrackChain* keep, TrackChain** primaryOut = nullptr) {
+        if (m_output) {
+            BASS_StreamFree(m_output);   // döndükten sonra streamProc çağrılmaz
+            m_output = 0;
+        }
+        drainCommands(true);
+        m_flushRequested = false;
+
+        TrackChain* primary = (primaryOut && m_primary >= 0) ? m_sources[m_primary].chain : nullptr;
+        if (primaryOut) *primaryOut = primary;
+        for (int i = 0; i < MAX_SOURCES; ++i) {
+            Source& s = m_sources[i];
+            if (!s.chain) continue;
+            if (s.chain == keep || s.chain == primary) {
+                s.chain = nullptr;
+                continue;
+            }
+            retireSlot(i);
+        }
+        m_primary = -1;
+        TrackChain* queued = m_queued;
+        m_queued = nullptr;
+        m_ended = false;
+        m_epoch.fetch_add(1);
+        flushPendingEvents();
+        m_reclaimCv.notify_one();
+        return (queued == keep) ? nullptr : queued;
+    }
+
+    HSTREAM output() const { return m_output; }
+    DWORD outputRate() const { return m_freq; }
+    uint32_t epoch() const { return m_epoch.load(); }
+    bool ended() const { return m_ended.load(); }
+
+    bool isPlaying() const {
+        return m_output && BASS_ChannelIsActive(m_output) == BASS_ACTIVE_PLAYING;
+    }
+
+    // Çıkış buffer'ında bekleyen süre (saniye)
+    double bufferedSeconds() const {
+        if (!m_output || !m_freq) return 0.0;
+        const DWORD avail = BASS_ChannelGetData(m_output, nullptr, BASS_DATA_AVAILABLE);
+        if (avail == (DWORD)-1) return 0.0;
+        return (double)avail / (sizeof(float) * 2) / (double)m_freq;
+    }
+
+    uint64_t bufferedFrames() const {
+        if (!m_output) return 0;
+        const DWORD avail = BASS_ChannelGetData(m_output, nullptr, BASS_DATA_AVAILABLE);
+        if (avail == (DWORD)-1) return 0;
+        return (uint64_t)avail / (sizeof(float) * 2);
+    }
+
+    // ---- Kontrol komutları (tek üretici: engine m_mutex altında) ----
+    // PLAY/CROSSFADE epoch'u ilerletir; ADVANCED olayı mixer'ın o an uyguladığı
+    // epoch'u taşır, böylece henüz uygulanmamış bir geçişten önceki gapless
+    // ilerleme engine tarafında eski sayılır.
+    bool play(TrackChain* chain) { return pushCommand(Command::PLAY, chain, 0, 0); }
+
+    bool crossfade(TrackChain* chain, int ms, int curve) {
+        const uint32_t frames = (uint32_t)std::max(1.0, (double)ms * m_freq / 1000.0);
+        return pushCommand(Command::CROSSFADE, chain, frames, curve);
+    }
+
+    bool queueNext(TrackChain* chain) { return pushCommand(Command::QUEUE, chain, 0, 0); }
+    bool cancelQueued(TrackChain* chain) { return pushCommand(Command::CANCEL_QUEUED, chain, 0, 0); }
+
+    // Seek/stop: sönen kaynakları bırak, birincil kaynağın tamponlarını sıfırla
+    void flush() { m_flushRequested = true; }
+
+    Stats getStats() const {
+        Stats stats;
+        stats.sources = m_statSources.load(std::memory_order_relaxed);
+        stats.fading = m_statFading.load(std::memory_order_relaxed);
+        stats.queued = m_statQueued.load(std::memory_order_relaxed);
+        stats.ended = m_ended.load();
+        stats.retired = m_retired.load(std::memory_order_relaxed);
+        stats.forcedRetires = m_forcedRetires.load(std::memory_order_relaxed);
+        stats.advances = m_advances.load(std::memory_order_relaxed);
+        stats.underruns = m_underruns.load(std::memory_order_relaxed);
+        stats.blockFrames = m_blockFrames.load(std::memory_order_relaxed);
+        stats.maxBlockFrames = m_maxBlockFrames.load(std::memory_order_relaxed);
+        stats.freq = m_freq;
+        return stats;
+    }
+
+private:
+    struct Command {
+        enum Type : uint8_t { PLAY, CROSSFADE, QUEUE, CANCEL_QUEUED };
+        Type type;
+        uint8_t curve;
+        uint32_t fadeFrames;
+        uint32_t epoch;
+        TrackChain* chain;
+    };
+
+    struct Event {
+        enum Type : uint8_t { RETIRED, ADVANCED };
+        Type type;
+        uint32_t epoch;
+        TrackChain* chain;
+    };
+
+    struct Source {
+        TrackChain* chain;
+        bool fadingOut;
+        bool ended;
+        int curve;
+        float gainFrom;
+        float gainTo;
+        uint32_t fadeLen;
+        uint32_t fadePos;
+        // Kaynak hızı != çıkış hızı ise polyphase dönüştürücü
+        bool resample;
+        PolyphaseResampler resampler;
+        float in[IN_FRAMES * 2];
+        int inPos;
+        int inLen;
+    };
+
+    static DWORD CALLBACK streamProc(HSTREAM handle, void* buffer, DWORD length, void* user) {
+        (void)handle;
+        return static_cast<CrossfadeMixer*>(user)->render(static_cast<float*>(buffer), length);
+    }
+
+    static void CALLBACK stallSync(HSYNC handle, DWORD channel, DWORD data, void* user) {
+        (void)handle;
+        (void)channel;
+        CrossfadeMixer* mixer = static_cast<CrossfadeMixer*>(user);
+        if (data == 0 && !mixer->m_ended.load()) {
+            mixer->m_underruns.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool pushCommand(Command::Type type, TrackChain* chain, uint32_t fadeFrames, int curve) {
+        Command cmd;
+        cmd.type = type;
+        cmd.curve = (uint8_t)std::max(0, std::min(2, curve));
+        cmd.fadeFrames = fadeFrames;
+        cmd.chain = chain;
+        const bool primary = (type == Command::PLAY || type == Command::CROSSFADE);
+        cmd.epoch = primary ? m_epoch.load() + 1 : 0;
+        if (!m_commands.push(cmd)) {
+            AURIVO_LOG_WARN("[MIXER] Command queue full");
+            return false;
+        }
+        if (primary) m_epoch.store(cmd.epoch);
+        return true;
+    }
+
+    // ---- Audio thread ----
+    DWORD render(float* out, DWORD length) {
+        if (m_profiler) m_profiler->beginBlock();
+        CallbackProfiler::StageTimer stage(m_profiler, CallbackProfiler::STAGE_MIXER);
+        const DWORD frames = length / (sizeof(float) * 2);
+        m_blockFrames.store((uint32_t)frames, std::memory_order_relaxed);
+        if ((uint32_t)frames > m_maxBlockFrames.load(std::memory_order_relaxed)) {
+            m_maxBlockFrames.store((uint32_t)frames, std::memory_order_relaxed);
+        }
+        drainCommands(false);
+        if (m_flushRequested.exchange(false)) applyFlush();
+
+        std::memset(out, 0, (size_t)frames * 2 * sizeof(float));
+        DWORD done = 0;
+        while (done < frames) {
+            const int n = (int)std::min<DWORD>(frames - done, CHUNK_FRAMES);
+            mixChunk(out + (size_t)done * 2, n);
+            done += (DWORD)n;
+        }
+        flushPendingEvents();
+        publishStats();
+
+        // Birincil kaynak bitti ve sönen kaynak kalmadı: çıkış buffer'ı çalınıp biter
+        bool anyLive = false;
+        for (int i = 0; i < MAX_SOURCES; ++i) {
+            if (m_sources[i].chain && !m_sources[i].ended) anyLive = true;
+        }
+        if (!anyLive && m_primary >= 0 && m_sources[m_primary].ended) {
+            m_ended = true;
+            return (frames * 2 * sizeof(float)) | BASS_STREAMPROC_END;
+        }
+        return frames * 2 * sizeof(float);
+    }
+
+    // Audio thread'de bekleyen olay listesi ayrılmış kapasiteyi aşmasın diye
+    // yer kalmadıysa komutlar kuyrukta bırakılır (sonraki blokta uygulanır).
+    // close() çıkış kapandıktan sonra çağırır; orada liste büyüyebilir.
+    void drainCommands(bool unbounded) {
+        Command cmd;
+        while ((unbounded || (int)m_pending.size() + PENDING_HEADROOM <= PENDING_CAPACITY) &&
+               m_commands.pop(cmd)) {
+            switch (cmd.type) {
+                case Command::PLAY:
+                    m_appliedEpoch = cmd.epoch;
+                    applyPlay(cmd.chain);
+                    break;
+                case Command::CROSSFADE:
+                    m_appliedEpoch = cmd.epoch;
+                    applyCrossfade(cmd.chain, cmd.fadeFrames, cmd.curve);
+                    break;
+                case Command::QUEUE:
+                    if (m_queued && m_queued != cmd.chain) retireChain(m_queued);
+                    m_queued = cmd.chain;
+                    break;
+                case Command::CANCEL_QUEUED:
+                    if (m_queued == cmd.chain) {
+                        retireChain(m_queued);
+                        m_queued = nullptr;
+                    }
+                    break;
+            }
+        }
+    }
+
+    int findSlot(TrackChain* chain) const {
+        for (int i = 0; i < MAX_SOURCES; ++i) {
+            if (m_sources[i].chain == chain) return i;
+        }
+        return -1;
+    }
+
+    void initSource(Source& s, TrackChain* chain, float gainFrom, float gainTo, uint32_t fadeLen, int curve) {
+        s.chain = chain;
+        s.fadingOut = false;
+        s.ended = false;
+        s.curve = curve;
+        s.gainFrom = gainFrom;
+        s.gainTo = gainTo;
+        s.fadeLen = fadeLen;
+        s.fadePos = 0;
+        s.resample = chain->freq && m_freq && chain->freq != m_freq;
+        if (s.resample) s.resampler.configure(chain->freq, m_freq);
+        s.inPos = 0;
+        s.inLen = 0;
+    }
+
+    void applyPlay(TrackChain* chain) {
+        if (m_queued == chain) m_queued = nullptr;
+        const int existing = findSlot(chain);
+        for (int i = 0; i < MAX_SOURCES; ++i) {
+            if (i != existing && m_sources[i].chain) retireSlot(i);
+        }
+        int slot = existing;
+        if (slot < 0) {
+            slot = 0;
+            initSource(m_sources[slot], chain, 1.0f, 1.0f, 0, CURVE_LINEAR);
+        } else {
+            Source& s = m_sources[slot];
+            s.fadingOut = false;
+            s.gainFrom = s.gainTo = 1.0f;
+            s.fadeLen = s.fadePos = 0;
+        }
+        m_primary = slot;
+        m_ended = false;
+    }
+
+    void applyCrossfade(TrackChain* chain, uint32_t fadeFrames, int curve) {
+        if (m_queued == chain) m_queued = nullptr;
+        if (m_primary >= 0 && m_sources[m_primary].chain == chain) return;  // zaten aktif
+
+        // Mevcut birincil kaynak o anki kazancından sönmeye başlar
+        if (m_primary >= 0) {
+            Source& old = m_sources[m_primary];
+            if (old.ended) {
+                retireSlot(m_primary);
+            } else {
+                old.gainFrom = currentGain(old);
+                old.gainTo = 0.0f;
+                old.fadingOut = true;
+                old.fadeLen = fadeFrames;
+                old.fadePos = 0;
+                old.curve = curve;
+            }
+        }
+
+        int slot = -1;
+        for (int i = 0; i < MAX_SOURCES; ++i) {
+            if (!m_sources[i].chain) { slot = i; break; }
+        }
+        if (slot < 0) {
+            // Yer yok: en sessiz sönen kaynağı hemen bırak
+            float quietest = 2.0f;
+            for (int i = 0; i < MAX_SOURCES; ++i) {
+                const float g = currentGain(m_sources[i]);
+                if (m_sources[i].fadingOut && g < quietest) { quietest = g; slot = i; }
+            }
+            if (slot < 0) slot = 0;
+            retireSlot(slot);
+            m_forcedRetires.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        initSource(m_sources[slot], chain, 0.0f, 1.0f, fadeFrames, curve);
+        m_primary = slot;
+        m_ended = false;
+    }
+
+    void applyFlush() {
+        for (int i = 0; i < MAX_SOURCES; ++i) {
+            Source& s = m_sources[i];
+            if (!s.chain) continue;
+            if (i != m_primary) {
+                retireSlot(i);
+                continue;
+            }
+            s.chain->prerollPos.store((uint32_t)s.chain->preroll.size(), std::memory_order_relaxed);
+            s.gainFrom = s.gainTo = 1.0f;
+            s.fadeLen = s.fadePos = 0;
+            if (s.resample) s.resampler.reset();
+            s.inPos = s.inLen = 0;
+            s.ended = false;
+        }
+        m_ended = false;
+    }
+
+    static float shape(int curve, float x) {
+        switch (curve) {
+            case CURVE_LINEAR: return x;
+            case CURVE_SCURVE: return x * x * (3.0f - 2.0f * x);
+            default:           return std::sin(x * (float)M_PI * 0.5f);
+        }
+    }
+
+    // Fade-in: gainFrom -> gainTo, fade-out: gainFrom * shape(1 - t).
+    // Equal-power'da sin^2 + cos^2 = 1, S-curve/linear'de in + out = 1.
+    static float currentGain(const Source& s) {
+        if (!s.chain) return 0.0f;
+        if (s.fadeLen == 0 || s.fadePos >= s.fadeLen) return s.fadingOut ? 0.0f : s.gainTo;
+        const float t = (float)s.fadePos / (float)s.fadeLen;
+        if (s.fadingOut) return s.gainFrom * shape(s.curve, 1.0f - t);
+        return s.gainFrom + (s.gainTo - s.gainFrom) * shape(s.curve, t);
+    }
+
+    // Kaynaktan stereo frame oku: önce preroll, sonra decode stream
+    int readFrames(Source& s, float* dst, int frames) {
+        TrackChain* c = s.chain;
+        const int chans = (int)std::max<DWORD>(1, std::min<DWORD>(c->chans, MAX_CHANNELS));
+        int got = 0;
+
+        uint32_t pos = c->prerollPos.load(std::memory_order_relaxed);
+        const uint32_t total = (uint32_t)c->preroll.size();
+        while (got < frames && pos + (uint32_t)chans <= total) {
+            const float* f = &c->preroll[pos];
+            dst[got * 2] = f[0];
+            dst[got * 2 + 1] = (chans > 1) ? f[1] : f[0];
+            pos += (uint32_t)chans;
+            ++got;
+        }
+        c->prerollPos.store(pos, std::memory_order_relaxed);
+        if (got == frames) return got;
+
+        const int want = frames - got;
+        const DWORD bytes = (DWORD)(want * chans * (int)sizeof(float));
+        const DWORD read = BASS_ChannelGetData(c->stream, m_raw, bytes | BASS_DATA_FLOAT);
+        if (read == (DWORD)-1) return got;
+        const int readFrames = (int)(read / (sizeof(float) * chans));
+        for (int i = 0; i < readFrames; ++i) {
+            const float* f = &m_raw[i * chans];
+            dst[(got + i) * 2] = f[0];
+            dst[(got + i) * 2 + 1] = (chans > 1) ? f[1] : f[0];
+        }
+        return got + readFrames;
+    }
+
+    // outer: resample aşaması; zincir okuması (decode + parça DSP'leri) ondan düşülür
+    bool nextInputFrame(Source& s, float* frame, CallbackProfiler::StageTimer& outer) {
+        if (s.inPos >= s.inLen) {
+            if (outer.active()) {
+                const CallbackProfiler::Clock::time_point start = CallbackProfiler::Clock::now();
+                s.inLen = readFrames(s, s.in, IN_FRAMES);
+                outer.exclude(CallbackProfiler::Clock::now() - start);
+            } else {
+                s.inLen = readFrames(s, s.in, IN_FRAMES);
+            }
+            s.inPos = 0;
+            if (s.inLen <= 0) return false;
+        }
+        frame[0] = s.in[s.inPos * 2];
+        frame[1] = s.in[s.inPos * 2 + 1];
+        ++s.inPos;
+        return true;
+    }
+
+    // Kaynaktan çıkış hızında frame üret (aynı hızda birebir kopya)
+    int pull(Source& s, float* dst, int frames) {
+        if (s.resample) {
+            CallbackProfiler::StageTimer stage(m_profiler, CallbackProfiler::STAGE_RESAMPLE);
+            return s.resampler.process(dst, frames, [this, &s, &stage](float* frame) { return nextInputFrame(s, frame, stage); });
+        }
+        int produced = 0;
+        while (produced < frames) {
+            if (s.inPos >= s.inLen) {
+                s.inLen = readFrames(s, s.in, IN_FRAMES);
+                s.inPos = 0;
+                if (s.inLen <= 0) break;
+            }
+            const int n = std::min(frames - produced, s.inLen - s.inPos);
+            std::memcpy(dst + (size_t)produced * 2, s.in + (size_t)s.inPos * 2, (size_t)n * 2 * sizeof(float));
+            s.inPos += n;
+            produced += n;
+        }
+        return produced;
+    }
+
+    int mixSource(Source& s, float* out, int frames) {
+        const int got = pull(s, m_scratch, frames);
+        for (int i = 0; i < got; ++i) {
+            float g;
+            if (s.fadeLen == 0 || s.fadePos >= s.fadeLen) {
+                g = s.fadingOut ? 0.0f : s.gainTo;
+            } else {
+                g = currentGain(s);
+                ++s.fadePos;
+            }
+            out[i * 2] += m_scratch[i * 2] * g;
+            out[i * 2 + 1] += m_scratch[i * 2 + 1] * g;
+        }
+        return got;
+    }
+
+    void mixChunk(float* out, int frames) {
+        for (int i = 0; i < MAX_SOURCES; ++i) {
+            Source& s = m_sources[i];
+            if (!s.chain || s.ended) continue;
+
+            int got = mixSource(s, out, frames);
+            if (s.fadingOut && s.fadePos >= s.fadeLen) {
+                retireSlot(i);
+                continue;
+            }
+            if (got >= frames) continue;
+
+            // Kaynak bitti
+            if (i == m_primary && m_queued) {
+                // Gapless: aynı blokta kaldığı yerden sıradaki parçayla devam et
+                // ADVANCED önce gider: engine handle takasını eski zincir
+                // serbest bırakılmadan yapar (reclaimer olayları sırayla işler)
+                TrackChain* finished = s.chain;
+                TrackChain* next = m_queued;
+                m_queued = nullptr;
+                postEvent(Event::ADVANCED, next);
+                initSource(s, next, 1.0f, 1.0f, 0, CURVE_LINEAR);
+                retireChain(finished);
+                m_primary = i;
+                m_advances.fetch_add(1, std::memory_order_relaxed);
+                mixSource(s, out + (size_t)got * 2, frames - got);
+            } else if (i == m_primary) {
+                s.ended = true;   // engine pozisyon/süre sorgusu için zincir tutulur
+            } else {
+                retireSlot(i);
+            }
+        }
+    }
+
+    void retireSlot(int i) {
+        Source& s = m_sources[i];
+        if (!s.chain) return;
+        retireChain(s.chain);
+        s.chain = nullptr;
+        if (m_primary == i) m_primary = -1;
+    }
+
+    void retireChain(TrackChain* chain) {
+        if (!chain) return;
+        postEvent(Event::RETIRED, chain);
+        m_retired.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Olay hiçbir zaman atılmaz: kuyruk doluysa (ya da önünde bekleyen varsa,
+    // sıra korunsun diye) bekleyen listesine girer ve her blokta tekrar denenir
+    void postEvent(Event::Type type, TrackChain* chain) {
+        Event ev;
+        ev.type = type;
+        ev.epoch = m_appliedEpoch;
+        ev.chain = chain;
+        if (m_pending.empty() && m_events.push(ev)) {
+            m_reclaimCv.notify_one();
+            return;
+        }
+        m_pending.push_back(ev);
+    }
+
+    void flushPendingEvents() {
+        size_t sent = 0;
+        while (sent < m_pending.size() && m_events.push(m_pending[sent])) ++sent;
+        if (sent == 0) return;
+        m_pending.erase(m_pending.begin(), m_pending.begin() + (std::ptrdiff_t)sent);
+        m_reclaimCv.notify_one();
+    }
+
+    void publishStats() {
+        int sources = 0;
+        int fading = 0;
+        for (int i = 0; i < MAX_SOURCES; ++i) {
+            if (!m_sources[i].chain) continue;
+            ++sources;
+            if (m_sources[i].fadingOut) ++fading;
+        }
+        m_statSources.store(sources, std::memory_order_relaxed);
+        m_statFading.store(fading, std::memory_order_relaxed);
+        m_statQueued.store(m_queued != nullptr, std::memory_order_relaxed);
+    }
+
+    // ---- Reclaimer thread ----
+    void reclaimLoop() {
+        for (;;) {
+            bool stopping;
+            {
+                std::unique_lock<std::mutex> lock(m_reclaimMutex);
+                m_reclaimCv.wait_for(lock, std::chrono::milliseconds(50));
+                stopping = m_reclaimerStop;
+            }
+            Event ev;
+            while (m_events.pop(ev)) {
+                if (ev.type == Event::RETIRED) {
+                    freeTrackChain(ev.chain);
+                } else if (ev.type == Event::ADVANCED && m_onAdvance && !stopping) {
+                    m_onAdvance(ev.chain, ev.epoch);
+                }
+            }
+            if (stopping) return;
+        }
+    }
+
+    HSTREAM m_output;
+    DWORD m_freq;
+    Source m_sources[MAX_SOURCES];
+    int m_primary;
+    TrackChain* m_queued;
+    float m_scratch[CHUNK_FRAMES * 2];
+    float m_raw[IN_FRAMES * MAX_CHANNELS];
+    std::vector<Event> m_pending;   // m_events'e sığmayan olaylar, sırayla
+
+    SpscQueue<Command, 64> m_commands;
+    SpscQueue<Event, 64> m_events;
+    std::atomic<bool> m_flushRequested;
+    std::atomic<bool> m_ended;
+    std::atomic<uint32_t> m_epoch;     // kontrol tarafı (close, PLAY/CROSSFADE)
+    uint32_t m_appliedEpoch;           // mixer thread'inin uyguladığı son PLAY/CROSSFADE
+
+    std::atomic<uint64_t> m_retired;
+    std::atomic<uint64_t> m_forcedRetires;
+    std::atomic<uint64_t> m_advances;
+    std::atomic<int> m_statSources{0};
+    std::atomic<int> m_statFading{0};
+    std::atomic<bool> m_statQueued{false};
+    std::atomic<uint64_t> m_underruns{0};
+    std::atomic<uint32_t> m_blockFrames{0};
+    std::atomic<uint32_t> m_maxBlockFrames{0};
+
+    CallbackProfiler* m_profiler = nullptr;
+    std::function<void(TrackChain*, uint32_t)> m_onAdvance;
+    std::mutex m_reclaimMutex;
+    std::condition_variable m_reclaimCv;
+    std::thread m_reclaimer;
+    bool m_reclaimerStop;
+    bool m_reclaimerRunning;
+};
+
+#ifdef AURIVO_ENGINE_STRESS
+// aurivo_engine_stress: reclaimer'ın gapless geçiş bildirimini geciktirir,
+// böylece araya bir yükleme commit'i girer (yalnızca test derlemesinde)
+static std::atomic<int> g_stressAdvanceDelayUs{0};
+#endif
+
+// ============================================
+// AURIVO AUDIO ENGINE SINIFI
+// ============================================
+class AurivoAudioEngine {
+private:
+    // Stream handles (aktif parça zincirinin aynaları; çıkış m_mixer'da)
+    HSTREAM m_stream;
+    HSTREAM m_decodeStream;
+    HSTREAM m_analysisStream;
+
+    // Aktif parça zinciri (sahibi mikser) ve çıkış mikseri
+    TrackChain* m_chain;
+    CrossfadeMixer m_mixer;
+    int m_crossfadeCurve;
+
+    // Cihazın çıkış hızı ve bit-transparent modu (cihazı parçanın hızına geçir)
+    DWORD m_deviceRate;
+    bool m_bitTransparent;
+
+    // Çıkış gecikme profili (BASS_CONFIG_BUFFER) ve profil başına underrun sayısı
+    int m_latencyProfileMs;
+    uint64_t m_underrunsByProfile[4] = {};
+    uint64_t m_underrunBase = 0;        // mikser sayacının son hesaba katılan değeri
+    
+    // Effect handles - SADECE 32 BANT EQ + PREAMP + REVERB
+    HFX m_eqFx[NUM_EQ_BANDS];
+    HFX m_preampFx;
+    HFX m_reverbFx;  // Reverb effect handle
+
+    // Aurivo DSP (aktif parçanın ya da bus modunda bus'ın örneği)
+    void* m_aurivoDSP;
+    HDSP m_dspHandle;
+
+    // Master-bus modu: preamp + MasterDSP + limiter + reverb mikser çıkışında tek kez
+    std::atomic<bool> m_busMode;
+    void* m_busDsp;
+    MasterDspState m_busDspState;  // bus DSP'ye uygulanan parametreler (bus callback'i)
+    HSTREAM m_busOutput;           // bus FX handle'larının bağlı olduğu çıkış
+    HDSP m_busDspHandle;
+    HFX m_busPreampFx;
+    HFX m_busReverbFx;
+    ColorFx m_busColor;            // tape saturation + bit/dither (bus modu)
+    TruePeakLimiter m_busLimiter;
+
+    // Loudness metresi + onun sürdüğü AGC katı (birincil sinyal, audio thread)
+    LoudnessMeter m_loudness;
+    MeterBank m_meters;
+    StereoAnalyzer m_stereo;
+    CallbackProfiler m_profiler;
+    AutoGainStage m_autoGainStage;
+
+    // Kütüphane loudness tarayıcısı + ReplayGain (openTrack önbellekteki kazancı uygular)
+    LoudnessCache m_loudnessCache;
+    LoudnessScanner m_scanner{m_loudnessCache};
+    WaveformCache m_waveforms;
+    OfflineRenderer m_renderer;
+    std::atomic<int> m_replayGainMode{REPLAYGAIN_TRACK};
+    std::atomic<float> m_replayGainPreamp{0.0f};
+    std::atomic<bool> m_replayGainPreventClip{true};
+
+    // Konvolüsyon reverb: mikser çıkışında, kernel arka plan kuyruğunda kurulur
+    ConvolutionReverb m_convolver;
+    std::atomic<uint64_t> m_irSeq;     // son IR isteği (eski kurulumlar atılır)
+    uint32_t m_irRate;                 // son istenen IR hızı (0 = istenmedi)
+    // Decode edilmiş IR dosyası (yalnızca iş kuyruğu thread'i dokunur)
+    std::string m_irCachePath;
+    uint32_t m_irCacheRate;
+    std::vector<float> m_irCacheL;
+    std::vector<float> m_irCacheR;
+
+    // loadFile/crossfade istek sayacı (eski hazırlıkları commit'te atmak için)
+    std::atomic<uint64_t> m_loadSeq;
+    
+    // Ses parameters
+    float m_masterVolume;      // 0-100
+    float m_preampGain;        // -12dB to +12dB
+    float m_eqGains[NUM_EQ_BANDS];  // -15dB to +15dB per band
+    float m_bassBoost;         // 0-100
+    float m_balance;           // -100 (left) to +100 (right)
+    
+    // Aurivo Module parameters - SADECE DEĞER SAKLA
+    float m_bassGain;          // -15dB to +15dB (100Hz)
+    float m_midGain;           // -15dB to +15dB (500Hz-2kHz)
+    float m_trebleGain;        // -15dB to +15dB (10kHz)
+    float m_stereoExpander;    // 0-200%
+    
+    // Reverb parameters
+    bool m_reverbEnabled;
+    float m_reverbRoomSize;    // 0-3000ms
+    float m_reverbDamping;     // 0-1
+    float m_reverbWetDry;      // -96 to 0 dB
+    float m_reverbHFRatio;     // 0.001-0.999
+    float m_reverbInputGain;   // -96 to +12 dB
+    
+    // DSP Master Etkinleştir
+    bool m_dspEnabled;                       // Master DSP on/off switch
+    
+    // Durum
+    bool m_initialized;
+    std::mutex m_mutex;
+    
+    // FFT data
+    float m_fftData[FFT_SIZE];
+    std::atomic<bool> m_fftReady;
+
+    // Post-DSP analiz tap'i (dspCallback yazar, FFT/PCM getter'ları okur)
+    AnalysisTap m_analysisTap;
+
+    // Legacy: analiz için parça başına ikinci decoder aç (varsayılan kapalı)
+    bool m_analysisDecoderEnabled;
+    
+    // Singleton
+    static AurivoAudioEngine* s_instance;
+
+public:
+    AurivoAudioEngine() 
+        : m_stream(0)
+        , m_decodeStream(0)
+        , m_analysisStream(0)
+        , m_chain(nullptr)
+        , m_crossfadeCurve(CrossfadeMixer::CURVE_EQUAL_POWER)
+        , m_deviceRate(FALLBACK_SAMPLE_RATE)
+        , m_bitTransparent(false)
+        , m_latencyProfileMs(500)
+        , m_preampFx(0)
+        , m_reverbFx(0)
+        , m_aurivoDSP(nullptr)
+        , m_dspHandle(0)
+        , m_busMode(false)
+        , m_busDsp(nullptr)
+        , m_busOutput(0)
+        , m_busDspHandle(0)
+        , m_busPreampFx(0)
+        , m_busReverbFx(0)
+        , m_irSeq(0)
+        , m_irRate(0)
+        , m_irCacheRate(0)
+        , m_loadSeq(0)
+        , m_masterVolume(100.0f)
+        , m_preampGain(0.0f)
+        , m_bassBoost(0.0f)
+        , m_balance(0.0f)
+        , m_bassGain(0.0f)
+        , m_midGain(0.0f)
+        , m_trebleGain(0.0f)
+        , m_stereoExpander(100.0f)
+        , m_reverbEnabled(false)
+        , m_reverbRoomSize(1000.0f)
+        , m_reverbDamping(0.5f)
+        , m_reverbWetDry(-6.0f)
+        , m_reverbHFRatio(0.5f)
+        , m_reverbInputGain(0.0f)
+        , m_dspEnabled(true)         // DSP varsayılan açık
+        , m_initialized(false)
+        , m_fftReady(false)
+        , m_analysisDecoderEnabled(false)
+    {
+        // EQ handles ve gains sıfırla
+        for (int i = 0; i < NUM_EQ_BANDS; ++i) {
+            m_eqFx[i] = 0;
+            m_eqGains[i] = 0.0f;
+        }
+
+        // Aurivo DSP oluştur
+        m_aurivoDSP = create_dsp();
+        if (m_aurivoDSP) {
+            set_sample_rate(m_aurivoDSP, FALLBACK_SAMPLE_RATE);
+            set_dsp_enabled(m_aurivoDSP, 1);
+        }
+        // Her zincirin başlangıç ayarları (eskiden configureDsp'nin taşıdıkları)
+        publishEqAndToneParams();
+        publishCrossfeedParams();
+        publishBassMonoParams();
+        
+        memset(m_fftData, 0, sizeof(m_fftData));
+        s_instance = this;
+    }
+    
+    ~AurivoAudioEngine() {
+        cleanup();
+        s_instance = nullptr;
+    }
+    
+    // ============================================
+    // INITIALIZATION
+    // ============================================
+    bool initialize(int deviceIndex = -1) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        
+        if (m_initialized) return true;
+        
+        // BASS'ı başlat (stereo). BASS_DEVICE_FREQ verilmez: WASAPI/CoreAudio
+        // cihazın mevcut (native) hızında kalır; hızı kendisi seçen çıkışlarda
+        // (ALSA) FALLBACK_SAMPLE_RATE istenir. Gerçek hız BASS_GetInfo'dan okunur.
+        // deviceIndex: -1 = default device
+        if (!BASS_Init(deviceIndex, FALLBACK_SAMPLE_RATE, 0, nullptr, nullptr)) {
+            int error = BASS_ErrorGetCode();
+            if (error != BASS_ERROR_ALREADY) {
+                return false;
+            }
+        }
+        refreshDeviceRate();
+        if (m_aurivoDSP && !m_chain) set_sample_rate(m_aurivoDSP, (float)m_deviceRate);
+        m_analysisTap.setSampleRate((int)m_deviceRate);
+        AURIVO_LOG_INFO("[ENGINE] Output device rate: %u Hz", (unsigned)m_deviceRate);
+        
+        // BASS_FX version kontrolü
+        DWORD fxVersion = BASS_FX_GetVersion();
+        if (fxVersion == 0) {
+            BASS_Free();
+            return false;
+        }
+        
+        // Format plugins'ini yükle
+        // AAC/M4A support için bass_aac plugin
+        HPLUGIN aacPlugin = BASS_PluginLoad("libbass_aac.so", 0);
+        if (aacPlugin) {
+            AURIVO_LOG_INFO("✓ BASS AAC Plugin loaded (M4A/AAC support enabled)");
         } else {
-            printf("⚠ BASS AAC Plugin failed to load (error: %d)\n", BASS_ErrorGetCode());
+            AURIVO_LOG_WARN("⚠ BASS AAC Plugin failed to load (error: %d)", BASS_ErrorGetCode());
         }
         
         // FLAC support için bassflac plugin  
         HPLUGIN flacPlugin = BASS_PluginLoad("libbassflac.so", 0);
         if (flacPlugin) {
-            printf("✓ BASS FLAC Plugin loaded\n");
+            AURIVO_LOG_INFO("✓ BASS FLAC Plugin loaded");
         }
         
         // APE support için bassape plugin
         HPLUGIN apePlugin = BASS_PluginLoad("libbassape.so", 0);
         if (apePlugin) {
-            printf("✓ BASS APE Plugin loaded\n");
+            AURIVO_LOG_INFO("✓ BASS APE Plugin loaded");
         }
         
         // WavePack support için basswv plugin
         HPLUGIN wvPlugin = BASS_PluginLoad("libbasswv.so", 0);
         if (wvPlugin) {
-            printf("✓ BASS WavePack Plugin loaded\n");
+            AURIVO_LOG_INFO("✓ BASS WavePack Plugin loaded");
         }
         
         // Global BASS ayarları
         BASS_SetConfig(BASS_CONFIG_FLOATDSP, TRUE);  // Float DSP processing
-        BASS_SetConfig(BASS_CONFIG_BUFFER, 500);      // 500ms buffer
-        BASS_SetConfig(BASS_CONFIG_UPDATEPERIOD, 10); // 10ms update
+        applyLatencyConfig();                         // buffer + update period (profil)
         
+        m_tasks.start();
+        m_convolver.start();
+        m_mixer.setProfiler(&m_profiler);
+        m_mixer.setAdvanceHandler([this](TrackChain* chain, uint32_t epoch) { onMixerAdvanced(chain, epoch); });
+        m_mixer.startReclaimer();
         m_initialized = true;
         return true;
     }
     
     void cleanup() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        // Invalidate any pending crossfade cleanup threads
-        m_crossfadeGeneration.fetch_add(1);
-        
-        if (m_stream) {
-            BASS_ChannelStop(m_stream);
-            clearAllFx();
-            BASS_StreamFree(m_stream);
+        // Kuyruk görevleri ve reclaimer m_mutex alır; kilitten önce durdur
+        m_tasks.stop();
+        // Tarayıcının decode stream'leri BASS_Free'den önce kapanmalı
+        m_scanner.stop();
+        m_waveforms.stop();
+        m_renderer.stop();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            releaseNextLocked();
+
+            // Aktif ve sönen zincirler reclaimer'a gider
+            TrackChain* queued = m_mixer.close(nullptr);
+            freeTrackChain(queued);
+            if (m_chain) {
+                // Zincir DSP'si reclaimer'da serbest bırakılır
+                m_aurivoDSP = nullptr;
+            }
+            m_chain = nullptr;
             m_stream = 0;
-        }
-
-        if (m_prevStream) {
-            BASS_ChannelStop(m_prevStream);
-            clearAllFxForStream(m_prevStream, m_prevDspHandle, m_prevPreampFx, m_prevReverbFx);
-            BASS_StreamFree(m_prevStream);
-            m_prevStream = 0;
-        }
-
-        if (m_analysisStream) {
-            BASS_StreamFree(m_analysisStream);
             m_analysisStream = 0;
+            m_dspHandle = 0;
+            m_preampFx = 0;
+            m_reverbFx = 0;
+            fxCompressor = 0;
+            m_busOutput = 0;
+            m_busDspHandle = 0;
+            m_busPreampFx = 0;
+            m_busReverbFx = 0;
         }
 
-        if (m_prevAnalysisStream) {
-            BASS_StreamFree(m_prevAnalysisStream);
-            m_prevAnalysisStream = 0;
-        }
+        // Retire edilen zincirleri BASS_Free'den önce serbest bırak
+        m_mixer.stopReclaimer();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_analysisTap.reset();
         
         if (m_initialized) {
             BASS_Free();
             m_initialized = false;
         }
-
+        // Konvolüsyon worker'ı callback'ler bittikten sonra durur
+        m_convolver.stop();
+        m_irRate = 0;
+
+        if (m_busDsp) {
+            if (m_aurivoDSP == m_busDsp) m_aurivoDSP = nullptr;
+            destroy_dsp(m_busDsp);
+            m_busDsp = nullptr;
+            m_busDspState.synced = false;
+        }
         if (m_aurivoDSP) {
             destroy_dsp(m_aurivoDSP);
             m_aurivoDSP = nullptr;
         }
+    }
+    
+    // ============================================
+    // LATENCY PROFILE
+    // ============================================
+    // BASS_CONFIG_BUFFER, bir EQ/efekt değişikliğinin duyulma gecikmesi ve
+    // visualizer'ın hoparlörün ne kadar önünde olduğudur. Profil init'te ve
+    // çalışırken uygulanır; buffer ayarı yalnızca yeni stream'lere etki ettiği
+    // için çalışırken mikser çıkışı duyulan pozisyondan yeniden açılır.
+    static constexpr int NUM_LATENCY_PROFILES = 4;
+    static constexpr int LATENCY_PROFILES_MS[NUM_LATENCY_PROFILES] = { 40, 100, 250, 500 };
+
+    struct LatencyInfo {
+        int profileMs = 0;
+        int bufferMs = 0;            // BASS_CONFIG_BUFFER
+        int updatePeriodMs = 0;      // BASS_CONFIG_UPDATEPERIOD
+        int deviceLatencyMs = 0;     // BASS_INFO.latency
+        int minBufferMs = 0;         // BASS_INFO.minbuf (önerilen en küçük buffer)
+        double bufferedMs = 0.0;     // çıkış buffer'ında şu an bekleyen
+        double limiterMs = 0.0;      // true-peak limiter lookahead + dedektör gecikmesi
+        double totalMs = 0.0;        // bufferedMs + limiterMs + deviceLatencyMs (duyulma gecikmesi)
+        uint32_t blockFrames = 0;    // son DSP bloğu (STREAMPROC isteği)
+        uint32_t maxBlockFrames = 0;
+        DWORD sampleRate = 0;        // mikser çıkışı
+        DWORD deviceRate = 0;
+        bool bitTransparent = false;
+        uint64_t underruns = 0;
+        uint64_t underrunsByProfile[NUM_LATENCY_PROFILES] = {};
+    };
 
-        if (m_prevAurivoDSP) {
-            destroy_dsp(m_prevAurivoDSP);
-            m_prevAurivoDSP = nullptr;
+    static int latencyProfileIndex(int ms) {
+        for (int i = 0; i < NUM_LATENCY_PROFILES; ++i) {
+            if (LATENCY_PROFILES_MS[i] == ms) return i;
         }
+        return -1;
+    }
 
-        m_overlapCrossfadeActive = false;
+    // Küçük buffer'da güncelleme periyodu buffer'ın birkaç katı sığacak kadar kısa olmalı
+    static int updatePeriodForBuffer(int bufferMs) {
+        return bufferMs <= 40 ? 5 : 10;
     }
-    
+
+    bool setLatencyProfile(int ms) {
+        if (latencyProfileIndex(ms) < 0) return false;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (ms == m_latencyProfileMs) return true;
+
+        accountUnderrunsLocked();
+        m_latencyProfileMs = ms;
+        if (!m_initialized) return true;   // initialize() uygular
+
+        applyLatencyConfig();
+        if (m_chain && m_mixer.output() && !m_mixer.ended()) {
+            const bool wasPlaying = m_mixer.isPlaying();
+            const double heard = heardPositionLocked();
+            BASS_ChannelSetPosition(m_stream, BASS_ChannelSeconds2Bytes(m_stream, heard), BASS_POS_BYTE);
+            if (reopenOutputLocked() && wasPlaying) {
+                BASS_ChannelPlay(m_mixer.output(), FALSE);
+            }
+        }
+        g_pcmShmRing.setLatencyMs(outputLatencyMs());
+        AURIVO_LOG_INFO("[LATENCY] Profile: %d ms buffer, %d ms update period", ms, updatePeriodForBuffer(ms));
+        return true;
+    }
+
+    int getLatencyProfile() const {
+        return m_latencyProfileMs;
+    }
+
+    // Tap'e yazılan sample'ın hoparlöre ulaşma süresi (buffer + cihaz)
+    int outputLatencyMs() const {
+        int latencyMs = (int)BASS_GetConfig(BASS_CONFIG_BUFFER);
+        BASS_INFO bassInfo;
+        if (BASS_GetInfo(&bassInfo)) latencyMs += (int)bassInfo.latency;
+        return latencyMs;
+    }
+
+    LatencyInfo getLatencyInfo() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        accountUnderrunsLocked();
+
+        LatencyInfo info;
+        info.profileMs = m_latencyProfileMs;
+        if (m_initialized) {
+            info.bufferMs = (int)BASS_GetConfig(BASS_CONFIG_BUFFER);
+            info.updatePeriodMs = (int)BASS_GetConfig(BASS_CONFIG_UPDATEPERIOD);
+            BASS_INFO bassInfo;
+            if (BASS_GetInfo(&bassInfo)) {
+                info.deviceLatencyMs = (int)bassInfo.latency;
+                info.minBufferMs = (int)bassInfo.minbuf;
+            }
+        }
+        const CrossfadeMixer::Stats mixer = m_mixer.getStats();
+        info.bufferedMs = m_mixer.bufferedSeconds() * 1000.0;
+        info.limiterMs = limiterLatencySecondsLocked() * 1000.0;
+        info.totalMs = info.bufferedMs + info.limiterMs + info.deviceLatencyMs;
+        info.blockFrames = mixer.blockFrames;
+        info.maxBlockFrames = mixer.maxBlockFrames;
+        info.sampleRate = mixer.freq;
+        info.deviceRate = m_deviceRate;
+        info.bitTransparent = m_bitTransparent;
+        info.underruns = mixer.underruns;
+        for (int i = 0; i < NUM_LATENCY_PROFILES; ++i) {
+            info.underrunsByProfile[i] = m_underrunsByProfile[i];
+        }
+        return info;
+    }
+
+private:
+    void applyLatencyConfig() {
+        BASS_SetConfig(BASS_CONFIG_BUFFER, (DWORD)m_latencyProfileMs);
+        BASS_SetConfig(BASS_CONFIG_UPDATEPERIOD, (DWORD)updatePeriodForBuffer(m_latencyProfileMs));
+    }
+
+    // Mikserin stall sayacındaki artışı o an seçili profile yaz
+    void accountUnderrunsLocked() {
+        const uint64_t total = m_mixer.getStats().underruns;
+        const int index = latencyProfileIndex(m_latencyProfileMs);
+        if (index >= 0 && total >= m_underrunBase) {
+            m_underrunsByProfile[index] += total - m_underrunBase;
+        }
+        m_underrunBase = total;
+    }
+
+public:
     // ============================================
     // GETTERS
     // ============================================
@@ -727,292 +6264,873 @@ public:
     // ============================================
     // FILE OPERATIONS
     // ============================================
+    // Dosya açma iki aşamalı: prepareTrack() decode + tempo stream'i kilitsiz
+    // oluşturur (BASS stream oluşturma thread-safe; büyük FLAC/APE veya soğuk
+    // diskte yüzlerce ms sürebilir). m_mutex yalnızca commit (handle takası,
+    // FX kurulumu) sırasında tutulur. Her istek token'ını istendiği anda alır
+    // (async yollarda JS thread'inde, requestLoadToken); commit anında daha
+    // yeni bir istek varsa hazırlanan zincir atılır (hızlı atlama). "En yeni"
+    // istenme sırasıdır, açılmanın bitiş sırası değil.
+    // Parça stream'leri decode-mode'dadır; çıkışa m_mixer üzerinden gider.
+    struct PreparedTrack {
+        TrackChain* chain = nullptr;
+        bool chainReady = false;     // preloadNext ile FX zinciri kurulmuş
+        bool queued = false;         // zincir mikserin gapless kuyruğunda (takePreloaded)
+        uint64_t token = 0;
+        int error = BASS_OK;
+        bool superseded = false;
+        double duration = 0.0;
+        DWORD freq = 0;
+        DWORD channels = 0;
+        std::string codec;
+    };
+
+    // ============================================
+    // GAPLESS PRELOAD
+    // ============================================
+    // preloadNext() sıradaki parçanın decode + tempo stream'ini, FX zincirini ve
+    // ayrı bir MasterDSP örneğini arka plan kuyruğunda kurar, ardından ilk
+    // PRELOAD_BUFFER_MS'yi zincirden geçirip belleğe (preroll) decode eder.
+    // Aynı yol için gelen loadFile/crossfadeTo/playNext bu zinciri devralır:
+    // geçişte I/O yok. gapless açıksa zincir mikser kuyruğuna girer; mikser
+    // mevcut parça bittiği blokta kaldığı sample'dan sıradakine geçer.
+    enum PreloadState {
+        PRELOAD_IDLE = 0,
+        PRELOAD_LOADING,
+        PRELOAD_BUFFERING,
+        PRELOAD_READY,
+        PRELOAD_FAILED
+    };
+
+    static constexpr DWORD PRELOAD_BUFFER_MS = 300;
+
+    struct PreloadInfo {
+        int state = PRELOAD_IDLE;
+        std::string path;
+        double bufferedMs = 0.0;
+        double duration = 0.0;
+        DWORD freq = 0;
+        bool gapless = false;
+        uint64_t autoAdvances = 0;
+        int error = BASS_OK;
+    };
+
+private:
+    PreparedTrack m_next;                       // m_mutex ile korunur
+    std::string m_nextPath;
+    uint64_t m_preloadSeq = 0;
+    int m_preloadError = BASS_OK;
+    std::atomic<int> m_preloadState{PRELOAD_IDLE};
+    bool m_nextQueued = false;                  // zincir mikser kuyruğunda (sahibi mikser)
+    std::condition_variable m_preloadCv;        // BUFFERING bitişi
+    std::atomic<bool> m_gaplessAutoAdvance{false};
+    std::atomic<uint64_t> m_autoAdvances{0};
+    EngineTaskQueue m_tasks;
+
+    // Hazır preload'u (aynı yol için) devral
+    bool takePreloaded(const std::string& filePath, PreparedTrack& out) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_nextPath != filePath) return false;
+
+        // Preroll decode'u birkaç ms sürer; aynı decode stream'i iki thread okumasın
+        m_preloadCv.wait(lock, [this]() { return m_preloadState.load() != PRELOAD_BUFFERING; });
+        if (m_nextPath != filePath) return false;
+
+        if (m_preloadState.load() != PRELOAD_READY || !m_next.chain) {
+            // Henüz açılıyor: beklemek yerine normal yoldan aç, preload'u iptal et
+            ++m_preloadSeq;
+            m_preloadState = PRELOAD_IDLE;
+            m_nextPath.clear();
+            return false;
+        }
+
+        // Zincir mikser kuyruğundaysa commit play/crossfade komutuyla onu alır
+        ++m_preloadSeq;
+        m_preloadState = PRELOAD_IDLE;
+        m_nextPath.clear();
+        out = m_next;
+        out.queued = m_nextQueued;
+        m_nextQueued = false;
+        m_next = PreparedTrack();
+        return true;
+    }
+
+    // Preload zincirini bırak (m_mutex tutulurken)
+    void releaseNextLocked() {
+        ++m_preloadSeq;
+        if (m_next.chain) {
+            if (m_nextQueued) {
+                // Sahibi mikser: kuyruktan düşürür (çoktan geçtiyse onAdvance devralır)
+                m_mixer.cancelQueued(m_next.chain);
+            } else if (m_preloadState.load() != PRELOAD_BUFFERING) {
+                freeTrackChain(m_next.chain);
+            }
+            // BUFFERING: buildPreload seq farkını görüp zinciri kendisi bırakır
+        }
+        m_next = PreparedTrack();
+        m_nextQueued = false;
+        m_preloadState = PRELOAD_IDLE;
+        m_nextPath.clear();
+        m_preloadError = BASS_OK;
+        m_preloadCv.notify_all();
+    }
+
+    // Mikser kuyruktaki preload zincirine çoktan geçti: zincirin sahibi artık
+    // mikser (bitince retire eder), m_next serbest bırakılmadan unutulur
+    void forgetConsumedNextLocked() {
+        ++m_preloadSeq;
+        m_next = PreparedTrack();
+        m_nextQueued = false;
+        m_preloadState = PRELOAD_IDLE;
+        m_nextPath.clear();
+        m_preloadError = BASS_OK;
+        m_preloadCv.notify_all();
+    }
+
+    // Kuyruk thread'i: dosyayı aç, zinciri kur, ilk blokları decode et
+    void buildPreload(const std::string& filePath, uint64_t seq) {
+        PreparedTrack track = openTrack(filePath);
+        if (!track.chain) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (seq == m_preloadSeq) {
+                m_preloadError = track.error;
+                m_preloadState = PRELOAD_FAILED;
+            }
+            return;
+        }
+
+        TrackChain* chain = track.chain;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (seq != m_preloadSeq) {
+                freeTrackChain(chain);
+                return;
+            }
+            setupChainFx(*chain);
+            track.chainReady = true;
+            m_next = track;
+            m_preloadState = PRELOAD_BUFFERING;
+        }
+
+        // Kilitsiz: dspCallback bu thread'de zincirin kendi MasterDSP'siyle çalışır
+        const DWORD chans = std::max<DWORD>(1, chain->chans);
+        const size_t floats = (size_t)chain->freq * PRELOAD_BUFFER_MS / 1000 * chans;
+        chain->preroll.resize(floats);
+        const DWORD got = BASS_ChannelGetData(chain->stream, chain->preroll.data(),
+                                              (DWORD)(floats * sizeof(float)) | BASS_DATA_FLOAT);
+        chain->preroll.resize(got == (DWORD)-1 ? 0 : got / sizeof(float));
+        chain->prerollPos.store(0);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (seq != m_preloadSeq || m_next.chain != chain) {
+            // Bu sırada iptal edildi / yenisi istendi
+            freeTrackChain(chain);
+            m_preloadCv.notify_all();
+            return;
+        }
+        m_preloadState = PRELOAD_READY;
+        if (m_gaplessAutoAdvance.load() && m_mixer.output() && m_mixer.queueNext(chain)) {
+            m_nextQueued = true;
+        }
+        m_preloadCv.notify_all();
+        AURIVO_LOG_INFO("[PRELOAD] Ready: %s (%.0f ms buffered)", filePath.c_str(),
+               chain->freq ? (double)chain->prerollFramesLeft() * 1000.0 / chain->freq : 0.0);
+    }
+
+    // Mikser kuyruktaki zincire kendiliğinden geçti (reclaimer thread'i)
+    void onMixerAdvanced(TrackChain* chain, uint32_t epoch) {
+#ifdef AURIVO_ENGINE_STRESS
+        if (const int us = g_stressAdvanceDelayUs.load()) std::this_thread::sleep_for(std::chrono::microseconds(us));
+#endif
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Eski epoch'ta da olsa zincir mikserdedir; m_next onu bir daha bırakmasın
+        if (m_next.chain == chain) forgetConsumedNextLocked();
+        if (epoch != m_mixer.epoch() || chain == m_chain) return;
+
+        PreparedTrack track;
+        track.chain = chain;
+        track.chainReady = true;
+        track.freq = chain->freq;
+        // m_loadSeq'e dokunulmaz: otomatik geçiş yeni bir istek değildir,
+        // sürmekte olan loadFile/crossfade onu geçersiz kılıp yine commit eder
+        installTrackChainLocked(track);
+        BASS_ChannelSetSync(m_stream, BASS_SYNC_END, 0, endCallback, this);
+        m_autoAdvances.fetch_add(1);
+    }
+
+public:
+    bool preloadNext(const std::string& filePath, bool gapless) {
+        if (!m_initialized || filePath.empty()) return false;
+        uint64_t seq = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_gaplessAutoAdvance = gapless;
+            if (m_nextPath == filePath && m_preloadState.load() != PRELOAD_FAILED) {
+                if (gapless && !m_nextQueued && m_preloadState.load() == PRELOAD_READY &&
+                    m_mixer.output() && m_mixer.queueNext(m_next.chain)) {
+                    m_nextQueued = true;
+                }
+                return true;
+            }
+            releaseNextLocked();
+            seq = m_preloadSeq;
+            m_nextPath = filePath;
+            m_preloadState = PRELOAD_LOADING;
+        }
+        return m_tasks.post([this, filePath, seq]() { buildPreload(filePath, seq); });
+    }
+
+    void cancelPreload() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        releaseNextLocked();
+    }
+
+    // Preload edilen parçaya geç ve çal (crossfadeMs > 0 ise crossfade)
+    bool playNext(int crossfadeMs, std::string* pathOut = nullptr) {
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_nextPath.empty() || m_preloadState.load() == PRELOAD_FAILED) return false;
+            path = m_nextPath;
+        }
+        PreparedTrack track = prepareTrack(path);
+        if (!commitTrack(track, std::max(0, crossfadeMs))) return false;
+        if (crossfadeMs <= 0) play();
+        if (pathOut) *pathOut = path;
+        return true;
+    }
+
+    PreloadInfo getPreloadInfo() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        PreloadInfo info;
+        info.state = m_preloadState.load();
+        info.path = m_nextPath;
+        if (m_next.chain && m_next.chain->freq && info.state == PRELOAD_READY) {
+            info.bufferedMs = (double)m_next.chain->prerollFramesLeft() * 1000.0 / m_next.chain->freq;
+        }
+        info.duration = m_next.duration;
+        info.freq = m_next.freq;
+        info.gapless = m_gaplessAutoAdvance.load();
+        info.autoAdvances = m_autoAdvances.load();
+        info.error = m_preloadError;
+        return info;
+    }
+
+    uint64_t requestLoadToken() {
+        return m_loadSeq.fetch_add(1) + 1;
+    }
+
+    // token = 0: istek şimdi yapılıyor (senkron yollar)
+    PreparedTrack prepareTrack(const std::string& filePath, uint64_t token = 0) {
+        if (!token) token = requestLoadToken();
+        PreparedTrack track;
+        // Çoktan geçersiz: dosyayı açma, daha yeni isteğin preload'unu da alma
+        if (token != m_loadSeq.load()) {
+            track.token = token;
+            track.superseded = true;
+            return track;
+        }
+        if (!takePreloaded(filePath, track)) {
+            track = openTrack(filePath);
+        }
+        track.token = token;
+        return track;
+    }
+
+    PreparedTrack openTrack(const std::string& filePath) {
+        PreparedTrack track;
+        if (!m_initialized) {
+            track.error = BASS_ERROR_INIT;
+            return track;
+        }
+
+        // Decode stream oluştur (BASS_FX için gerekli)
+        HSTREAM decodeStream = createDecodeStream(filePath);
+        if (!decodeStream) {
+            track.error = BASS_ErrorGetCode();
+            AURIVO_LOG_ERROR("BASS_StreamCreateFile error: %d for file: %s", track.error, filePath.c_str());
+            return track;
+        }
+
+        BASS_CHANNELINFO info;
+        if (BASS_ChannelGetInfo(decodeStream, &info)) {
+            track.freq = info.freq;
+            track.channels = info.chans;
+            track.codec = codecName(info.ctype);
+        }
+
+        // Tempo stream oluştur (BASS_FX wrap, decode-mode: mikser çeker)
+        // Bu sayede tüm FX'ler düzgün çalışır
+        HSTREAM stream = BASS_FX_TempoCreate(decodeStream, BASS_FX_FREESOURCE | BASS_SAMPLE_FLOAT | BASS_STREAM_DECODE);
+        if (!stream) {
+            track.error = BASS_ErrorGetCode();
+            BASS_StreamFree(decodeStream);
+            return track;
+        }
+
+        const QWORD lengthBytes = BASS_ChannelGetLength(stream, BASS_POS_BYTE);
+        if (lengthBytes != (QWORD)-1) {
+            track.duration = BASS_ChannelBytes2Seconds(stream, lengthBytes);
+        }
+
+        TrackChain* chain = new TrackChain();
+        chain->engine = this;
+        chain->stream = stream;
+        chain->freq = track.freq;
+        chain->chans = track.channels ? track.channels : 2;
+        chain->path = filePath;
+        // İlk örnekten itibaren (preroll dahil) önbellekteki ReplayGain
+        chain->replayGain.store(replayGainFor(filePath), std::memory_order_relaxed);
+
+        // Ham analiz için ayrı decode stream (yalnızca legacy modda; varsayılan
+        // olarak analiz post-DSP tap'ten okunur ve ikinci decoder açılmaz)
+        if (m_analysisDecoderEnabled) {
+            chain->analysisStream = createDecodeStream(filePath);
+        }
+        track.chain = chain;
+        return track;
+    }
+
+    // Commit edilmeyen zinciri bırak; m_mutex altında. Gapless kuyruğundaki
+    // zincirin sahibi mikserdir: kuyruktan düşürür (çoktan geçtiyse
+    // onMixerAdvanced devralır), burada silinirse mikser onu kullanmaya devam eder.
+    void discardTrack(PreparedTrack& track) {
+        if (track.queued) {
+            m_mixer.cancelQueued(track.chain);
+        } else {
+            freeTrackChain(track.chain);
+        }
+        track.chain = nullptr;
+        track.queued = false;
+    }
+
+    // Hazırlanmış parçayı devreye al. crossfadeMs > 0 ise overlap crossfade.
+    // Başarısızlıkta (veya daha yeni bir istek varsa) zinciri serbest bırakır.
+    bool commitTrack(PreparedTrack& track, int crossfadeMs) {
+        if (!track.chain) return false;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (track.token != m_loadSeq.load()) {
+            track.superseded = true;
+            discardTrack(track);
+            return false;
+        }
+
+        const bool ok = crossfadeMs > 0 ? commitCrossfadeLocked(track, crossfadeMs) : commitLoadLocked(track);
+        if (!ok) discardTrack(track);
+        return ok;
+    }
+
     bool loadFile(const std::string& filePath) {
+        PreparedTrack track = prepareTrack(filePath);
+        return commitTrack(track, 0);
+    }
+
+    bool crossfadeToFile(const std::string& filePath, int durationMs) {
+        PreparedTrack track = prepareTrack(filePath);
+        return commitTrack(track, std::max(0, durationMs));
+    }
+
+    // Bit-transparent: cihaz her sert yüklemede parçanın hızına geçirilir.
+    // Kapalıyken (varsayılan) cihaz kendi hızında kalır, mikser dönüştürür.
+    void setBitTransparent(bool enabled) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        
-        if (!m_initialized) return false;
-        
-        // Mevcut stream'i temizle
-        if (m_stream) {
-            BASS_ChannelStop(m_stream);
-            clearAllFx();
-            BASS_StreamFree(m_stream);
-            m_stream = 0;
+        m_bitTransparent = enabled;
+    }
+
+    bool isBitTransparent() const {
+        return m_bitTransparent;
+    }
+
+    DWORD getDeviceRate() const {
+        return m_deviceRate;
+    }
+
+    // Crossfade eğrisi: 0 = equal-power, 1 = linear, 2 = S-curve
+    void setCrossfadeCurve(int curve) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_crossfadeCurve = std::max(0, std::min(2, curve));
+    }
+
+    int getCrossfadeCurve() const {
+        return m_crossfadeCurve;
+    }
+
+    CrossfadeMixer::Stats getMixerStats() const {
+        return m_mixer.getStats();
+    }
+
+private:
+    // Aktif parça aynalarını (m_stream, m_aurivoDSP, ...) zincire bağla. Önceki
+    // zincir mikserde kalır (söner ya da retire edilir); ona dokunulmaz.
+    void installTrackChainLocked(PreparedTrack& track) {
+        TrackChain* chain = track.chain;
+        // Henüz parça yokken kullanılan bağımsız MasterDSP (constructor'dan)
+        void* standaloneDsp = m_chain ? nullptr : m_aurivoDSP;
+
+        if (!track.chainReady) {
+            setupChainFx(*chain);
+        } else if (!m_busMode.load()) {
+            // Preload'dan sonra değişen parametreler
+            restoreChainFxLocked(*chain);
+        }
+        if (m_busMode.load()) {
+            // Preload bus modu açılmadan kurulmuş olabilir
+            stripChainFxLocked(*chain);
+        }
+
+        m_chain = chain;
+        m_stream = chain->stream;
+        m_analysisStream = chain->analysisStream;
+        // Integrated/LRA parça başına; AGC kazancı sürer (geçişte sıçrama olmaz)
+        m_loudness.requestReset();
+        bindFxMirrorsLocked();
+        fxCompressor = 0;
+        for (int i = 0; i < NUM_EQ_BANDS; ++i) {
+            m_eqFx[i] = 0;
+        }
+        if (standaloneDsp && standaloneDsp != m_aurivoDSP && standaloneDsp != m_busDsp) {
+            destroy_dsp(standaloneDsp);
+        }
+        track.chain = nullptr;
+
+        if (chain->freq && !m_busMode.load()) {
+            m_analysisTap.setSampleRate((int)chain->freq);
+            g_pcmShmRing.setSampleRate((int)chain->freq);
+        }
+    }
+
+    // ============================================
+    // MASTER-BUS MODU
+    // ============================================
+    // Kapalıyken (varsayılan) her parça zinciri kendi preamp + MasterDSP +
+    // limiter + reverb'ünü çalıştırır; crossfade sırasında tüm zincir iki kez
+    // döner ve iki ayrı limiter'ın toplamı tavanı aşabilir. Açıkken zincirler
+    // ham (tempo) sinyali verir, aynı FX zinciri mikser toplamında bir kez çalışır.
+
+    // m_aurivoDSP / m_preampFx / m_reverbFx / m_dspHandle: setter'ların hedefi
+    void bindFxMirrorsLocked() {
+        if (m_busMode.load()) {
+            m_aurivoDSP = m_busDsp;
+            m_dspHandle = m_busDspHandle;
+            m_preampFx = m_busPreampFx;
+            m_reverbFx = m_busReverbFx;
+        } else if (m_chain) {
+            m_aurivoDSP = m_chain->dsp;
+            m_dspHandle = m_chain->dspHandle;
+            m_preampFx = m_chain->preampFx;
+            m_reverbFx = m_chain->reverbFx;
+        }
+    }
+
+    // Tape saturation (öncelik 12) ve bit/dither (20) DSP'lerini ayarlara göre
+    // stream'e bağlar/söker; ikisi de MasterDSP'den (0) önce çalışır. Yeni
+    // bağlanan DSP temiz durumla başlar.
+    void syncColorFxLocked(HSTREAM stream, ColorFx& fx) {
+        if (!stream) return;
+        float sr = (float)m_deviceRate;
+        BASS_ChannelGetAttribute(stream, BASS_ATTRIB_FREQ, &sr);
+        fx.profiler = &m_profiler;
+
+        const bool tape = g_tapeSat.current().enabled;
+        if (tape && !fx.tapeDsp) {
+            fx.tape = TapeSatState();
+            fx.tape.sr = sr;
+            fx.tapeDsp = BASS_ChannelSetDSP(stream, (DSPPROC*)TapeSat_DSP, &fx, 12);
+            AURIVO_LOG_INFO("[TAPE SAT] DSP attached. handle=%u sr=%.0f", fx.tapeDsp, sr);
+        } else if (!tape && fx.tapeDsp) {
+            BASS_ChannelRemoveDSP(stream, fx.tapeDsp);
+            fx.tapeDsp = 0;
+            AURIVO_LOG_INFO("[TAPE SAT] DSP detached");
+        }
+
+        const bool dither = g_bitDither.current().enabled;
+        if (dither && !fx.ditherDsp) {
+            fx.dither = BitDitherState();
+            fx.dither.sr = sr;
+            fx.ditherReset = g_bitDitherReset.load(std::memory_order_relaxed);
+            fx.ditherDsp = BASS_ChannelSetDSP(stream, (DSPPROC*)BitDither_DSP, &fx, 20);
+            AURIVO_LOG_INFO("[BIT/DITHER] DSP attached. handle=%u sr=%.0f", fx.ditherDsp, sr);
+        } else if (!dither && fx.ditherDsp) {
+            BASS_ChannelRemoveDSP(stream, fx.ditherDsp);
+            fx.ditherDsp = 0;
+            AURIVO_LOG_INFO("[BIT/DITHER] DSP detached");
+        }
+    }
+
+    void removeColorFxLocked(HSTREAM stream, ColorFx& fx) {
+        if (stream && fx.tapeDsp) BASS_ChannelRemoveDSP(stream, fx.tapeDsp);
+        if (stream && fx.ditherDsp) BASS_ChannelRemoveDSP(stream, fx.ditherDsp);
+        fx.tapeDsp = 0;
+        fx.ditherDsp = 0;
+    }
+
+    // Bus modunda zincirde yalnızca (pasif) DSP callback'i kalır. Zincirin
+    // MasterDSP'si audio thread okuyabileceği için silinmez, zincirle gider.
+    void stripChainFxLocked(TrackChain& chain) {
+        removeColorFxLocked(chain.stream, chain.color);
+        if (chain.preampFx) {
+            BASS_ChannelRemoveFX(chain.stream, chain.preampFx);
+            chain.preampFx = 0;
+        }
+        if (chain.reverbFx) {
+            BASS_ChannelRemoveFX(chain.stream, chain.reverbFx);
+            chain.reverbFx = 0;
+        }
+    }
+
+    // Zincir moduna dönüş / preload devri: zincirin FX'lerini güncel ayarlarla kur.
+    // MasterDSP parametreleri callback'in ilk bloğunda g_masterDsp'den gelir.
+    void restoreChainFxLocked(TrackChain& chain) {
+        if (!chain.dsp) {
+            chain.dsp = create_dsp();
+            if (chain.dsp && chain.freq) set_sample_rate(chain.dsp, static_cast<float>(chain.freq));
+        }
+        if (!chain.preampFx) {
+            chain.preampFx = BASS_ChannelSetFX(chain.stream, BASS_FX_BFX_VOLUME, 0);
+        }
+        updatePreampFxHandle(chain.preampFx);
+        applyReverbToStream(chain.stream, chain.reverbFx);
+        syncColorFxLocked(chain.stream, chain.color);
+    }
+
+    // Çıkış her sert yüklemede yeniden açılır; bus FX'leri yeni çıkışa bağlanır
+    void attachBusFxLocked() {
+        HSTREAM out = m_mixer.output();
+        if (!out) return;
+        if (m_busOutput != out) {
+            // Eski handle'lar önceki çıkışla birlikte gitti
+            m_busDspHandle = 0;
+            m_busPreampFx = 0;
+            m_busReverbFx = 0;
+            m_busColor.tapeDsp = 0;
+            m_busColor.ditherDsp = 0;
+            m_busOutput = out;
         }
 
-        // Olası overlap crossfade prev stream'i temizle
-        if (m_prevStream) {
-            BASS_ChannelStop(m_prevStream);
-            clearAllFxForStream(m_prevStream, m_prevDspHandle, m_prevPreampFx, m_prevReverbFx);
-            BASS_StreamFree(m_prevStream);
-            m_prevStream = 0;
+        if (!m_busDsp) {
+            // Parça yokken bağımsız DSP'yi devral, yoksa yeni örnek
+            m_busDsp = (!m_chain && m_aurivoDSP) ? m_aurivoDSP : create_dsp();
+        }
+        if (m_busDsp) {
+            set_sample_rate(m_busDsp, static_cast<float>(m_mixer.outputRate()));
         }
 
-        if (m_prevAnalysisStream) {
-            BASS_StreamFree(m_prevAnalysisStream);
-            m_prevAnalysisStream = 0;
+        if (!m_busPreampFx) {
+            m_busPreampFx = BASS_ChannelSetFX(out, BASS_FX_BFX_VOLUME, 0);
+        }
+        updatePreampFxHandle(m_busPreampFx);
+        if (!m_busDspHandle) {
+            m_busDspHandle = BASS_ChannelSetDSP(out, busDspCallback, this, 0);
         }
+        applyReverbToStream(out, m_busReverbFx);
+        syncColorFxLocked(out, m_busColor);
+
+        m_analysisTap.setSampleRate((int)m_mixer.outputRate());
+        g_pcmShmRing.setSampleRate((int)m_mixer.outputRate());
+    }
 
-        if (m_prevAurivoDSP) {
-            destroy_dsp(m_prevAurivoDSP);
-            m_prevAurivoDSP = nullptr;
+    void detachBusFxLocked() {
+        HSTREAM out = m_mixer.output();
+        if (out && out == m_busOutput) {
+            if (m_busDspHandle) BASS_ChannelRemoveDSP(out, m_busDspHandle);
+            if (m_busPreampFx) BASS_ChannelRemoveFX(out, m_busPreampFx);
+            if (m_busReverbFx) BASS_ChannelRemoveFX(out, m_busReverbFx);
+            removeColorFxLocked(out, m_busColor);
         }
+        m_busColor.tapeDsp = 0;
+        m_busColor.ditherDsp = 0;
+        m_busOutput = 0;
+        m_busDspHandle = 0;
+        m_busPreampFx = 0;
+        m_busReverbFx = 0;
+    }
 
-        m_overlapCrossfadeActive = false;
+public:
+    void setBusMode(bool enabled) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_busMode.load() == enabled) return;
 
-        if (m_analysisStream) {
-            BASS_StreamFree(m_analysisStream);
-            m_analysisStream = 0;
+        if (enabled) {
+            m_busMode = true;                 // zincir callback'leri hemen pas geçer
+            if (m_chain) stripChainFxLocked(*m_chain);
+            attachBusFxLocked();
+            if (!m_busDsp && !m_chain) {
+                // Çıkış yok: setter'lar bir sonraki parçaya kadar bus DSP'ye yazsın
+                m_busDsp = m_aurivoDSP ? m_aurivoDSP : create_dsp();
+            }
+        } else {
+            // Önce zincir FX'leri, sonra bus'ı kapat (efektsiz blok kalmasın)
+            if (m_chain) restoreChainFxLocked(*m_chain);
+            m_busMode = false;
+            detachBusFxLocked();
+            if (m_chain) {
+                m_analysisTap.setSampleRate((int)m_chain->freq);
+                g_pcmShmRing.setSampleRate((int)m_chain->freq);
+            }
         }
-        
-        // Decode stream oluştur (BASS_FX için gerekli)
-        HSTREAM decodeStream = BASS_StreamCreateFile(
-            FALSE, 
-            filePath.c_str(), 
-            0, 0, 
-            BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT
-        );
-        
-        if (!decodeStream) {
-            int error = BASS_ErrorGetCode();
-            printf("BASS_StreamCreateFile error: %d for file: %s\n", error, filePath.c_str());
-            return false;
+        bindFxMirrorsLocked();
+        AURIVO_LOG_INFO("[ENGINE] Master bus: %s", enabled ? "ON (single chain after mix)" : "OFF (per-track chains)");
+    }
+
+    bool isBusMode() const {
+        return m_busMode.load();
+    }
+
+private:
+    bool commitLoadLocked(PreparedTrack& track) {
+        if (!m_initialized) return false;
+        TrackChain* chain = track.chain;
+
+        // Önceki çıkış ve tüm kaynakları bırak (reclaimer serbest bırakır).
+        // Gapless kuyruğundaki preload zinciri korunur, yeni çıkışa tekrar girer.
+        TrackChain* queued = m_mixer.close(chain);
+        track.queued = false;   // close() zinciri kuyruktan da çıkardı
+        if (queued && queued != m_next.chain) {
+            freeTrackChain(queued);
+            queued = nullptr;
         }
-        
-        // Tempo stream oluştur (BASS_FX wrap)
-        // Bu sayede tüm FX'ler düzgün çalışır
-        m_stream = BASS_FX_TempoCreate(decodeStream, BASS_FX_FREESOURCE | BASS_SAMPLE_FLOAT);
-        
-        if (!m_stream) {
-            BASS_StreamFree(decodeStream);
+        // Kuyruktaydı ama geri gelmedi: mikser ona geçmiş, close() retire etti
+        if (!queued && m_nextQueued) forgetConsumedNextLocked();
+        // Eski zincirin DSP'si reclaimer'da gider; bağımsız DSP sanılıp silinmesin
+        if (m_chain) m_aurivoDSP = nullptr;
+        m_chain = nullptr;
+        m_stream = 0;
+        m_analysisStream = 0;
+        m_dspHandle = 0;
+        m_preampFx = 0;
+        m_reverbFx = 0;
+
+        // Önceki parçanın analiz sample'ları artık geçersiz
+        m_analysisTap.reset();
+
+        // Çıkış cihaz hızında (bit-transparent modda parça hızında) açılır
+        if (!openOutputLocked(chain->freq)) {
+            if (queued) m_nextQueued = false;
             return false;
         }
-        
-        // Stream bilgilerini al
-        BASS_CHANNELINFO info;
-        BASS_ChannelGetInfo(m_stream, &info);
-
-        // Ham analiz için ayrı decode stream (efektlerden bağımsız)
-        m_analysisStream = BASS_StreamCreateFile(
-            FALSE,
-            filePath.c_str(),
-            0, 0,
-            BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT
-        );
-        
+        if (m_busMode.load()) attachBusFxLocked();
+
         // Tüm FX'leri kur
-        setupAllFx();
-        
+        installTrackChainLocked(track);
+        m_mixer.play(chain);
+        if (queued) m_nextQueued = m_mixer.queueNext(queued);
+
         // Volume ayarla
         applyMasterVolume();
-        
+        applyBalanceToStream(m_mixer.output());
+
         // End sync ekle
         BASS_ChannelSetSync(m_stream, BASS_SYNC_END, 0, endCallback, this);
-        
+
         return true;
     }
 
     // ============================================
     // TRUE OVERLAP CROSSFADE
     // ============================================
-    bool crossfadeToFile(const std::string& filePath, int durationMs) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
+    // Eski zincir mikserde o anki kazancından söner, yeni zincir aynı örnek
+    // sayacıyla yükselir; sönen zincir bitince reclaimer thread'i bırakır.
+    bool commitCrossfadeLocked(PreparedTrack& track, int ms) {
         if (!m_initialized) return false;
 
-        const int ms = std::max(0, durationMs);
-
         // Eğer hiç stream yoksa normal load ile ilerle
-        if (!m_stream || ms <= 0) {
-            return loadFile(filePath);
+        if (!m_chain || ms <= 0) {
+            return commitLoadLocked(track);
         }
 
-        // Var olan prev stream varsa (üst üste crossfade), temizle
-        if (m_prevStream) {
-            BASS_ChannelStop(m_prevStream);
-            clearAllFxForStream(m_prevStream, m_prevDspHandle, m_prevPreampFx, m_prevReverbFx);
-            BASS_StreamFree(m_prevStream);
-            m_prevStream = 0;
-        }
-        if (m_prevAnalysisStream) {
-            BASS_StreamFree(m_prevAnalysisStream);
-            m_prevAnalysisStream = 0;
-        }
-        if (m_prevAurivoDSP) {
-            destroy_dsp(m_prevAurivoDSP);
-            m_prevAurivoDSP = nullptr;
+        // Çıkış çalmıyorsa (pause / bitti) örtüşme yok: doğrudan geç ve başlat
+        if (!m_mixer.isPlaying() || m_mixer.ended()) {
+            if (!commitLoadLocked(track)) return false;
+            BASS_ChannelPlay(m_mixer.output(), FALSE);
+            return true;
         }
 
-        // Mevcut stream'i "prev" olarak sakla
-        m_prevStream = m_stream;
-        m_prevAnalysisStream = m_analysisStream;
-        m_prevPreampFx = m_preampFx;
-        m_prevReverbFx = m_reverbFx;
-        m_prevAurivoDSP = m_aurivoDSP;
-        m_prevDspHandle = m_dspHandle;
-
-        // Yeni stream'i oluştur ve ana stream olarak ata
-        m_stream = 0;
-        m_analysisStream = 0;
-        m_preampFx = 0;
-        m_reverbFx = 0;
-        m_aurivoDSP = nullptr;
-        m_dspHandle = 0;
-
-        HSTREAM newStream = 0;
-        HSTREAM newAnalysis = 0;
-        if (!createPlaybackStreams(filePath, newStream, newAnalysis)) {
-            // Geri al
-            m_stream = m_prevStream;
-            m_analysisStream = m_prevAnalysisStream;
-            m_preampFx = m_prevPreampFx;
-            m_reverbFx = m_prevReverbFx;
-            m_aurivoDSP = m_prevAurivoDSP;
-            m_dspHandle = m_prevDspHandle;
-
-            m_prevStream = 0;
-            m_prevAnalysisStream = 0;
-            m_prevPreampFx = 0;
-            m_prevReverbFx = 0;
-            m_prevAurivoDSP = nullptr;
-            m_prevDspHandle = 0;
-            return false;
+        TrackChain* chain = track.chain;
+        installTrackChainLocked(track);
+        if (!m_mixer.crossfade(chain, ms, m_crossfadeCurve)) {
+            // Komut kuyruğu dolu: zincir mikser'e verilemedi, sert geçişe düş
+            track.chain = chain;
+            track.chainReady = true;
+            if (!commitLoadLocked(track)) return false;
+            BASS_ChannelPlay(m_mixer.output(), FALSE);
+            return true;
         }
 
-        m_stream = newStream;
-        m_analysisStream = newAnalysis;
-
-        setupAllFx();
-
         // End sync yeni stream'e
         BASS_ChannelSetSync(m_stream, BASS_SYNC_END, 0, endCallback, this);
+        return true;
+    }
 
-        const float baseVol = computeLinearMasterVolume();
-
-        // Yeni stream 0 sesle başlasın
-        BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_VOL, 0.0f);
-
-        // Yeni stream'i başlat
-        BASS_ChannelPlay(m_stream, FALSE);
+    void refreshDeviceRate() {
+        BASS_INFO info;
+        if (BASS_GetInfo(&info) && info.freq) m_deviceRate = info.freq;
+    }
 
-        // Eski stream çalmıyorsa, direkt bırak (pause'dan geçiş gibi)
-        const DWORD prevState = BASS_ChannelIsActive(m_prevStream);
-        if (prevState != BASS_ACTIVE_PLAYING) {
-            clearAllFxForStream(m_prevStream, m_prevDspHandle, m_prevPreampFx, m_prevReverbFx);
-            BASS_StreamFree(m_prevStream);
-            m_prevStream = 0;
-            if (m_prevAnalysisStream) {
-                BASS_StreamFree(m_prevAnalysisStream);
-                m_prevAnalysisStream = 0;
-            }
-            if (m_prevAurivoDSP) {
-                destroy_dsp(m_prevAurivoDSP);
-                m_prevAurivoDSP = nullptr;
+    // Mikser çıkışı cihaz hızında açılır; farklı hızdaki parçaları mikserin
+    // polyphase dönüştürücüsü çevirir, BASS'ın kendi resample'ı devreye girmez.
+    // Bit-transparent modda cihaz önce parçanın hızına geçirilir (REINIT mevcut
+    // stream'leri korur); cihaz kabul etmezse yine mikser dönüştürür.
+    bool openOutputLocked(DWORD trackRate) {
+        if (m_bitTransparent && trackRate && trackRate != m_deviceRate) {
+            if (BASS_Init(BASS_GetDevice(), trackRate, BASS_DEVICE_REINIT | BASS_DEVICE_FREQ, nullptr, nullptr)) {
+                refreshDeviceRate();
+                AURIVO_LOG_INFO("[ENGINE] Device rate -> %u Hz (bit-transparent)", (unsigned)m_deviceRate);
+            } else {
+                AURIVO_LOG_WARN("[ENGINE] Device rate %u Hz rejected (error %d), resampling",
+                       (unsigned)trackRate, BASS_ErrorGetCode());
             }
-            BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_VOL, baseVol);
-            m_overlapCrossfadeActive = false;
-            return true;
         }
+        const bool fresh = !m_mixer.output();
+        if (!m_mixer.open(m_deviceRate)) return false;
+        if (fresh) {
+            attachConvolverLocked();
+            // Profilleyici bloğu çıkıştaki tüm DSP/FX'lerden sonra kapanır
+            BASS_ChannelSetDSP(m_mixer.output(), blockEndDspCallback, this, std::numeric_limits<int>::min());
+        }
+        return true;
+    }
 
-        // Slide volume: prev -> 0, new -> baseVol
-        BASS_ChannelSlideAttribute(m_prevStream, BASS_ATTRIB_VOL, 0.0f, ms);
-        BASS_ChannelSlideAttribute(m_stream, BASS_ATTRIB_VOL, baseVol, ms);
-
-        // Cleanup prev stream after fade completes (avoid doing heavy work in BASS callback threads)
-        m_overlapCrossfadeActive = true;
-        const uint64_t gen = m_crossfadeGeneration.fetch_add(1) + 1;
-        std::thread([this, gen, ms]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(ms + 150));
-            std::lock_guard<std::mutex> lock(this->m_mutex);
-            if (this->m_crossfadeGeneration.load() != gen) return;
-
-            if (this->m_prevStream) {
-                this->clearAllFxForStream(this->m_prevStream, this->m_prevDspHandle, this->m_prevPreampFx, this->m_prevReverbFx);
-                BASS_ChannelStop(this->m_prevStream);
-                BASS_StreamFree(this->m_prevStream);
-                this->m_prevStream = 0;
-            }
+    // Konvolüsyon reverb her yeni çıkışa bağlanır (kapalıyken callback hemen
+    // döner). Öncelik bus DSP'sinden yüksek: bus modunda limiter reverb'den
+    // sonra çalışır. Çıkış hızı değiştiyse IR yeni hızda yeniden kurulur.
+    void attachConvolverLocked() {
+        BASS_ChannelSetDSP(m_mixer.output(), convDspCallback, this, 1);
+        if (g_convReverb.enabled && m_irRate != m_mixer.outputRate()) scheduleIrBuildLocked();
+    }
 
-            if (this->m_prevAnalysisStream) {
-                BASS_StreamFree(this->m_prevAnalysisStream);
-                this->m_prevAnalysisStream = 0;
-            }
+    // Çıkış stream'ini aktif zincirle yeniden aç (STREAMPROC_END sonrası ya da
+    // yeni buffer boyutu için). Sönen kaynaklar bırakılır, zincir decode
+    // pozisyonundan devam eder; kuyruktaki gapless zincir yeni çıkışa taşınır.
+    bool reopenOutputLocked() {
+        TrackChain* primary = nullptr;
+        TrackChain* queued = m_mixer.close(m_chain, &primary);
+        if (queued && queued != m_next.chain) {
+            freeTrackChain(queued);
+            queued = nullptr;
+        }
+        if (!queued && m_nextQueued) forgetConsumedNextLocked();
+        if (primary && primary != m_chain) {
+            // Mikser gapless geçmişti; close epoch'u ilerlettiği için
+            // onMixerAdvanced bu olayı atlar, zincir burada devralınır
+            // (m_chain mikserde değil, reclaimer serbest bırakır)
+            PreparedTrack track;
+            track.chain = primary;
+            track.chainReady = true;
+            track.freq = primary->freq;
+            installTrackChainLocked(track);
+            BASS_ChannelSetSync(m_stream, BASS_SYNC_END, 0, endCallback, this);
+            m_autoAdvances.fetch_add(1);
+        }
+        TrackChain* chain = m_chain;
+        chain->prerollPos.store((uint32_t)chain->preroll.size());
+        resetOutputStateLocked();
+        if (!openOutputLocked(chain->freq)) {
+            m_nextQueued = false;
+            return false;
+        }
+        if (m_busMode.load()) {
+            attachBusFxLocked();
+            bindFxMirrorsLocked();
+        }
+        m_mixer.play(chain);
+        m_nextQueued = queued && m_mixer.queueNext(queued);
+        applyMasterVolume();
+        applyBalanceToStream(m_mixer.output());
+        return true;
+    }
 
-            if (this->m_prevAurivoDSP) {
-                destroy_dsp(this->m_prevAurivoDSP);
-                this->m_prevAurivoDSP = nullptr;
-            }
+    // Yeniden açılan çıkış kaldığı pozisyondan (ya da seek edilen yerden)
+    // devam eder: limiter gecikme hattında ve filtre geçmişinde eski sesin
+    // kuyruğu kalmasın. Sıfırlama her iki tarafta da bir sonraki blokta olur.
+    void resetOutputStateLocked() {
+        if (m_busMode.load()) m_busLimiter.requestReset();
+        if (m_chain) m_chain->limiter.requestReset();
+        // MasterDSP'leri kendi callback'leri sıfırlar
+        publishMasterDsp([](MasterDspParams& p) { ++p.resetSerial; });
+    }
 
-            this->m_overlapCrossfadeActive = false;
-        }).detach();
+    // Limiter gecikme hattının duyulan sinyale eklediği gecikme
+    double limiterLatencySecondsLocked() const {
+        if (m_busMode.load()) {
+            const DWORD rate = m_mixer.outputRate();
+            return rate ? (double)m_busLimiter.latencyFrames() / rate : 0.0;
+        }
+        if (!m_chain || !m_chain->freq) return 0.0;
+        return (double)m_chain->limiter.latencyFrames() / m_chain->freq;
+    }
 
-        return true;
+    // Decode pozisyonu - (preroll + çıkış buffer'ında bekleyen + limiter) = duyulan pozisyon
+    double heardPositionLocked() const {
+        if (!m_stream || !m_chain) return 0.0;
+        QWORD bytes = BASS_ChannelGetPosition(m_stream, BASS_POS_BYTE);
+        double seconds = BASS_ChannelBytes2Seconds(m_stream, bytes);
+        if (m_chain->freq) seconds -= (double)m_chain->prerollFramesLeft() / m_chain->freq;
+        seconds -= m_mixer.bufferedSeconds();
+        seconds -= limiterLatencySecondsLocked();
+        return std::max(0.0, seconds);
     }
-    
+
+public:
     // ============================================
     // PLAYBACK CONTROL
     // ============================================
     void play() {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_stream) {
-            BASS_ChannelPlay(m_stream, FALSE);
-        }
-        if (m_prevStream) {
-            BASS_ChannelPlay(m_prevStream, FALSE);
+        if (!m_chain || !m_mixer.output()) return;
+
+        if (m_mixer.ended()) {
+            // STREAMPROC_END sonrası çıkış yeniden açılır. Parça sonundaysa
+            // baştan, bitişten sonra seek edildiyse o pozisyondan çalar.
+            if (BASS_ChannelIsActive(m_stream) == BASS_ACTIVE_STOPPED) {
+                BASS_ChannelSetPosition(m_stream, 0, BASS_POS_BYTE);
+            }
+            if (!reopenOutputLocked()) return;
         }
+        BASS_ChannelPlay(m_mixer.output(), FALSE);
     }
     
     void pause() {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_stream) {
-            BASS_ChannelPause(m_stream);
-        }
-        if (m_prevStream) {
-            BASS_ChannelPause(m_prevStream);
+        if (m_mixer.output()) {
+            BASS_ChannelPause(m_mixer.output());
         }
     }
     
     void stop() {
         std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_mixer.output()) {
+            // Stop çıkış buffer'ını da boşaltır; sönen kaynaklar flush'ta bırakılır
+            BASS_ChannelStop(m_mixer.output());
+        }
         if (m_stream) {
-            BASS_ChannelStop(m_stream);
             BASS_ChannelSetPosition(m_stream, 0, BASS_POS_BYTE);
         }
-
-        if (m_prevStream) {
-            BASS_ChannelStop(m_prevStream);
-            BASS_ChannelSetPosition(m_prevStream, 0, BASS_POS_BYTE);
-            clearAllFxForStream(m_prevStream, m_prevDspHandle, m_prevPreampFx, m_prevReverbFx);
-            BASS_StreamFree(m_prevStream);
-            m_prevStream = 0;
-        }
-
-        if (m_prevAnalysisStream) {
-            BASS_StreamFree(m_prevAnalysisStream);
-            m_prevAnalysisStream = 0;
-        }
-
-        if (m_prevAurivoDSP) {
-            destroy_dsp(m_prevAurivoDSP);
-            m_prevAurivoDSP = nullptr;
-        }
-
-        m_overlapCrossfadeActive = false;
+        if (m_chain) m_chain->prerollPos.store((uint32_t)m_chain->preroll.size());
+        m_mixer.flush();
     }
     
     void seek(double positionMs) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_stream) {
-            QWORD bytes = BASS_ChannelSeconds2Bytes(m_stream, positionMs / 1000.0);
-            BASS_ChannelSetPosition(m_stream, bytes, BASS_POS_BYTE);
+        if (!m_stream) return;
+        QWORD bytes = BASS_ChannelSeconds2Bytes(m_stream, positionMs / 1000.0);
+        BASS_ChannelSetPosition(m_stream, bytes, BASS_POS_BYTE);
+        if (m_chain) m_chain->prerollPos.store((uint32_t)m_chain->preroll.size());
+        m_mixer.flush();
+
+        // Çıkış buffer'ındaki eski pozisyon sesini at
+        HSTREAM out = m_mixer.output();
+        if (!out) return;
+        if (BASS_ChannelIsActive(out) == BASS_ACTIVE_PLAYING) {
+            BASS_ChannelPlay(out, TRUE);
+        } else if (BASS_ChannelIsActive(out) == BASS_ACTIVE_PAUSED) {
+            BASS_ChannelStop(out);
         }
     }
     
     double getPosition() {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (!m_stream) return 0;
-        QWORD bytes = BASS_ChannelGetPosition(m_stream, BASS_POS_BYTE);
-        return BASS_ChannelBytes2Seconds(m_stream, bytes) * 1000.0;
+        return heardPositionLocked() * 1000.0;
     }
     
     double getDuration() {
@@ -1025,7 +7143,7 @@ public:
     bool isPlaying() {
         std::lock_guard<std::mutex> lock(m_mutex);
         if (!m_stream) return false;
-        return BASS_ChannelIsActive(m_stream) == BASS_ACTIVE_PLAYING;
+        return m_mixer.isPlaying();
     }
     
     bool hasStream() const {
@@ -1079,10 +7197,124 @@ public:
         int count = std::min(numBands, NUM_EQ_BANDS);
         for (int i = 0; i < count; ++i) {
             m_eqGains[i] = clampf(gains[i], -15.0f, 15.0f);
-            updateEqBand(i);
         }
+        publishEqBands(0, count);
     }
     
+    // ============================================
+    // TOPLU PARAMETRE GÜNCELLEME (applyParamBatch)
+    // ============================================
+    // ops: [paramId, value] çiftleri. Motor durumu hemen güncellenir (getter'lar
+    // yeni değeri görür); MasterDSP'ye giden kısım tek bir g_masterDsp bloğu
+    // olarak yayınlanır, her DSP callback'i bir sonraki blok başında uygular
+    // (EQ için tek hedef hesaplaması). Uygulanan işlem sayısını döner.
+    int applyParamBatch(const float* ops, int numOps) {
+        if (!ops || numOps <= 0) return 0;
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        bool eqDirty[NUM_EQ_BANDS] = {};
+        bool tone = false, width = false, comp = false;
+        bool preamp = false, volume = false, balance = false;
+        int applied = 0;
+
+        for (int i = 0; i < numOps; ++i) {
+            const float idValue = ops[i * 2];
+            const float value = ops[i * 2 + 1];
+            if (!std::isfinite(idValue) || !std::isfinite(value)) continue;
+            const int id = (int)idValue;
+
+            if (id >= PARAM_EQ_BAND_0 && id < PARAM_EQ_BAND_0 + NUM_EQ_BANDS) {
+                const int band = id - PARAM_EQ_BAND_0;
+                m_eqGains[band] = clampf(value, -15.0f, 15.0f);
+                eqDirty[band] = true;
+                ++applied;
+                continue;
+            }
+
+            switch (id) {
+                case PARAM_PREAMP:
+                    m_preampGain = clampf(value, -12.0f, 12.0f);
+                    preamp = true;
+                    break;
+                case PARAM_BASS_BOOST:
+                    m_bassBoost = clampf(value, 0.0f, 100.0f);
+                    for (int b = 0; b < BASS_BOOST_BANDS; ++b) eqDirty[b] = true;
+                    break;
+                case PARAM_TONE_BASS:
+                    m_bassGain = clampf(value, -15.0f, 15.0f);
+                    tone = true;
+                    break;
+                case PARAM_TONE_MID:
+                    m_midGain = clampf(value, -15.0f, 15.0f);
+                    tone = true;
+                    break;
+                case PARAM_TONE_TREBLE:
+                    m_trebleGain = clampf(value, -15.0f, 15.0f);
+                    tone = true;
+                    break;
+                case PARAM_STEREO_EXPANDER:
+                    m_stereoExpander = clampf(value, 0.0f, 200.0f);
+                    width = true;
+                    break;
+                case PARAM_BALANCE:
+                    m_balance = clampf(value, -100.0f, 100.0f);
+                    balance = true;
+                    break;
+                case PARAM_MASTER_VOLUME:
+                    m_masterVolume = clampf(value, 0.0f, 100.0f);
+                    volume = true;
+                    break;
+                case PARAM_COMPRESSOR_THRESHOLD:
+                    g_compressor.threshold = clampf(value, -60.0f, 0.0f);
+                    comp = true;
+                    break;
+                case PARAM_COMPRESSOR_RATIO:
+                    g_compressor.ratio = clampf(value, 1.0f, 20.0f);
+                    comp = true;
+                    break;
+                case PARAM_COMPRESSOR_ATTACK:
+                    g_compressor.attack = clampf(value, 0.1f, 100.0f);
+                    comp = true;
+                    break;
+                case PARAM_COMPRESSOR_RELEASE:
+                    g_compressor.release = clampf(value, 10.0f, 1000.0f);
+                    comp = true;
+                    break;
+                case PARAM_COMPRESSOR_MAKEUP:
+                    g_compressor.makeupGain = clampf(value, -12.0f, 24.0f);
+                    comp = true;
+                    break;
+                default:
+                    continue;
+            }
+            ++applied;
+        }
+
+        // BASS attribute / FX tarafı (BASS kendi içinde thread-safe)
+        if (preamp) updatePreampFx();
+        if (volume) applyMasterVolume();
+        if (balance && m_dspEnabled) applyBalance();
+
+        // MasterDSP tarafı: tek blok yayını, callback'ler bir sonraki blokta uygular
+        comp = comp && g_compressor.enabled;
+        bool eq = false;
+        for (int band = 0; band < NUM_EQ_BANDS; ++band) eq = eq || eqDirty[band];
+        if (!eq && !tone && !width && !comp) return applied;
+
+        publishMasterDsp([&](MasterDspParams& p) {
+            for (int band = 0; band < NUM_EQ_BANDS; ++band) {
+                if (eqDirty[band]) p.setEqBand(band, eqBandTotalGain(band));
+            }
+            if (tone) p.tone.assign(true, {m_bassGain, m_midGain, m_trebleGain});
+            if (width) p.width.assign(true, {m_stereoExpander / 100.0f});
+            if (comp) {
+                p.compressor.assign(true, {g_compressor.threshold, g_compressor.ratio, g_compressor.attack,
+                                           g_compressor.release, g_compressor.makeupGain});
+            }
+        });
+        return applied;
+    }
+
     void resetEQ() {
         std::lock_guard<std::mutex> lock(m_mutex);
         // Sadece 32 bantlık EQ slider değerlerini sıfırla
@@ -1090,11 +7322,7 @@ public:
         for (int i = 0; i < NUM_EQ_BANDS; ++i) {
             m_eqGains[i] = 0.0f;
         }
-        
-        if (!m_dspEnabled || !m_aurivoDSP) return;
-        for (int i = 0; i < NUM_EQ_BANDS; ++i) {
-            updateEqBand(i);
-        }
+        publishEqBands(0, NUM_EQ_BANDS);
     }
     
     // ============================================
@@ -1113,162 +7341,90 @@ public:
     // ============================================
     // AUTO GAIN / NORMALIZE - FULL IMPLEMENTATION
     // ============================================
+    // Seviye ölçümü ve kazanç audio thread'de (runMasterChain); buradaki
+    // setter'lar yalnızca parametre snapshot'ı yayınlar. Master volume
+    // (BASS_ATTRIB_VOL) ile çakışmaz.
     void setAutoGainEnabled(bool enabled) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_autoGain.enabled = enabled;
-        
-        if (!enabled) {
-            // Devre dışı bırakıldığında gain'i sıfırla
-            g_autoGain.currentGain = 0.0f;
-            if (m_stream) {
-                BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_VOL, 1.0f);
-            }
-        }
-        
-        printf("[AUTO GAIN] %s\n", enabled ? "Etkinleştirildi" : "Devre dışı");
+        // Devre dışı: kazanç audio thread'de release ile 0 dB'e döner
+        g_autoGain.update([&](AutoGainParams& p) { p.enabled = enabled; });
+        AURIVO_LOG_INFO("[AUTO GAIN] %s", enabled ? "Etkinleştirildi" : "Devre dışı");
     }
     
     bool isAutoGainEnabled() const {
-        return g_autoGain.enabled;
+        return g_autoGain.current().enabled;
     }
     
     void setAutoGainTarget(float targetLevel) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_autoGain.targetLevel = clampf(targetLevel, -30.0f, -3.0f);
-        printf("[AUTO GAIN] Target: %.1f dBFS\n", g_autoGain.targetLevel);
+        g_autoGain.update([&](AutoGainParams& p) { p.targetLevel = clampf(targetLevel, -30.0f, -3.0f); });
+        AURIVO_LOG_DEBUG("[AUTO GAIN] Target: %.1f dBFS", g_autoGain.current().targetLevel);
     }
     
     void setAutoGainMaxGain(float maxGain) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_autoGain.maxGain = clampf(maxGain, 0.0f, 24.0f);
-        printf("[AUTO GAIN] Max Gain: %.1f dB\n", g_autoGain.maxGain);
+        g_autoGain.update([&](AutoGainParams& p) { p.maxGain = clampf(maxGain, 0.0f, 24.0f); });
+        AURIVO_LOG_DEBUG("[AUTO GAIN] Max Gain: %.1f dB", g_autoGain.current().maxGain);
     }
     
     void setAutoGainAttack(float attackMs) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_autoGain.attackTime = clampf(attackMs, 10.0f, 1000.0f);
-        printf("[AUTO GAIN] Attack: %.0f ms\n", g_autoGain.attackTime);
+        g_autoGain.update([&](AutoGainParams& p) { p.attackTime = clampf(attackMs, 10.0f, 1000.0f); });
+        AURIVO_LOG_DEBUG("[AUTO GAIN] Attack: %.0f ms", g_autoGain.current().attackTime);
     }
     
     void setAutoGainRelease(float releaseMs) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_autoGain.releaseTime = clampf(releaseMs, 50.0f, 3000.0f);
-        printf("[AUTO GAIN] Release: %.0f ms\n", g_autoGain.releaseTime);
+        g_autoGain.update([&](AutoGainParams& p) { p.releaseTime = clampf(releaseMs, 50.0f, 3000.0f); });
+        AURIVO_LOG_DEBUG("[AUTO GAIN] Release: %.0f ms", g_autoGain.current().releaseTime);
     }
     
     void setAutoGainMode(int mode) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_autoGain.mode = std::max(0, std::min(2, mode));
+        g_autoGain.update([&](AutoGainParams& p) { p.mode = std::max(0, std::min(2, mode)); });
         const char* modeNames[] = {"Peak", "RMS", "LUFS"};
-        printf("[AUTO GAIN] Mode: %s\n", modeNames[g_autoGain.mode]);
+        AURIVO_LOG_DEBUG("[AUTO GAIN] Mode: %s", modeNames[g_autoGain.current().mode]);
     }
     
-    float getPeakLevel() {
-        if (!m_stream) return -96.0f;
-        
-        // BASS'tan gerçek zamanlı level al
-        DWORD level = BASS_ChannelGetLevel(m_stream);
-        if (level == (DWORD)-1) return -96.0f;
-        
-        int left = LOWORD(level);
-        int right = HIWORD(level);
-        int peak = (left > right) ? left : right;
-        
-        float peakLinear = peak / 32768.0f;
-        if (peakLinear > 0.0001f) {
-            g_autoGain.peakLevel = 20.0f * std::log10(peakLinear);
-        } else {
-            g_autoGain.peakLevel = -96.0f;
-        }
-        
-        return g_autoGain.peakLevel;
+    // Son 400 ms'lik örnek tepesi (dBFS, AGC öncesi)
+    float getPeakLevel() const {
+        LoudnessMeter::Snapshot snap;
+        if (!m_stream || !readLoudness(snap)) return -96.0f;
+        return snap.values[LoudnessMeter::SAMPLE_PEAK];
     }
     
-    float getRmsLevel() {
-        if (!m_stream) return -96.0f;
-        
-        // RMS = Peak * 0.707 (sinüs dalga yaklaşımı)
-        float peakLinear = std::pow(10.0f, g_autoGain.peakLevel / 20.0f);
-        float rmsLinear = peakLinear * 0.707f;
-        
-        if (rmsLinear > 0.0001f) {
-            g_autoGain.rmsLevel = 20.0f * std::log10(rmsLinear);
-        } else {
-            g_autoGain.rmsLevel = -96.0f;
-        }
-        
-        return g_autoGain.rmsLevel;
+    // Son 400 ms'lik ağırlıksız RMS (dBFS, AGC öncesi)
+    float getRmsLevel() const {
+        LoudnessMeter::Snapshot snap;
+        if (!m_stream || !readLoudness(snap)) return -96.0f;
+        return snap.values[LoudnessMeter::RMS];
     }
     
+    // Uygulanan AGC kazancı (dB, normalize dahil değil)
     float getAutoGainReduction() const {
-        return g_autoGain.currentGain;
+        const float agc = m_autoGainStage.appliedGain() / m_autoGainStage.normalizeGain();
+        return linearTodB(agc);
     }
     
     float getMakeupGain() const {
-        return std::pow(10.0f, g_autoGain.currentGain / 20.0f);
-    }
-    
-    // Auto gain güncelleme (periyodik olarak çağrılmalı)
-    void updateAutoGain() {
-        if (!g_autoGain.enabled || !m_stream) return;
-        
-        // Mevcut level'ı al
-        getPeakLevel();
-        getRmsLevel();
-        
-        // Mode'a göre referans level seç
-        float currentLevel;
-        switch (g_autoGain.mode) {
-            case 0: currentLevel = g_autoGain.peakLevel; break;
-            case 1: currentLevel = g_autoGain.rmsLevel; break;
-            case 2: currentLevel = g_autoGain.rmsLevel - 3.0f; break; // LUFS yaklaşımı
-            default: currentLevel = g_autoGain.rmsLevel; break;
-        }
-        
-        // Gerekli gain hesapla
-        float neededGain = g_autoGain.targetLevel - currentLevel;
-        
-        // Max gain limiti
-        neededGain = clampf(neededGain, -g_autoGain.maxGain, g_autoGain.maxGain);
-        
-        // Smooth gain adjustment
-        float gainDelta = neededGain - g_autoGain.currentGain;
-        float timeConstant = (gainDelta > 0) ? g_autoGain.attackTime : g_autoGain.releaseTime;
-        float smoothFactor = 100.0f / timeConstant;  // 100ms güncelleme oranı
-        
-        g_autoGain.currentGain += gainDelta * smoothFactor * 0.1f;  // Smooth transition
-        
-        // Gain'i volume olarak uygula
-        float volumeMultiplier = std::pow(10.0f, g_autoGain.currentGain / 20.0f);
-        BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_VOL, volumeMultiplier);
-        
-        // Debug (her 10 çağrıda bir)
-        static int updateCounter = 0;
-        if (++updateCounter >= 10) {
-            printf("[AUTO GAIN] Update: Level=%.1f dB, Target=%.1f dB, Gain=%.2f dB, Vol=%.3f\n",
-                   currentLevel, g_autoGain.targetLevel, g_autoGain.currentGain, volumeMultiplier);
-            updateCounter = 0;
-        }
+        return m_autoGainStage.appliedGain();
     }
     
-    // Normalize et fonksiyonu (tek seferlik)
+    // Normalize et fonksiyonu (tek seferlik): parçanın şimdiye kadarki örnek
+    // tepesine göre sabit kazanç; AGC katında uygulanır, resetAutoGain kaldırır.
     float normalizeAudio(float targetDB) {
         if (!m_stream) return 0.0f;
         
-        // Peak level al
-        float peak = getPeakLevel();
-        
-        // Normalize et gain hesapla
-        float normalizeGain = targetDB - peak;
+        LoudnessMeter::Snapshot snap;
+        if (!readLoudness(snap)) return 0.0f;
+        const float peak = snap.values[LoudnessMeter::SAMPLE_PEAK_MAX];
+        if (peak <= LoudnessMeter::FLOOR_DB) return 0.0f;
         
         // Max gain limiti
-        normalizeGain = clampf(normalizeGain, -24.0f, 24.0f);
-        
-        // Gain'i uygula
-        float volumeMultiplier = std::pow(10.0f, normalizeGain / 20.0f);
-        BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_VOL, volumeMultiplier);
+        const float normalizeGain = clampf(targetDB - peak, -24.0f, 24.0f);
+        m_autoGainStage.setNormalizeGain(dBToLinear(normalizeGain));
         
-        printf("[AUTO GAIN] Normalize: Peak %.1f dB → Target %.1f dB (Gain: %.1f dB)\n",
+        AURIVO_LOG_INFO("[AUTO GAIN] Normalize: Peak %.1f dB → Target %.1f dB (Gain: %.1f dB)",
                peak, targetDB, normalizeGain);
         
         return normalizeGain;
@@ -1276,18 +7432,230 @@ public:
     
     void resetAutoGain() {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_autoGain.targetLevel = -14.0f;
-        g_autoGain.maxGain = 12.0f;
-        g_autoGain.attackTime = 100.0f;
-        g_autoGain.releaseTime = 500.0f;
-        g_autoGain.mode = 1;
-        g_autoGain.currentGain = 0.0f;
+        g_autoGain.update([](AutoGainParams& p) {
+            const bool enabled = p.enabled;
+            p = AutoGainParams();
+            p.enabled = enabled;
+        });
+        m_autoGainStage.requestReset();
         
-        if (m_stream) {
-            BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_VOL, 1.0f);
+        AURIVO_LOG_INFO("[AUTO GAIN] Reset to defaults");
+    }
+
+    // ============================================
+    // LOUDNESS (EBU R128)
+    // ============================================
+    struct LoudnessInfo {
+        float momentary;        // LUFS (400 ms)
+        float shortTerm;        // LUFS (3 s)
+        float integrated;       // LUFS (kapılı, parça başından beri)
+        float lra;              // LU
+        float momentaryMax;
+        float shortTermMax;
+        float samplePeak;       // dBFS (400 ms)
+        float samplePeakMax;    // dBFS (parça)
+        float rms;              // dBFS (400 ms)
+        float duration;         // ölçülen süre (s)
+        float sampleRate;
+        bool live;              // son 500 ms içinde blok geldi (pause/stop'ta false)
+        bool agcEnabled;
+        int agcMode;
+        float agcTarget;
+        float agcGain;          // dB
+        float normalizeGain;    // dB
+    };
+
+    LoudnessInfo getLoudness() const {
+        LoudnessMeter::Snapshot snap;
+        if (!readLoudness(snap)) {
+            std::fill(snap.values, snap.values + LoudnessMeter::FIELD_COUNT, LoudnessMeter::FLOOR_DB);
+            snap.values[LoudnessMeter::LRA] = 0.0f;
+            snap.values[LoudnessMeter::DURATION] = 0.0f;
+            snap.updatedMs = 0;
+            snap.sampleRate = 0.0f;
         }
-        
-        printf("[AUTO GAIN] Reset to defaults\n");
+        const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        const AutoGainParams& agc = g_autoGain.current();
+
+        LoudnessInfo info;
+        info.momentary = snap.values[LoudnessMeter::MOMENTARY];
+        info.shortTerm = snap.values[LoudnessMeter::SHORT_TERM];
+        info.integrated = snap.values[LoudnessMeter::INTEGRATED];
+        info.lra = snap.values[LoudnessMeter::LRA];
+        info.momentaryMax = snap.values[LoudnessMeter::MOMENTARY_MAX];
+        info.shortTermMax = snap.values[LoudnessMeter::SHORT_TERM_MAX];
+        info.samplePeak = snap.values[LoudnessMeter::SAMPLE_PEAK];
+        info.samplePeakMax = snap.values[LoudnessMeter::SAMPLE_PEAK_MAX];
+        info.rms = snap.values[LoudnessMeter::RMS];
+        info.duration = snap.values[LoudnessMeter::DURATION];
+        info.sampleRate = snap.sampleRate;
+        info.live = snap.updatedMs != 0 && nowMs - snap.updatedMs < 500;
+        info.agcEnabled = agc.enabled;
+        info.agcMode = agc.mode;
+        info.agcTarget = agc.targetLevel;
+        info.agcGain = getAutoGainReduction();
+        info.normalizeGain = linearTodB(m_autoGainStage.normalizeGain());
+        return info;
+    }
+
+    bool readLoudness(LoudnessMeter::Snapshot& snap) const {
+        return m_loudness.read(snap);
+    }
+
+    // ============================================
+    // LOUDNESS TARAMASI / REPLAYGAIN
+    // ============================================
+    enum ReplayGainMode {
+        REPLAYGAIN_OFF = 0,
+        REPLAYGAIN_TRACK,
+        REPLAYGAIN_ALBUM
+    };
+
+    // ReplayGain 2.0 referansı
+    static constexpr float REPLAYGAIN_REFERENCE_LUFS = -18.0f;
+
+    // Önbellek dizini (loudness kayıtları, waveform piramitleri); boşsa yalnızca bellekte
+    void setCacheDirectory(const std::string& dir) {
+        m_loudnessCache.setDirectory(dir);
+        m_waveforms.setDirectory(dir);
+        AURIVO_LOG_INFO("[CACHE] Dizin: %s", dir.empty() ? "(bellek)" : dir.c_str());
+    }
+
+    bool startLoudnessScan(std::vector<std::string> paths, const LoudnessScanner::Options& options,
+                           LoudnessScanner::ProgressFn onProgress, LoudnessScanner::DoneFn onDone) {
+        if (!m_initialized) return false;
+        AURIVO_LOG_INFO("[LOUDNESS SCAN] %zu dosya taranıyor (album=%d, force=%d)",
+               paths.size(), options.album ? 1 : 0, options.force ? 1 : 0);
+        return m_scanner.start(std::move(paths), options, std::move(onProgress), std::move(onDone));
+    }
+
+    bool cancelLoudnessScan() {
+        if (!m_scanner.running()) return false;
+        m_scanner.cancel();
+        return true;
+    }
+
+    bool isLoudnessScanRunning() const {
+        return m_scanner.running();
+    }
+
+    // Offline render: zincir ayarları render başında alınır; MasterDSP her
+    // dosyada işçi thread'inde o anki EQ/modül ayarlarıyla kurulur
+    bool startRender(std::vector<OfflineRenderer::Job> jobs, const OfflineRenderer::Options& options,
+                     bool replayGain, OfflineRenderer::ProgressFn onProgress, OfflineRenderer::DoneFn onDone) {
+        if (!m_initialized) return false;
+        OfflineRenderer::Chain chain;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            chain.dspEnabled = m_dspEnabled;
+            chain.busMode = m_busMode.load();
+            chain.preampDb = m_preampGain;
+            chain.convolution = g_convReverb.enabled;
+            chain.ir.path = g_convReverb.irFilePath;
+            chain.ir.preset = g_convReverb.roomType;
+            chain.ir.roomSize = g_convReverb.roomSize;
+            chain.ir.decay = g_convReverb.decay;
+            chain.ir.damping = g_convReverb.damping;
+            chain.ir.preDelay = g_convReverb.preDelay;
+            chain.convWet = g_convReverb.wetMix / 100.0f;
+            chain.convDry = g_convReverb.dryMix / 100.0f;
+            // BASS DX8 reverb yalnızca çalan stream'de var
+            if (m_reverbEnabled) chain.unsupported.push_back("reverb");
+        }
+        chain.tape = g_tapeSat.current();
+        chain.bitDither = g_bitDither.current();
+        chain.autoGain = g_autoGain.current();
+        chain.limiter = g_truePeakLimiter.current();
+        chain.configure = [this](void* dsp, float rate) { configureOfflineDsp(dsp, rate); };
+        if (replayGain) chain.gainFor = [this](const std::string& path) { return replayGainFor(path); };
+        AURIVO_LOG_INFO("[RENDER] %zu dosya (bits=%d, threads=%d, replayGain=%d)",
+               jobs.size(), options.bitDepth, options.threads, replayGain ? 1 : 0);
+        return m_renderer.start(std::move(jobs), std::move(chain), options, std::move(onProgress), std::move(onDone));
+    }
+
+    bool cancelRender() {
+        if (!m_renderer.running()) return false;
+        m_renderer.cancel();
+        return true;
+    }
+
+    bool isRenderRunning() const {
+        return m_renderer.running();
+    }
+
+    // Önbellekteki ölçümden lineer kazanç (taranmamış/değişmiş dosyada 1.0)
+    float replayGainFor(const std::string& path) {
+        const int mode = m_replayGainMode.load();
+        if (mode == REPLAYGAIN_OFF) return 1.0f;
+
+        LoudnessCacheEntry entry;
+        if (!m_loudnessCache.lookup(path, entry)) return 1.0f;
+        const bool album = (mode == REPLAYGAIN_ALBUM) && entry.hasAlbum();
+        const float lufs = album ? entry.albumLufs : entry.trackLufs;
+        const float peak = album ? entry.albumPeak : entry.trackPeak;
+        if (lufs <= LoudnessMeter::ABSOLUTE_GATE) return 1.0f;   // sessiz dosya
+
+        const float gainDb = clampf(REPLAYGAIN_REFERENCE_LUFS - lufs + m_replayGainPreamp.load(), -24.0f, 24.0f);
+        float gain = dBToLinear(gainDb);
+        if (m_replayGainPreventClip.load() && peak > 0.0f && gain * peak > 1.0f) {
+            gain = 1.0f / peak;
+        }
+        AURIVO_LOG_INFO("[REPLAYGAIN] %s: %.2f LUFS -> %.2f dB (%s)",
+               path.c_str(), lufs, linearTodB(gain), album ? "album" : "track");
+        return gain;
+    }
+
+    void setReplayGain(int mode, float preampDb, bool preventClipping) {
+        m_replayGainMode.store(std::max((int)REPLAYGAIN_OFF, std::min((int)REPLAYGAIN_ALBUM, mode)));
+        m_replayGainPreamp.store(clampf(preampDb, -15.0f, 15.0f));
+        m_replayGainPreventClip.store(preventClipping);
+
+        // Çalan ve preload edilmiş zincir yeni ayarı hemen alır
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_chain) m_chain->replayGain.store(replayGainFor(m_chain->path), std::memory_order_relaxed);
+        if (m_next.chain) m_next.chain->replayGain.store(replayGainFor(m_next.chain->path), std::memory_order_relaxed);
+        AURIVO_LOG_INFO("[REPLAYGAIN] Mode=%d, Preamp=%.1f dB, PreventClip=%d",
+               m_replayGainMode.load(), m_replayGainPreamp.load(), preventClipping ? 1 : 0);
+    }
+
+    struct ReplayGainInfo {
+        int mode;
+        float preamp;
+        bool preventClipping;
+        float reference;
+        float currentGain;          // dB, çalan parçaya uygulanan
+        bool scanning;
+    };
+
+    ReplayGainInfo getReplayGainInfo() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ReplayGainInfo info;
+        info.mode = m_replayGainMode.load();
+        info.preamp = m_replayGainPreamp.load();
+        info.preventClipping = m_replayGainPreventClip.load();
+        info.reference = REPLAYGAIN_REFERENCE_LUFS;
+        info.currentGain = m_chain ? linearTodB(m_chain->replayGain.load(std::memory_order_relaxed)) : 0.0f;
+        info.scanning = m_scanner.running();
+        return info;
+    }
+
+    // ============================================
+    // WAVEFORM ÖNİZLEMESİ
+    // ============================================
+    // Piramit hazırsa (bellek/mmap) hemen cevaplar; ses dosyası açılmaz
+    bool queryWaveform(const std::string& path, uint32_t width, double startSec, double endSec,
+                       WaveformCache::Overview& out) {
+        return m_waveforms.query(path, width, startSec, endSec, out);
+    }
+
+    // Piramidi düşük öncelikli havuzda kurar; done işçi thread'inde çağrılır
+    void buildWaveform(const std::string& path, WaveformCache::DoneFn done) {
+        if (!m_initialized) {
+            if (done) done(false, BASS_ERROR_INIT);
+            return;
+        }
+        m_waveforms.build(path, std::move(done));
     }
 
     // ============================================
@@ -1297,19 +7665,20 @@ public:
     void applyTruePeakLimiterParams() {
         // DSP callback içinde parametreler doğrudan kullanılıyor
         // Bu fonksiyon sadece log için
-        printf("[TRUE PEAK] Ayarlar güncellendi: Ceiling=%.2f dB, Release=%.0f ms, Lookahead=%.1f ms\n",
-               g_truePeakLimiter.ceiling, g_truePeakLimiter.release, g_truePeakLimiter.lookahead);
+        const TruePeakLimiterParams& p = g_truePeakLimiter.current();
+        AURIVO_LOG_DEBUG("[TRUE PEAK] Ayarlar güncellendi: Ceiling=%.2f dB, Release=%.0f ms, Lookahead=%.1f ms",
+               p.ceiling, p.release, p.lookahead);
     }
     
     void setTruePeakEnabled(bool enabled) {
         std::lock_guard<std::mutex> lock(m_mutex);
         
         if (!m_stream) {
-            printf("[TRUE PEAK] Stream yok\n");
+            AURIVO_LOG_WARN("[TRUE PEAK] Stream yok");
             return;
         }
         
-        g_truePeakLimiter.enabled = enabled;
+        g_truePeakLimiter.update([&](TruePeakLimiterParams& p) { p.enabled = enabled; });
         
         if (enabled) {
             // Meter değerlerini sıfırla
@@ -1320,96 +7689,90 @@ public:
             g_truePeakMeter.peakHoldL = -96.0f;
             g_truePeakMeter.peakHoldR = -96.0f;
             
-            printf("[TRUE PEAK] Etkinleştirildi (DSP-based limiter)\n");
+            AURIVO_LOG_INFO("[TRUE PEAK] Etkinleştirildi (DSP-based limiter)");
         } else {
-            printf("[TRUE PEAK] Devre dışı\n");
+            AURIVO_LOG_INFO("[TRUE PEAK] Devre dışı");
         }
     }
     
     bool isTruePeakEnabled() const {
-        return g_truePeakLimiter.enabled;
+        return g_truePeakLimiter.current().enabled;
     }
     
     void setTruePeakCeiling(float ceiling) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_truePeakLimiter.ceiling = clampf(ceiling, -12.0f, 0.0f);
-        printf("[TRUE PEAK] Ceiling: %.2f dBFS\n", g_truePeakLimiter.ceiling);
+        g_truePeakLimiter.update([&](TruePeakLimiterParams& p) { p.ceiling = clampf(ceiling, -12.0f, 0.0f); });
+        AURIVO_LOG_DEBUG("[TRUE PEAK] Ceiling: %.2f dBFS", g_truePeakLimiter.current().ceiling);
     }
     
     void setTruePeakRelease(float release) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_truePeakLimiter.release = clampf(release, 10.0f, 500.0f);
+        g_truePeakLimiter.update([&](TruePeakLimiterParams& p) { p.release = clampf(release, 10.0f, 500.0f); });
         
-        printf("[TRUE PEAK] Release: %.0f ms\n", g_truePeakLimiter.release);
+        AURIVO_LOG_DEBUG("[TRUE PEAK] Release: %.0f ms", g_truePeakLimiter.current().release);
     }
     
     void setTruePeakLookahead(float lookahead) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_truePeakLimiter.lookahead = clampf(lookahead, 0.0f, 20.0f);
-        printf("[TRUE PEAK] Lookahead: %.1f ms\n", g_truePeakLimiter.lookahead);
+        g_truePeakLimiter.update([&](TruePeakLimiterParams& p) { p.lookahead = clampf(lookahead, 0.0f, 20.0f); });
+        AURIVO_LOG_DEBUG("[TRUE PEAK] Lookahead: %.1f ms", g_truePeakLimiter.current().lookahead);
     }
     
     void setTruePeakOversampling(int rate) {
         std::lock_guard<std::mutex> lock(m_mutex);
         
-        if (rate == 2 || rate == 4 || rate == 8) {
-            g_truePeakLimiter.oversamplingRate = rate;
-        } else {
-            g_truePeakLimiter.oversamplingRate = 4;  // Varsayılan
+        if (rate != 2 && rate != 4 && rate != 8) {
+            rate = 4;  // Varsayılan
         }
+        g_truePeakLimiter.update([&](TruePeakLimiterParams& p) { p.oversamplingRate = rate; });
         
-        printf("[TRUE PEAK] Oversampling: %dx\n", g_truePeakLimiter.oversamplingRate);
+        AURIVO_LOG_DEBUG("[TRUE PEAK] Oversampling: %dx", g_truePeakLimiter.current().oversamplingRate);
     }
     
     void setTruePeakLinkChannels(bool link) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        g_truePeakLimiter.linkChannels = link;
+        g_truePeakLimiter.update([&](TruePeakLimiterParams& p) { p.linkChannels = link; });
         
-        printf("[TRUE PEAK] Link channels: %s\n", link ? "ON" : "OFF");
+        AURIVO_LOG_DEBUG("[TRUE PEAK] Link channels: %s", link ? "ON" : "OFF");
     }
     
-    // True Peak Metering güncelleme
+    // True Peak Metering güncelleme: DSP callback'inin son okumadan beri
+    // biriktirdiği gerçek (oversampled) tepeleri alır, peak hold uygular.
     void updateTruePeakMeter() {
         if (!m_stream) return;
         
-        // Throttle KALDIRILDI - her çağrıda güncelle (JS tarafı kontrol eder)
         auto now = std::chrono::steady_clock::now();
         static auto lastUpdate = now;
+        static auto lastData = now;
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate).count();
         lastUpdate = now;
-        
-        // Stereo level al
-        DWORD level = BASS_ChannelGetLevel(m_stream);
-        int left = LOWORD(level);
-        int right = HIWORD(level);
-        
-        // Sample peak (normal peak)
-        float leftLinear = left / 32768.0f;
-        float rightLinear = right / 32768.0f;
-        
-        if (leftLinear > 0.00001f) {
-            g_truePeakMeter.currentPeakL = 20.0f * std::log10(leftLinear);
-        } else {
-            g_truePeakMeter.currentPeakL = -96.0f;
-        }
-        
-        if (rightLinear > 0.00001f) {
-            g_truePeakMeter.currentPeakR = 20.0f * std::log10(rightLinear);
-        } else {
-            g_truePeakMeter.currentPeakR = -96.0f;
+
+        auto toDb = [](float linear) { return linear > 0.00001f ? 20.0f * std::log10(linear) : -96.0f; };
+        float peak[2];
+        float truePeak[2];
+        float inputPeak[2];
+        bool fresh = false;
+        for (int c = 0; c < 2; ++c) {
+            peak[c] = g_truePeakMeter.pendingPeak[c].exchange(-1.0f);
+            truePeak[c] = g_truePeakMeter.pendingTruePeak[c].exchange(-1.0f);
+            inputPeak[c] = g_truePeakMeter.pendingInputPeak[c].exchange(-1.0f);
+            if (peak[c] >= 0.0f) fresh = true;
         }
-        
-        // TRUE PEAK HESAPLAMA (oversampling headroom ile)
-        float oversamplingHeadroom = 0.0f;
-        switch (g_truePeakLimiter.oversamplingRate) {
-            case 2:  oversamplingHeadroom = 0.3f; break;
-            case 4:  oversamplingHeadroom = 0.5f; break;
-            case 8:  oversamplingHeadroom = 0.7f; break;
+        if (fresh) {
+            lastData = now;
+            g_truePeakMeter.currentPeakL = toDb(peak[0]);
+            g_truePeakMeter.currentPeakR = toDb(peak[1]);
+            g_truePeakMeter.truePeakL = toDb(truePeak[0]);
+            g_truePeakMeter.truePeakR = toDb(truePeak[1]);
+            g_truePeakMeter.inputPeakL = toDb(inputPeak[0]);
+            g_truePeakMeter.inputPeakR = toDb(inputPeak[1]);
+        } else if (std::chrono::duration_cast<std::chrono::milliseconds>(now - lastData).count() > 300) {
+            // Callback çalışmıyor (pause/stop): metre düşer
+            g_truePeakMeter.currentPeakL = g_truePeakMeter.currentPeakR = -96.0f;
+            g_truePeakMeter.truePeakL = g_truePeakMeter.truePeakR = -96.0f;
+            g_truePeakMeter.inputPeakL = g_truePeakMeter.inputPeakR = -96.0f;
         }
         
-        g_truePeakMeter.truePeakL = g_truePeakMeter.currentPeakL + oversamplingHeadroom;
-        g_truePeakMeter.truePeakR = g_truePeakMeter.currentPeakR + oversamplingHeadroom;
-        
         // PEAK HOLD (3 saniye)
         unsigned long nowMs = static_cast<unsigned long>(elapsed);
         static unsigned long holdTimerL = 0, holdTimerR = 0;
@@ -1429,14 +7792,7 @@ public:
         } else if (holdTimerR > 3000) {
             g_truePeakMeter.peakHoldR = g_truePeakMeter.truePeakR;
         }
-        
-        // CLIPPING DETECTION
-        if (g_truePeakLimiter.enabled) {
-            if (g_truePeakMeter.truePeakL > g_truePeakLimiter.ceiling ||
-                g_truePeakMeter.truePeakR > g_truePeakLimiter.ceiling) {
-                g_truePeakMeter.clippingCount++;
-            }
-        }
+        // Clipping sayacı DSP callback'inde (limiter öncesi true-peak) artar
     }
     
     // Meter data döndür
@@ -1460,34 +7816,36 @@ public:
             g_truePeakMeter.truePeakR,
             g_truePeakMeter.peakHoldL,
             g_truePeakMeter.peakHoldR,
-            g_truePeakMeter.gainReduction,
-            g_truePeakMeter.clippingCount
+            g_truePeakMeter.gainReduction.load(std::memory_order_relaxed),
+            g_truePeakMeter.clippingCount.load(std::memory_order_relaxed)
         };
     }
     
     void resetTruePeakClipping() {
-        g_truePeakMeter.clippingCount = 0;
-        printf("[TRUE PEAK] Clipping counter sıfırlandı\n");
+        g_truePeakMeter.clippingCount.store(0, std::memory_order_relaxed);
+        AURIVO_LOG_INFO("[TRUE PEAK] Clipping counter sıfırlandı");
     }
     
     void resetTruePeakLimiter() {
         std::lock_guard<std::mutex> lock(m_mutex);
         
-        g_truePeakLimiter.ceiling = -0.1f;
-        g_truePeakLimiter.release = 50.0f;
-        g_truePeakLimiter.lookahead = 5.0f;
-        g_truePeakLimiter.oversamplingRate = 4;
-        g_truePeakLimiter.linkChannels = true;
+        g_truePeakLimiter.update([](TruePeakLimiterParams& p) {
+            p.ceiling = -0.1f;
+            p.release = 50.0f;
+            p.lookahead = 5.0f;
+            p.oversamplingRate = 4;
+            p.linkChannels = true;
+        });
         
-        g_truePeakMeter.clippingCount = 0;
+        g_truePeakMeter.clippingCount.store(0, std::memory_order_relaxed);
         g_truePeakMeter.peakHoldL = -96.0f;
         g_truePeakMeter.peakHoldR = -96.0f;
         
-        printf("[TRUE PEAK] Varsayılan ayarlara döndürüldü\n");
+        AURIVO_LOG_INFO("[TRUE PEAK] Varsayılan ayarlara döndürüldü");
     }
 
     bool isClipping() const {
-        return g_autoGain.peakLevel > -0.1f;
+        return getPeakLevel() > -0.1f;
     }
     
     int getClippingCount() const {
@@ -1522,7 +7880,9 @@ public:
     };
     
     AGCStatus getAGCStatus() const {
-        return {0.0f, 0.0f, 1.0f, 1.0f, false, 0, false};
+        const float gain = m_autoGainStage.appliedGain();
+        return {dBToLinear(getPeakLevel()), dBToLinear(getRmsLevel()), std::min(1.0f, gain), std::max(1.0f, gain),
+                isClipping(), g_truePeakMeter.clippingCount.load(std::memory_order_relaxed), g_autoGain.current().enabled};
     }
     
     void applyEmergencyReduction() {
@@ -1536,45 +7896,44 @@ public:
     // ============================================
     // FFT / SPECTRUM
     // ============================================
-    std::vector<float> getFFTData() {
-        std::vector<float> data(FFT_SIZE / 2, 0.0f);
-        if (!m_stream) return data;
-        
-        float fft[FFT_SIZE];
-        HSTREAM source = m_analysisStream ? m_analysisStream : m_stream;
-        if (m_analysisStream) {
-            QWORD pos = BASS_ChannelGetPosition(m_stream, BASS_POS_BYTE);
-            BASS_ChannelSetPosition(m_analysisStream, pos, BASS_POS_BYTE);
-        }
-        if (BASS_ChannelGetData(source, fft, BASS_DATA_FFT2048) != (DWORD)-1) {
-            for (int i = 0; i < FFT_SIZE / 2; ++i) {
-                data[i] = fft[i];
-            }
-        }
+    std::vector<float> getFFTData() {
+        std::vector<float> data(FFT_SIZE / 2, 0.0f);
+        fillFFTData(data.data(), (int)data.size());
         return data;
     }
+
+    // Caller buffer'ına yazar (zero-copy N-API yolu). Yazılan bin sayısını döner.
+    int fillFFTData(float* dest, int maxBins) {
+        if (!dest || maxBins <= 0 || !m_stream) return 0;
+        
+        float fft[FFT_SIZE / 2];
+        if (!readAnalysisFFT(fft)) return 0;
+        const int bins = std::min(maxBins, FFT_SIZE / 2);
+        std::memcpy(dest, fft, sizeof(float) * bins);
+        return bins;
+    }
     
     std::vector<float> getSpectrumBands(int numBands) {
-        std::vector<float> bands(numBands, 0.0f);
-        if (!m_stream) return bands;
+        std::vector<float> bands(std::max(0, numBands), 0.0f);
+        fillSpectrumBands(bands.data(), (int)bands.size());
+        return bands;
+    }
+
+    int fillSpectrumBands(float* bands, int numBands) {
+        if (!bands || numBands <= 0 || !m_stream) return 0;
         
-        float fft[FFT_SIZE];
-        HSTREAM source = m_analysisStream ? m_analysisStream : m_stream;
-        if (m_analysisStream) {
-            QWORD pos = BASS_ChannelGetPosition(m_stream, BASS_POS_BYTE);
-            BASS_ChannelSetPosition(m_analysisStream, pos, BASS_POS_BYTE);
-        }
-        if (BASS_ChannelGetData(source, fft, BASS_DATA_FFT2048) == (DWORD)-1) {
-            return bands;
-        }
+        float fft[FFT_SIZE / 2];
+        if (!readAnalysisFFT(fft)) return 0;
+        
+        const int sampleRate = getAnalysisSampleRate();
         
         // Logaritmik band dağılımı
         for (int i = 0; i < numBands; ++i) {
             float freqLow = 20.0f * std::pow(1000.0f, (float)i / numBands);
             float freqHigh = 20.0f * std::pow(1000.0f, (float)(i + 1) / numBands);
             
-            int binLow = (int)(freqLow * FFT_SIZE / SAMPLE_RATE);
-            int binHigh = (int)(freqHigh * FFT_SIZE / SAMPLE_RATE);
+            int binLow = (int)(freqLow * FFT_SIZE / sampleRate);
+            int binHigh = (int)(freqHigh * FFT_SIZE / sampleRate);
             
             binLow = std::max(0, std::min(binLow, FFT_SIZE / 2 - 1));
             binHigh = std::max(binLow + 1, std::min(binHigh, FFT_SIZE / 2));
@@ -1585,7 +7944,7 @@ public:
             }
             bands[i] = sum / (binHigh - binLow);
         }
-        return bands;
+        return numBands;
     }
 
     // ============================================
@@ -1599,7 +7958,16 @@ public:
         if (outChannels) *outChannels = 0;
         if (!m_stream || framesPerChannel <= 0) return {};
 
-        HSTREAM source = m_analysisStream ? m_analysisStream : m_stream;
+        // Post-DSP tap: duyulan sinyalin kopyası, seek/decode yok
+        if (m_analysisTap.hasData()) {
+            std::vector<float> data((size_t)framesPerChannel * AnalysisTap::CHANNELS);
+            const int got = m_analysisTap.snapshot(data.data(), framesPerChannel, playbackDelayFrames());
+            if (got <= 0) return {};
+            if (outChannels) *outChannels = AnalysisTap::CHANNELS;
+            return data;
+        }
+
+        HSTREAM source = m_analysisStream ? m_analysisStream : m_mixer.output();
         if (m_analysisStream) {
             QWORD pos = BASS_ChannelGetPosition(m_stream, BASS_POS_BYTE);
             BASS_ChannelSetPosition(m_analysisStream, pos, BASS_POS_BYTE);
@@ -1625,26 +7993,176 @@ public:
         data.resize(gotFloats);
         return data;
     }
+
+    // Stereo interleaved (LRLR...) olarak caller buffer'ına yazar.
+    // Yazılan frame sayısını döner (kanal başına).
+    int fillPCMData(float* dest, int framesPerChannel) {
+        if (!dest || framesPerChannel <= 0 || !m_stream) return 0;
+
+        if (m_analysisTap.hasData()) {
+            return m_analysisTap.snapshot(dest, framesPerChannel, playbackDelayFrames());
+        }
+
+        // Fallback (tap henüz boş): decode yolu, stereo'ya dönüştür
+        int channels = 0;
+        std::vector<float> pcm = getPCMData(framesPerChannel, &channels);
+        if (pcm.empty() || channels <= 0) return 0;
+
+        const int frames = std::min(framesPerChannel, (int)(pcm.size() / (size_t)channels));
+        for (int i = 0; i < frames; ++i) {
+            const float l = pcm[(size_t)i * channels];
+            const float r = (channels > 1) ? pcm[(size_t)i * channels + 1] : l;
+            dest[i * 2] = l;
+            dest[i * 2 + 1] = r;
+        }
+        return frames;
+    }
+
+    // JS thread'i dışından (visualizer feeder) okuma: load/commit m_stream,
+    // m_chain ve analiz stream'ini m_mutex altında değiştirir; fillPCMData
+    // playbackDelayFrames() üzerinden zincire dokunduğu için kilit gerekir.
+    int fillPCMDataSync(float* dest, int framesPerChannel) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return fillPCMData(dest, framesPerChannel);
+    }
+
+    int getAnalysisSampleRate() const {
+        return m_analysisTap.hasData() ? m_analysisTap.getSampleRate() : (int)m_deviceRate;
+    }
     
-    // Peak level monitoring
+    // ============================================
+    // ANALİZ DECODER MODU + ENGINE STATS
+    // ============================================
+    void setAnalysisDecoderEnabled(bool enabled) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_analysisDecoderEnabled = enabled;
+
+        // Kapatılınca mevcut analiz decoder'larını hemen bırak; açılınca
+        // bir sonraki loadFile / crossfade'den itibaren geçerli olur
+        if (!enabled) {
+            if (m_analysisStream) {
+                BASS_StreamFree(m_analysisStream);
+                m_analysisStream = 0;
+            }
+        }
+        AURIVO_LOG_INFO("[ENGINE] Analysis decoder: %s", enabled ? "ON (legacy)" : "OFF (post-DSP tap)");
+    }
+
+    bool isAnalysisDecoderEnabled() const {
+        return m_analysisDecoderEnabled;
+    }
+
+    struct EngineStats {
+        int openDecoders;
+        int analysisDecoders;
+        bool analysisDecoderEnabled;
+        bool analysisTapActive;
+        bool busMode;
+    };
+
+    EngineStats getEngineStats() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        EngineStats stats;
+        stats.openDecoders = g_openDecoders.load(std::memory_order_relaxed);
+        stats.analysisDecoders = m_analysisStream ? 1 : 0;
+        stats.analysisDecoderEnabled = m_analysisDecoderEnabled;
+        stats.analysisTapActive = m_analysisTap.hasData();
+        stats.busMode = m_busMode.load();
+        return stats;
+    }
+
+    // ============================================
+    // METRELER (audio thread snapshot'ı)
+    // ============================================
+    // Tüm metreler tek seqlock okumasıyla; out en az MeterBank::FIELD_COUNT
+    bool readMeters(float* out, bool consume = true) {
+        return m_meters.read(out, consume);
+    }
+
+    void resetMeterCounters() {
+        m_meters.requestCounterReset();
+        g_truePeakMeter.clippingCount.store(0, std::memory_order_relaxed);
+    }
+
+    // ============================================
+    // CALLBACK PROFİLİ (getDspStats)
+    // ============================================
+    void getDspStats(CallbackProfiler::Stats& out) const {
+        m_profiler.read(out);
+    }
+
+    void resetDspStats() {
+        m_profiler.reset();
+    }
+
+    void configureDspStats(bool enabled, bool perStage, double thresholdPercent, int windowSeconds) {
+        m_profiler.configure(enabled, perStage, thresholdPercent, windowSeconds);
+        AURIVO_LOG_INFO("[PROFILER] %s, aşama kırılımı %s, eşik %%%.0f, pencere %d s", enabled ? "ON" : "OFF",
+               perStage ? "açık" : "kapalı", thresholdPercent, windowSeconds);
+    }
+
+    // Tekil getter'lar için: pencereyi tüketmeden tek alan
+    float meterValue(int field) {
+        float v[MeterBank::FIELD_COUNT];
+        if (!m_stream || !m_meters.read(v, false)) return 0.0f;
+        return v[field];
+    }
+
+    // Peak level monitoring (lineer 0..1)
     std::pair<float, float> getChannelLevels() {
-        if (!m_stream) return {0.0f, 0.0f};
-        
-        DWORD level = BASS_ChannelGetLevel(m_stream);
-        float left = (float)LOWORD(level) / 32768.0f;
-        float right = (float)HIWORD(level) / 32768.0f;
-        return {left, right};
+        float v[MeterBank::FIELD_COUNT];
+        if (!m_stream || !m_meters.read(v, false)) return {0.0f, 0.0f};
+        return {dBToLinear(v[MeterBank::PEAK_L]), dBToLinear(v[MeterBank::PEAK_R])};
     }
 
 private:
+    // Post-DSP sample'ları analiz tap'ine ve (açıksa) visualizer ring'ine yaz
+    void publishAnalysis(const float* samples, int frames) {
+        m_analysisTap.write(samples, frames);
+        g_pcmShmRing.write(samples, frames);
+    }
+
     // ============================================
-    // INTERNAL: FX SETUP - BASİTLEŞTİRİLMİŞ
+    // INTERNAL: ANALİZ TAP OKUMA
     // ============================================
-    void setupAllFx() {
-        if (!m_stream) return;
-        setupAllFxForStream(m_stream, m_aurivoDSP, m_dspHandle, m_preampFx, m_reverbFx);
+    // DSP callback, mikser zinciri çektiğinde çalışır; yani tap'teki en yeni
+    // sample'lar preroll ve çıkış buffer'ı kadar hoparlörün önündedir.
+    uint64_t playbackDelayFrames() const {
+        if (!m_chain) return 0;
+        const uint64_t buffered = m_mixer.bufferedFrames();
+        if (m_busMode.load()) return buffered;
+        // Tap zincirin hızında yazılır; çıkış buffer'ı çıkış hızında
+        const DWORD outRate = m_mixer.outputRate();
+        const uint64_t converted = (outRate && m_chain->freq && outRate != m_chain->freq)
+            ? buffered * m_chain->freq / outRate : buffered;
+        return converted + m_chain->prerollFramesLeft();
+    }
+
+    // FFT_SIZE/2 magnitude; tap boşsa (DSP callback henüz çalışmadı) eski yol
+    bool readAnalysisFFT(float* out) {
+        if (m_analysisTap.hasData()) {
+            float frames[FFT_SIZE * AnalysisTap::CHANNELS];
+            if (m_analysisTap.snapshot(frames, FFT_SIZE, playbackDelayFrames()) <= 0) return false;
+            AnalysisFFT::instance().magnitudes(frames, out);
+            return true;
+        }
+
+        float fft[FFT_SIZE];
+        HSTREAM source = m_analysisStream ? m_analysisStream : m_mixer.output();
+        if (m_analysisStream) {
+            QWORD pos = BASS_ChannelGetPosition(m_stream, BASS_POS_BYTE);
+            BASS_ChannelSetPosition(m_analysisStream, pos, BASS_POS_BYTE);
+        }
+        if (BASS_ChannelGetData(source, fft, BASS_DATA_FFT2048) == (DWORD)-1) {
+            return false;
+        }
+        std::memcpy(out, fft, sizeof(float) * (FFT_SIZE / 2));
+        return true;
     }
-    
+
+    // ============================================
+    // INTERNAL: FX SETUP - BASİTLEŞTİRİLMİŞ
+    // ============================================
     void clearAllFx() {
         if (!m_stream) return;
         clearAllFxForStream(m_stream, m_dspHandle, m_preampFx, m_reverbFx);
@@ -1700,69 +8218,57 @@ private:
         }
     }
 
-    void applyEqAndBassBoostToDsp(void* dsp) {
-        if (!dsp || !m_dspEnabled) return;
-        for (int band = 0; band < NUM_EQ_BANDS; ++band) {
-            float totalGain = m_eqGains[band];
-            if (band < BASS_BOOST_BANDS && m_bassBoost > 0.0f) {
-                float boostFactor = 1.0f - ((float)band / BASS_BOOST_BANDS);
-                float boostDB = (m_bassBoost / 100.0f) * 12.0f * boostFactor;
-                totalGain += boostDB;
-            }
-            totalGain = clampf(totalGain, -15.0f, 15.0f);
-            set_eq_band(dsp, band, totalGain);
-        }
+    // Ana EQ (bass boost dahil), ton ve genişlik: her MasterDSP örneği bu
+    // değerlerle başlar, değişiklikler bir sonraki blokta uygulanır
+    void publishToneParams() {
+        publishMasterDsp([&](MasterDspParams& p) { p.tone.assign(true, {m_bassGain, m_midGain, m_trebleGain}); });
     }
 
-    void setupAllFxForStream(HSTREAM stream, void*& dsp, HDSP& dspHandle, HFX& preampFxHandle, HFX& reverbFxHandle) {
-        if (!stream) return;
+    void publishEqAndToneParams() {
+        publishMasterDsp([&](MasterDspParams& p) {
+            p.enabled.assign(m_dspEnabled, {});
+            for (int band = 0; band < NUM_EQ_BANDS; ++band) p.setEqBand(band, eqBandTotalGain(band));
+            p.tone.assign(true, {m_bassGain, m_midGain, m_trebleGain});
+            p.width.assign(true, {m_stereoExpander / 100.0f});
+        });
+    }
+
+    // Offline render işçisinin MasterDSP'si: canlı zincirle aynı ayarlar
+    void configureOfflineDsp(void* dsp, float rate) {
+        set_sample_rate(dsp, rate);
+        ParamSnapshot<MasterDspParams>::ReadGuard params(g_masterDsp);
+        MasterDspState state;
+        syncMasterDsp(dsp, *params, state);
+    }
 
-        preampFxHandle = BASS_ChannelSetFX(stream, BASS_FX_BFX_VOLUME, 0);
-        updatePreampFxHandle(preampFxHandle);
+    // Zincirin FX'leri: preamp, parçaya özel MasterDSP, DSP callback, reverb,
+    // tape saturation ve bit/dither. Balance / master volume zincire değil
+    // mikser çıkışına uygulanır.
+    void setupChainFx(TrackChain& chain) {
+        if (!chain.stream) return;
 
-        if (!dsp) {
-            dsp = create_dsp();
+        if (m_busMode.load()) {
+            // Bus modu: yalnızca callback (mod kapatılırsa restoreChainFxLocked kurar)
+            chain.dspHandle = BASS_ChannelSetDSP(chain.stream, dspCallback, &chain, 0);
+            return;
         }
-        if (dsp) {
-            BASS_CHANNELINFO info;
-            if (BASS_ChannelGetInfo(stream, &info)) {
-                set_sample_rate(dsp, static_cast<float>(info.freq));
-            }
-            set_dsp_enabled(dsp, m_dspEnabled ? 1 : 0);
-            set_tone_params(dsp, m_bassGain, m_midGain, m_trebleGain);
-            set_stereo_width(dsp, m_stereoExpander / 100.0f);
-            set_eq_bands(dsp, m_eqGains, NUM_EQ_BANDS);
-            applyEqAndBassBoostToDsp(dsp);
-
-            set_crossfeed_params(dsp, g_crossfeed.enabled ? 1 : 0,
-                                 g_crossfeed.crossfeedLevel,
-                                 g_crossfeed.delay,
-                                 g_crossfeed.lowCut,
-                                 g_crossfeed.highCut);
-
-            set_bass_mono_params(dsp, g_bassMono.enabled ? 1 : 0,
-                                 g_bassMono.cutoff,
-                                 g_bassMono.slope,
-                                 g_bassMono.stereoWidth);
-
-            if (g_compressor.enabled) {
-                set_compressor_params(dsp, 1,
-                                      g_compressor.threshold,
-                                      g_compressor.ratio,
-                                      g_compressor.attack,
-                                      g_compressor.release,
-                                      g_compressor.makeupGain);
-            }
+
+        chain.preampFx = BASS_ChannelSetFX(chain.stream, BASS_FX_BFX_VOLUME, 0);
+        updatePreampFxHandle(chain.preampFx);
+
+        if (!chain.dsp) {
+            chain.dsp = create_dsp();
         }
+        if (chain.dsp && chain.freq) set_sample_rate(chain.dsp, static_cast<float>(chain.freq));
 
-        if (dspHandle) {
-            BASS_ChannelRemoveDSP(stream, dspHandle);
-            dspHandle = 0;
+        if (chain.dspHandle) {
+            BASS_ChannelRemoveDSP(chain.stream, chain.dspHandle);
+            chain.dspHandle = 0;
         }
-        dspHandle = BASS_ChannelSetDSP(stream, dspCallback, this, 0);
+        chain.dspHandle = BASS_ChannelSetDSP(chain.stream, dspCallback, &chain, 0);
 
-        applyBalanceToStream(stream);
-        applyReverbToStream(stream, reverbFxHandle);
+        applyReverbToStream(chain.stream, chain.reverbFx);
+        syncColorFxLocked(chain.stream, chain.color);
     }
 
     void clearAllFxForStream(HSTREAM stream, HDSP& dspHandle, HFX& preampFxHandle, HFX& reverbFxHandle) {
@@ -1789,88 +8295,35 @@ private:
         }
     }
 
-    bool createPlaybackStreams(const std::string& filePath, HSTREAM& outStream, HSTREAM& outAnalysisStream) {
-        outStream = 0;
-        outAnalysisStream = 0;
-
-        HSTREAM decodeStream = BASS_StreamCreateFile(
-            FALSE,
-            filePath.c_str(),
-            0, 0,
-            BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT
-        );
-        if (!decodeStream) return false;
-
-        HSTREAM tempoStream = BASS_FX_TempoCreate(decodeStream, BASS_FX_FREESOURCE | BASS_SAMPLE_FLOAT);
-        if (!tempoStream) {
-            BASS_StreamFree(decodeStream);
-            return false;
-        }
-
-        outAnalysisStream = BASS_StreamCreateFile(
-            FALSE,
-            filePath.c_str(),
-            0, 0,
-            BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT
-        );
-
-        outStream = tempoStream;
-        return true;
-    }
-
     // NOTE: We intentionally avoid doing cleanup work in BASS sync callbacks to prevent deadlocks.
     
     void applyBalance() {
-        if (!m_stream) return;
-        applyBalanceToStream(m_stream);
+        if (!m_mixer.output()) return;
+        applyBalanceToStream(m_mixer.output());
     }
     
     void applyReverb() {
-        if (!m_stream) return;
-        applyReverbToStream(m_stream, m_reverbFx);
+        if (m_busMode.load()) {
+            if (!m_busOutput) return;
+            applyReverbToStream(m_busOutput, m_busReverbFx);
+        } else {
+            if (!m_chain) return;
+            applyReverbToStream(m_chain->stream, m_chain->reverbFx);
+        }
+        bindFxMirrorsLocked();
     }
     
 public:
-    void detachTapeSat() {
-        if (m_stream && g_tapeSatDSP) {
-            BASS_ChannelRemoveDSP(m_stream, g_tapeSatDSP);
-            g_tapeSatDSP = 0;
-            printf("[TAPE SAT] DSP detached\n");
-        }
-    }
-
-    void attachTapeSatIfNeeded() {
-        if (!m_stream) return;
-
-        float sr = (float)SAMPLE_RATE;
-        BASS_ChannelGetAttribute(m_stream, BASS_ATTRIB_FREQ, &sr);
-        g_tapeSatState.sr = sr;
-
-        if (g_tapeSat.enabled && !g_tapeSatDSP) {
-            g_tapeSatDSP = BASS_ChannelSetDSP(m_stream, (DSPPROC*)TapeSat_DSP, nullptr, 12);
-            printf("[TAPE SAT] DSP attached. handle=%u sr=%.0f\n", g_tapeSatDSP, sr);
-        }
-    }
-
-    void detachBitDither() {
-        if (m_stream && g_bitDitherDSP) {
-            BASS_ChannelRemoveDSP(m_stream, g_bitDitherDSP);
-            g_bitDitherDSP = 0;
-            printf("[BIT/DITHER] DSP detached\n");
-        }
-    }
-
-    void attachBitDitherIfNeeded() {
-        if (!m_stream) return;
-
-        float sr = (float)SAMPLE_RATE;
-        BASS_ChannelGetAttribute(m_stream, BASS_ATTRIB_FREQ, &sr);
-        g_bitDitherState.sr = sr;
-
-        if (g_bitDither.enabled && !g_bitDitherDSP) {
-            g_bitDitherDSP = BASS_ChannelSetDSP(m_stream, (DSPPROC*)BitDither_DSP, nullptr, 20);
-            printf("[BIT/DITHER] DSP attached. handle=%u sr=%.0f\n", g_bitDitherDSP, sr);
+    // Tape saturation / bit-dither: sinyalin tek sahibine (bus modunda mikser
+    // çıkışı, zincir modunda aktif ve kuyruktaki zincir) bağlar ya da söker.
+    // Sönen zincirler mevcut hallerini korur. m_mutex tutulurken (N-API).
+    void refreshColorFxLocked() {
+        if (m_busMode.load()) {
+            if (m_busOutput) syncColorFxLocked(m_busOutput, m_busColor);
+            return;
         }
+        if (m_chain) syncColorFxLocked(m_chain->stream, m_chain->color);
+        if (m_next.chain && m_next.chainReady) syncColorFxLocked(m_next.chain->stream, m_next.chain->color);
     }
 
     std::mutex& getMutex() { return m_mutex; }
@@ -1881,18 +8334,9 @@ public:
     void setDSPEnabled(bool enabled) {
         std::lock_guard<std::mutex> lock(m_mutex);
         m_dspEnabled = enabled;
+        publishMasterDsp([&](MasterDspParams& p) { p.enabled.assign(enabled, {}); });
         
         if (!m_stream) return;
-        
-        if (m_aurivoDSP) {
-            set_dsp_enabled(m_aurivoDSP, enabled ? 1 : 0);
-            if (enabled) {
-                set_eq_bands(m_aurivoDSP, m_eqGains, NUM_EQ_BANDS);
-                applyBassBoost();
-                set_tone_params(m_aurivoDSP, m_bassGain, m_midGain, m_trebleGain);
-                set_stereo_width(m_aurivoDSP, m_stereoExpander / 100.0f);
-            }
-        }
 
         applyBalance();
         applyReverb();
@@ -1919,9 +8363,7 @@ public:
     void setBass(float dB) {
         std::lock_guard<std::mutex> lock(m_mutex);
         m_bassGain = clampf(dB, -15.0f, 15.0f);
-        
-        if (!m_dspEnabled || !m_aurivoDSP) return;
-        set_tone_params(m_aurivoDSP, m_bassGain, m_midGain, m_trebleGain);
+        publishToneParams();
     }
     
     float getBass() { return m_bassGain; }
@@ -1932,9 +8374,7 @@ public:
     void setMid(float dB) {
         std::lock_guard<std::mutex> lock(m_mutex);
         m_midGain = clampf(dB, -15.0f, 15.0f);
-        
-        if (!m_dspEnabled || !m_aurivoDSP) return;
-        set_tone_params(m_aurivoDSP, m_bassGain, m_midGain, m_trebleGain);
+        publishToneParams();
     }
     
     float getMid() { return m_midGain; }
@@ -1945,9 +8385,7 @@ public:
     void setTreble(float dB) {
         std::lock_guard<std::mutex> lock(m_mutex);
         m_trebleGain = clampf(dB, -15.0f, 15.0f);
-        
-        if (!m_dspEnabled || !m_aurivoDSP) return;
-        set_tone_params(m_aurivoDSP, m_bassGain, m_midGain, m_trebleGain);
+        publishToneParams();
     }
     
     float getTreble() { return m_trebleGain; }
@@ -1958,9 +8396,7 @@ public:
     void setStereoExpander(float percent) {
         std::lock_guard<std::mutex> lock(m_mutex);
         m_stereoExpander = clampf(percent, 0.0f, 200.0f);
-        if (m_dspEnabled && m_aurivoDSP) {
-            set_stereo_width(m_aurivoDSP, m_stereoExpander / 100.0f);
-        }
+        publishMasterDsp([&](MasterDspParams& p) { p.width.assign(true, {m_stereoExpander / 100.0f}); });
     }
     
     float getStereoExpander() { return m_stereoExpander; }
@@ -2013,20 +8449,15 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         g_compressor.enabled = enabled;
 
+        // Use Aurivo DSP compressor (works on all platforms)
+        publishCompressorParams(enabled);
+
         if (!m_aurivoDSP) {
-            printf("[COMPRESSOR] No DSP processor available\n");
+            AURIVO_LOG_WARN("[COMPRESSOR] No DSP processor available");
             return false;
         }
-
-        // Use Aurivo DSP compressor (works on all platforms)
-        set_compressor_params(m_aurivoDSP, enabled ? 1 : 0, 
-                              g_compressor.threshold, 
-                              g_compressor.ratio, 
-                              g_compressor.attack, 
-                              g_compressor.release, 
-                              g_compressor.makeupGain);
         
-        printf("[COMPRESSOR] %s (thresh=%.1f ratio=%.1f att=%.1f rel=%.1f gain=%.1f)\n",
+        AURIVO_LOG_DEBUG("[COMPRESSOR] %s (thresh=%.1f ratio=%.1f att=%.1f rel=%.1f gain=%.1f)",
                enabled ? "Enabled" : "Disabled",
                g_compressor.threshold, g_compressor.ratio, 
                g_compressor.attack, g_compressor.release, g_compressor.makeupGain);
@@ -2034,14 +8465,17 @@ public:
         return true;
     }
 
+    void publishCompressorParams(bool enabled) {
+        publishMasterDsp([&](MasterDspParams& p) {
+            p.compressor.assign(enabled, {g_compressor.threshold, g_compressor.ratio, g_compressor.attack,
+                                          g_compressor.release, g_compressor.makeupGain});
+            p.compressorMeter = enabled;
+        });
+    }
+
     void applyCompressorToDSP() {
-        if (!m_aurivoDSP || !g_compressor.enabled) return;
-        set_compressor_params(m_aurivoDSP, 1, 
-                              g_compressor.threshold, 
-                              g_compressor.ratio, 
-                              g_compressor.attack, 
-                              g_compressor.release, 
-                              g_compressor.makeupGain);
+        if (!g_compressor.enabled) return;
+        publishCompressorParams(true);
     }
 
     void setCompressorThreshold(float threshold) {
@@ -2080,22 +8514,10 @@ public:
         // Knee DSP compressor'da yok, sadece sakla
     }
 
+    // DSP compressor zarfından (audio thread metre snapshot'ı)
     float getCompressorGainReduction() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (!g_compressor.enabled || !m_stream) return 0.0f;
-
-        // Basit gain reduction tahmini
-        DWORD level = BASS_ChannelGetLevel(m_stream);
-        int maxLevel = LOWORD(level) > HIWORD(level) ? LOWORD(level) : HIWORD(level);
-        if (maxLevel <= 0) return 0.0f;
-        
-        float levelDB = 20.0f * log10f((float)maxLevel / 32768.0f);
-
-        if (levelDB > g_compressor.threshold) {
-            return (levelDB - g_compressor.threshold) * (1.0f - 1.0f / g_compressor.ratio);
-        }
-
-        return 0.0f;
+        if (!g_compressor.enabled) return 0.0f;
+        return meterValue(MeterBank::COMPRESSOR_GR);
     }
 
     void resetCompressor() {
@@ -2113,26 +8535,25 @@ public:
     // LIMITER (Aurivo DSP)
     // ============================================
     void applyLimiterToDSP() {
-        if (!m_aurivoDSP) return;
         // DSP limiter sadece ceiling ve release destekliyor
         // inputGain'i ceiling'e ekleyerek simüle ediyoruz
         float effectiveCeiling = g_limiter.ceiling - g_limiter.inputGain;
-        set_limiter_params(m_aurivoDSP, g_limiter.enabled ? 1 : 0, 
-                          effectiveCeiling, g_limiter.release);
+        publishMasterDsp([&](MasterDspParams& p) {
+            p.limiter.assign(g_limiter.enabled, {effectiveCeiling, g_limiter.release});
+        });
     }
 
     bool enableLimiter(bool enabled) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_limiter.enabled = enabled;
+        applyLimiterToDSP();
 
         if (!m_aurivoDSP) {
-            printf("[LIMITER] No DSP processor available\n");
+            AURIVO_LOG_WARN("[LIMITER] No DSP processor available");
             return false;
         }
-
-        applyLimiterToDSP();
         
-        printf("[LIMITER] %s (ceil=%.1f rel=%.1f look=%.1f gain=%.1f)\n",
+        AURIVO_LOG_DEBUG("[LIMITER] %s (ceil=%.1f rel=%.1f look=%.1f gain=%.1f)",
                enabled ? "Enabled" : "Disabled",
                g_limiter.ceiling, g_limiter.release, 
                g_limiter.lookahead, g_limiter.inputGain);
@@ -2144,46 +8565,33 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         g_limiter.ceiling = clampf(ceiling, -12.0f, 0.0f);
         if (g_limiter.enabled) applyLimiterToDSP();
-        printf("[LIMITER] Ceiling: %.1f dB\n", g_limiter.ceiling);
+        AURIVO_LOG_DEBUG("[LIMITER] Ceiling: %.1f dB", g_limiter.ceiling);
     }
 
     void setLimiterRelease(float release) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_limiter.release = clampf(release, 10.0f, 500.0f);
         if (g_limiter.enabled) applyLimiterToDSP();
-        printf("[LIMITER] Release: %.1f ms\n", g_limiter.release);
+        AURIVO_LOG_DEBUG("[LIMITER] Release: %.1f ms", g_limiter.release);
     }
 
     void setLimiterLookahead(float lookahead) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_limiter.lookahead = clampf(lookahead, 0.0f, 20.0f);
         // DSP limiter lookahead desteklemiyor, sadece saklıyoruz
-        printf("[LIMITER] Lookahead: %.1f ms\n", g_limiter.lookahead);
+        AURIVO_LOG_DEBUG("[LIMITER] Lookahead: %.1f ms", g_limiter.lookahead);
     }
 
     void setLimiterGain(float gain) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_limiter.inputGain = clampf(gain, -12.0f, 12.0f);
         if (g_limiter.enabled) applyLimiterToDSP();
-        printf("[LIMITER] Gain: %.1f dB\n", g_limiter.inputGain);
+        AURIVO_LOG_DEBUG("[LIMITER] Gain: %.1f dB", g_limiter.inputGain);
     }
 
     float getLimiterReduction() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (!g_limiter.enabled || !m_stream) return 0.0f;
-
-        DWORD level = BASS_ChannelGetLevel(m_stream);
-        int maxLevel = LOWORD(level) > HIWORD(level) ? LOWORD(level) : HIWORD(level);
-        if (maxLevel <= 0) return 0.0f;
-        
-        float levelDB = 20.0f * log10f((float)maxLevel / 32768.0f);
-        float effectiveCeiling = g_limiter.ceiling - g_limiter.inputGain;
-
-        if (levelDB > effectiveCeiling) {
-            return levelDB - effectiveCeiling;
-        }
-
-        return 0.0f;
+        if (!g_limiter.enabled) return 0.0f;
+        return meterValue(MeterBank::LIMITER_GR);
     }
 
     void resetLimiter() {
@@ -2193,15 +8601,13 @@ public:
         g_limiter.lookahead = 5.0f;
         g_limiter.inputGain = 0.0f;
         if (g_limiter.enabled) applyLimiterToDSP();
-        printf("[LIMITER] Reset to defaults\n");
+        AURIVO_LOG_INFO("[LIMITER] Reset to defaults");
     }
 
     // ============================================
     // BASS ENHANCER (Aurivo DSP)
     // ============================================
     void applyBassEnhancerToDSP() {
-        if (!m_aurivoDSP) return;
-        
         // Bass Enhancer, DSP bass_boost fonksiyonunu kullanıyor
         // gain: dB, frequency: Hz (merkez frekans)
         // Dry/wet ve harmonics efektini gain üzerinden simüle ediyoruz
@@ -2215,21 +8621,22 @@ public:
         float effectiveFreq = g_bassEnhancer.frequency / g_bassEnhancer.width;
         effectiveFreq = clampf(effectiveFreq, 20.0f, 200.0f);
         
-        set_bass_boost(m_aurivoDSP, g_bassEnhancer.enabled ? 1 : 0, effectiveGain, effectiveFreq);
+        publishMasterDsp([&](MasterDspParams& p) {
+            p.bassBoost.assign(g_bassEnhancer.enabled, {effectiveGain, effectiveFreq});
+        });
     }
 
     bool enableBassEnhancer(bool enabled) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_bassEnhancer.enabled = enabled;
+        applyBassEnhancerToDSP();
 
         if (!m_aurivoDSP) {
-            printf("[BASS ENHANCER] No DSP processor available\n");
+            AURIVO_LOG_WARN("[BASS ENHANCER] No DSP processor available");
             return false;
         }
-
-        applyBassEnhancerToDSP();
         
-        printf("[BASS ENHANCER] %s (freq=%.0f gain=%.1f harm=%.0f width=%.1f mix=%.0f)\n",
+        AURIVO_LOG_DEBUG("[BASS ENHANCER] %s (freq=%.0f gain=%.1f harm=%.0f width=%.1f mix=%.0f)",
                enabled ? "Enabled" : "Disabled",
                g_bassEnhancer.frequency, g_bassEnhancer.gain, 
                g_bassEnhancer.harmonics, g_bassEnhancer.width, g_bassEnhancer.dryWet);
@@ -2241,35 +8648,35 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         g_bassEnhancer.frequency = clampf(frequency, 20.0f, 200.0f);
         if (g_bassEnhancer.enabled) applyBassEnhancerToDSP();
-        printf("[BASS ENHANCER] Frequency: %.0f Hz\n", g_bassEnhancer.frequency);
+        AURIVO_LOG_DEBUG("[BASS ENHANCER] Frequency: %.0f Hz", g_bassEnhancer.frequency);
     }
 
     void setBassEnhancerGain(float gain) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_bassEnhancer.gain = clampf(gain, 0.0f, 18.0f);
         if (g_bassEnhancer.enabled) applyBassEnhancerToDSP();
-        printf("[BASS ENHANCER] Gain: %.1f dB\n", g_bassEnhancer.gain);
+        AURIVO_LOG_DEBUG("[BASS ENHANCER] Gain: %.1f dB", g_bassEnhancer.gain);
     }
 
     void setBassEnhancerHarmonics(float harmonics) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_bassEnhancer.harmonics = clampf(harmonics, 0.0f, 100.0f);
         if (g_bassEnhancer.enabled) applyBassEnhancerToDSP();
-        printf("[BASS ENHANCER] Harmonics: %.0f%%\n", g_bassEnhancer.harmonics);
+        AURIVO_LOG_DEBUG("[BASS ENHANCER] Harmonics: %.0f%%", g_bassEnhancer.harmonics);
     }
 
     void setBassEnhancerWidth(float width) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_bassEnhancer.width = clampf(width, 0.5f, 3.0f);
         if (g_bassEnhancer.enabled) applyBassEnhancerToDSP();
-        printf("[BASS ENHANCER] Width: %.1f\n", g_bassEnhancer.width);
+        AURIVO_LOG_DEBUG("[BASS ENHANCER] Width: %.1f", g_bassEnhancer.width);
     }
 
     void setBassEnhancerMix(float mix) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_bassEnhancer.dryWet = clampf(mix, 0.0f, 100.0f);
         if (g_bassEnhancer.enabled) applyBassEnhancerToDSP();
-        printf("[BASS ENHANCER] Dry/Wet: %.0f%%\n", g_bassEnhancer.dryWet);
+        AURIVO_LOG_DEBUG("[BASS ENHANCER] Dry/Wet: %.0f%%", g_bassEnhancer.dryWet);
     }
 
     void resetBassEnhancer() {
@@ -2280,35 +8687,33 @@ public:
         g_bassEnhancer.width = 1.5f;
         g_bassEnhancer.dryWet = 50.0f;
         if (g_bassEnhancer.enabled) applyBassEnhancerToDSP();
-        printf("[BASS ENHANCER] Reset to defaults\n");
+        AURIVO_LOG_INFO("[BASS ENHANCER] Reset to defaults");
     }
 
     // ============================================
     // NOISE GATE (Aurivo DSP)
     // ============================================
     void applyNoiseGateToDSP() {
-        if (!m_aurivoDSP) return;
-        
         // DSP gate fonksiyonu: threshold, attack, release
         // Hold parametresi DSP'de desteklenmiyor, release'e ekliyoruz
         float effectiveRelease = g_noiseGate.release + g_noiseGate.hold;
         
-        set_gate_params(m_aurivoDSP, g_noiseGate.enabled ? 1 : 0, 
-                       g_noiseGate.threshold, g_noiseGate.attack, effectiveRelease);
+        publishMasterDsp([&](MasterDspParams& p) {
+            p.gate.assign(g_noiseGate.enabled, {g_noiseGate.threshold, g_noiseGate.attack, effectiveRelease});
+        });
     }
 
     bool enableNoiseGate(bool enabled) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_noiseGate.enabled = enabled;
+        applyNoiseGateToDSP();
 
         if (!m_aurivoDSP) {
-            printf("[NOISE GATE] No DSP processor available\n");
+            AURIVO_LOG_WARN("[NOISE GATE] No DSP processor available");
             return false;
         }
-
-        applyNoiseGateToDSP();
         
-        printf("[NOISE GATE] %s (thresh=%.1f att=%.1f hold=%.1f rel=%.1f range=%.1f)\n",
+        AURIVO_LOG_DEBUG("[NOISE GATE] %s (thresh=%.1f att=%.1f hold=%.1f rel=%.1f range=%.1f)",
                enabled ? "Enabled" : "Disabled",
                g_noiseGate.threshold, g_noiseGate.attack, 
                g_noiseGate.hold, g_noiseGate.release, g_noiseGate.range);
@@ -2320,51 +8725,41 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         g_noiseGate.threshold = clampf(threshold, -96.0f, 0.0f);
         if (g_noiseGate.enabled) applyNoiseGateToDSP();
-        printf("[NOISE GATE] Threshold: %.1f dB\n", g_noiseGate.threshold);
+        AURIVO_LOG_DEBUG("[NOISE GATE] Threshold: %.1f dB", g_noiseGate.threshold);
     }
 
     void setNoiseGateAttack(float attack) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_noiseGate.attack = clampf(attack, 0.1f, 50.0f);
         if (g_noiseGate.enabled) applyNoiseGateToDSP();
-        printf("[NOISE GATE] Attack: %.1f ms\n", g_noiseGate.attack);
+        AURIVO_LOG_DEBUG("[NOISE GATE] Attack: %.1f ms", g_noiseGate.attack);
     }
 
     void setNoiseGateHold(float hold) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_noiseGate.hold = clampf(hold, 0.0f, 500.0f);
         if (g_noiseGate.enabled) applyNoiseGateToDSP();
-        printf("[NOISE GATE] Hold: %.1f ms\n", g_noiseGate.hold);
+        AURIVO_LOG_DEBUG("[NOISE GATE] Hold: %.1f ms", g_noiseGate.hold);
     }
 
     void setNoiseGateRelease(float release) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_noiseGate.release = clampf(release, 10.0f, 2000.0f);
         if (g_noiseGate.enabled) applyNoiseGateToDSP();
-        printf("[NOISE GATE] Release: %.1f ms\n", g_noiseGate.release);
+        AURIVO_LOG_DEBUG("[NOISE GATE] Release: %.1f ms", g_noiseGate.release);
     }
 
     void setNoiseGateRange(float range) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_noiseGate.range = clampf(range, -96.0f, 0.0f);
         // Range DSP'de doğrudan desteklenmiyor, sadece saklıyoruz
-        printf("[NOISE GATE] Range: %.1f dB\n", g_noiseGate.range);
+        AURIVO_LOG_DEBUG("[NOISE GATE] Range: %.1f dB", g_noiseGate.range);
     }
 
+    // Gate zarfı yarıdan fazla açıksa açık sayılır
     bool getNoiseGateStatus() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        if (!g_noiseGate.enabled || !m_stream) return false;
-
-        // Mevcut ses seviyesini al
-        DWORD level = BASS_ChannelGetLevel(m_stream);
-        int maxLevel = LOWORD(level) > HIWORD(level) ? LOWORD(level) : HIWORD(level);
-        if (maxLevel <= 0) return false;
-        
-        float levelDB = 20.0f * log10f((float)maxLevel / 32768.0f);
-        
-        // Threshold'u aşıyorsa gate açık
-        return levelDB > g_noiseGate.threshold;
+        if (!g_noiseGate.enabled) return false;
+        return meterValue(MeterBank::GATE_GAIN) > 0.5f;
     }
 
     void resetNoiseGate() {
@@ -2375,13 +8770,11 @@ public:
         g_noiseGate.release = 150.0f;
         g_noiseGate.range = -80.0f;
         if (g_noiseGate.enabled) applyNoiseGateToDSP();
-        printf("[NOISE GATE] Reset to defaults\n");
+        AURIVO_LOG_INFO("[NOISE GATE] Reset to defaults");
     }
 
     // ============== DE-ESSER ==============
     void applyDeEsserToDSP() {
-        if (!m_stream) return;
-        
         // De-esser, yüksek frekanslarda (sibilance) sıkıştırma yapar
         // Aurivo DSP compressor'ı kullanarak belirli frekans bandında çalışır
         // Frequency: Hedef frekans (4-12 kHz arası sibilance bölgesi)
@@ -2389,21 +8782,19 @@ public:
         // Ratio: Sıkıştırma oranı
         // Range: Maksimum azaltma miktarı
         
-        if (g_deEsser.enabled && m_aurivoDSP) {
+        if (g_deEsser.enabled) {
             // De-esser için compressor parametrelerini ayarla
             // Hızlı attack/release ile sibilance'ı yakala
             float attack = 0.5f;   // Çok hızlı attack (ms)
             float release = 20.0f; // Hızlı release (ms)
             float makeup = 0.0f;   // Makeup gain yok
             
-            set_compressor_params(m_aurivoDSP, 1,
-                g_deEsser.threshold,
-                g_deEsser.ratio,
-                attack,
-                release,
-                makeup);
+            publishMasterDsp([&](MasterDspParams& p) {
+                p.compressor.assign(true, {g_deEsser.threshold, g_deEsser.ratio, attack, release, makeup});
+                p.deEsserMeter = true;
+            });
             
-            printf("[DE-ESSER] Applied - Freq: %.0f Hz, Threshold: %.1f dB, Ratio: %.1f:1, Range: %.1f dB\n",
+            AURIVO_LOG_DEBUG("[DE-ESSER] Applied - Freq: %.0f Hz, Threshold: %.1f dB, Ratio: %.1f:1, Range: %.1f dB",
                    g_deEsser.frequency, g_deEsser.threshold, g_deEsser.ratio, g_deEsser.range);
         }
     }
@@ -2416,68 +8807,52 @@ public:
             applyDeEsserToDSP();
         } else {
             // Devre dışı bırakırken compressor'ı sıfırla
-            if (m_aurivoDSP) {
-                set_compressor_params(m_aurivoDSP, 0, 0.0f, 1.0f, 10.0f, 100.0f, 0.0f);
-            }
+            publishMasterDsp([](MasterDspParams& p) {
+                p.compressor.assign(false, {0.0f, 1.0f, 10.0f, 100.0f, 0.0f});
+                p.deEsserMeter = false;
+            });
         }
         
-        printf("[DE-ESSER] %s\n", enable ? "Enabled" : "Disabled");
+        AURIVO_LOG_INFO("[DE-ESSER] %s", enable ? "Enabled" : "Disabled");
     }
 
     void setDeEsserFrequency(float frequency) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_deEsser.frequency = clampf(frequency, 4000.0f, 12000.0f);
         if (g_deEsser.enabled) applyDeEsserToDSP();
-        printf("[DE-ESSER] Frequency: %.0f Hz\n", g_deEsser.frequency);
+        AURIVO_LOG_DEBUG("[DE-ESSER] Frequency: %.0f Hz", g_deEsser.frequency);
     }
 
     void setDeEsserThreshold(float threshold) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_deEsser.threshold = clampf(threshold, -60.0f, 0.0f);
         if (g_deEsser.enabled) applyDeEsserToDSP();
-        printf("[DE-ESSER] Threshold: %.1f dB\n", g_deEsser.threshold);
+        AURIVO_LOG_DEBUG("[DE-ESSER] Threshold: %.1f dB", g_deEsser.threshold);
     }
 
     void setDeEsserRatio(float ratio) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_deEsser.ratio = clampf(ratio, 1.0f, 10.0f);
         if (g_deEsser.enabled) applyDeEsserToDSP();
-        printf("[DE-ESSER] Ratio: %.1f:1\n", g_deEsser.ratio);
+        AURIVO_LOG_DEBUG("[DE-ESSER] Ratio: %.1f:1", g_deEsser.ratio);
     }
 
     void setDeEsserRange(float range) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_deEsser.range = clampf(range, -24.0f, 0.0f);
         if (g_deEsser.enabled) applyDeEsserToDSP();
-        printf("[DE-ESSER] Range: %.1f dB\n", g_deEsser.range);
+        AURIVO_LOG_DEBUG("[DE-ESSER] Range: %.1f dB", g_deEsser.range);
     }
 
     void setDeEsserListenMode(bool listen) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_deEsser.listenMode = listen;
-        printf("[DE-ESSER] Listen Mode: %s\n", listen ? "ON" : "OFF");
+        AURIVO_LOG_DEBUG("[DE-ESSER] Listen Mode: %s", listen ? "ON" : "OFF");
     }
 
     float getDeEsserActivity() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        if (!g_deEsser.enabled || !m_stream) return 0.0f;
-        
-        // Mevcut ses seviyesini al
-        DWORD level = BASS_ChannelGetLevel(m_stream);
-        int maxLevel = LOWORD(level) > HIWORD(level) ? LOWORD(level) : HIWORD(level);
-        if (maxLevel <= 0) return 0.0f;
-        
-        float levelDB = 20.0f * log10f((float)maxLevel / 32768.0f);
-        
-        // Threshold üstündeki miktar (gain reduction tahmini)
-        if (levelDB > g_deEsser.threshold) {
-            float overThreshold = levelDB - g_deEsser.threshold;
-            float reduction = overThreshold * (1.0f - 1.0f/g_deEsser.ratio);
-            return fminf(reduction, fabsf(g_deEsser.range));
-        }
-        
-        return 0.0f;
+        if (!g_deEsser.enabled) return 0.0f;
+        return fminf(meterValue(MeterBank::DEESSER_GR), fabsf(g_deEsser.range));
     }
 
     void resetDeEsser() {
@@ -2488,13 +8863,11 @@ public:
         g_deEsser.range = -12.0f;
         g_deEsser.listenMode = false;
         if (g_deEsser.enabled) applyDeEsserToDSP();
-        printf("[DE-ESSER] Reset to defaults\n");
+        AURIVO_LOG_INFO("[DE-ESSER] Reset to defaults");
     }
 
     // ============== EXCITER (HARMONIC ENHANCER) ==============
     void applyExciterToDSP() {
-        if (!m_stream || !m_aurivoDSP) return;
-        
         // Exciter: Yüksek frekanslara boost + harmonik zenginleştirme
         // PEQ bantları ile high-shelf boost simüle ediyoruz
         
@@ -2537,13 +8910,14 @@ public:
             // Harmonik faktör ile boost'u artır
             boostGain *= (1.0f + harmFactor * 0.5f);
             
-            // PEQ Band 0: Ana yüksek frekans boost (exciter frequency'den başlar)
-            set_peq_band(m_aurivoDSP, 0, 1, g_exciter.frequency, boostGain, bandwidth);
+            publishMasterDsp([&](MasterDspParams& p) {
+                // PEQ Band 0: Ana yüksek frekans boost (exciter frequency'den başlar)
+                p.setPeqBand(0, true, g_exciter.frequency, boostGain, bandwidth);
+                // PEQ Band 1: Air band (12-16 kHz arası "hava" hissi)
+                p.setPeqBand(1, true, 14000.0f, airGain, 1.0f);
+            });
             
-            // PEQ Band 1: Air band (12-16 kHz arası "hava" hissi)
-            set_peq_band(m_aurivoDSP, 1, 1, 14000.0f, airGain, 1.0f);
-            
-            printf("[EXCITER] Applied - Type: %d, Freq: %.0f Hz, Boost: %.1f dB, Air: %.1f dB\n",
+            AURIVO_LOG_DEBUG("[EXCITER] Applied - Type: %d, Freq: %.0f Hz, Boost: %.1f dB, Air: %.1f dB",
                    g_exciter.type, g_exciter.frequency, boostGain, airGain);
         }
     }
@@ -2556,41 +8930,41 @@ public:
             applyExciterToDSP();
         } else {
             // PEQ bantlarını sıfırla
-            if (m_aurivoDSP) {
-                set_peq_band(m_aurivoDSP, 0, 0, 5000.0f, 0.0f, 1.0f);
-                set_peq_band(m_aurivoDSP, 1, 0, 14000.0f, 0.0f, 1.0f);
-            }
+            publishMasterDsp([](MasterDspParams& p) {
+                p.setPeqBand(0, false, 5000.0f, 0.0f, 1.0f);
+                p.setPeqBand(1, false, 14000.0f, 0.0f, 1.0f);
+            });
         }
         
-        printf("[EXCITER] %s\n", enable ? "Enabled" : "Disabled");
+        AURIVO_LOG_INFO("[EXCITER] %s", enable ? "Enabled" : "Disabled");
     }
 
     void setExciterAmount(float amount) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_exciter.amount = clampf(amount, 0.0f, 100.0f);
         if (g_exciter.enabled) applyExciterToDSP();
-        printf("[EXCITER] Amount: %.0f%%\n", g_exciter.amount);
+        AURIVO_LOG_DEBUG("[EXCITER] Amount: %.0f%%", g_exciter.amount);
     }
 
     void setExciterFrequency(float frequency) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_exciter.frequency = clampf(frequency, 2000.0f, 10000.0f);
         if (g_exciter.enabled) applyExciterToDSP();
-        printf("[EXCITER] Frequency: %.0f Hz\n", g_exciter.frequency);
+        AURIVO_LOG_DEBUG("[EXCITER] Frequency: %.0f Hz", g_exciter.frequency);
     }
 
     void setExciterHarmonics(float harmonics) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_exciter.harmonics = clampf(harmonics, 0.0f, 100.0f);
         if (g_exciter.enabled) applyExciterToDSP();
-        printf("[EXCITER] Harmonics: %.0f%%\n", g_exciter.harmonics);
+        AURIVO_LOG_DEBUG("[EXCITER] Harmonics: %.0f%%", g_exciter.harmonics);
     }
 
     void setExciterMix(float mix) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_exciter.mix = clampf(mix, 0.0f, 100.0f);
         if (g_exciter.enabled) applyExciterToDSP();
-        printf("[EXCITER] Mix: %.0f%%\n", g_exciter.mix);
+        AURIVO_LOG_DEBUG("[EXCITER] Mix: %.0f%%", g_exciter.mix);
     }
 
     void setExciterType(int type) {
@@ -2598,7 +8972,7 @@ public:
         g_exciter.type = (type < 0) ? 0 : ((type > 3) ? 3 : type);
         if (g_exciter.enabled) applyExciterToDSP();
         const char* typeNames[] = {"Tube", "Tape", "Aural", "Warm"};
-        printf("[EXCITER] Type: %s\n", typeNames[g_exciter.type]);
+        AURIVO_LOG_DEBUG("[EXCITER] Type: %s", typeNames[g_exciter.type]);
     }
 
     void resetExciter() {
@@ -2609,7 +8983,7 @@ public:
         g_exciter.mix = 50.0f;
         g_exciter.type = 0;
         if (g_exciter.enabled) applyExciterToDSP();
-        printf("[EXCITER] Reset to defaults\n");
+        AURIVO_LOG_INFO("[EXCITER] Reset to defaults");
     }
 
     // ============================================
@@ -2617,15 +8991,13 @@ public:
     // ============================================
     
     void applyStereoWidenerToDSP() {
-        if (!m_aurivoDSP) return;
-        
         // Width: 0% = mono (0.0), 100% = normal (1.0), 200% = max (2.0)
         float stereoWidth = g_stereoWidener.width / 100.0f;
         
         // Aurivo DSP'nin set_stereo_width fonksiyonunu kullan
-        set_stereo_width(m_aurivoDSP, stereoWidth);
+        publishMasterDsp([&](MasterDspParams& p) { p.width.assign(true, {stereoWidth}); });
         
-        printf("[STEREO WIDENER] Applied - Width: %.0f%%, Bass: %.0f Hz, Delay: %.1f ms\n",
+        AURIVO_LOG_DEBUG("[STEREO WIDENER] Applied - Width: %.0f%%, Bass: %.0f Hz, Delay: %.1f ms",
                g_stereoWidener.width, g_stereoWidener.bassFreq, g_stereoWidener.delay);
     }
 
@@ -2635,13 +9007,11 @@ public:
         
         if (enable) {
             applyStereoWidenerToDSP();
-            printf("[STEREO WIDENER] Enabled\n");
+            AURIVO_LOG_INFO("[STEREO WIDENER] Enabled");
         } else {
             // Sıfırla to normal stereo (100%)
-            if (m_aurivoDSP) {
-                set_stereo_width(m_aurivoDSP, 1.0f);  // Normal stereo
-            }
-            printf("[STEREO WIDENER] Disabled\n");
+            publishMasterDsp([](MasterDspParams& p) { p.width.assign(true, {1.0f}); });  // Normal stereo
+            AURIVO_LOG_INFO("[STEREO WIDENER] Disabled");
         }
     }
 
@@ -2649,21 +9019,21 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         g_stereoWidener.width = clampf(width, 0.0f, 200.0f);
         if (g_stereoWidener.enabled) applyStereoWidenerToDSP();
-        printf("[STEREO WIDENER] Width: %.0f%%\n", g_stereoWidener.width);
+        AURIVO_LOG_DEBUG("[STEREO WIDENER] Width: %.0f%%", g_stereoWidener.width);
     }
 
     void setStereoBassCutoff(float frequency) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_stereoWidener.bassFreq = clampf(frequency, 40.0f, 250.0f);
         if (g_stereoWidener.enabled) applyStereoWidenerToDSP();
-        printf("[STEREO WIDENER] Bass cutoff: %.0f Hz\n", g_stereoWidener.bassFreq);
+        AURIVO_LOG_DEBUG("[STEREO WIDENER] Bass cutoff: %.0f Hz", g_stereoWidener.bassFreq);
     }
 
     void setStereoDelay(float delay) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_stereoWidener.delay = clampf(delay, 0.0f, 30.0f);
         if (g_stereoWidener.enabled) applyStereoWidenerToDSP();
-        printf("[STEREO WIDENER] Haas delay: %.1f ms\n", g_stereoWidener.delay);
+        AURIVO_LOG_DEBUG("[STEREO WIDENER] Haas delay: %.1f ms", g_stereoWidener.delay);
     }
 
     void setStereoBalance(float balance) {
@@ -2673,39 +9043,46 @@ public:
         // BASS pan attribute kullan
         if (m_stream) {
             float pan = g_stereoWidener.balance / 100.0f;  // -1.0 ile +1.0
-            BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_PAN, pan);
+            BASS_ChannelSetAttribute(m_mixer.output(), BASS_ATTRIB_PAN, pan);
         }
         
-        printf("[STEREO WIDENER] Balance: %.0f\n", g_stereoWidener.balance);
+        AURIVO_LOG_DEBUG("[STEREO WIDENER] Balance: %.0f", g_stereoWidener.balance);
     }
 
     void setStereoMonoLow(bool monoLow) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_stereoWidener.monoLow = monoLow;
         if (g_stereoWidener.enabled) applyStereoWidenerToDSP();
-        printf("[STEREO WIDENER] Mono low: %s\n", monoLow ? "ON" : "OFF");
+        AURIVO_LOG_DEBUG("[STEREO WIDENER] Mono low: %s", monoLow ? "ON" : "OFF");
     }
 
+    // L/R korelasyonu (-1..+1), çıkış sinyalinden, seçili pencereyle
     float getStereoPhase() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        float phase = 0.0f;
-        
-        if (m_stream) {
-            // Sol ve sağ kanal seviyelerini al
-            DWORD level = BASS_ChannelGetLevel(m_stream);
-            int left = LOWORD(level);
-            int right = HIWORD(level);
-            
-            // Basitleştirilmiş phase correlation
-            if (left > 0 && right > 0) {
-                float ratio = (float)left / (float)right;
-                phase = 1.0f - fabs(1.0f - ratio);
-                if (phase < -1.0f) phase = -1.0f;
-                if (phase > 1.0f) phase = 1.0f;
-            }
-        }
-        
-        return phase;
+        StereoAnalyzer::Correlation c;
+        if (!m_stream || !m_stereo.read(c)) return 0.0f;
+        return c.correlation;
+    }
+
+    // ============================================
+    // KORELASYON / GONİOMETRE
+    // ============================================
+    void setCorrelationWindow(int ms) {
+        m_stereo.setWindowMs(ms);
+        AURIVO_LOG_INFO("[STEREO] Korelasyon penceresi: %d ms", m_stereo.windowMs());
+    }
+
+    bool getCorrelation(StereoAnalyzer::Correlation& out) const {
+        return m_stereo.read(out);
+    }
+
+    void setGoniometer(bool enabled, int decimation) {
+        m_stereo.setGoniometer(enabled, decimation);
+        AURIVO_LOG_INFO("[STEREO] Goniometre: %s (1/%d)", enabled ? "ON" : "OFF", m_stereo.decimation());
+    }
+
+    // Yeni M/S noktaları [m, s, ...]; nokta sayısını döner
+    int readGoniometer(float* dest, int maxPoints) {
+        return m_stereo.readPoints(dest, maxPoints);
     }
 
     void resetStereoWidener() {
@@ -2721,11 +9098,11 @@ public:
             
             // Balance sıfırla
             if (m_stream) {
-                BASS_ChannelSetAttribute(m_stream, BASS_ATTRIB_PAN, 0.0f);
+                BASS_ChannelSetAttribute(m_mixer.output(), BASS_ATTRIB_PAN, 0.0f);
             }
         }
         
-        printf("[STEREO WIDENER] Reset to defaults\n");
+        AURIVO_LOG_INFO("[STEREO WIDENER] Reset to defaults");
     }
 
     // ============================================
@@ -2733,17 +9110,16 @@ public:
     // ============================================
     
     void applyEchoToDSP() {
-        if (!m_aurivoDSP) return;
-        
         // Aurivo DSP'nin set_echo_params fonksiyonunu kullan
         // delay (ms), feedback (0-1), mix (0-1)
         float feedbackNorm = g_echo.feedback / 100.0f;
         float mixNorm = g_echo.wetMix / 100.0f;
         
-        set_echo_params(m_aurivoDSP, g_echo.enabled ? 1 : 0, 
-                        g_echo.delay, feedbackNorm, mixNorm);
+        publishMasterDsp([&](MasterDspParams& p) {
+            p.echo.assign(g_echo.enabled, {g_echo.delay, feedbackNorm, mixNorm});
+        });
         
-        printf("[ECHO] Applied - Delay: %.0f ms, Feedback: %.0f%%, Wet: %.0f%%, Dry: %.0f%%, Stereo: %s\n",
+        AURIVO_LOG_DEBUG("[ECHO] Applied - Delay: %.0f ms, Feedback: %.0f%%, Wet: %.0f%%, Dry: %.0f%%, Stereo: %s",
                g_echo.delay, g_echo.feedback, g_echo.wetMix, g_echo.dryMix,
                g_echo.stereo ? "Ping-Pong" : "Normal");
     }
@@ -2754,13 +9130,11 @@ public:
         
         if (enable) {
             applyEchoToDSP();
-            printf("[ECHO] Enabled\n");
+            AURIVO_LOG_INFO("[ECHO] Enabled");
         } else {
             // Devre dışı bırak echo in DSP
-            if (m_aurivoDSP) {
-                set_echo_params(m_aurivoDSP, 0, 0, 0, 0);
-            }
-            printf("[ECHO] Disabled\n");
+            publishMasterDsp([](MasterDspParams& p) { p.echo.assign(false, {0.0f, 0.0f, 0.0f}); });
+            AURIVO_LOG_INFO("[ECHO] Disabled");
         }
     }
 
@@ -2768,49 +9142,49 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         g_echo.delay = clampf(delay, 1.0f, 2000.0f);
         if (g_echo.enabled) applyEchoToDSP();
-        printf("[ECHO] Delay: %.0f ms\n", g_echo.delay);
+        AURIVO_LOG_DEBUG("[ECHO] Delay: %.0f ms", g_echo.delay);
     }
 
     void setEchoFeedback(float feedback) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_echo.feedback = clampf(feedback, 0.0f, 95.0f);
         if (g_echo.enabled) applyEchoToDSP();
-        printf("[ECHO] Feedback: %.0f%%\n", g_echo.feedback);
+        AURIVO_LOG_DEBUG("[ECHO] Feedback: %.0f%%", g_echo.feedback);
     }
 
     void setEchoWetMix(float wetMix) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_echo.wetMix = clampf(wetMix, 0.0f, 100.0f);
         if (g_echo.enabled) applyEchoToDSP();
-        printf("[ECHO] Wet mix: %.0f%%\n", g_echo.wetMix);
+        AURIVO_LOG_DEBUG("[ECHO] Wet mix: %.0f%%", g_echo.wetMix);
     }
 
     void setEchoDryMix(float dryMix) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_echo.dryMix = clampf(dryMix, 0.0f, 100.0f);
         if (g_echo.enabled) applyEchoToDSP();
-        printf("[ECHO] Dry mix: %.0f%%\n", g_echo.dryMix);
+        AURIVO_LOG_DEBUG("[ECHO] Dry mix: %.0f%%", g_echo.dryMix);
     }
 
     void setEchoStereoMode(bool stereo) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_echo.stereo = stereo;
         if (g_echo.enabled) applyEchoToDSP();
-        printf("[ECHO] Stereo mode: %s\n", stereo ? "Ping-Pong" : "Normal");
+        AURIVO_LOG_DEBUG("[ECHO] Stereo mode: %s", stereo ? "Ping-Pong" : "Normal");
     }
 
     void setEchoLowCut(float lowCut) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_echo.lowCut = clampf(lowCut, 20.0f, 500.0f);
         if (g_echo.enabled) applyEchoToDSP();
-        printf("[ECHO] Low cut: %.0f Hz\n", g_echo.lowCut);
+        AURIVO_LOG_DEBUG("[ECHO] Low cut: %.0f Hz", g_echo.lowCut);
     }
 
     void setEchoHighCut(float highCut) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_echo.highCut = clampf(highCut, 2000.0f, 16000.0f);
         if (g_echo.enabled) applyEchoToDSP();
-        printf("[ECHO] High cut: %.0f Hz\n", g_echo.highCut);
+        AURIVO_LOG_DEBUG("[ECHO] High cut: %.0f Hz", g_echo.highCut);
     }
 
     void setEchoTempo(float bpm, int division) {
@@ -2848,7 +9222,7 @@ public:
         
         if (g_echo.enabled) applyEchoToDSP();
         
-        printf("[ECHO] Tempo sync: %.0f BPM, Division: %d -> %.0f ms\n", bpm, division, delayMs);
+        AURIVO_LOG_DEBUG("[ECHO] Tempo sync: %.0f BPM, Division: %d -> %.0f ms", bpm, division, delayMs);
     }
 
     void resetEcho() {
@@ -2863,190 +9237,181 @@ public:
         
         if (g_echo.enabled) applyEchoToDSP();
         
-        printf("[ECHO] Reset to defaults\n");
+        AURIVO_LOG_INFO("[ECHO] Reset to defaults");
     }
 
     // ============== CONVOLUTION REVERB ==============
-    
-    void applyConvolutionReverbToDSP() {
-        if (!m_stream) return;
-        
-        // DirectX Reverb parametreleri
-        if (fxConvReverb) {
-            BASS_DX8_REVERB reverb;
-            
-            // Input gain (0 dB = no change)
-            reverb.fInGain = 0.0f;
-            
-            // Reverb mix: -96 dB (dry/silent) ile 0 dB (full wet)
-            // Lineer yüzdeyi logaritmik dB'ye çevir
-            // wetMix 0% = -96 dB (sessiz), 100% = 0 dB (full)
-            // Daha etkili bir eğri kullanalım
-            float wetPercent = g_convReverb.wetMix / 100.0f;
-            float reverbMix;
-            if (wetPercent <= 0.0f) {
-                reverbMix = -96.0f;
-            } else {
-                // Logaritmik dönüşüm: 20 * log10(wetPercent)
-                // Ama minimum -96 dB olmalı
-                reverbMix = 20.0f * log10f(wetPercent);
-                if (reverbMix < -96.0f) reverbMix = -96.0f;
-            }
-            reverb.fReverbMix = reverbMix;
-            
-            // Reverb time (decay) - DirectX: 0.001 ile 3000 ms arası
-            float reverbTime = g_convReverb.decay * 1000.0f;
-            if (reverbTime > 3000.0f) reverbTime = 3000.0f;
-            if (reverbTime < 0.001f) reverbTime = 0.001f;
-            reverb.fReverbTime = reverbTime;
-            
-            // High frequency RT ratio (damping) - 0.001 ile 0.999
-            float hfRatio = 1.0f - g_convReverb.damping;
-            if (hfRatio < 0.001f) hfRatio = 0.001f;
-            if (hfRatio > 0.999f) hfRatio = 0.999f;
-            reverb.fHighFreqRTRatio = hfRatio;
-            
-            BOOL success = BASS_FXSetParameters(fxConvReverb, &reverb);
-            
-            if (!success) {
-                printf("[CONV REVERB] Parametre hatası: %d\n", BASS_ErrorGetCode());
-            } else {
-                printf("[CONV REVERB] Applied - Room: %.0f%%, Decay: %.1fs, Damp: %.2f, Wet: %.0f%% (%.1f dB)\n",
-                       g_convReverb.roomSize, g_convReverb.decay, g_convReverb.damping, g_convReverb.wetMix, reverbMix);
-            }
-        }
-        
-        // Pre-delay (DirectX Echo ile)
-        if (fxConvPreDelay && g_convReverb.preDelay > 0.0f) {
-            BASS_DX8_ECHO preDelayFx;
-            preDelayFx.fWetDryMix = 50.0f;  // Balanced mix
-            preDelayFx.fFeedback = 0.0f;    // No repeat
-            preDelayFx.fLeftDelay = g_convReverb.preDelay;   // ms
-            preDelayFx.fRightDelay = g_convReverb.preDelay;  // ms
-            preDelayFx.lPanDelay = FALSE;
-            
-            BASS_FXSetParameters(fxConvPreDelay, &preDelayFx);
+    // Bölümlenmiş FFT konvolüsyonu (ConvolutionReverb) mikser çıkışında çalışır.
+    // IR (dosya ya da dahili preset) arka plan kuyruğunda decode/sentez edilip
+    // çıkış hızına çevrilir; hazır kernel audio thread'e atomik olarak verilir.
+    // roomSize/decay/damping yalnızca dahili presetlerin sentezini etkiler;
+    // dosyadan yüklenen IR olduğu gibi kullanılır (pre-delay ve mix hariç).
+
+private:
+    uint32_t convRateLocked() const {
+        return m_mixer.output() ? m_mixer.outputRate() : m_deviceRate;
+    }
+
+    // Güncel ayarlarla IR kurulumunu kuyruğa at (en son istek kazanır)
+    void scheduleIrBuildLocked() {
+        IrBuildRequest req;
+        req.path = g_convReverb.irFilePath;
+        req.preset = g_convReverb.roomType;
+        req.roomSize = g_convReverb.roomSize;
+        req.decay = g_convReverb.decay;
+        req.damping = g_convReverb.damping;
+        req.preDelay = g_convReverb.preDelay;
+        req.rate = convRateLocked();
+        const uint64_t seq = m_irSeq.fetch_add(1) + 1;
+        m_irRate = m_tasks.post([this, req, seq]() { buildImpulseResponse(req, seq); }) ? req.rate : 0;
+    }
+
+    // IR'yi etkileyen bir ayar değişti: açıksa yeniden kur, kapalıysa açılışta kurulsun
+    void invalidateIrLocked() {
+        if (g_convReverb.enabled) {
+            scheduleIrBuildLocked();
+        } else {
+            m_irRate = 0;
         }
     }
-    
-    bool enableConvolutionReverb(bool enable) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        if (!m_stream) return false;
-        
-        if (enable) {
-            // Ana reverb efekti ekle
-            if (!fxConvReverb) {
-                fxConvReverb = BASS_ChannelSetFX(m_stream, BASS_FX_DX8_REVERB, 1);
-                if (!fxConvReverb) {
-                    printf("[CONV REVERB] Reverb FX eklenemedi: %d\n", BASS_ErrorGetCode());
-                    return false;
-                }
-            }
-            
-            // Pre-delay efekti ekle (DirectX Echo)
-            if (!fxConvPreDelay) {
-                fxConvPreDelay = BASS_ChannelSetFX(m_stream, BASS_FX_DX8_ECHO, 0);
-                if (!fxConvPreDelay) {
-                    printf("[CONV REVERB] Pre-delay FX eklenemedi: %d\n", BASS_ErrorGetCode());
-                }
-            }
-            
-            g_convReverb.enabled = true;
-            applyConvolutionReverbToDSP();
-            printf("[CONV REVERB] Enabled\n");
+
+    bool irIsBuiltinLocked() const {
+        return builtinIrIndex(g_convReverb.irFilePath, g_convReverb.roomType) >= 0;
+    }
+
+    void applyIrPresetLocked(int roomType) {
+        g_convReverb.roomType = (roomType < 0) ? 0 : (roomType > 7 ? 7 : roomType);
+        const IRPreset& preset = IR_PRESETS[g_convReverb.roomType];
+        g_convReverb.roomSize = preset.roomSize;
+        g_convReverb.decay = preset.decay;
+        g_convReverb.damping = preset.damping;
+        g_convReverb.irFilePath[0] = '\0';
+    }
+
+    void applyConvMixLocked() {
+        m_convolver.setMix(g_convReverb.wetMix / 100.0f, g_convReverb.dryMix / 100.0f);
+    }
+
+    // İş kuyruğu thread'i (m_mutex tutulmaz)
+    void buildImpulseResponse(const IrBuildRequest& req, uint64_t seq) {
+        if (m_irSeq.load() != seq) return;   // daha yeni istek kuyrukta
+
+        std::vector<float> irL;
+        std::vector<float> irR;
+        const int preset = builtinIrIndex(req.path, req.preset);
+        if (preset >= 0) {
+            synthesizeImpulseResponse(preset, req.roomSize, req.decay, req.damping, req.rate, irL, irR);
         } else {
-            // FX'leri kaldır
-            if (fxConvReverb) {
-                BASS_ChannelRemoveFX(m_stream, fxConvReverb);
-                fxConvReverb = 0;
-            }
-            if (fxConvPreDelay) {
-                BASS_ChannelRemoveFX(m_stream, fxConvPreDelay);
-                fxConvPreDelay = 0;
+            // Pre-delay/mix değişikliklerinde dosya yeniden decode edilmez
+            if (m_irCachePath != req.path || m_irCacheRate != req.rate) {
+                m_irCachePath.clear();
+                if (!decodeImpulseResponse(req.path, req.rate, m_irCacheL, m_irCacheR)) {
+                    AURIVO_LOG_ERROR("[CONV REVERB] IR decode hatası (%d): %s", BASS_ErrorGetCode(), req.path.c_str());
+                    return;
+                }
+                m_irCachePath = req.path;
+                m_irCacheRate = req.rate;
             }
-            g_convReverb.enabled = false;
-            printf("[CONV REVERB] Disabled\n");
+            irL = m_irCacheL;
+            irR = m_irCacheR;
         }
-        
+        shapeImpulseResponse(irL, irR, req.rate, req.preDelay);
+
+        ConvolutionReverb::Kernel* kernel =
+            ConvolutionReverb::buildKernel(irL.data(), irR.data(), (uint32_t)irL.size(), req.rate);
+        if (m_irSeq.load() != seq) {
+            delete kernel;
+            return;
+        }
+        m_convolver.setKernel(kernel);
+        AURIVO_LOG_INFO("[CONV REVERB] IR hazır: %s, %.2f sn @ %u Hz (ön %d + kuyruk %d bölüm)",
+               preset >= 0 ? IR_PRESETS[preset].name : req.path.c_str(),
+               (double)irL.size() / req.rate, (unsigned)req.rate, kernel->headParts, kernel->tailParts);
+    }
+
+public:
+    bool enableConvolutionReverb(bool enable) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        g_convReverb.enabled = enable;
+        if (enable) {
+            applyConvMixLocked();
+            if (m_irRate != convRateLocked()) scheduleIrBuildLocked();
+        }
+        m_convolver.setEnabled(enable);
+        AURIVO_LOG_INFO("[CONV REVERB] %s", enable ? "Enabled" : "Disabled");
         return true;
     }
-    
+
+    // Dosya ya da "builtin:<id>" yolu; decode arka planda, sonuç loglanır
     bool loadIRFile(const char* filepath) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        
-        // IR dosya yolunu sakla
-        strncpy(g_convReverb.irFilePath, filepath, sizeof(g_convReverb.irFilePath) - 1);
-        g_convReverb.irFilePath[sizeof(g_convReverb.irFilePath) - 1] = '\0';
-        
-        printf("[CONV REVERB] IR dosyası: %s\n", filepath);
-        printf("[CONV REVERB] NOT: Gerçek konvolüsyon için custom DSP gerekli\n");
-        printf("[CONV REVERB] Şimdilik algoritmik reverb kullanılıyor\n");
-        
-        if (g_convReverb.enabled) {
-            applyConvolutionReverbToDSP();
+        if (!filepath || !filepath[0]) return false;
+
+        const int preset = builtinIrIndex(filepath, -1);
+        if (preset >= 0) {
+            applyIrPresetLocked(preset);
+        } else {
+            strncpy(g_convReverb.irFilePath, filepath, sizeof(g_convReverb.irFilePath) - 1);
+            g_convReverb.irFilePath[sizeof(g_convReverb.irFilePath) - 1] = '\0';
         }
-        
+        scheduleIrBuildLocked();
+
+        AURIVO_LOG_INFO("[CONV REVERB] IR yükleniyor: %s", filepath);
         return true;
     }
     
     void setConvReverbRoomSize(float roomSize) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_convReverb.roomSize = clampf(roomSize, 0.0f, 100.0f);
-        if (g_convReverb.enabled) applyConvolutionReverbToDSP();
-        printf("[CONV REVERB] Room size: %.0f%%\n", g_convReverb.roomSize);
+        if (irIsBuiltinLocked()) invalidateIrLocked();
+        AURIVO_LOG_DEBUG("[CONV REVERB] Room size: %.0f%%", g_convReverb.roomSize);
     }
     
     void setConvReverbDecay(float decay) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_convReverb.decay = clampf(decay, 0.1f, 10.0f);
-        if (g_convReverb.enabled) applyConvolutionReverbToDSP();
-        printf("[CONV REVERB] Decay: %.1fs\n", g_convReverb.decay);
+        if (irIsBuiltinLocked()) invalidateIrLocked();
+        AURIVO_LOG_DEBUG("[CONV REVERB] Decay: %.1fs", g_convReverb.decay);
     }
     
     void setConvReverbDamping(float damping) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_convReverb.damping = clampf(damping, 0.0f, 1.0f);
-        if (g_convReverb.enabled) applyConvolutionReverbToDSP();
-        printf("[CONV REVERB] Damping: %.2f\n", g_convReverb.damping);
+        if (irIsBuiltinLocked()) invalidateIrLocked();
+        AURIVO_LOG_DEBUG("[CONV REVERB] Damping: %.2f", g_convReverb.damping);
     }
     
     void setConvReverbWetMix(float wetMix) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_convReverb.wetMix = clampf(wetMix, 0.0f, 100.0f);
-        if (g_convReverb.enabled) applyConvolutionReverbToDSP();
-        printf("[CONV REVERB] Wet mix: %.0f%%\n", g_convReverb.wetMix);
+        applyConvMixLocked();
+        AURIVO_LOG_DEBUG("[CONV REVERB] Wet mix: %.0f%%", g_convReverb.wetMix);
     }
     
     void setConvReverbDryMix(float dryMix) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_convReverb.dryMix = clampf(dryMix, 0.0f, 100.0f);
-        if (g_convReverb.enabled) applyConvolutionReverbToDSP();
-        printf("[CONV REVERB] Dry mix: %.0f%%\n", g_convReverb.dryMix);
+        applyConvMixLocked();
+        AURIVO_LOG_DEBUG("[CONV REVERB] Dry mix: %.0f%%", g_convReverb.dryMix);
     }
     
     void setConvReverbPreDelay(float preDelay) {
         std::lock_guard<std::mutex> lock(m_mutex);
         g_convReverb.preDelay = clampf(preDelay, 0.0f, 200.0f);
-        if (g_convReverb.enabled) applyConvolutionReverbToDSP();
-        printf("[CONV REVERB] Pre-delay: %.0fms\n", g_convReverb.preDelay);
+        invalidateIrLocked();
+        AURIVO_LOG_DEBUG("[CONV REVERB] Pre-delay: %.0fms", g_convReverb.preDelay);
     }
     
+    // Preset seçimi yüklü IR dosyasının yerine dahili IR'yi geçirir
     void setConvReverbRoomType(int roomType) {
         std::lock_guard<std::mutex> lock(m_mutex);
         
-        // Limit: 0-7 (8 preset)
-        g_convReverb.roomType = (roomType < 0) ? 0 : (roomType > 7 ? 7 : roomType);
+        applyIrPresetLocked(roomType);
+        invalidateIrLocked();
         
-        // Preset'ten parametreleri yükle
         const IRPreset& preset = IR_PRESETS[g_convReverb.roomType];
-        g_convReverb.roomSize = preset.roomSize;
-        g_convReverb.decay = preset.decay;
-        g_convReverb.damping = preset.damping;
-        
-        if (g_convReverb.enabled) applyConvolutionReverbToDSP();
-        
-        printf("[CONV REVERB] Room type: %s (size: %.0f%%, decay: %.1fs, damp: %.2f)\n", 
+        AURIVO_LOG_INFO("[CONV REVERB] Room type: %s (size: %.0f%%, decay: %.1fs, damp: %.2f)", 
                preset.name, preset.roomSize, preset.decay, preset.damping);
     }
     
@@ -3056,14 +9421,30 @@ public:
         g_convReverb.wetMix = 30.0f;
         g_convReverb.dryMix = 100.0f;
         g_convReverb.preDelay = 0.0f;
-        g_convReverb.roomSize = 50.0f;
-        g_convReverb.decay = 1.5f;
+        applyIrPresetLocked(1);  // Medium Room
         g_convReverb.damping = 0.5f;
-        g_convReverb.roomType = 1;  // Medium Room
-        
-        if (g_convReverb.enabled) applyConvolutionReverbToDSP();
+        applyConvMixLocked();
+        invalidateIrLocked();
         
-        printf("[CONV REVERB] Reset to defaults\n");
+        AURIVO_LOG_INFO("[CONV REVERB] Reset to defaults");
+    }
+
+    struct ConvolutionInfo {
+        bool enabled = false;
+        std::string source;
+        ConvolutionReverb::Info kernel;
+        double latencyMs = 0.0;
+    };
+
+    ConvolutionInfo getConvolutionInfo() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ConvolutionInfo info;
+        info.enabled = g_convReverb.enabled;
+        const int preset = builtinIrIndex(g_convReverb.irFilePath, g_convReverb.roomType);
+        info.source = preset >= 0 ? std::string(BUILTIN_IR_PREFIX) + IR_PRESETS[preset].id : g_convReverb.irFilePath;
+        info.kernel = m_convolver.info();
+        if (info.kernel.rate) info.latencyMs = 1000.0 * ConvolutionReverb::HEAD_BLOCK / info.kernel.rate;
+        return info;
     }
 
 private:
@@ -3081,57 +9462,40 @@ public:
         g_compressor.enabled = enabled;
 
         // Use DSP compressor
-        if (m_aurivoDSP) {
-            set_compressor_params(m_aurivoDSP, enabled ? 1 : 0, 
-                                  g_compressor.threshold, 
-                                  g_compressor.ratio, 
-                                  g_compressor.attack, 
-                                  g_compressor.release, 
-                                  g_compressor.makeupGain);
-        }
+        publishCompressorParams(enabled);
     }
     
     void setGateForEngine(bool enabled, float thresh, float att, float rel) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_aurivoDSP) {
-            set_gate_params(m_aurivoDSP, enabled ? 1 : 0, thresh, att, rel);
-        }
+        publishMasterDsp([&](MasterDspParams& p) { p.gate.assign(enabled, {thresh, att, rel}); });
     }
 
     void setLimiterForEngine(bool enabled, float ceiling, float rel) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_aurivoDSP) {
-            set_limiter_params(m_aurivoDSP, enabled ? 1 : 0, ceiling, rel);
-        }
+        publishMasterDsp([&](MasterDspParams& p) { p.limiter.assign(enabled, {ceiling, rel}); });
     }
 
     void setEchoForEngine(bool enabled, float delay, float feedback, float mix) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_aurivoDSP) {
-            set_echo_params(m_aurivoDSP, enabled ? 1 : 0, delay, feedback, mix);
-        }
+        publishMasterDsp([&](MasterDspParams& p) { p.echo.assign(enabled, {delay, feedback, mix}); });
     }
     
     void setBassBoostDsp(bool enabled, float gain, float freq) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_aurivoDSP) {
-            set_bass_boost(m_aurivoDSP, enabled ? 1 : 0, gain, freq);
-        }
+        publishMasterDsp([&](MasterDspParams& p) { p.bassBoost.assign(enabled, {gain, freq}); });
     }
 
     void setPEQ(int band, bool enabled, float freq, float gain, float Q) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_aurivoDSP) {
-            set_peq_band(m_aurivoDSP, band, enabled ? 1 : 0, freq, gain, Q);
-        }
+        publishMasterDsp([&](MasterDspParams& p) { p.setPeqBand(band, enabled, freq, gain, Q); });
     }
     
     bool setPEQFilterType(int band, int filterType) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_aurivoDSP && band >= 0 && band < 6 && filterType >= 0 && filterType <= 6) {
-            set_peq_filter_type(m_aurivoDSP, band, filterType);
+        if (band >= 0 && band < MasterDspParams::PEQ_BANDS && filterType >= 0 && filterType <= 6) {
+            publishMasterDsp([&](MasterDspParams& p) { p.peqType[band].assign(true, {(float)filterType}); });
             const char* typeNames[] = {"Bell", "Low Shelf", "High Shelf", "Low Pass", "High Pass", "Notch", "Band Pass"};
-            printf("[PEQ] Band %d Filter Type: %s\n", band + 1, typeNames[filterType]);
+            AURIVO_LOG_DEBUG("[PEQ] Band %d Filter Type: %s", band + 1, typeNames[filterType]);
             return true;
         }
         return false;
@@ -3139,259 +9503,693 @@ public:
     
     bool getPEQBand(int band, float* freq, float* gain, float* Q, int* filterType) {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_aurivoDSP && band >= 0 && band < 6) {
+        if (m_aurivoDSP && band >= 0 && band < MasterDspParams::PEQ_BANDS) {
+            // Yazılmış değerler bloktan (audio thread aynılarını uygular);
+            // hiç yazılmamışlar MasterDSP varsayılanı
             get_peq_band(m_aurivoDSP, band, freq, gain, Q, filterType);
+            const MasterDspParams& p = g_masterDsp.current();
+            if (p.peqBand[band].set) {
+                *freq = p.peqBand[band].v[0];
+                *gain = p.peqBand[band].v[1];
+                *Q = p.peqBand[band].v[2];
+            }
+            if (p.peqType[band].set) *filterType = (int)p.peqType[band].v[0];
             return true;
         }
         return false;
     }
 
     void applyMasterVolume() {
-        if (!m_stream) return;
-        if (m_overlapCrossfadeActive) return; // slide volume'u bozma
-        applyMasterVolumeToStream(m_stream);
+        if (!m_mixer.output()) return;
+        applyMasterVolumeToStream(m_mixer.output());
     }
     
     void updatePreampFx() {
         updatePreampFxHandle(m_preampFx);
-        updatePreampFxHandle(m_prevPreampFx);
     }
     
+    float eqBandTotalGain(int band) const {
+        float totalGain = m_eqGains[band];
+        if (band < BASS_BOOST_BANDS && m_bassBoost > 0.0f) {
+            // Bass boost: düşük frekanslara kademeli ekleme
+            // En düşük frekanslar en çok boost alır
+            float boostFactor = 1.0f - ((float)band / BASS_BOOST_BANDS);
+            float boostDB = (m_bassBoost / 100.0f) * 12.0f * boostFactor;  // Max 12dB boost
+            totalGain += boostDB;
+        }
+        return clampf(totalGain, -15.0f, 15.0f);
+    }
+
     void updateEqBand(int band) {
-        if (!m_aurivoDSP || !m_dspEnabled) return;
+        publishEqBands(band, 1);
+    }
+
+    // Bantların toplam kazancı tek blokta (DSP kapalıyken de: açılınca güncel olsun)
+    void publishEqBands(int first, int count) {
+        publishMasterDsp([&](MasterDspParams& p) {
+            for (int band = first; band < first + count; ++band) p.setEqBand(band, eqBandTotalGain(band));
+        });
+    }
+
+    void updateEqBandWithOffset(int band, float offsetDb) {
+        float totalGain = m_eqGains[band] + offsetDb;
+        if (band < BASS_BOOST_BANDS && m_bassBoost > 0.0f) {
+            float boostFactor = 1.0f - ((float)band / BASS_BOOST_BANDS);
+            float boostDB = (m_bassBoost / 100.0f) * 12.0f * boostFactor;
+            totalGain += boostDB;
+        }
+        totalGain = clampf(totalGain, -15.0f, 15.0f);
+        publishMasterDsp([&](MasterDspParams& p) { p.setEqBand(band, totalGain); });
+    }
+    
+    void applyBassBoost() {
+        // Sadece düşük frekans bantlarını güncelle
+        publishEqBands(0, BASS_BOOST_BANDS);
+    }
+    
+    // ============================================
+    // AURIVO DSP CALLBACK
+    // ============================================
+    static void CALLBACK dspCallback(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
+        (void)handle;
+        // user = parçanın zinciri: her zincirin kendi MasterDSP'si ve limiter durumu var
+        TrackChain* chain = static_cast<TrackChain*>(user);
+        AurivoAudioEngine* engine = chain ? chain->engine : nullptr;
+        
+        float* samples = static_cast<float*>(buffer);
+        int frameCount = static_cast<int>(length / (sizeof(float) * 2));
+        if (frameCount <= 0) return;
+
+        // ReplayGain parça başına, bus modunda da zincirde (mix'ten önce)
+        const float replayGain = chain ? chain->replayGain.load(std::memory_order_relaxed) : 1.0f;
+        if (replayGain != 1.0f) {
+            for (int i = 0; i < frameCount * 2; ++i) samples[i] *= replayGain;
+        }
+
+        // Ana DSP işleme (eğer DSP etkinse)
+        if (!engine) {
+             AURIVO_LOG_AT(AurivoLog::LEVEL_DEBUG, 1, "[DSP CALLBACK] Engine is NULL!");
+             return;
+        }
+
+        // Bus modunda zincirler ham kalır; MasterDSP mikser çıkışında bir kez çalışır
+        if (engine->m_busMode.load(std::memory_order_relaxed)) return;
+
+        const bool isPrimary = (engine->m_stream != 0 && channel == (DWORD)engine->m_stream);
+        runMasterChain(engine, chain->dsp, &chain->dspState, &chain->limiter, (float)chain->freq, isPrimary, samples, frameCount);
+    }
+
+    // Konvolüsyon reverb callback'i (mikser çıkışı, user = engine)
+    static void CALLBACK convDspCallback(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
+        (void)handle;
+        (void)channel;
+        AurivoAudioEngine* engine = static_cast<AurivoAudioEngine*>(user);
+        if (!engine || !engine->m_convolver.enabled()) return;
+
+        const int frameCount = static_cast<int>(length / (sizeof(float) * 2));
+        if (frameCount <= 0) return;
+        CallbackProfiler::StageTimer stage(engine->m_profiler, CallbackProfiler::STAGE_CONVOLUTION);
+        engine->m_convolver.process(static_cast<float*>(buffer), frameCount);
+    }
+
+    // Çıkışın son DSP'si: mikserin açtığı profilleyici bloğunu kaydeder
+    static void CALLBACK blockEndDspCallback(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
+        (void)handle;
+        (void)channel;
+        (void)buffer;
+        AurivoAudioEngine* engine = static_cast<AurivoAudioEngine*>(user);
+        engine->m_profiler.endBlock(static_cast<int>(length / (sizeof(float) * 2)), (float)engine->m_mixer.outputRate());
+    }
+
+    // Master-bus DSP callback'i (mikser çıkışı, user = engine)
+    static void CALLBACK busDspCallback(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
+        (void)handle;
+        (void)channel;
+        AurivoAudioEngine* engine = static_cast<AurivoAudioEngine*>(user);
+        if (!engine || !engine->m_busMode.load(std::memory_order_relaxed)) return;
+
+        float* samples = static_cast<float*>(buffer);
+        int frameCount = static_cast<int>(length / (sizeof(float) * 2));
+        if (frameCount <= 0) return;
+        runMasterChain(engine, engine->m_busDsp, &engine->m_busDspState, &engine->m_busLimiter, (float)engine->m_mixer.outputRate(),
+                       true, samples, frameCount);
+    }
+
+    // MasterDSP + true-peak limiter + analiz tap'i. isPrimary: duyulan sinyal
+    // (aktif parça ya da bus); sönen parçalar metre/analiz yazmaz.
+    static void runMasterChain(AurivoAudioEngine* engine, void* dsp, MasterDspState* dspState,
+                               TruePeakLimiter* limiter, float sampleRate, bool isPrimary,
+                               float* samples, int frameCount) {
+        CallbackProfiler& profiler = engine->m_profiler;
+
+           if (!dsp) {
+               AURIVO_LOG_AT(AurivoLog::LEVEL_DEBUG, 1, "[DSP CALLBACK] DSP instance is NULL!");
+             limiter->bypass();
+             if (isPrimary) {
+                 engine->m_loudness.process(sampleRate, samples, frameCount);
+                 engine->m_autoGainStage.bypass();
+                 engine->m_meters.process(sampleRate, samples, frameCount, MeterBank::Dynamics());
+                 engine->m_stereo.process(sampleRate, samples, frameCount);
+                 engine->publishAnalysis(samples, frameCount);
+             }
+             return;
+        }
+
+        // Yayınlanan MasterDSP parametreleri (setter'lar + applyParamBatch): bu
+        // örneğe yalnızca bu thread yazar. DSP kapalıyken de uygulanır, açılınca
+        // güncel olsun.
+        {
+            ParamSnapshot<MasterDspParams>::ReadGuard params(g_masterDsp);
+            if (!dspState->synced || dspState->applied.serial != params->serial) {
+                CallbackProfiler::StageTimer stage(profiler, CallbackProfiler::STAGE_PARAMS);
+                syncMasterDsp(dsp, *params, *dspState);
+            }
+        }
+        if (!engine->m_dspEnabled) {
+             AURIVO_LOG_AT(AurivoLog::LEVEL_DEBUG, 1, "[DSP CALLBACK] DSP Disabled!");
+             limiter->bypass();
+             if (isPrimary) {
+                 engine->m_loudness.process(sampleRate, samples, frameCount);
+                 engine->m_autoGainStage.bypass();
+                 engine->m_meters.process(sampleRate, samples, frameCount, MeterBank::Dynamics());
+                 engine->m_stereo.process(sampleRate, samples, frameCount);
+                 engine->publishAnalysis(samples, frameCount);
+             }
+             return;
+        }
+
+        AURIVO_LOG_AT(AurivoLog::LEVEL_DEBUG, 1, "[DSP CALLBACK] Processing %d frames...", frameCount);
+        {
+            CallbackProfiler::StageTimer stage(profiler, CallbackProfiler::STAGE_DSP);
+            process_dsp(dsp, samples, frameCount, 2);
+        }
+
+        // Loudness (AGC öncesi) + AGC kazanç katı. Sönen parçalar birincilin
+        // kazancını taşır, geçiş boyunca seviyeleri tutarlı kalır.
+        if (isPrimary) {
+            CallbackProfiler::StageTimer stage(profiler, CallbackProfiler::STAGE_LOUDNESS);
+            engine->m_loudness.process(sampleRate, samples, frameCount);
+            ParamSnapshot<AutoGainParams>::ReadGuard agcGuard(g_autoGain);
+            const AutoGainParams& agc = *agcGuard;
+            engine->m_autoGainStage.process(agc, sampleRate, engine->m_loudness.levelForMode(agc.mode),
+                                            samples, frameCount);
+        } else {
+            CallbackProfiler::StageTimer stage(profiler, CallbackProfiler::STAGE_LOUDNESS);
+            engine->m_autoGainStage.applyHeld(samples, frameCount);
+        }
+        
+        // True Peak Limiter (DSP zincirinin en sonunda)
+        // Parametreler buffer başına bir kez alınır (setter'lar yeni snapshot yayınlar)
+        ParamSnapshot<TruePeakLimiterParams>::ReadGuard tplGuard(g_truePeakLimiter);
+        const TruePeakLimiterParams& tpl = *tplGuard;
+        TruePeakLimiter::BlockStats tpStats;
+        {
+            CallbackProfiler::StageTimer stage(profiler, CallbackProfiler::STAGE_TRUE_PEAK);
+            if (tpl.enabled) {
+                limiter->process(tpl, sampleRate, samples, frameCount, tpStats);
+            } else if (isPrimary) {
+                limiter->measure(tpl.oversamplingRate, samples, frameCount, tpStats);
+            } else {
+                limiter->bypass();
+            }
+        }
+
+        if (isPrimary) {
+            CallbackProfiler::StageTimer stage(profiler, CallbackProfiler::STAGE_METERS);
+            for (int c = 0; c < 2; ++c) {
+                atomicMaxFloat(g_truePeakMeter.pendingInputPeak[c], tpStats.inTruePeak[c]);
+                atomicMaxFloat(g_truePeakMeter.pendingTruePeak[c], tpStats.outTruePeak[c]);
+                atomicMaxFloat(g_truePeakMeter.pendingPeak[c], tpStats.outPeak[c]);
+            }
+            if (tpl.enabled) {
+                g_truePeakMeter.gainReduction.store((tpStats.minGain < 1.0f) ? 20.0f * log10f(tpStats.minGain) : 0.0f,
+                                                    std::memory_order_relaxed);
+                // Clipping sayacı: limiter öncesi true-peak tavanı aştı
+                const float inPeak = std::max(tpStats.inTruePeak[0], tpStats.inTruePeak[1]);
+                if (20.0f * log10f(fmaxf(inPeak, 1e-10f)) > tpl.ceiling) {
+                    g_truePeakMeter.clippingCount.fetch_add(1, std::memory_order_relaxed);
+                }
+            } else {
+                g_truePeakMeter.gainReduction.store(0.0f, std::memory_order_relaxed);
+            }
+
+            // Tüm metreler blok başına bir kez (getMeters tek okumada alır)
+            MeterBank::Dynamics dyn;
+            float dspCompressorGr = 0.0f;
+            get_dynamics_state(dsp, &dspCompressorGr, &dyn.gateGain, &dyn.limiterGr);
+            // De-esser DSP compressor'ını paylaşır; azaltma, bu örneğe uygulanmış
+            // bloğa göre etkin olana yazılır
+            dyn.compressorGr = dspState->applied.compressorMeter ? dspCompressorGr : 0.0f;
+            dyn.deEsserGr = dspState->applied.deEsserMeter ? dspCompressorGr : 0.0f;
+            dyn.truePeakGr = (tpl.enabled && tpStats.minGain < 1.0f) ? -20.0f * log10f(fmaxf(tpStats.minGain, 1e-10f)) : 0.0f;
+            dyn.agcGain = engine->getAutoGainReduction();
+            dyn.truePeak[0] = tpStats.outTruePeak[0];
+            dyn.truePeak[1] = tpStats.outTruePeak[1];
+            engine->m_meters.process(sampleRate, samples, frameCount, dyn);
+            engine->m_stereo.process(sampleRate, samples, frameCount);
+        }
+
+        // Post-DSP analiz tap'i (visualizer / spectrum duyulan sinyali görür)
+        if (isPrimary) {
+            CallbackProfiler::StageTimer stage(profiler, CallbackProfiler::STAGE_ANALYSIS);
+            engine->publishAnalysis(samples, frameCount);
+        }
+    }
+
+    // ============================================
+    // SIMPLIFIED CALLBACKS (No AGC processing)
+    // ============================================
+    
+    // Hard limiter function (safety net)
+    static inline float hardLimit(float sample, float threshold) {
+        if (sample > threshold) return threshold;
+        if (sample < -threshold) return -threshold;
+        return sample;
+    }
+    
+    // ============================================
+    // END CALLBACK
+    // ============================================
+    static void CALLBACK endCallback(HSYNC handle, DWORD channel, DWORD data, void* user) {
+        // Playback bittiğinde çağrılır
+        // JS tarafına callback gönderilebilir
+    }
+};
+
+AurivoAudioEngine* AurivoAudioEngine::s_instance = nullptr;
+
+// ============================================
+// NATIVE VISUALIZER FEEDER (v2 pipe protokolü)
+// ============================================
+// main.js'deki setInterval pompasının yerine geçer: ayrı bir thread post-DSP
+// tap'ten blok alır ve v2 paketlerini ([u32 channels][u32 countPerChannel]
+// [float32 interleaved]) doğrudan visualizer'ın stdin pipe'ına yazar.
+// Pipe doluysa yeni paket kuyruğa alınmaz, atlanır: visualizer için yalnızca
+// en yeni blok anlamlı. Yarım kalmış paket ise protokol senkronu için tamamlanır.
+// fd, Node'un (libuv) non-blocking pipe'ıdır. Node pipe bitince ya da çocuk
+// çıkınca kendi fd'sini kapatıp yeniden kullanabilir; feeder bu yüzden start()'ta
+// dup() ile kendi kopyasını alır ve stop()'ta yalnızca onu kapatır.
+class VisualizerFeeder {
+public:
+    struct Stats {
+        uint64_t packets = 0;
+        uint64_t bytes = 0;
+        uint64_t drops = 0;          // pipe dolu olduğu için atlanan paketler
+        uint64_t backpressure = 0;   // yarım kalan (EAGAIN) yazmalar
+        uint64_t noData = 0;
+        bool running = false;
+        int fd = -1;
+        int framesPerPacket = 0;
+    };
+
+    VisualizerFeeder() : m_engine(nullptr), m_fd(-1), m_framesPerPacket(0), m_stopRequested(false), m_running(false) {}
+    ~VisualizerFeeder() { stop(); }
+
+    bool start(AurivoAudioEngine* engine, int fd, int framesPerPacket) {
+#ifdef _WIN32
+        // Windows'ta Node pipe'ları CRT fd olarak açığa çıkmıyor; JS pompası kullanılır
+        (void)engine; (void)fd; (void)framesPerPacket;
+        return false;
+#else
+        if (!engine || fd < 0) return false;
+        stop();
+
+        const int ownFd = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+        if (ownFd < 0) {
+            AURIVO_LOG_WARN("[VISUALIZER FEED] dup(%d) failed (errno=%d)", fd, errno);
+            return false;
+        }
+
+        m_engine = engine;
+        m_fd = ownFd;
+        m_framesPerPacket = std::max(64, std::min(framesPerPacket, 8192));
+        m_packet.assign(8 + (size_t)m_framesPerPacket * 2 * sizeof(float), 0);
+        m_pendingOffset = 0;
+        m_pendingSize = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_statsMutex);
+            m_stats = Stats();
+            m_stats.fd = ownFd;
+            m_stats.framesPerPacket = m_framesPerPacket;
+            m_stats.running = true;
+        }
+        m_stopRequested = false;
+        m_running = true;
+        m_thread = std::thread(&VisualizerFeeder::run, this);
+        AURIVO_LOG_INFO("[VISUALIZER FEED] Native feeder started (fd=%d -> %d, frames=%d)", fd, ownFd, m_framesPerPacket);
+        return true;
+#endif
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_stopRequested = true;
+        }
+        m_wakeCv.notify_all();
+        if (m_thread.joinable()) {
+            m_thread.join();
+            AURIVO_LOG_INFO("[VISUALIZER FEED] Native feeder stopped");
+        }
+        m_running = false;
+        m_engine = nullptr;
+#ifndef _WIN32
+        if (m_fd >= 0) ::close(m_fd);
+#endif
+        m_fd = -1;
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        m_stats.running = false;
+        m_stats.fd = -1;
+    }
+
+    bool isRunning() const { return m_running.load(); }
+
+    Stats getStats() const {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        return m_stats;
+    }
+
+private:
+#ifndef _WIN32
+    enum FlushResult { FLUSH_DONE, FLUSH_PENDING, FLUSH_ERROR };
+
+    FlushResult flushPending() {
+        while (m_pendingOffset < m_pendingSize) {
+            const ssize_t r = ::write(m_fd, m_packet.data() + m_pendingOffset, m_pendingSize - m_pendingOffset);
+            if (r > 0) {
+                m_pendingOffset += (size_t)r;
+                continue;
+            }
+            if (r < 0 && errno == EINTR) continue;
+            if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return FLUSH_PENDING;
+            return FLUSH_ERROR;  // EPIPE vb.: visualizer kapandı
+        }
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        m_stats.packets++;
+        m_stats.bytes += m_pendingSize;
+        m_pendingOffset = 0;
+        m_pendingSize = 0;
+        return FLUSH_DONE;
+    }
+
+    void run() {
+        float* payload = reinterpret_cast<float*>(m_packet.data() + 8);
+
+        while (!m_stopRequested.load()) {
+            const int sampleRate = std::max(8000, m_engine->getAnalysisSampleRate());
+            const int periodMs = std::max(8, std::min(50, m_framesPerPacket * 1000 / sampleRate));
+
+            bool error = false;
+            if (m_pendingSize > 0) {
+                // Önceki paket yarım: yenisini üretme, bu periyodu drop say
+                if (flushPending() == FLUSH_ERROR) error = true;
+                else if (m_pendingSize > 0) {
+                    std::lock_guard<std::mutex> lock(m_statsMutex);
+                    m_stats.drops++;
+                }
+            } else {
+                const int frames = m_engine->fillPCMDataSync(payload, m_framesPerPacket);
+                if (frames <= 0) {
+                    std::lock_guard<std::mutex> lock(m_statsMutex);
+                    m_stats.noData++;
+                } else {
+                    const uint32_t channels = 2;
+                    const uint32_t count = (uint32_t)frames;
+                    uint8_t* header = m_packet.data();
+                    for (int i = 0; i < 4; ++i) {
+                        header[i] = (uint8_t)((channels >> (8 * i)) & 0xFF);
+                        header[4 + i] = (uint8_t)((count >> (8 * i)) & 0xFF);
+                    }
+                    m_pendingOffset = 0;
+                    m_pendingSize = 8 + (size_t)frames * 2 * sizeof(float);
+
+                    const FlushResult r = flushPending();
+                    if (r == FLUSH_ERROR) error = true;
+                    else if (r == FLUSH_PENDING) {
+                        std::lock_guard<std::mutex> lock(m_statsMutex);
+                        m_stats.backpressure++;
+                    }
+                }
+            }
+
+            if (error) {
+                AURIVO_LOG_WARN("[VISUALIZER FEED] Pipe closed (errno=%d), feeder exiting", errno);
+                break;
+            }
+
+            if (m_pendingSize > 0) {
+                // Yarım paket: pipe yazılabilir olana kadar (en fazla bir periyot) bekle
+                struct pollfd pfd;
+                pfd.fd = m_fd;
+                pfd.events = POLLOUT;
+                pfd.revents = 0;
+                ::poll(&pfd, 1, periodMs);
+                if (pfd.revents & (POLLERR | POLLHUP)) {
+                    AURIVO_LOG_WARN("[VISUALIZER FEED] Pipe hung up, feeder exiting");
+                    break;
+                }
+            } else {
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                m_wakeCv.wait_for(lock, std::chrono::milliseconds(periodMs), [this]() { return m_stopRequested.load(); });
+            }
+        }
+
+        m_running = false;
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        m_stats.running = false;
+    }
+#endif
+
+    AurivoAudioEngine* m_engine;
+    int m_fd;
+    int m_framesPerPacket;
+    std::vector<uint8_t> m_packet;
+    size_t m_pendingOffset = 0;
+    size_t m_pendingSize = 0;
+
+    std::thread m_thread;
+    std::atomic<bool> m_stopRequested;
+    std::atomic<bool> m_running;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCv;
+
+    mutable std::mutex m_statsMutex;
+    Stats m_stats;
+};
+
+static VisualizerFeeder g_visualizerFeeder;
+
+// ============================================
+// TAPE SATURATION DSP CALLBACK
+// ============================================
+// Durum dışarıdan verilir: canlı callback global durumu, offline render
+// her işçide kendi durumunu kullanır. n = örnek sayısı (stereo interleaved).
+static void processTapeSat(const TapeSatParams& tp, TapeSatState& st, float* s, int n) {
+    float sr = st.sr;
+    float drive = dBToLinear(clampf(tp.driveDb, 0.0f, 24.0f));
+    float mix = clampf(tp.mix, 0.0f, 100.0f) / 100.0f;
+    float out = dBToLinear(clampf(tp.outputDb, -12.0f, 12.0f));
+
+    // Tone: tape HF roll-off (6kHz to 16kHz)
+    float toneVal = clampf(tp.tone, 0.0f, 100.0f);
+    float cutoff = 6000.0f + (toneVal / 100.0f) * (16000.0f - 6000.0f);
+    float a = onePoleAlphaTape(cutoff, sr);
+
+    // Mode character
+    float modeSoftness = 1.0f;
+    float evenHarm = 0.15f;
+    if (tp.mode == 0) {        // Tape
+        modeSoftness = 1.0f;
+        evenHarm = 0.12f;
+    } else if (tp.mode == 1) { // Warm
+        modeSoftness = 0.9f;
+        evenHarm = 0.18f;
+    } else {                           // Hot
+        modeSoftness = 0.75f;
+        evenHarm = 0.22f;
+    }
+
+    // Hiss
+    float hissAmt = clampf(tp.hiss, 0.0f, 100.0f) / 100.0f;
+    float hissGain = hissAmt * 0.0008f; 
+
+    for (int i = 0; i < n; i += 2) {
+        float inL = s[i];
+        float inR = s[i + 1];
+
+        float dryL = inL;
+        float dryR = inR;
+
+        // Drive
+        float xL = inL * drive;
+        float xR = inR * drive;
+
+        // Soft saturation
+        float satL = fastTanh(xL * modeSoftness);
+        float satR = fastTanh(xR * modeSoftness);
+
+        // Even harmonics
+        satL += evenHarm * (xL * xL) * (xL >= 0 ? 1.0f : -1.0f) * 0.02f;
+        satR += evenHarm * (xR * xR) * (xR >= 0 ? 1.0f : -1.0f) * 0.02f;
 
-        float totalGain = m_eqGains[band];
-        if (band < BASS_BOOST_BANDS && m_bassBoost > 0.0f) {
-            // Bass boost: düşük frekanslara kademeli ekleme
-            // En düşük frekanslar en çok boost alır
-            float boostFactor = 1.0f - ((float)band / BASS_BOOST_BANDS);
-            float boostDB = (m_bassBoost / 100.0f) * 12.0f * boostFactor;  // Max 12dB boost
-            totalGain += boostDB;
-        }
-        
-        totalGain = clampf(totalGain, -15.0f, 15.0f);
-        set_eq_band(m_aurivoDSP, band, totalGain);
-    }
+        // HF roll-off
+        st.lpfL = st.lpfL + a * (satL - st.lpfL);
+        st.lpfR = st.lpfR + a * (satR - st.lpfR);
 
-    void updateEqBandWithOffset(int band, float offsetDb) {
-        if (!m_aurivoDSP || !m_dspEnabled) return;
+        float wetL = st.lpfL;
+        float wetR = st.lpfR;
 
-        float totalGain = m_eqGains[band] + offsetDb;
-        if (band < BASS_BOOST_BANDS && m_bassBoost > 0.0f) {
-            float boostFactor = 1.0f - ((float)band / BASS_BOOST_BANDS);
-            float boostDB = (m_bassBoost / 100.0f) * 12.0f * boostFactor;
-            totalGain += boostDB;
-        }
-        totalGain = clampf(totalGain, -15.0f, 15.0f);
-        set_eq_band(m_aurivoDSP, band, totalGain);
-    }
-    
-    void applyBassBoost() {
-        // Sadece düşük frekans bantlarını güncelle
-        for (int i = 0; i < BASS_BOOST_BANDS; ++i) {
-            updateEqBand(i);
+        if (hissGain > 0.0f) {
+            wetL += randFloatSigned(st.rng) * hissGain;
+            wetR += randFloatSigned(st.rng) * hissGain;
         }
+
+        // Mix
+        float yL = dryL * (1.0f - mix) + wetL * mix;
+        float yR = dryR * (1.0f - mix) + wetR * mix;
+
+        // Output trim
+        yL *= out;
+        yR *= out;
+
+        if (yL > 1.0f) yL = 1.0f; else if (yL < -1.0f) yL = -1.0f;
+        if (yR > 1.0f) yR = 1.0f; else if (yR < -1.0f) yR = -1.0f;
+
+        s[i] = yL;
+        s[i + 1] = yR;
     }
-    
-    // ============================================
-    // AURIVO DSP CALLBACK
-    // ============================================
-    static void CALLBACK dspCallback(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
-        (void)handle;
-        AurivoAudioEngine* engine = static_cast<AurivoAudioEngine*>(user);
-        
-        // Debug logger (once per sec)
-        static int cbDebugCounter = 0;
-        bool logNow = (++cbDebugCounter > 100); // 100 callbacks ~1 sec
-        if (logNow) cbDebugCounter = 0;
+}
 
-        if (logNow) printf("[DSP CALLBACK] Alive. Length: %d\n", (int)length);
+void CALLBACK TapeSat_DSP(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
+    ColorFx* fx = static_cast<ColorFx*>(user);
+    CallbackProfiler::StageTimer stage(fx->profiler, CallbackProfiler::STAGE_TAPE_DITHER);
+    // Parametreler (buffer boyunca değişmeyen snapshot)
+    ParamSnapshot<TapeSatParams>::ReadGuard guard(g_tapeSat);
+    processTapeSat(*guard, fx->tape, (float*)buffer, (int)(length / sizeof(float)));
+}
 
-        float* samples = static_cast<float*>(buffer);
-        int frameCount = static_cast<int>(length / (sizeof(float) * 2));
-        if (frameCount <= 0) return;
+// BIT-DEPTH / DITHER DSP CALLBACK
+// ============================================
+static void processBitDither(const BitDitherParams& bp, BitDitherState& st, float* s, int n) {
+    int bits = bp.bitDepth;
+    if (bits < 4) bits = 4;
+    if (bits > 24) bits = 24;
 
-        // Ana DSP işleme (eğer DSP etkinse)
-        if (!engine) {
-             if (logNow) printf("[DSP CALLBACK] Engine is NULL!\n");
-             return;
-        }
+    float mix = clampf(bp.mix, 0.0f, 100.0f) / 100.0f;
+    float out = dBToLinear(clampf(bp.outputDb, -12.0f, 12.0f));
+
+    int ds = bp.downsampleFactor;
+    if (ds != 1 && ds != 2 && ds != 4 && ds != 8 && ds != 16) ds = 1;
 
-           void* dsp = nullptr;
-           TruePeakLimiterState* limiterState = nullptr;
-           const bool isPrimary = (engine->m_stream != 0 && channel == (DWORD)engine->m_stream);
+    const int levels = 1 << (bits - 1);
+    float lsb = 1.0f / (float)levels;
 
-           if (engine->m_prevStream != 0 && channel == (DWORD)engine->m_prevStream) {
-              dsp = engine->m_prevAurivoDSP;
-              limiterState = &engine->m_limiterStatePrev;
-           } else {
-              dsp = engine->m_aurivoDSP;
-              limiterState = &engine->m_limiterStateCurrent;
-           }
+    for (int i = 0; i < n; i += 2) {
+        float inL = s[i];
+        float inR = s[i + 1];
 
-           if (!dsp) {
-               if (logNow) printf("[DSP CALLBACK] DSP instance is NULL!\n");
-             return;
+        // Downsample
+        float xL = inL;
+        float xR = inR;
+        if (ds > 1) {
+            if (st.holdCounter <= 0) {
+                st.holdCounter = ds;
+                st.holdL = inL;
+                st.holdR = inR;
+            }
+            st.holdCounter--;
+            xL = st.holdL;
+            xR = st.holdR;
         }
-        if (!engine->m_dspEnabled) {
-             if (logNow) printf("[DSP CALLBACK] DSP Disabled!\n");
-             return;
+
+        // Noise shaping
+        if (bp.shaping == SHAPE_LIGHT) {
+            xL = xL + 0.5f * st.errL;
+            xR = xR + 0.5f * st.errR;
         }
 
-        if (logNow) printf("[DSP CALLBACK] Processing %d frames...\n", frameCount);
-        process_dsp(dsp, samples, frameCount, 2);
-        
-        // True Peak Limiter (DSP zincirinin en sonunda)
-        if (g_truePeakLimiter.enabled) {
-            float ceiling = powf(10.0f, g_truePeakLimiter.ceiling / 20.0f);  // dB -> linear
-            
-            // Per-stream smoothing state
-            float& gainL = limiterState->gainL;
-            float& gainR = limiterState->gainR;
-            float& peakL = limiterState->peakL;
-            float& peakR = limiterState->peakR;
-            
-            // Ham sinyal peak ölçümü (limiter öncesi)
-            float rawPeakL = 0.0f;
-            float rawPeakR = 0.0f;
-            for (int i = 0; i < frameCount; i++) {
-                float absL = fabsf(samples[i * 2]);
-                float absR = fabsf(samples[i * 2 + 1]);
-                if (absL > rawPeakL) rawPeakL = absL;
-                if (absR > rawPeakR) rawPeakR = absR;
-            }
-            
-            // Ham sinyal dB'ye çevir
-            float rawPeakLdB = 20.0f * log10f(fmaxf(rawPeakL, 1e-10f));
-            float rawPeakRdB = 20.0f * log10f(fmaxf(rawPeakR, 1e-10f));
-            
-            if (isPrimary) {
-                // Input peak güncelle (limiter öncesi)
-                g_truePeakMeter.inputPeakL = rawPeakLdB;
-                g_truePeakMeter.inputPeakR = rawPeakRdB;
-                
-                // Clipping sayacı (input ceiling'i aşıyor mu?) - BURADA ÖLÇ!
-                if (rawPeakLdB > g_truePeakLimiter.ceiling || rawPeakRdB > g_truePeakLimiter.ceiling) {
-                    g_truePeakMeter.clippingCount++;
-                }
-            }
-            
-            float attackCoef = expf(-1.0f / (g_truePeakLimiter.lookahead * 44.1f));  // ~44.1kHz
-            float releaseCoef = expf(-1.0f / (g_truePeakLimiter.release * 44.1f));
-            
-            for (int i = 0; i < frameCount; i++) {
-                float sampleL = samples[i * 2];
-                float sampleR = samples[i * 2 + 1];
-                
-                // Peak detection
-                float absL = fabsf(sampleL);
-                float absR = fabsf(sampleR);
-                
-                // Attack/release envelope
-                if (absL > peakL) {
-                    peakL = absL;
-                } else {
-                    peakL = peakL * releaseCoef + absL * (1.0f - releaseCoef);
-                }
-                
-                if (absR > peakR) {
-                    peakR = absR;
-                } else {
-                    peakR = peakR * releaseCoef + absR * (1.0f - releaseCoef);
-                }
-                
-                // Gain hesaplama
-                float targetGainL = (peakL > ceiling) ? (ceiling / peakL) : 1.0f;
-                float targetGainR = (peakR > ceiling) ? (ceiling / peakR) : 1.0f;
-                
-                // Stereo link
-                if (g_truePeakLimiter.linkChannels) {
-                    float minGain = fminf(targetGainL, targetGainR);
-                    targetGainL = targetGainR = minGain;
-                }
-                
-                // Smooth gain değişimi
-                if (targetGainL < gainL) {
-                    gainL = targetGainL;  // Fast attack
-                } else {
-                    gainL = gainL * releaseCoef + targetGainL * (1.0f - releaseCoef);
-                }
-                
-                if (targetGainR < gainR) {
-                    gainR = targetGainR;
-                } else {
-                    gainR = gainR * releaseCoef + targetGainR * (1.0f - releaseCoef);
-                }
-                
-                // Uygula limiting
-                samples[i * 2] = sampleL * gainL;
-                samples[i * 2 + 1] = sampleR * gainR;
-                
-                // Hard clip (güvenlik)
-                if (samples[i * 2] > ceiling) samples[i * 2] = ceiling;
-                if (samples[i * 2] < -ceiling) samples[i * 2] = -ceiling;
-                if (samples[i * 2 + 1] > ceiling) samples[i * 2 + 1] = ceiling;
-                if (samples[i * 2 + 1] < -ceiling) samples[i * 2 + 1] = -ceiling;
-            }
-            
-            if (isPrimary) {
-                // Gain reduction hesapla (en düşük gain)
-                float minGain = fminf(gainL, gainR);
-                g_truePeakMeter.gainReduction = (minGain < 1.0f) ? 20.0f * log10f(minGain) : 0.0f;
-                
-                // Metering güncelle
-                g_truePeakMeter.currentPeakL = 20.0f * log10f(fmaxf(peakL, 1e-10f));
-                g_truePeakMeter.currentPeakR = 20.0f * log10f(fmaxf(peakR, 1e-10f));
-                
-                // True peak (oversampling simulasyonu)
-                float oversampleBoost = 0.0f;
-                if (g_truePeakLimiter.oversamplingRate == 2) oversampleBoost = 0.3f;
-                else if (g_truePeakLimiter.oversamplingRate == 4) oversampleBoost = 0.5f;
-                else if (g_truePeakLimiter.oversamplingRate == 8) oversampleBoost = 0.7f;
-                
-                g_truePeakMeter.truePeakL = g_truePeakMeter.currentPeakL + oversampleBoost;
-                g_truePeakMeter.truePeakR = g_truePeakMeter.currentPeakR + oversampleBoost;
-                
-                // Peak hold güncelle
-                if (g_truePeakMeter.truePeakL > g_truePeakMeter.peakHoldL) {
-                    g_truePeakMeter.peakHoldL = g_truePeakMeter.truePeakL;
-                }
-                if (g_truePeakMeter.truePeakR > g_truePeakMeter.peakHoldR) {
-                    g_truePeakMeter.peakHoldR = g_truePeakMeter.truePeakR;
-                }
-            }
-            
-            // Clipping sayacı zaten yukarıda (input aşamasında) sayılıyor
+        // Dither
+        float dL = 0.0f, dR = 0.0f;
+        if (bp.dither == DITHER_RPDF) {
+            dL = randSigned(st.rng) * 0.5f * lsb;
+            dR = randSigned(st.rng) * 0.5f * lsb;
+        } else if (bp.dither == DITHER_TPDF) {
+            dL = (rand01(st.rng) - rand01(st.rng)) * lsb;
+            dR = (rand01(st.rng) - rand01(st.rng)) * lsb;
         }
-    }
 
-    // ============================================
-    // SIMPLIFIED CALLBACKS (No AGC processing)
-    // ============================================
-    
-    // Hard limiter function (safety net)
-    static inline float hardLimit(float sample, float threshold) {
-        if (sample > threshold) return threshold;
-        if (sample < -threshold) return -threshold;
-        return sample;
+        float yL = xL + dL;
+        float yR = xR + dR;
+
+        // Quantize
+        float qL = quantize(yL, bits);
+        float qR = quantize(yR, bits);
+
+        st.errL = yL - qL;
+        st.errR = yR - qR;
+
+        // Mix
+        float outL = inL * (1.0f - mix) + qL * mix;
+        float outR = inR * (1.0f - mix) + qR * mix;
+
+        // Trim & Clamp
+        outL *= out;
+        outR *= out;
+
+        if (outL > 1.0f) outL = 1.0f; else if (outL < -1.0f) outL = -1.0f;
+        if (outR > 1.0f) outR = 1.0f; else if (outR < -1.0f) outR = -1.0f;
+
+        s[i] = outL;
+        s[i + 1] = outR;
     }
-    
-    // ============================================
-    // END CALLBACK
-    // ============================================
-    static void CALLBACK endCallback(HSYNC handle, DWORD channel, DWORD data, void* user) {
-        // Playback bittiğinde çağrılır
-        // JS tarafına callback gönderilebilir
+}
+
+void CALLBACK BitDither_DSP(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
+    ColorFx* fx = static_cast<ColorFx*>(user);
+    CallbackProfiler::StageTimer stage(fx->profiler, CallbackProfiler::STAGE_TAPE_DITHER);
+    const uint32_t reset = g_bitDitherReset.load(std::memory_order_acquire);
+    if (reset != fx->ditherReset) {
+        fx->ditherReset = reset;
+        fx->dither.holdCounter = 0;
+        fx->dither.holdL = fx->dither.holdR = 0.0f;
+        fx->dither.errL = fx->dither.errR = 0.0f;
     }
-};
+    // Parametreler (buffer boyunca değişmeyen snapshot)
+    ParamSnapshot<BitDitherParams>::ReadGuard guard(g_bitDither);
+    processBitDither(*guard, fx->dither, (float*)buffer, (int)(length / sizeof(float)));
+}
 
-AurivoAudioEngine* AurivoAudioEngine::s_instance = nullptr;
+#ifndef AURIVO_RENDER_CLI
 
 // ============================================
 // N-API WRAPPER
 // ============================================
 static AurivoAudioEngine* g_engine = nullptr;
 
+// Engine'e dokunan async yükleme worker'ları. Cleanup engine'i silmeden önce
+// sayacın sıfıra inmesini condition variable ile bekler.
+static struct PendingLoadWorkers {
+    std::mutex mutex;
+    std::condition_variable idle;
+    int count = 0;
+
+    void add() {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++count;
+    }
+
+    // Bildirim kilit altında: bekleyen uyanıp devam etmeden sayaç bırakılmış olur
+    void done() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--count == 0) idle.notify_all();
+    }
+
+    void waitIdle() {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this]() { return count == 0; });
+    }
+} g_pendingLoadWorkers;
+
 // Başlat
 Napi::Value InitAudio(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
@@ -3418,6 +10216,10 @@ Napi::Value InitAudio(const Napi::CallbackInfo& info) {
 
 // Cleanup
 Napi::Value Cleanup(const Napi::CallbackInfo& info) {
+    g_visualizerFeeder.stop();
+    g_pcmShmRing.close();
+    // Worker thread'de commit bekleyen yüklemeler engine'i kullanıyor olabilir
+    g_pendingLoadWorkers.waitIdle();
     if (g_engine) {
         delete g_engine;
         g_engine = nullptr;
@@ -3490,6 +10292,264 @@ Napi::Value CrossfadeTo(const Napi::CallbackInfo& info) {
     return result;
 }
 
+// ============================================
+// ASYNC LOAD / CROSSFADE (Promise)
+// ============================================
+// Dosya açma worker thread'de; m_mutex yalnızca commit (handle takası) için.
+// Cleanup, engine silinmeden önce devam eden worker'ların bitmesini bekler.
+
+class LoadTrackWorker : public Napi::AsyncWorker {
+public:
+    LoadTrackWorker(Napi::Env env, AurivoAudioEngine* engine, const std::string& filePath, int crossfadeMs)
+        : Napi::AsyncWorker(env)
+        , m_deferred(Napi::Promise::Deferred::New(env))
+        , m_engine(engine)
+        , m_filePath(filePath)
+        , m_crossfadeMs(crossfadeMs)
+        , m_token(engine->requestLoadToken())   // istek sırası JS thread'inde belirlenir
+    {
+        g_pendingLoadWorkers.add();
+    }
+
+    Napi::Promise GetPromise() const { return m_deferred.Promise(); }
+
+    // Sayaç Execute sonunda düşer: OnOK main thread'de çalışır ve Cleanup
+    // main thread'de beklerken destructor'a kadar gelemezdi.
+    void Execute() override {
+        runOnEngine();
+        g_pendingLoadWorkers.done();
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::Object result = Napi::Object::New(env);
+        result.Set("success", Napi::Boolean::New(env, true));
+        result.Set("duration", Napi::Number::New(env, m_track.duration));
+        result.Set("rate", Napi::Number::New(env, m_track.freq));
+        result.Set("channels", Napi::Number::New(env, m_track.channels));
+        result.Set("codec", Napi::String::New(env, m_track.codec));
+        result.Set("crossfade", Napi::Boolean::New(env, m_crossfadeMs > 0));
+        m_deferred.Resolve(result);
+    }
+
+    // Yerini daha yeni bir isteğe bırakan yükleme JS'e err.code ile işaretlenir
+    void OnError(const Napi::Error& error) override {
+        Napi::Object err = error.Value();
+        if (m_track.superseded) {
+            err.Set("code", Napi::String::New(Env(), "SUPERSEDED"));
+        }
+        m_deferred.Reject(err);
+    }
+
+private:
+    void runOnEngine() {
+        m_track = m_engine->prepareTrack(m_filePath, m_token);
+        if (!m_track.chain) {
+            SetError(m_track.superseded ? "Superseded by a newer load request"
+                                        : "BASS Error: " + std::to_string(m_track.error));
+            return;
+        }
+        if (!m_engine->commitTrack(m_track, m_crossfadeMs)) {
+            SetError(m_track.superseded ? "Superseded by a newer load request" : "Failed to start track");
+        }
+    }
+
+    Napi::Promise::Deferred m_deferred;
+    AurivoAudioEngine* m_engine;
+    std::string m_filePath;
+    int m_crossfadeMs;
+    uint64_t m_token;
+    AurivoAudioEngine::PreparedTrack m_track;
+};
+
+static Napi::Value QueueLoadTrack(const Napi::CallbackInfo& info, int crossfadeMs) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsString()) {
+        Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+        deferred.Reject(Napi::Error::New(env, g_engine ? "File path required" : "Engine not initialized").Value());
+        return deferred.Promise();
+    }
+
+    auto* worker = new LoadTrackWorker(env, g_engine, info[0].As<Napi::String>().Utf8Value(), crossfadeMs);
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+    return promise;
+}
+
+// loadFileAsync(path) -> Promise<{ duration, rate, channels, codec }>
+Napi::Value LoadFileAsync(const Napi::CallbackInfo& info) {
+    return QueueLoadTrack(info, 0);
+}
+
+// crossfadeToAsync(path, durationMs = 2000) -> Promise<{ duration, rate, channels, codec }>
+Napi::Value CrossfadeToAsync(const Napi::CallbackInfo& info) {
+    int durationMs = 2000;
+    if (info.Length() >= 2 && info[1].IsNumber()) {
+        durationMs = std::max(0, info[1].As<Napi::Number>().Int32Value());
+    }
+    return QueueLoadTrack(info, durationMs);
+}
+
+// ============================================
+// GAPLESS PRELOAD
+// ============================================
+// preloadNext(path, { gapless = false }) -> boolean (kuyruğa alındı mı)
+Napi::Value PreloadNext(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsString()) {
+        return Napi::Boolean::New(env, false);
+    }
+
+    bool gapless = false;
+    if (info.Length() >= 2 && info[1].IsObject()) {
+        Napi::Object opts = info[1].As<Napi::Object>();
+        if (opts.Has("gapless")) gapless = opts.Get("gapless").ToBoolean().Value();
+    }
+    return Napi::Boolean::New(env, g_engine->preloadNext(info[0].As<Napi::String>().Utf8Value(), gapless));
+}
+
+Napi::Value CancelPreload(const Napi::CallbackInfo& info) {
+    if (g_engine) g_engine->cancelPreload();
+    return info.Env().Undefined();
+}
+
+// playNext(crossfadeMs = 0) -> { success, path }
+Napi::Value PlayNext(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Object result = Napi::Object::New(env);
+    if (!g_engine) {
+        result.Set("success", Napi::Boolean::New(env, false));
+        result.Set("error", Napi::String::New(env, "Engine not initialized"));
+        return result;
+    }
+
+    int crossfadeMs = 0;
+    if (info.Length() >= 1 && info[0].IsNumber()) {
+        crossfadeMs = std::max(0, info[0].As<Napi::Number>().Int32Value());
+    }
+
+    std::string path;
+    const bool success = g_engine->playNext(crossfadeMs, &path);
+    result.Set("success", Napi::Boolean::New(env, success));
+    result.Set("path", success ? Napi::String::New(env, path) : env.Null());
+    if (!success) result.Set("error", Napi::String::New(env, "No preloaded track"));
+    return result;
+}
+
+Napi::Value GetPreloadState(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Object result = Napi::Object::New(env);
+    if (!g_engine) {
+        result.Set("state", Napi::String::New(env, "idle"));
+        return result;
+    }
+
+    static const char* kStateNames[] = { "idle", "loading", "buffering", "ready", "failed" };
+    const AurivoAudioEngine::PreloadInfo preload = g_engine->getPreloadInfo();
+    const int stateIndex = std::max(0, std::min(preload.state, 4));
+    result.Set("state", Napi::String::New(env, kStateNames[stateIndex]));
+    result.Set("path", preload.path.empty() ? env.Null() : Napi::String::New(env, preload.path));
+    result.Set("bufferedMs", Napi::Number::New(env, preload.bufferedMs));
+    result.Set("duration", Napi::Number::New(env, preload.duration));
+    result.Set("rate", Napi::Number::New(env, preload.freq));
+    result.Set("gapless", Napi::Boolean::New(env, preload.gapless));
+    result.Set("autoAdvances", Napi::Number::New(env, (double)preload.autoAdvances));
+    result.Set("error", Napi::Number::New(env, preload.error));
+    return result;
+}
+
+// Gecikme profili (ms): 40 / 100 / 250 / 500
+Napi::Value SetLatencyProfile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsNumber()) {
+        return Napi::Boolean::New(env, false);
+    }
+    return Napi::Boolean::New(env, g_engine->setLatencyProfile(info[0].As<Napi::Number>().Int32Value()));
+}
+
+Napi::Value GetLatencyInfo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Object result = Napi::Object::New(env);
+    if (!g_engine) return result;
+
+    const AurivoAudioEngine::LatencyInfo latency = g_engine->getLatencyInfo();
+    Napi::Array profiles = Napi::Array::New(env, AurivoAudioEngine::NUM_LATENCY_PROFILES);
+    Napi::Object byProfile = Napi::Object::New(env);
+    for (int i = 0; i < AurivoAudioEngine::NUM_LATENCY_PROFILES; ++i) {
+        const int ms = AurivoAudioEngine::LATENCY_PROFILES_MS[i];
+        profiles.Set((uint32_t)i, Napi::Number::New(env, ms));
+        byProfile.Set(std::to_string(ms), Napi::Number::New(env, (double)latency.underrunsByProfile[i]));
+    }
+    result.Set("profileMs", Napi::Number::New(env, latency.profileMs));
+    result.Set("profiles", profiles);
+    result.Set("bufferMs", Napi::Number::New(env, latency.bufferMs));
+    result.Set("updatePeriodMs", Napi::Number::New(env, latency.updatePeriodMs));
+    result.Set("deviceLatencyMs", Napi::Number::New(env, latency.deviceLatencyMs));
+    result.Set("minBufferMs", Napi::Number::New(env, latency.minBufferMs));
+    result.Set("bufferedMs", Napi::Number::New(env, latency.bufferedMs));
+    result.Set("limiterMs", Napi::Number::New(env, latency.limiterMs));
+    result.Set("totalMs", Napi::Number::New(env, latency.totalMs));
+    result.Set("blockFrames", Napi::Number::New(env, latency.blockFrames));
+    result.Set("maxBlockFrames", Napi::Number::New(env, latency.maxBlockFrames));
+    result.Set("sampleRate", Napi::Number::New(env, latency.sampleRate));
+    result.Set("deviceRate", Napi::Number::New(env, latency.deviceRate));
+    result.Set("bitTransparent", Napi::Boolean::New(env, latency.bitTransparent));
+    result.Set("underruns", Napi::Number::New(env, (double)latency.underruns));
+    result.Set("underrunsByProfile", byProfile);
+    return result;
+}
+
+// Bit-transparent: cihazı parçanın hızına geçir (sonraki yüklemeden itibaren)
+Napi::Value SetBitTransparent(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsBoolean()) {
+        return Napi::Boolean::New(env, false);
+    }
+    g_engine->setBitTransparent(info[0].As<Napi::Boolean>().Value());
+    return Napi::Boolean::New(env, true);
+}
+
+// Crossfade eğrisi: 0/1/2 veya "equal-power" / "linear" / "s-curve"
+Napi::Value SetCrossfadeCurve(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1) return Napi::Boolean::New(env, false);
+
+    int curve = -1;
+    if (info[0].IsNumber()) {
+        curve = info[0].As<Napi::Number>().Int32Value();
+    } else if (info[0].IsString()) {
+        const std::string name = info[0].As<Napi::String>().Utf8Value();
+        if (name == "equal-power" || name == "equalPower") curve = CrossfadeMixer::CURVE_EQUAL_POWER;
+        else if (name == "linear") curve = CrossfadeMixer::CURVE_LINEAR;
+        else if (name == "s-curve" || name == "scurve") curve = CrossfadeMixer::CURVE_SCURVE;
+    }
+    if (curve < 0 || curve > 2) return Napi::Boolean::New(env, false);
+
+    g_engine->setCrossfadeCurve(curve);
+    return Napi::Boolean::New(env, true);
+}
+
+Napi::Value GetMixerStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Object result = Napi::Object::New(env);
+    if (!g_engine) return result;
+
+    static const char* kCurveNames[] = { "equal-power", "linear", "s-curve" };
+    const CrossfadeMixer::Stats stats = g_engine->getMixerStats();
+    result.Set("sources", Napi::Number::New(env, stats.sources));
+    result.Set("fading", Napi::Number::New(env, stats.fading));
+    result.Set("queued", Napi::Boolean::New(env, stats.queued));
+    result.Set("ended", Napi::Boolean::New(env, stats.ended));
+    result.Set("retired", Napi::Number::New(env, (double)stats.retired));
+    result.Set("forcedRetires", Napi::Number::New(env, (double)stats.forcedRetires));
+    result.Set("advances", Napi::Number::New(env, (double)stats.advances));
+    result.Set("underruns", Napi::Number::New(env, (double)stats.underruns));
+    result.Set("blockFrames", Napi::Number::New(env, stats.blockFrames));
+    result.Set("rate", Napi::Number::New(env, stats.freq));
+    result.Set("curve", Napi::String::New(env, kCurveNames[std::max(0, std::min(g_engine->getCrossfadeCurve(), 2))]));
+    return result;
+}
+
 // Playback controls
 Napi::Value Play(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
@@ -3519,9 +10579,19 @@ Napi::Value Seek(const Napi::CallbackInfo& info) {
     return Napi::Boolean::New(env, false);
 }
 
+// update() sırasında hâlâ okuyucusu olan emekli blokları topla (audio thread dışında)
+static void reclaimParamSnapshots() {
+    g_truePeakLimiter.reclaim();
+    g_masterDsp.reclaim();
+    g_tapeSat.reclaim();
+    g_bitDither.reclaim();
+}
+
 // Position / Duration
 Napi::Value GetCurrentPosition(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
+    // UI pozisyonu sürekli yokluyor; emekli parametre bloklarını burada topla
+    reclaimParamSnapshots();
     double pos = g_engine ? g_engine->getPosition() : 0;
     return Napi::Number::New(env, pos);
 }
@@ -3808,15 +10878,6 @@ Napi::Value NormalizeAudio(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, 0.0f);
 }
 
-Napi::Value UpdateAutoGain(const Napi::CallbackInfo& info) {
-    Napi::Env env = info.Env();
-    if (g_engine) {
-        g_engine->updateAutoGain();
-        return Napi::Boolean::New(env, true);
-    }
-    return Napi::Boolean::New(env, false);
-}
-
 Napi::Value ResetAutoGain(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (g_engine) {
@@ -3831,13 +10892,14 @@ Napi::Value GetAutoGainStats(const Napi::CallbackInfo& info) {
     Napi::Object stats = Napi::Object::New(env);
     
     if (g_engine) {
-        stats.Set("enabled", Napi::Boolean::New(env, g_autoGain.enabled));
-        stats.Set("peakLevel", Napi::Number::New(env, g_autoGain.peakLevel));
-        stats.Set("rmsLevel", Napi::Number::New(env, g_autoGain.rmsLevel));
-        stats.Set("currentGain", Napi::Number::New(env, g_autoGain.currentGain));
-        stats.Set("targetLevel", Napi::Number::New(env, g_autoGain.targetLevel));
-        stats.Set("maxGain", Napi::Number::New(env, g_autoGain.maxGain));
-        stats.Set("mode", Napi::Number::New(env, g_autoGain.mode));
+        const AutoGainParams& p = g_autoGain.current();
+        stats.Set("enabled", Napi::Boolean::New(env, p.enabled));
+        stats.Set("peakLevel", Napi::Number::New(env, g_engine->getPeakLevel()));
+        stats.Set("rmsLevel", Napi::Number::New(env, g_engine->getRmsLevel()));
+        stats.Set("currentGain", Napi::Number::New(env, g_engine->getAutoGainReduction()));
+        stats.Set("targetLevel", Napi::Number::New(env, p.targetLevel));
+        stats.Set("maxGain", Napi::Number::New(env, p.maxGain));
+        stats.Set("mode", Napi::Number::New(env, p.mode));
     } else {
         stats.Set("enabled", Napi::Boolean::New(env, false));
         stats.Set("peakLevel", Napi::Number::New(env, -96.0f));
@@ -3848,6 +10910,463 @@ Napi::Value GetAutoGainStats(const Napi::CallbackInfo& info) {
     return stats;
 }
 
+// EBU R128 loudness anlık görüntüsü (metre + AGC durumu tek çağrıda)
+Napi::Value GetLoudness(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine) return env.Null();
+
+    const auto l = g_engine->getLoudness();
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("momentary", Napi::Number::New(env, l.momentary));
+    result.Set("shortTerm", Napi::Number::New(env, l.shortTerm));
+    result.Set("integrated", Napi::Number::New(env, l.integrated));
+    result.Set("lra", Napi::Number::New(env, l.lra));
+    result.Set("momentaryMax", Napi::Number::New(env, l.momentaryMax));
+    result.Set("shortTermMax", Napi::Number::New(env, l.shortTermMax));
+    result.Set("samplePeak", Napi::Number::New(env, l.samplePeak));
+    result.Set("samplePeakMax", Napi::Number::New(env, l.samplePeakMax));
+    result.Set("rms", Napi::Number::New(env, l.rms));
+    result.Set("duration", Napi::Number::New(env, l.duration));
+    result.Set("sampleRate", Napi::Number::New(env, l.sampleRate));
+    result.Set("live", Napi::Boolean::New(env, l.live));
+
+    Napi::Object agc = Napi::Object::New(env);
+    agc.Set("enabled", Napi::Boolean::New(env, l.agcEnabled));
+    agc.Set("mode", Napi::Number::New(env, l.agcMode));
+    agc.Set("target", Napi::Number::New(env, l.agcTarget));
+    agc.Set("gain", Napi::Number::New(env, l.agcGain));
+    agc.Set("normalizeGain", Napi::Number::New(env, l.normalizeGain));
+    result.Set("agc", agc);
+    return result;
+}
+
+// ============================================
+// WAVEFORM ÖNİZLEMESİ N-API
+// ============================================
+
+static Napi::Float32Array floatVectorToJs(Napi::Env env, const std::vector<float>& v) {
+    Napi::Float32Array arr = Napi::Float32Array::New(env, v.size());
+    if (!v.empty()) std::memcpy(arr.Data(), v.data(), v.size() * sizeof(float));
+    return arr;
+}
+
+static Napi::Object waveformOverviewToJs(Napi::Env env, const WaveformCache::Overview& o, bool built) {
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("width", Napi::Number::New(env, o.width));
+    obj.Set("duration", Napi::Number::New(env, o.duration));
+    obj.Set("start", Napi::Number::New(env, o.start));
+    obj.Set("end", Napi::Number::New(env, o.end));
+    obj.Set("sampleRate", Napi::Number::New(env, o.sampleRate));
+    obj.Set("channels", Napi::Number::New(env, o.channels));
+    obj.Set("level", Napi::Number::New(env, o.level));
+    obj.Set("binFrames", Napi::Number::New(env, o.binFrames));
+    obj.Set("mapped", Napi::Boolean::New(env, o.mapped));
+    obj.Set("built", Napi::Boolean::New(env, built));
+    obj.Set("min", floatVectorToJs(env, o.min));
+    obj.Set("max", floatVectorToJs(env, o.max));
+    obj.Set("rms", floatVectorToJs(env, o.rms));
+    return obj;
+}
+
+struct WaveformRequestJs {
+    Napi::Promise::Deferred deferred;
+    Napi::ThreadSafeFunction tsfn;
+    std::string path;
+    uint32_t width;
+    double start;
+    double end;
+};
+
+// getWaveformOverview(path, width, { start, end }?) -> Promise<{ min, max, rms: Float32Array, ... }>
+// Piramit hazırsa Promise hemen çözülür; değilse arka planda kurulur (bir kez).
+Napi::Value GetWaveformOverview(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+    if (!g_engine || info.Length() < 2 || !info[0].IsString() || !info[1].IsNumber()) {
+        deferred.Reject(Napi::Error::New(env, g_engine ? "Path and width required" : "Engine not initialized").Value());
+        return deferred.Promise();
+    }
+
+    const std::string path = info[0].As<Napi::String>().Utf8Value();
+    const uint32_t width = (uint32_t)std::max(1, std::min(65536, info[1].As<Napi::Number>().Int32Value()));
+    double start = 0.0;
+    double end = 0.0;
+    if (info.Length() > 2 && info[2].IsObject()) {
+        Napi::Object o = info[2].As<Napi::Object>();
+        if (o.Has("start") && o.Get("start").IsNumber()) start = o.Get("start").As<Napi::Number>().DoubleValue();
+        if (o.Has("end") && o.Get("end").IsNumber()) end = o.Get("end").As<Napi::Number>().DoubleValue();
+    }
+
+    WaveformCache::Overview overview;
+    if (g_engine->queryWaveform(path, width, start, end, overview)) {
+        deferred.Resolve(waveformOverviewToJs(env, overview, false));
+        return deferred.Promise();
+    }
+
+    auto* ctx = new WaveformRequestJs{ deferred, Napi::ThreadSafeFunction(), path, width, start, end };
+    Napi::Function noop = Napi::Function::New(env, [](const Napi::CallbackInfo& ci) -> Napi::Value { return ci.Env().Undefined(); });
+    ctx->tsfn = Napi::ThreadSafeFunction::New(env, noop, "aurivoWaveform", 0, 1, ctx,
+                                              [](Napi::Env, WaveformRequestJs* c) { delete c; });
+
+    g_engine->buildWaveform(path, [ctx](bool ok, int error) {
+        auto* status = new int(ok ? BASS_OK : (error != BASS_OK ? error : BASS_ERROR_UNKNOWN));
+        const auto called = ctx->tsfn.BlockingCall(status, [ctx](Napi::Env env, Napi::Function, int* err) {
+            WaveformCache::Overview o;
+            if (*err == BASS_OK && g_engine &&
+                g_engine->queryWaveform(ctx->path, ctx->width, ctx->start, ctx->end, o)) {
+                ctx->deferred.Resolve(waveformOverviewToJs(env, o, true));
+            } else {
+                ctx->deferred.Reject(Napi::Error::New(env, "Waveform analysis failed (BASS error " +
+                                                      std::to_string(*err) + ")").Value());
+            }
+            delete err;
+        });
+        if (called != napi_ok) delete status;
+        ctx->tsfn.Release();
+    });
+    return deferred.Promise();
+}
+
+// ============================================
+// LOUDNESS TARAMASI / REPLAYGAIN N-API
+// ============================================
+
+static Napi::Object loudnessResultToJs(Napi::Env env, const LoudnessScanner::Result& r) {
+    const LoudnessCacheEntry& e = r.entry;
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("path", Napi::String::New(env, r.path));
+    obj.Set("ok", Napi::Boolean::New(env, r.ok));
+    if (!r.ok) {
+        obj.Set("error", Napi::Number::New(env, r.error));
+        return obj;
+    }
+    const float ref = AurivoAudioEngine::REPLAYGAIN_REFERENCE_LUFS;
+    obj.Set("cached", Napi::Boolean::New(env, r.cached));
+    obj.Set("integrated", Napi::Number::New(env, e.trackLufs));
+    obj.Set("truePeak", Napi::Number::New(env, linearTodB(e.trackPeak)));
+    obj.Set("lra", Napi::Number::New(env, e.lra));
+    obj.Set("duration", Napi::Number::New(env, e.duration));
+    obj.Set("trackGain", Napi::Number::New(env, ref - e.trackLufs));
+    if (e.hasAlbum()) {
+        obj.Set("albumLoudness", Napi::Number::New(env, e.albumLufs));
+        obj.Set("albumPeak", Napi::Number::New(env, linearTodB(e.albumPeak)));
+        obj.Set("albumGain", Napi::Number::New(env, ref - e.albumLufs));
+    }
+    if (!r.cached && r.seconds > 0.0) {
+        obj.Set("scanSeconds", Napi::Number::New(env, r.seconds));
+        obj.Set("realtimeFactor", Napi::Number::New(env, e.duration / r.seconds));
+    }
+    return obj;
+}
+
+struct LoudnessScanJs {
+    Napi::Promise::Deferred deferred;
+    Napi::ThreadSafeFunction tsfn;
+};
+
+struct LoudnessScanProgress {
+    LoudnessScanner::Result result;
+    size_t done;
+    size_t total;
+};
+
+struct LoudnessScanDone {
+    std::vector<LoudnessScanner::Result> results;
+    bool cancelled;
+};
+
+// scanLoudness(paths[], { threads, album, force }, onProgress?) -> Promise<{ cancelled, results }>
+// onProgress({ done, total, result }) JS thread'inde, dosya başına bir kez
+Napi::Value ScanLoudness(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+    if (!g_engine || info.Length() < 1 || !info[0].IsArray()) {
+        deferred.Reject(Napi::Error::New(env, g_engine ? "Path array required" : "Engine not initialized").Value());
+        return deferred.Promise();
+    }
+
+    std::vector<std::string> paths;
+    Napi::Array arr = info[0].As<Napi::Array>();
+    for (uint32_t i = 0; i < arr.Length(); ++i) {
+        Napi::Value v = arr.Get(i);
+        if (v.IsString()) paths.push_back(v.As<Napi::String>().Utf8Value());
+    }
+
+    LoudnessScanner::Options options;
+    if (info.Length() > 1 && info[1].IsObject()) {
+        Napi::Object o = info[1].As<Napi::Object>();
+        if (o.Has("threads") && o.Get("threads").IsNumber()) options.threads = o.Get("threads").As<Napi::Number>().Int32Value();
+        if (o.Has("album") && o.Get("album").IsBoolean()) options.album = o.Get("album").As<Napi::Boolean>().Value();
+        if (o.Has("force") && o.Get("force").IsBoolean()) options.force = o.Get("force").As<Napi::Boolean>().Value();
+    }
+
+    const bool hasProgress = info.Length() > 2 && info[2].IsFunction();
+    Napi::Function callback = hasProgress
+        ? info[2].As<Napi::Function>()
+        : Napi::Function::New(env, [](const Napi::CallbackInfo& ci) -> Napi::Value { return ci.Env().Undefined(); });
+
+    auto* ctx = new LoudnessScanJs{ deferred, Napi::ThreadSafeFunction() };
+    ctx->tsfn = Napi::ThreadSafeFunction::New(env, callback, "aurivoLoudnessScan", 0, 1, ctx,
+                                              [](Napi::Env, LoudnessScanJs* c) { delete c; });
+
+    Napi::ThreadSafeFunction tsfn = ctx->tsfn;
+    auto onProgress = [tsfn, hasProgress](const LoudnessScanner::Result& r, size_t done, size_t total) {
+        if (!hasProgress) return;
+        auto* ev = new LoudnessScanProgress{ r, done, total };
+        const auto status = tsfn.NonBlockingCall(ev, [](Napi::Env env, Napi::Function jsCallback, LoudnessScanProgress* p) {
+            Napi::Object obj = Napi::Object::New(env);
+            obj.Set("done", Napi::Number::New(env, (double)p->done));
+            obj.Set("total", Napi::Number::New(env, (double)p->total));
+            obj.Set("result", loudnessResultToJs(env, p->result));
+            jsCallback.Call({ obj });
+            delete p;
+        });
+        if (status != napi_ok) delete ev;
+    };
+    auto onDone = [ctx](std::vector<LoudnessScanner::Result>& results, bool cancelled) {
+        auto* done = new LoudnessScanDone{ std::move(results), cancelled };
+        const auto status = ctx->tsfn.BlockingCall(done, [ctx](Napi::Env env, Napi::Function, LoudnessScanDone* d) {
+            Napi::Array list = Napi::Array::New(env, d->results.size());
+            for (size_t i = 0; i < d->results.size(); ++i) list.Set((uint32_t)i, loudnessResultToJs(env, d->results[i]));
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("cancelled", Napi::Boolean::New(env, d->cancelled));
+            result.Set("results", list);
+            ctx->deferred.Resolve(result);
+            delete d;
+        });
+        if (status != napi_ok) delete done;
+        ctx->tsfn.Release();
+    };
+
+    if (!g_engine->startLoudnessScan(std::move(paths), options, onProgress, onDone)) {
+        deferred.Reject(Napi::Error::New(env, g_engine->isLoudnessScanRunning()
+            ? "A loudness scan is already running" : "Engine not initialized").Value());
+        ctx->tsfn.Release();
+    }
+    return deferred.Promise();
+}
+
+Napi::Value CancelLoudnessScan(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return Napi::Boolean::New(env, g_engine ? g_engine->cancelLoudnessScan() : false);
+}
+
+Napi::Value SetCacheDirectory(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsString()) return Napi::Boolean::New(env, false);
+    g_engine->setCacheDirectory(info[0].As<Napi::String>().Utf8Value());
+    return Napi::Boolean::New(env, true);
+}
+
+// setReplayGain({ mode: 'off' | 'track' | 'album', preamp: dB, preventClipping: bool })
+Napi::Value SetReplayGain(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsObject()) return Napi::Boolean::New(env, false);
+
+    const auto current = g_engine->getReplayGainInfo();
+    int mode = current.mode;
+    float preamp = current.preamp;
+    bool preventClipping = current.preventClipping;
+
+    Napi::Object o = info[0].As<Napi::Object>();
+    if (o.Has("mode")) {
+        Napi::Value m = o.Get("mode");
+        if (m.IsString()) {
+            const std::string name = m.As<Napi::String>().Utf8Value();
+            mode = (name == "album") ? AurivoAudioEngine::REPLAYGAIN_ALBUM
+                 : (name == "track") ? AurivoAudioEngine::REPLAYGAIN_TRACK
+                 : AurivoAudioEngine::REPLAYGAIN_OFF;
+        } else if (m.IsNumber()) {
+            mode = m.As<Napi::Number>().Int32Value();
+        }
+    }
+    if (o.Has("preamp") && o.Get("preamp").IsNumber()) preamp = o.Get("preamp").As<Napi::Number>().FloatValue();
+    if (o.Has("preventClipping") && o.Get("preventClipping").IsBoolean()) {
+        preventClipping = o.Get("preventClipping").As<Napi::Boolean>().Value();
+    }
+    g_engine->setReplayGain(mode, preamp, preventClipping);
+    return Napi::Boolean::New(env, true);
+}
+
+Napi::Value GetReplayGainInfo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine) return env.Null();
+    static const char* modeNames[] = { "off", "track", "album" };
+    const auto rg = g_engine->getReplayGainInfo();
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("mode", Napi::String::New(env, modeNames[rg.mode]));
+    result.Set("preamp", Napi::Number::New(env, rg.preamp));
+    result.Set("preventClipping", Napi::Boolean::New(env, rg.preventClipping));
+    result.Set("reference", Napi::Number::New(env, rg.reference));
+    result.Set("currentGain", Napi::Number::New(env, rg.currentGain));
+    result.Set("scanning", Napi::Boolean::New(env, rg.scanning));
+    return result;
+}
+
+// ============================================
+// OFFLINE RENDER N-API
+// ============================================
+
+static Napi::Array stringsToJs(Napi::Env env, const std::vector<std::string>& values) {
+    Napi::Array list = Napi::Array::New(env, values.size());
+    for (size_t i = 0; i < values.size(); ++i) list.Set((uint32_t)i, Napi::String::New(env, values[i]));
+    return list;
+}
+
+static Napi::Object renderResultToJs(Napi::Env env, const OfflineRenderer::Result& r) {
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("input", Napi::String::New(env, r.input));
+    obj.Set("output", Napi::String::New(env, r.output));
+    obj.Set("ok", Napi::Boolean::New(env, r.ok));
+    if (!r.ok) {
+        obj.Set("error", Napi::Number::New(env, r.error));
+        obj.Set("message", Napi::String::New(env, r.message));
+        return obj;
+    }
+    obj.Set("sampleRate", Napi::Number::New(env, r.sampleRate));
+    obj.Set("frames", Napi::Number::New(env, (double)r.frames));
+    obj.Set("duration", Napi::Number::New(env, r.duration));
+    obj.Set("renderSeconds", Napi::Number::New(env, r.seconds));
+    obj.Set("realtimeFactor", Napi::Number::New(env, r.realtimeFactor()));
+    obj.Set("gain", Napi::Number::New(env, linearTodB(r.gain)));
+    obj.Set("truePeak", Napi::Number::New(env, linearTodB(r.truePeak)));
+    obj.Set("stages", stringsToJs(env, r.stages));
+    obj.Set("skippedStages", stringsToJs(env, r.skipped));
+    return obj;
+}
+
+struct RenderJs {
+    Napi::Promise::Deferred deferred;
+    Napi::ThreadSafeFunction tsfn;
+    bool single;    // renderFile: tek sonuç nesnesi döner
+};
+
+struct RenderProgress {
+    OfflineRenderer::Result result;
+    size_t done;
+    size_t total;
+};
+
+struct RenderDone {
+    std::vector<OfflineRenderer::Result> results;
+    bool cancelled;
+};
+
+// Ortak gövde: jobs hazır, options = info[optionsIndex], onProgress = info[optionsIndex + 1]
+static Napi::Value StartRender(const Napi::CallbackInfo& info, std::vector<OfflineRenderer::Job> jobs,
+                               size_t optionsIndex, bool single) {
+    Napi::Env env = info.Env();
+    Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+
+    OfflineRenderer::Options options;
+    bool replayGain = false;
+    if (info.Length() > optionsIndex && info[optionsIndex].IsObject()) {
+        Napi::Object o = info[optionsIndex].As<Napi::Object>();
+        if (o.Has("threads") && o.Get("threads").IsNumber()) options.threads = o.Get("threads").As<Napi::Number>().Int32Value();
+        if (o.Has("bitDepth") && o.Get("bitDepth").IsNumber()) options.bitDepth = o.Get("bitDepth").As<Napi::Number>().Int32Value();
+        if (o.Has("dither") && o.Get("dither").IsBoolean()) options.dither = o.Get("dither").As<Napi::Boolean>().Value();
+        if (o.Has("limiter") && o.Get("limiter").IsBoolean()) options.limiter = o.Get("limiter").As<Napi::Boolean>().Value() ? 1 : 0;
+        if (o.Has("replayGain") && o.Get("replayGain").IsBoolean()) replayGain = o.Get("replayGain").As<Napi::Boolean>().Value();
+    }
+
+    const size_t progressIndex = optionsIndex + 1;
+    const bool hasProgress = info.Length() > progressIndex && info[progressIndex].IsFunction();
+    Napi::Function callback = hasProgress
+        ? info[progressIndex].As<Napi::Function>()
+        : Napi::Function::New(env, [](const Napi::CallbackInfo& ci) -> Napi::Value { return ci.Env().Undefined(); });
+
+    auto* ctx = new RenderJs{ deferred, Napi::ThreadSafeFunction(), single };
+    ctx->tsfn = Napi::ThreadSafeFunction::New(env, callback, "aurivoOfflineRender", 0, 1, ctx,
+                                              [](Napi::Env, RenderJs* c) { delete c; });
+
+    Napi::ThreadSafeFunction tsfn = ctx->tsfn;
+    auto onProgress = [tsfn, hasProgress](const OfflineRenderer::Result& r, size_t done, size_t total) {
+        if (!hasProgress) return;
+        auto* ev = new RenderProgress{ r, done, total };
+        const auto status = tsfn.NonBlockingCall(ev, [](Napi::Env env, Napi::Function jsCallback, RenderProgress* p) {
+            Napi::Object obj = Napi::Object::New(env);
+            obj.Set("done", Napi::Number::New(env, (double)p->done));
+            obj.Set("total", Napi::Number::New(env, (double)p->total));
+            obj.Set("result", renderResultToJs(env, p->result));
+            jsCallback.Call({ obj });
+            delete p;
+        });
+        if (status != napi_ok) delete ev;
+    };
+    auto onDone = [ctx](std::vector<OfflineRenderer::Result>& results, bool cancelled) {
+        auto* done = new RenderDone{ std::move(results), cancelled };
+        const auto status = ctx->tsfn.BlockingCall(done, [ctx](Napi::Env env, Napi::Function, RenderDone* d) {
+            if (ctx->single) {
+                if (d->results.empty()) {
+                    ctx->deferred.Reject(Napi::Error::New(env, "Render cancelled").Value());
+                } else {
+                    ctx->deferred.Resolve(renderResultToJs(env, d->results[0]));
+                }
+            } else {
+                Napi::Array list = Napi::Array::New(env, d->results.size());
+                for (size_t i = 0; i < d->results.size(); ++i) list.Set((uint32_t)i, renderResultToJs(env, d->results[i]));
+                Napi::Object result = Napi::Object::New(env);
+                result.Set("cancelled", Napi::Boolean::New(env, d->cancelled));
+                result.Set("results", list);
+                ctx->deferred.Resolve(result);
+            }
+            delete d;
+        });
+        if (status != napi_ok) delete done;
+        ctx->tsfn.Release();
+    };
+
+    if (!g_engine->startRender(std::move(jobs), options, replayGain, onProgress, onDone)) {
+        deferred.Reject(Napi::Error::New(env, g_engine->isRenderRunning()
+            ? "A render is already running" : "Engine not initialized").Value());
+        ctx->tsfn.Release();
+    }
+    return deferred.Promise();
+}
+
+// renderFile(input, output, { bitDepth, dither, limiter, replayGain }) -> Promise<result>
+Napi::Value RenderFile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 2 || !info[0].IsString() || !info[1].IsString()) {
+        Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+        deferred.Reject(Napi::Error::New(env, g_engine ? "Input and output paths required" : "Engine not initialized").Value());
+        return deferred.Promise();
+    }
+    std::vector<OfflineRenderer::Job> jobs(1);
+    jobs[0].input = info[0].As<Napi::String>().Utf8Value();
+    jobs[0].output = info[1].As<Napi::String>().Utf8Value();
+    return StartRender(info, std::move(jobs), 2, true);
+}
+
+// renderFiles([{ input, output }], { threads, bitDepth, dither, limiter, replayGain }, onProgress?)
+//   -> Promise<{ cancelled, results }>; onProgress({ done, total, result }) dosya başına
+Napi::Value RenderFiles(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsArray()) {
+        Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+        deferred.Reject(Napi::Error::New(env, g_engine ? "Job array required" : "Engine not initialized").Value());
+        return deferred.Promise();
+    }
+    std::vector<OfflineRenderer::Job> jobs;
+    Napi::Array arr = info[0].As<Napi::Array>();
+    for (uint32_t i = 0; i < arr.Length(); ++i) {
+        Napi::Value v = arr.Get(i);
+        if (!v.IsObject()) continue;
+        Napi::Object o = v.As<Napi::Object>();
+        if (!o.Get("input").IsString() || !o.Get("output").IsString()) continue;
+        OfflineRenderer::Job job;
+        job.input = o.Get("input").As<Napi::String>().Utf8Value();
+        job.output = o.Get("output").As<Napi::String>().Utf8Value();
+        jobs.push_back(std::move(job));
+    }
+    return StartRender(info, std::move(jobs), 1, false);
+}
+
+Napi::Value CancelRender(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return Napi::Boolean::New(env, g_engine ? g_engine->cancelRender() : false);
+}
+
 Napi::Value GetPeakLevel(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     float peak = g_engine ? g_engine->getPeakLevel() : -96.0f;
@@ -4069,9 +11588,230 @@ Napi::Value IsTruePeakEnabled(const Napi::CallbackInfo& info) {
     return Napi::Boolean::New(env, enabled);
 }
 
+// Caller'ın verdiği Float32Array / ArrayBuffer hedefini çöz.
+// SharedArrayBuffer üzerindeki Float32Array view'ları da buradan geçer.
+static bool GetFloatTarget(const Napi::Value& value, float*& data, size_t& length) {
+    data = nullptr;
+    length = 0;
+    if (value.IsTypedArray()) {
+        Napi::TypedArray typed = value.As<Napi::TypedArray>();
+        if (typed.TypedArrayType() != napi_float32_array) return false;
+        Napi::Float32Array arr = value.As<Napi::Float32Array>();
+        data = arr.Data();
+        length = arr.ElementLength();
+        return data != nullptr;
+    }
+    if (value.IsArrayBuffer()) {
+        Napi::ArrayBuffer buffer = value.As<Napi::ArrayBuffer>();
+        data = static_cast<float*>(buffer.Data());
+        length = buffer.ByteLength() / sizeof(float);
+        return data != nullptr;
+    }
+    return false;
+}
+
+// ============================================
+// METRELER NAPI
+// ============================================
+// getMeters(Float32Array?) -> Float32Array
+// Verilen hedef (en az meterFields.COUNT eleman) yerinde doldurulur, yoksa yeni
+// dizi döner. Alan sırası `meterFields` export'undadır. UI karesi başına tek çağrı.
+Napi::Value GetMeters(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine) return env.Null();
+
+    float* data = nullptr;
+    size_t length = 0;
+    if (info.Length() > 0 && !info[0].IsUndefined() && !info[0].IsNull()) {
+        if (!GetFloatTarget(info[0], data, length) || length < (size_t)MeterBank::FIELD_COUNT) {
+            Napi::TypeError::New(env, "getMeters: Float32Array target too small").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        if (!g_engine->readMeters(data)) return env.Null();
+        return info[0];
+    }
+
+    Napi::Float32Array out = Napi::Float32Array::New(env, MeterBank::FIELD_COUNT);
+    if (!g_engine->readMeters(out.Data())) return env.Null();
+    return out;
+}
+
+Napi::Value ResetMeterCounters(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (g_engine) g_engine->resetMeterCounters();
+    return env.Undefined();
+}
+
+// ============================================
+// CALLBACK PROFİLİ N-API
+// ============================================
+// getDspStats() -> { blocks, meanUs, maxUs, worstUs, worstLoad, deadlineMisses,
+//                    overThreshold, histogram: { lowerUs[], counts[] }, stages? }
+// Süreler µs, load = işlem süresi / blok bütçesi (1.0 = deadline).
+Napi::Value GetDspStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine) return env.Null();
+
+    CallbackProfiler::Stats stats;
+    g_engine->getDspStats(stats);
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("enabled", Napi::Boolean::New(env, stats.enabled));
+    result.Set("perStage", Napi::Boolean::New(env, stats.perStage));
+    result.Set("thresholdPercent", Napi::Number::New(env, stats.thresholdPercent));
+    result.Set("windowSeconds", Napi::Number::New(env, stats.windowSeconds));
+    result.Set("blocks", Napi::Number::New(env, (double)stats.blocks));
+    result.Set("frames", Napi::Number::New(env, (double)stats.frames));
+    result.Set("sampleRate", Napi::Number::New(env, stats.sampleRate));
+    result.Set("lastUs", Napi::Number::New(env, stats.lastUs));
+    result.Set("budgetUs", Napi::Number::New(env, stats.lastBudgetUs));
+    result.Set("meanUs", Napi::Number::New(env, stats.meanUs));
+    result.Set("maxUs", Napi::Number::New(env, stats.maxUs));
+    result.Set("p50Us", Napi::Number::New(env, stats.p50Us));
+    result.Set("p99Us", Napi::Number::New(env, stats.p99Us));
+    result.Set("meanLoad", Napi::Number::New(env, stats.meanLoad));
+    result.Set("maxLoad", Napi::Number::New(env, stats.maxLoad));
+    result.Set("worstUs", Napi::Number::New(env, stats.worstUs));
+    result.Set("worstLoad", Napi::Number::New(env, stats.worstLoad));
+    result.Set("overThreshold", Napi::Number::New(env, (double)stats.overThreshold));
+    result.Set("deadlineMisses", Napi::Number::New(env, (double)stats.deadlineMisses));
+    result.Set("sinceResetSec", Napi::Number::New(env, stats.sinceResetSec));
+
+    Napi::Array lower = Napi::Array::New(env, CallbackProfiler::BUCKETS);
+    Napi::Array counts = Napi::Array::New(env, CallbackProfiler::BUCKETS);
+    for (int b = 0; b < CallbackProfiler::BUCKETS; ++b) {
+        lower.Set((uint32_t)b, Napi::Number::New(env, CallbackProfiler::bucketLowerUs(b)));
+        counts.Set((uint32_t)b, Napi::Number::New(env, (double)stats.histogram[b]));
+    }
+    Napi::Object histogram = Napi::Object::New(env);
+    histogram.Set("lowerUs", lower);
+    histogram.Set("counts", counts);
+    result.Set("histogram", histogram);
+
+    if (stats.perStage) {
+        Napi::Object stages = Napi::Object::New(env);
+        for (int s = 0; s < CallbackProfiler::STAGE_COUNT; ++s) {
+            const CallbackProfiler::StageStats& st = stats.stages[s];
+            Napi::Object stage = Napi::Object::New(env);
+            stage.Set("calls", Napi::Number::New(env, (double)st.calls));
+            stage.Set("totalUs", Napi::Number::New(env, st.totalUs));
+            stage.Set("meanUs", Napi::Number::New(env, st.meanUs));
+            stage.Set("maxUs", Napi::Number::New(env, st.maxUs));
+            stages.Set(CallbackProfiler::stageName(s), stage);
+        }
+        result.Set("stages", stages);
+    }
+    return result;
+}
+
+Napi::Value ResetDspStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (g_engine) g_engine->resetDspStats();
+    return env.Undefined();
+}
+
+// setDspStatsOptions({ enabled?, perStage?, thresholdPercent?, windowSeconds? })
+// Verilmeyen alanlar mevcut değerini korur.
+Napi::Value SetDspStatsOptions(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Options object expected").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!g_engine) return Napi::Boolean::New(env, false);
+
+    CallbackProfiler::Stats current;
+    g_engine->getDspStats(current);
+    bool enabled = current.enabled;
+    bool perStage = current.perStage;
+    double threshold = current.thresholdPercent;
+    int window = current.windowSeconds;
+
+    Napi::Object o = info[0].As<Napi::Object>();
+    if (o.Has("enabled") && o.Get("enabled").IsBoolean()) enabled = o.Get("enabled").As<Napi::Boolean>().Value();
+    if (o.Has("perStage") && o.Get("perStage").IsBoolean()) perStage = o.Get("perStage").As<Napi::Boolean>().Value();
+    if (o.Has("thresholdPercent") && o.Get("thresholdPercent").IsNumber()) {
+        threshold = o.Get("thresholdPercent").As<Napi::Number>().DoubleValue();
+    }
+    if (o.Has("windowSeconds") && o.Get("windowSeconds").IsNumber()) {
+        window = o.Get("windowSeconds").As<Napi::Number>().Int32Value();
+    }
+    g_engine->configureDspStats(enabled, perStage, threshold, window);
+    return Napi::Boolean::New(env, true);
+}
+
+static Napi::Object CreateMeterFields(Napi::Env env) {
+    Napi::Object fields = Napi::Object::New(env);
+    for (int f = 0; f < MeterBank::FIELD_COUNT; ++f) {
+        fields.Set(MeterBank::fieldName(f), Napi::Number::New(env, f));
+    }
+    fields.Set("COUNT", Napi::Number::New(env, MeterBank::FIELD_COUNT));
+    return fields;
+}
+
+// ============================================
+// TOPLU PARAMETRE NAPI
+// ============================================
+// applyParamBatch(Float32Array | number[]) -> uygulanan işlem sayısı
+// Dizi [paramId, value, paramId, value, ...] çiftlerinden oluşur (bkz. paramIds).
+Napi::Value ApplyParamBatch(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1) {
+        return Napi::Number::New(env, 0);
+    }
+
+    float* ops = nullptr;
+    size_t length = 0;
+    std::vector<float> copied;
+    if (!GetFloatTarget(info[0], ops, length)) {
+        if (!info[0].IsArray()) {
+            return Napi::Number::New(env, 0);
+        }
+        Napi::Array arr = info[0].As<Napi::Array>();
+        copied.resize(arr.Length(), NAN);
+        for (uint32_t i = 0; i < arr.Length(); ++i) {
+            Napi::Value val = arr.Get(i);
+            if (val.IsNumber()) copied[i] = val.As<Napi::Number>().FloatValue();
+        }
+        ops = copied.data();
+        length = copied.size();
+    }
+
+    return Napi::Number::New(env, g_engine->applyParamBatch(ops, (int)(length / 2)));
+}
+
+static Napi::Object CreateParamIds(Napi::Env env) {
+    Napi::Object ids = Napi::Object::New(env);
+    ids.Set("EQ_BAND_0", Napi::Number::New(env, PARAM_EQ_BAND_0));
+    ids.Set("EQ_BAND_COUNT", Napi::Number::New(env, NUM_EQ_BANDS));
+    ids.Set("PREAMP", Napi::Number::New(env, PARAM_PREAMP));
+    ids.Set("BASS_BOOST", Napi::Number::New(env, PARAM_BASS_BOOST));
+    ids.Set("TONE_BASS", Napi::Number::New(env, PARAM_TONE_BASS));
+    ids.Set("TONE_MID", Napi::Number::New(env, PARAM_TONE_MID));
+    ids.Set("TONE_TREBLE", Napi::Number::New(env, PARAM_TONE_TREBLE));
+    ids.Set("STEREO_EXPANDER", Napi::Number::New(env, PARAM_STEREO_EXPANDER));
+    ids.Set("BALANCE", Napi::Number::New(env, PARAM_BALANCE));
+    ids.Set("MASTER_VOLUME", Napi::Number::New(env, PARAM_MASTER_VOLUME));
+    ids.Set("COMPRESSOR_THRESHOLD", Napi::Number::New(env, PARAM_COMPRESSOR_THRESHOLD));
+    ids.Set("COMPRESSOR_RATIO", Napi::Number::New(env, PARAM_COMPRESSOR_RATIO));
+    ids.Set("COMPRESSOR_ATTACK", Napi::Number::New(env, PARAM_COMPRESSOR_ATTACK));
+    ids.Set("COMPRESSOR_RELEASE", Napi::Number::New(env, PARAM_COMPRESSOR_RELEASE));
+    ids.Set("COMPRESSOR_MAKEUP", Napi::Number::New(env, PARAM_COMPRESSOR_MAKEUP));
+    return ids;
+}
+
 // FFT / Spectrum
+// getFFTData()            -> number[] (legacy)
+// getFFTData(Float32Array) -> yazılan bin sayısı (zero-copy)
 Napi::Value GetFFTData(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
+
+    float* target = nullptr;
+    size_t targetLen = 0;
+    if (info.Length() > 0 && GetFloatTarget(info[0], target, targetLen)) {
+        int written = g_engine ? g_engine->fillFFTData(target, (int)std::min<size_t>(targetLen, FFT_SIZE / 2)) : 0;
+        return Napi::Number::New(env, written);
+    }
     
     if (!g_engine) {
         return Napi::Array::New(env, 0);
@@ -4086,59 +11826,255 @@ Napi::Value GetFFTData(const Napi::CallbackInfo& info) {
 }
 
 // PCM (Float32Array)
+// getPCMData(frames)                -> { channels, data } (legacy, kopya)
+// getPCMData(Float32Array[, frames]) -> yazılan frame sayısı, stereo interleaved (zero-copy)
 Napi::Value GetPCMData(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
 
+    float* target = nullptr;
+    size_t targetLen = 0;
+    if (info.Length() > 0 && GetFloatTarget(info[0], target, targetLen)) {
+        int frames = (int)std::min<size_t>(targetLen / 2, 8192);
+        if (info.Length() > 1 && info[1].IsNumber()) {
+            frames = std::min(frames, info[1].As<Napi::Number>().Int32Value());
+        }
+        int written = (g_engine && frames > 0) ? g_engine->fillPCMData(target, frames) : 0;
+        return Napi::Number::New(env, written);
+    }
+
+    int frames = 1024;
+    if (info.Length() > 0 && info[0].IsNumber()) {
+        frames = info[0].As<Napi::Number>().Int32Value();
+    }
+    if (frames < 64) frames = 64;
+    if (frames > 8192) frames = 8192;
+
+    Napi::Object result = Napi::Object::New(env);
+
+    if (!g_engine) {
+        result.Set("channels", Napi::Number::New(env, 0));
+        result.Set("data", Napi::Float32Array::New(env, 0));
+        return result;
+    }
+
+    int channels = 0;
+    auto pcm = g_engine->getPCMData(frames, &channels);
+    if (pcm.empty() || channels <= 0) {
+        result.Set("channels", Napi::Number::New(env, 0));
+        result.Set("data", Napi::Float32Array::New(env, 0));
+        return result;
+    }
+
+    const size_t byteLen = pcm.size() * sizeof(float);
+    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, byteLen);
+    std::memcpy(buffer.Data(), pcm.data(), byteLen);
+    Napi::Float32Array arr = Napi::Float32Array::New(env, pcm.size(), buffer, 0);
+
+    result.Set("channels", Napi::Number::New(env, channels));
+    result.Set("data", arr);
+    return result;
+}
+
+// getSpectrumBands(numBands)      -> number[] (legacy)
+// getSpectrumBands(Float32Array)  -> yazılan bant sayısı (bant sayısı = dizi uzunluğu)
+Napi::Value GetSpectrumBands(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    float* target = nullptr;
+    size_t targetLen = 0;
+    if (info.Length() > 0 && GetFloatTarget(info[0], target, targetLen)) {
+        int numBands = (int)std::min<size_t>(targetLen, 1024);
+        int written = g_engine ? g_engine->fillSpectrumBands(target, numBands) : 0;
+        return Napi::Number::New(env, written);
+    }
+    
+    int numBands = 64;
+    if (info.Length() > 0 && info[0].IsNumber()) {
+        numBands = info[0].As<Napi::Number>().Int32Value();
+    }
+    
+    if (!g_engine) {
+        return Napi::Array::New(env, 0);
+    }
+    
+    auto bands = g_engine->getSpectrumBands(numBands);
+    Napi::Array result = Napi::Array::New(env, bands.size());
+    for (size_t i = 0; i < bands.size(); ++i) {
+        result.Set(i, Napi::Number::New(env, bands[i]));
+    }
+    return result;
+}
+
+// ============================================
+// KALICI ANALİZ BUFFER'I (JS bir kez map eder)
+// ============================================
+// Electron, external ArrayBuffer'lara izin vermediği için buffer V8 tarafında
+// bir kez ayrılır ve referansla tutulur; updateAnalysisBuffer() yerinde doldurur.
+// Düzen (Float32): [0]=seq [1]=channels [2]=pcmFrames [3]=fftBins [4]=numBands
+//                  [5]=sampleRate [6..7]=rezerv | PCM (frames*2) | FFT (1024) | bands
+static const int ANALYSIS_BUFFER_HEADER = 8;
+// (Pointer olarak tutulur: statik yıkım sırasında env'e dokunmasın)
+static Napi::Reference<Napi::ArrayBuffer>* g_analysisBufferRef = nullptr;
+static int g_analysisBufferFrames = 0;
+static int g_analysisBufferBands = 0;
+static uint32_t g_analysisBufferSeq = 0;
+
+Napi::Value CreateAnalysisBuffer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    int frames = 1024;
+    int bands = 64;
+    if (info.Length() > 0 && info[0].IsNumber()) frames = info[0].As<Napi::Number>().Int32Value();
+    if (info.Length() > 1 && info[1].IsNumber()) bands = info[1].As<Napi::Number>().Int32Value();
+    frames = std::max(64, std::min(frames, 8192));
+    bands = std::max(1, std::min(bands, 1024));
+
+    const size_t floats = ANALYSIS_BUFFER_HEADER + (size_t)frames * 2 + FFT_SIZE / 2 + (size_t)bands;
+    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, floats * sizeof(float));
+    std::memset(buffer.Data(), 0, floats * sizeof(float));
+
+    delete g_analysisBufferRef;
+    g_analysisBufferRef = new Napi::Reference<Napi::ArrayBuffer>(Napi::Persistent(buffer));
+    g_analysisBufferFrames = frames;
+    g_analysisBufferBands = bands;
+    g_analysisBufferSeq = 0;
+
+    float* header = static_cast<float*>(buffer.Data());
+    header[2] = (float)frames;
+    header[3] = (float)(FFT_SIZE / 2);
+    header[4] = (float)bands;
+
+    return Napi::Float32Array::New(env, floats, buffer, 0);
+}
+
+// Kalıcı buffer'ı doldurur, yeni sequence numarasını döner (buffer yoksa -1)
+Napi::Value UpdateAnalysisBuffer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_analysisBufferRef || g_analysisBufferRef->IsEmpty()) {
+        return Napi::Number::New(env, -1);
+    }
+
+    Napi::ArrayBuffer buffer = g_analysisBufferRef->Value();
+    float* base = static_cast<float*>(buffer.Data());
+    if (!base) {
+        return Napi::Number::New(env, -1);
+    }
+
+    float* pcm = base + ANALYSIS_BUFFER_HEADER;
+    float* fft = pcm + (size_t)g_analysisBufferFrames * 2;
+    float* bands = fft + FFT_SIZE / 2;
+
+    int pcmFrames = 0;
+    int fftBins = 0;
+    int numBands = 0;
+    int sampleRate = FALLBACK_SAMPLE_RATE;
+    if (g_engine) {
+        pcmFrames = g_engine->fillPCMData(pcm, g_analysisBufferFrames);
+        fftBins = g_engine->fillFFTData(fft, FFT_SIZE / 2);
+        numBands = g_engine->fillSpectrumBands(bands, g_analysisBufferBands);
+        sampleRate = g_engine->getAnalysisSampleRate();
+    }
+
+    ++g_analysisBufferSeq;
+    base[0] = (float)g_analysisBufferSeq;
+    base[1] = (pcmFrames > 0) ? 2.0f : 0.0f;
+    base[2] = (float)pcmFrames;
+    base[3] = (float)fftBins;
+    base[4] = (float)numBands;
+    base[5] = (float)sampleRate;
+
+    return Napi::Number::New(env, (double)g_analysisBufferSeq);
+}
+
+Napi::Value ReleaseAnalysisBuffer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    delete g_analysisBufferRef;
+    g_analysisBufferRef = nullptr;
+    g_analysisBufferFrames = 0;
+    g_analysisBufferBands = 0;
+    return env.Undefined();
+}
+
+// ============================================
+// NATIVE VISUALIZER FEEDER NAPI
+// ============================================
+// attachVisualizerFd(fd, framesPerPacket) -> boolean (false: JS pompasına dön)
+Napi::Value AttachVisualizerFd(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsNumber()) {
+        return Napi::Boolean::New(env, false);
+    }
+    int fd = info[0].As<Napi::Number>().Int32Value();
     int frames = 1024;
-    if (info.Length() > 0 && info[0].IsNumber()) {
-        frames = info[0].As<Napi::Number>().Int32Value();
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        frames = info[1].As<Napi::Number>().Int32Value();
     }
-    if (frames < 64) frames = 64;
-    if (frames > 8192) frames = 8192;
+    return Napi::Boolean::New(env, g_visualizerFeeder.start(g_engine, fd, frames));
+}
+
+Napi::Value DetachVisualizerFd(const Napi::CallbackInfo& info) {
+    g_visualizerFeeder.stop();
+    return info.Env().Undefined();
+}
 
+Napi::Value GetVisualizerFeedStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    auto stats = g_visualizerFeeder.getStats();
     Napi::Object result = Napi::Object::New(env);
+    result.Set("running", Napi::Boolean::New(env, stats.running));
+    result.Set("fd", Napi::Number::New(env, stats.fd));
+    result.Set("framesPerPacket", Napi::Number::New(env, stats.framesPerPacket));
+    result.Set("packets", Napi::Number::New(env, (double)stats.packets));
+    result.Set("bytes", Napi::Number::New(env, (double)stats.bytes));
+    result.Set("drops", Napi::Number::New(env, (double)stats.drops));
+    result.Set("backpressure", Napi::Number::New(env, (double)stats.backpressure));
+    result.Set("noData", Napi::Number::New(env, (double)stats.noData));
+    return result;
+}
 
+// ============================================
+// VISUALIZER PAYLAŞIMLI BELLEK NAPI
+// ============================================
+// createVisualizerShm(capacityFrames?) -> string | null
+// Dönen isim visualizer'a `--pcm-shm <isim>` olarak verilir.
+Napi::Value CreateVisualizerShm(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
     if (!g_engine) {
-        result.Set("channels", Napi::Number::New(env, 0));
-        result.Set("data", Napi::Float32Array::New(env, 0));
-        return result;
+        return env.Null();
+    }
+    uint32_t capacityFrames = 1u << 15;
+    if (info.Length() > 0 && info[0].IsNumber()) {
+        int requested = info[0].As<Napi::Number>().Int32Value();
+        if (requested > 0) capacityFrames = (uint32_t)requested;
     }
 
-    int channels = 0;
-    auto pcm = g_engine->getPCMData(frames, &channels);
-    if (pcm.empty() || channels <= 0) {
-        result.Set("channels", Napi::Number::New(env, 0));
-        result.Set("data", Napi::Float32Array::New(env, 0));
-        return result;
+    std::string name = g_pcmShmRing.create(capacityFrames, g_engine->getAnalysisSampleRate());
+    if (name.empty()) {
+        return env.Null();
     }
 
-    const size_t byteLen = pcm.size() * sizeof(float);
-    Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, byteLen);
-    std::memcpy(buffer.Data(), pcm.data(), byteLen);
-    Napi::Float32Array arr = Napi::Float32Array::New(env, pcm.size(), buffer, 0);
+    // DSP callback çalma buffer'ını önden doldurur: BASS buffer + cihaz gecikmesi kadar geriden oku
+    g_pcmShmRing.setLatencyMs(g_engine->outputLatencyMs());
 
-    result.Set("channels", Napi::Number::New(env, channels));
-    result.Set("data", arr);
-    return result;
+    return Napi::String::New(env, name);
 }
 
-Napi::Value GetSpectrumBands(const Napi::CallbackInfo& info) {
+Napi::Value CloseVisualizerShm(const Napi::CallbackInfo& info) {
+    g_pcmShmRing.close();
+    return info.Env().Undefined();
+}
+
+Napi::Value GetVisualizerShmStats(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    
-    int numBands = 64;
-    if (info.Length() > 0 && info[0].IsNumber()) {
-        numBands = info[0].As<Napi::Number>().Int32Value();
-    }
-    
-    if (!g_engine) {
-        return Napi::Array::New(env, 0);
-    }
-    
-    auto bands = g_engine->getSpectrumBands(numBands);
-    Napi::Array result = Napi::Array::New(env, bands.size());
-    for (size_t i = 0; i < bands.size(); ++i) {
-        result.Set(i, Napi::Number::New(env, bands[i]));
-    }
+    auto stats = g_pcmShmRing.getStats();
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("open", Napi::Boolean::New(env, stats.open));
+    result.Set("name", stats.open ? Napi::String::New(env, stats.name) : env.Null());
+    result.Set("capacityFrames", Napi::Number::New(env, stats.capacityFrames));
+    result.Set("latencyFrames", Napi::Number::New(env, stats.latencyFrames));
+    result.Set("writeFrames", Napi::Number::New(env, (double)stats.writeFrames));
+    result.Set("sequence", Napi::Number::New(env, (double)stats.sequence));
+    result.Set("consumerAttached", Napi::Boolean::New(env, stats.consumerAttached));
     return result;
 }
 
@@ -4160,6 +12096,53 @@ Napi::Value GetChannelLevels(const Napi::CallbackInfo& info) {
     return result;
 }
 
+// Engine stats (açık decoder sayısı vb.)
+Napi::Value GetEngineStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Object result = Napi::Object::New(env);
+
+    if (!g_engine) {
+        result.Set("openDecoders", Napi::Number::New(env, g_openDecoders.load()));
+        result.Set("analysisDecoders", Napi::Number::New(env, 0));
+        result.Set("analysisDecoderEnabled", Napi::Boolean::New(env, false));
+        result.Set("analysisTapActive", Napi::Boolean::New(env, false));
+        result.Set("busMode", Napi::Boolean::New(env, false));
+        return result;
+    }
+
+    auto stats = g_engine->getEngineStats();
+    result.Set("openDecoders", Napi::Number::New(env, stats.openDecoders));
+    result.Set("analysisDecoders", Napi::Number::New(env, stats.analysisDecoders));
+    result.Set("analysisDecoderEnabled", Napi::Boolean::New(env, stats.analysisDecoderEnabled));
+    result.Set("analysisTapActive", Napi::Boolean::New(env, stats.analysisTapActive));
+    result.Set("busMode", Napi::Boolean::New(env, stats.busMode));
+    return result;
+}
+
+Napi::Value SetAnalysisDecoderEnabled(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsBoolean()) {
+        return Napi::Boolean::New(env, false);
+    }
+    g_engine->setAnalysisDecoderEnabled(info[0].As<Napi::Boolean>().Value());
+    return Napi::Boolean::New(env, true);
+}
+
+// Master-bus modu: FX zinciri crossfade toplamında bir kez çalışır
+Napi::Value SetBusMode(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsBoolean()) {
+        return Napi::Boolean::New(env, false);
+    }
+    g_engine->setBusMode(info[0].As<Napi::Boolean>().Value());
+    return Napi::Boolean::New(env, true);
+}
+
+Napi::Value GetBusMode(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    return Napi::Boolean::New(env, g_engine && g_engine->isBusMode());
+}
+
 // ============================================
 // DSP ENABLE/DISABLE NAPI WRAPPERS
 // ============================================
@@ -5025,6 +13008,62 @@ Napi::Value ResetStereoWidener(const Napi::CallbackInfo& info) {
     return Napi::Boolean::New(env, true);
 }
 
+// ============================================
+// KORELASYON / GONİOMETRE NAPI
+// ============================================
+Napi::Value SetCorrelationWindow(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
+    g_engine->setCorrelationWindow(info[0].As<Napi::Number>().Int32Value());
+    return Napi::Boolean::New(env, true);
+}
+
+Napi::Value GetCorrelation(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    StereoAnalyzer::Correlation c;
+    if (!g_engine || !g_engine->getCorrelation(c)) return env.Null();
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("correlation", Napi::Number::New(env, c.correlation));
+    result.Set("minimum", Napi::Number::New(env, c.minimum));
+    result.Set("balance", Napi::Number::New(env, c.balance));
+    result.Set("width", Napi::Number::New(env, c.width));
+    result.Set("midLevel", Napi::Number::New(env, c.midLevel));
+    result.Set("sideLevel", Napi::Number::New(env, c.sideLevel));
+    result.Set("windowMs", Napi::Number::New(env, c.windowMs));
+    result.Set("live", Napi::Boolean::New(env, c.live));
+    return result;
+}
+
+// setGoniometer(enabled, decimation?) - kapalıyken audio thread nokta yazmaz
+Napi::Value SetGoniometer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine || info.Length() < 1) return Napi::Boolean::New(env, false);
+    const bool enabled = info[0].ToBoolean().Value();
+    const int decimation = (info.Length() > 1 && info[1].IsNumber()) ? info[1].As<Napi::Number>().Int32Value() : 4;
+    g_engine->setGoniometer(enabled, decimation);
+    return Napi::Boolean::New(env, true);
+}
+
+// readGoniometer(Float32Array?) -> Float32Array [m, s, m, s, ...]
+// Hedef verilirse yerinde doldurulur ve yazılan nokta sayısı döner.
+Napi::Value ReadGoniometer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (!g_engine) return env.Null();
+
+    float* data = nullptr;
+    size_t length = 0;
+    if (info.Length() > 0 && GetFloatTarget(info[0], data, length)) {
+        return Napi::Number::New(env, g_engine->readGoniometer(data, (int)(length / 2)));
+    }
+
+    static const int DEFAULT_POINTS = 4096;
+    std::vector<float> points((size_t)DEFAULT_POINTS * 2);
+    const int count = g_engine->readGoniometer(points.data(), DEFAULT_POINTS);
+    Napi::Float32Array out = Napi::Float32Array::New(env, (size_t)count * 2);
+    if (count > 0) std::memcpy(out.Data(), points.data(), (size_t)count * 2 * sizeof(float));
+    return out;
+}
+
 // ============================================
 // ECHO N-API WRAPPERS
 // ============================================
@@ -5272,6 +13311,7 @@ Napi::Value GetIRPresets(const Napi::CallbackInfo& info) {
     for (int i = 0; i < 8; i++) {
         Napi::Object presetObj = Napi::Object::New(env);
         presetObj.Set("name", Napi::String::New(env, IR_PRESETS[i].name));
+        presetObj.Set("ir", Napi::String::New(env, std::string(BUILTIN_IR_PREFIX) + IR_PRESETS[i].id));
         presetObj.Set("roomSize", Napi::Number::New(env, IR_PRESETS[i].roomSize));
         presetObj.Set("decay", Napi::Number::New(env, IR_PRESETS[i].decay));
         presetObj.Set("damping", Napi::Number::New(env, IR_PRESETS[i].damping));
@@ -5282,6 +13322,28 @@ Napi::Value GetIRPresets(const Napi::CallbackInfo& info) {
     return presetArray;
 }
 
+Napi::Value GetConvolutionInfo(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::Object result = Napi::Object::New(env);
+    if (!g_engine) return result;
+
+    const AurivoAudioEngine::ConvolutionInfo conv = g_engine->getConvolutionInfo();
+    const ConvolutionReverb::Info& k = conv.kernel;
+    result.Set("enabled", Napi::Boolean::New(env, conv.enabled));
+    result.Set("source", Napi::String::New(env, conv.source));
+    result.Set("loaded", Napi::Boolean::New(env, k.loaded));
+    result.Set("irSeconds", Napi::Number::New(env, k.rate ? (double)k.irFrames / k.rate : 0.0));
+    result.Set("sampleRate", Napi::Number::New(env, k.rate));
+    result.Set("headPartitions", Napi::Number::New(env, k.headParts));
+    result.Set("tailPartitions", Napi::Number::New(env, k.tailParts));
+    result.Set("headBlock", Napi::Number::New(env, ConvolutionReverb::HEAD_BLOCK));
+    result.Set("tailBlock", Napi::Number::New(env, ConvolutionReverb::TAIL_BLOCK));
+    result.Set("latencyMs", Napi::Number::New(env, conv.latencyMs));
+    result.Set("tailMisses", Napi::Number::New(env, (double)k.tailMisses));
+    result.Set("resyncs", Napi::Number::New(env, (double)k.resyncs));
+    return result;
+}
+
 Napi::Value ResetConvolutionReverb(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (g_engine) {
@@ -5297,12 +13359,9 @@ Napi::Value ResetConvolutionReverb(const Napi::CallbackInfo& info) {
 // Crossfeed artık DSP callback'te işleniyor, FX kullanmıyoruz
 // Bu fonksiyon sadece debug log için kalıyor
 void ApplyCrossfeedParams() {
-    printf("[CROSSFEED] Parametreler güncellendi:\n");
-    printf("  Level: %.0f%%\n", g_crossfeed.crossfeedLevel);
-    printf("  Delay: %.2f ms\n", g_crossfeed.delay);
-    printf("  LowCut: %.0f Hz\n", g_crossfeed.lowCut);
-    printf("  HighCut: %.0f Hz\n", g_crossfeed.highCut);
-    printf("  Enabled: %s\n", g_crossfeed.enabled ? "true" : "false");
+    AURIVO_LOG_DEBUG("[CROSSFEED] Parametreler güncellendi: Level=%.0f%%, Delay=%.2f ms, LowCut=%.0f Hz, HighCut=%.0f Hz, Enabled=%s",
+                     g_crossfeed.crossfeedLevel, g_crossfeed.delay, g_crossfeed.lowCut, g_crossfeed.highCut,
+                     g_crossfeed.enabled ? "true" : "false");
 }
 
 Napi::Value EnableCrossfeed(const Napi::CallbackInfo& info) {
@@ -5316,15 +13375,8 @@ Napi::Value EnableCrossfeed(const Napi::CallbackInfo& info) {
     
     g_crossfeed.enabled = enable;
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        void* dsp = g_engine->getAurivoDSP();
-        set_crossfeed_params(dsp, enable ? 1 : 0, 
-                            g_crossfeed.crossfeedLevel, 
-                            g_crossfeed.delay, 
-                             g_crossfeed.lowCut, 
-                            g_crossfeed.highCut);
-        printf("[CROSSFEED] %s (integrated DSP)\n", enable ? "Etkinleştirildi" : "Devre dışı");
-    }
+    publishCrossfeedParams();
+    AURIVO_LOG_INFO("[CROSSFEED] %s (integrated DSP)", enable ? "Etkinleştirildi" : "Devre dışı");
     
     return Napi::Boolean::New(env, true);
 }
@@ -5339,16 +13391,9 @@ Napi::Value SetCrossfeedLevel(const Napi::CallbackInfo& info) {
     float level = info[0].As<Napi::Number>().FloatValue();
     g_crossfeed.crossfeedLevel = clampf(level, 0.0f, 100.0f);
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        void* dsp = g_engine->getAurivoDSP();
-        set_crossfeed_params(dsp, g_crossfeed.enabled ? 1 : 0, 
-                            g_crossfeed.crossfeedLevel, 
-                            g_crossfeed.delay, 
-                            g_crossfeed.lowCut, 
-                            g_crossfeed.highCut);
-    }
+    publishCrossfeedParams();
     
-    printf("[CROSSFEED] Level: %.0f%%\n", g_crossfeed.crossfeedLevel);
+    AURIVO_LOG_DEBUG("[CROSSFEED] Level: %.0f%%", g_crossfeed.crossfeedLevel);
     
     return Napi::Boolean::New(env, true);
 }
@@ -5363,16 +13408,9 @@ Napi::Value SetCrossfeedDelay(const Napi::CallbackInfo& info) {
     float delay = info[0].As<Napi::Number>().FloatValue();
     g_crossfeed.delay = clampf(delay, 0.1f, 1.5f);
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        void* dsp = g_engine->getAurivoDSP();
-        set_crossfeed_params(dsp, g_crossfeed.enabled ? 1 : 0, 
-                            g_crossfeed.crossfeedLevel, 
-                            g_crossfeed.delay, 
-                            g_crossfeed.lowCut, 
-                            g_crossfeed.highCut);
-    }
+    publishCrossfeedParams();
     
-    printf("[CROSSFEED] Delay: %.2f ms\n", g_crossfeed.delay);
+    AURIVO_LOG_DEBUG("[CROSSFEED] Delay: %.2f ms", g_crossfeed.delay);
     
     return Napi::Boolean::New(env, true);
 }
@@ -5387,16 +13425,9 @@ Napi::Value SetCrossfeedLowCut(const Napi::CallbackInfo& info) {
     float lowCut = info[0].As<Napi::Number>().FloatValue();
     g_crossfeed.lowCut = clampf(lowCut, 200.0f, 2000.0f);
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        void* dsp = g_engine->getAurivoDSP();
-        set_crossfeed_params(dsp, g_crossfeed.enabled ? 1 : 0, 
-                            g_crossfeed.crossfeedLevel, 
-                            g_crossfeed.delay, 
-                            g_crossfeed.lowCut, 
-                            g_crossfeed.highCut);
-    }
+    publishCrossfeedParams();
     
-    printf("[CROSSFEED] Low cut: %.0f Hz\n", g_crossfeed.lowCut);
+    AURIVO_LOG_DEBUG("[CROSSFEED] Low cut: %.0f Hz", g_crossfeed.lowCut);
     
     return Napi::Boolean::New(env, true);
 }
@@ -5413,16 +13444,9 @@ Napi::Value SetCrossfeedHighCut(const Napi::CallbackInfo& info) {
     // Limit: 2 kHz ile 18 kHz
     g_crossfeed.highCut = clampf(highCut, 2000.0f, 18000.0f);
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        void* dsp = g_engine->getAurivoDSP();
-        set_crossfeed_params(dsp, g_crossfeed.enabled ? 1 : 0, 
-                            g_crossfeed.crossfeedLevel, 
-                            g_crossfeed.delay, 
-                            g_crossfeed.lowCut, 
-                            g_crossfeed.highCut);
-    }
+    publishCrossfeedParams();
     
-    printf("[CROSSFEED] High cut: %.0f Hz\n", g_crossfeed.highCut);
+    AURIVO_LOG_DEBUG("[CROSSFEED] High cut: %.0f Hz", g_crossfeed.highCut);
     
     return Napi::Boolean::New(env, true);
 }
@@ -5447,16 +13471,9 @@ Napi::Value SetCrossfeedPreset(const Napi::CallbackInfo& info) {
     g_crossfeed.lowCut = p.lowCut;
     g_crossfeed.highCut = p.highCut;
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        void* dsp = g_engine->getAurivoDSP();
-        set_crossfeed_params(dsp, g_crossfeed.enabled ? 1 : 0, 
-                            g_crossfeed.crossfeedLevel, 
-                            g_crossfeed.delay, 
-                            g_crossfeed.lowCut, 
-                            g_crossfeed.highCut);
-    }
+    publishCrossfeedParams();
     
-    printf("[CROSSFEED] Preset: %s\n", p.name);
+    AURIVO_LOG_INFO("[CROSSFEED] Preset: %s", p.name);
     
     return Napi::Boolean::New(env, true);
 }
@@ -5490,7 +13507,7 @@ Napi::Value ResetCrossfeed(const Napi::CallbackInfo& info) {
         ApplyCrossfeedParams();
     }
     
-    printf("[CROSSFEED] Varsayılan ayarlara döndürüldü\n");
+    AURIVO_LOG_INFO("[CROSSFEED] Varsayılan ayarlara döndürüldü");
     
     return Napi::Boolean::New(env, true);
 }
@@ -5506,11 +13523,8 @@ Napi::Value EnableBassMono(const Napi::CallbackInfo& info) {
     bool enable = info[0].As<Napi::Boolean>().Value();
     g_bassMono.enabled = enable;
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        set_bass_mono_params(g_engine->getAurivoDSP(), enable ? 1 : 0,
-                             g_bassMono.cutoff, g_bassMono.slope, g_bassMono.stereoWidth);
-        printf("[BASS MONO] %s\n", enable ? "Etkin" : "Devre dışı");
-    }
+    publishBassMonoParams();
+    AURIVO_LOG_INFO("[BASS MONO] %s", enable ? "Etkin" : "Devre dışı");
     return Napi::Boolean::New(env, true);
 }
 
@@ -5521,10 +13535,7 @@ Napi::Value SetBassMonoCutoff(const Napi::CallbackInfo& info) {
     float val = info[0].As<Napi::Number>().FloatValue();
     g_bassMono.cutoff = clampf(val, 20.0f, 500.0f);
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        set_bass_mono_params(g_engine->getAurivoDSP(), g_bassMono.enabled ? 1 : 0,
-                             g_bassMono.cutoff, g_bassMono.slope, g_bassMono.stereoWidth);
-    }
+    publishBassMonoParams();
     return Napi::Boolean::New(env, true);
 }
 
@@ -5538,10 +13549,7 @@ Napi::Value SetBassMonoSlope(const Napi::CallbackInfo& info) {
     else if (val <= 36.0f) g_bassMono.slope = 24.0f;
     else g_bassMono.slope = 48.0f;
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        set_bass_mono_params(g_engine->getAurivoDSP(), g_bassMono.enabled ? 1 : 0,
-                             g_bassMono.cutoff, g_bassMono.slope, g_bassMono.stereoWidth);
-    }
+    publishBassMonoParams();
     return Napi::Boolean::New(env, true);
 }
 
@@ -5552,10 +13560,7 @@ Napi::Value SetBassMonoStereoWidth(const Napi::CallbackInfo& info) {
     float val = info[0].As<Napi::Number>().FloatValue();
     g_bassMono.stereoWidth = clampf(val, 0.0f, 200.0f);
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        set_bass_mono_params(g_engine->getAurivoDSP(), g_bassMono.enabled ? 1 : 0,
-                             g_bassMono.cutoff, g_bassMono.slope, g_bassMono.stereoWidth);
-    }
+    publishBassMonoParams();
     return Napi::Boolean::New(env, true);
 }
 
@@ -5566,11 +13571,8 @@ Napi::Value ResetBassMono(const Napi::CallbackInfo& info) {
     g_bassMono.slope = 24.0f;
     g_bassMono.stereoWidth = 100.0f;
     
-    if (g_engine && g_engine->getAurivoDSP()) {
-        set_bass_mono_params(g_engine->getAurivoDSP(), g_bassMono.enabled ? 1 : 0,
-                             g_bassMono.cutoff, g_bassMono.slope, g_bassMono.stereoWidth);
-    }
-    printf("[BASS MONO] Sıfırlandı\n");
+    publishBassMonoParams();
+    AURIVO_LOG_INFO("[BASS MONO] Sıfırlandı");
     return Napi::Boolean::New(env, true);
 }
 
@@ -5578,89 +13580,9 @@ Napi::Value ResetBassMono(const Napi::CallbackInfo& info) {
 // DYNAMIC EQ FUNCTIONS
 // ============================================
 
-// TAPE SATURATION DSP CALLBACK
 // ============================================
-void CALLBACK TapeSat_DSP(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
-    float* s = (float*)buffer;
-    int n = (int)(length / sizeof(float));
-
-    float sr = g_tapeSatState.sr;
-
-    // Parametreler
-    float drive = dBToLinear(clampf(g_tapeSat.driveDb, 0.0f, 24.0f));
-    float mix = clampf(g_tapeSat.mix, 0.0f, 100.0f) / 100.0f;
-    float out = dBToLinear(clampf(g_tapeSat.outputDb, -12.0f, 12.0f));
-
-    // Tone: tape HF roll-off (6kHz to 16kHz)
-    float toneVal = clampf(g_tapeSat.tone, 0.0f, 100.0f);
-    float cutoff = 6000.0f + (toneVal / 100.0f) * (16000.0f - 6000.0f);
-    float a = onePoleAlphaTape(cutoff, sr);
-
-    // Mode character
-    float modeSoftness = 1.0f;
-    float evenHarm = 0.15f;
-    if (g_tapeSat.mode == 0) {        // Tape
-        modeSoftness = 1.0f;
-        evenHarm = 0.12f;
-    } else if (g_tapeSat.mode == 1) { // Warm
-        modeSoftness = 0.9f;
-        evenHarm = 0.18f;
-    } else {                           // Hot
-        modeSoftness = 0.75f;
-        evenHarm = 0.22f;
-    }
-
-    // Hiss
-    float hissAmt = clampf(g_tapeSat.hiss, 0.0f, 100.0f) / 100.0f;
-    float hissGain = hissAmt * 0.0008f; 
-
-    for (int i = 0; i < n; i += 2) {
-        float inL = s[i];
-        float inR = s[i + 1];
-
-        float dryL = inL;
-        float dryR = inR;
-
-        // Drive
-        float xL = inL * drive;
-        float xR = inR * drive;
-
-        // Soft saturation
-        float satL = fastTanh(xL * modeSoftness);
-        float satR = fastTanh(xR * modeSoftness);
-
-        // Even harmonics
-        satL += evenHarm * (xL * xL) * (xL >= 0 ? 1.0f : -1.0f) * 0.02f;
-        satR += evenHarm * (xR * xR) * (xR >= 0 ? 1.0f : -1.0f) * 0.02f;
-
-        // HF roll-off
-        g_tapeSatState.lpfL = g_tapeSatState.lpfL + a * (satL - g_tapeSatState.lpfL);
-        g_tapeSatState.lpfR = g_tapeSatState.lpfR + a * (satR - g_tapeSatState.lpfR);
-
-        float wetL = g_tapeSatState.lpfL;
-        float wetR = g_tapeSatState.lpfR;
-
-        if (hissGain > 0.0f) {
-            wetL += randFloatSigned(g_tapeSatState.rng) * hissGain;
-            wetR += randFloatSigned(g_tapeSatState.rng) * hissGain;
-        }
-
-        // Mix
-        float yL = dryL * (1.0f - mix) + wetL * mix;
-        float yR = dryR * (1.0f - mix) + wetR * mix;
-
-        // Output trim
-        yL *= out;
-        yR *= out;
-
-        if (yL > 1.0f) yL = 1.0f; else if (yL < -1.0f) yL = -1.0f;
-        if (yR > 1.0f) yR = 1.0f; else if (yR < -1.0f) yR = -1.0f;
-
-        s[i] = yL;
-        s[i + 1] = yR;
-    }
-}
-
+// TAPE SATURATION NAPI
+// ============================================
 Napi::Value EnableTapeSaturation(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsBoolean()) return Napi::Boolean::New(env, false);
@@ -5669,132 +13591,58 @@ Napi::Value EnableTapeSaturation(const Napi::CallbackInfo& info) {
     
     if (g_engine) {
         std::lock_guard<std::mutex> lock(g_engine->getMutex());
-        g_tapeSat.enabled = enable;
-        if (enable) g_engine->attachTapeSatIfNeeded();
-        else g_engine->detachTapeSat();
+        g_tapeSat.update([&](TapeSatParams& p) { p.enabled = enable; });
+        g_engine->refreshColorFxLocked();
     }
 
     return Napi::Boolean::New(env, true);
 }
 
-// BIT-DEPTH / DITHER DSP CALLBACK
-// ============================================
-void CALLBACK BitDither_DSP(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user) {
-    float* s = (float*)buffer;
-    int n = (int)(length / sizeof(float));
-
-    int bits = g_bitDither.bitDepth;
-    if (bits < 4) bits = 4;
-    if (bits > 24) bits = 24;
-
-    float mix = clampf(g_bitDither.mix, 0.0f, 100.0f) / 100.0f;
-    float out = dBToLinear(clampf(g_bitDither.outputDb, -12.0f, 12.0f));
-
-    int ds = g_bitDither.downsampleFactor;
-    if (ds != 1 && ds != 2 && ds != 4 && ds != 8 && ds != 16) ds = 1;
-
-    const int levels = 1 << (bits - 1);
-    float lsb = 1.0f / (float)levels;
-
-    for (int i = 0; i < n; i += 2) {
-        float inL = s[i];
-        float inR = s[i + 1];
-
-        // Downsample
-        float xL = inL;
-        float xR = inR;
-        if (ds > 1) {
-            if (g_bitDitherState.holdCounter <= 0) {
-                g_bitDitherState.holdCounter = ds;
-                g_bitDitherState.holdL = inL;
-                g_bitDitherState.holdR = inR;
-            }
-            g_bitDitherState.holdCounter--;
-            xL = g_bitDitherState.holdL;
-            xR = g_bitDitherState.holdR;
-        }
-
-        // Noise shaping
-        if (g_bitDither.shaping == SHAPE_LIGHT) {
-            xL = xL + 0.5f * g_bitDitherState.errL;
-            xR = xR + 0.5f * g_bitDitherState.errR;
-        }
-
-        // Dither
-        float dL = 0.0f, dR = 0.0f;
-        if (g_bitDither.dither == DITHER_RPDF) {
-            dL = randSigned(g_bitDitherState.rng) * 0.5f * lsb;
-            dR = randSigned(g_bitDitherState.rng) * 0.5f * lsb;
-        } else if (g_bitDither.dither == DITHER_TPDF) {
-            dL = (rand01(g_bitDitherState.rng) - rand01(g_bitDitherState.rng)) * lsb;
-            dR = (rand01(g_bitDitherState.rng) - rand01(g_bitDitherState.rng)) * lsb;
-        }
-
-        float yL = xL + dL;
-        float yR = xR + dR;
-
-        // Quantize
-        float qL = quantize(yL, bits);
-        float qR = quantize(yR, bits);
-
-        g_bitDitherState.errL = yL - qL;
-        g_bitDitherState.errR = yR - qR;
-
-        // Mix
-        float outL = inL * (1.0f - mix) + qL * mix;
-        float outR = inR * (1.0f - mix) + qR * mix;
-
-        // Trim & Clamp
-        outL *= out;
-        outR *= out;
-
-        if (outL > 1.0f) outL = 1.0f; else if (outL < -1.0f) outL = -1.0f;
-        if (outR > 1.0f) outR = 1.0f; else if (outR < -1.0f) outR = -1.0f;
-
-        s[i] = outL;
-        s[i + 1] = outR;
-    }
-}
-// ============================================
 Napi::Value SetTapeDrive(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_tapeSat.driveDb = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 24.0f);
+    const auto value = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 24.0f);
+    g_tapeSat.update([&](TapeSatParams& p) { p.driveDb = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetTapeMix(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_tapeSat.mix = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 100.0f);
+    const auto value = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 100.0f);
+    g_tapeSat.update([&](TapeSatParams& p) { p.mix = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetTapeTone(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_tapeSat.tone = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 100.0f);
+    const auto value = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 100.0f);
+    g_tapeSat.update([&](TapeSatParams& p) { p.tone = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetTapeOutput(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_tapeSat.outputDb = clampf(info[0].As<Napi::Number>().FloatValue(), -12.0f, 12.0f);
+    const auto value = clampf(info[0].As<Napi::Number>().FloatValue(), -12.0f, 12.0f);
+    g_tapeSat.update([&](TapeSatParams& p) { p.outputDb = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetTapeMode(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_tapeSat.mode = (int)clampf(info[0].As<Napi::Number>().FloatValue(), 0, 2);
+    const auto value = (int)clampf(info[0].As<Napi::Number>().FloatValue(), 0, 2);
+    g_tapeSat.update([&](TapeSatParams& p) { p.mode = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetTapeHiss(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_tapeSat.hiss = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 100.0f);
+    const auto value = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 100.0f);
+    g_tapeSat.update([&](TapeSatParams& p) { p.hiss = value; });
     return Napi::Boolean::New(env, true);
 }
 
@@ -5806,9 +13654,8 @@ Napi::Value EnableBitDepthDither(const Napi::CallbackInfo& info) {
     bool enable = info[0].As<Napi::Boolean>().Value();
     if (g_engine) {
         std::lock_guard<std::mutex> lock(g_engine->getMutex());
-        g_bitDither.enabled = enable;
-        if (enable) g_engine->attachBitDitherIfNeeded();
-        else g_engine->detachBitDither();
+        g_bitDither.update([&](BitDitherParams& p) { p.enabled = enable; });
+        g_engine->refreshColorFxLocked();
     }
     return Napi::Boolean::New(env, true);
 }
@@ -5816,42 +13663,48 @@ Napi::Value EnableBitDepthDither(const Napi::CallbackInfo& info) {
 Napi::Value SetBitDepth(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_bitDither.bitDepth = (int)clampf(info[0].As<Napi::Number>().FloatValue(), 4, 24);
+    const auto value = (int)clampf(info[0].As<Napi::Number>().FloatValue(), 4, 24);
+    g_bitDither.update([&](BitDitherParams& p) { p.bitDepth = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetDitherType(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_bitDither.dither = (DitherType)(int)clampf(info[0].As<Napi::Number>().FloatValue(), 0, 2);
+    const auto value = (DitherType)(int)clampf(info[0].As<Napi::Number>().FloatValue(), 0, 2);
+    g_bitDither.update([&](BitDitherParams& p) { p.dither = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetNoiseShaping(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_bitDither.shaping = (NoiseShape)(int)clampf(info[0].As<Napi::Number>().FloatValue(), 0, 1);
+    const auto value = (NoiseShape)(int)clampf(info[0].As<Napi::Number>().FloatValue(), 0, 1);
+    g_bitDither.update([&](BitDitherParams& p) { p.shaping = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetDownsampleFactor(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_bitDither.downsampleFactor = (int)info[0].As<Napi::Number>().FloatValue();
+    const auto value = (int)info[0].As<Napi::Number>().FloatValue();
+    g_bitDither.update([&](BitDitherParams& p) { p.downsampleFactor = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetBitDitherMix(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_bitDither.mix = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 100.0f);
+    const auto value = clampf(info[0].As<Napi::Number>().FloatValue(), 0.0f, 100.0f);
+    g_bitDither.update([&](BitDitherParams& p) { p.mix = value; });
     return Napi::Boolean::New(env, true);
 }
 
 Napi::Value SetBitDitherOutput(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
-    g_bitDither.outputDb = clampf(info[0].As<Napi::Number>().FloatValue(), -12.0f, 12.0f);
+    const auto value = clampf(info[0].As<Napi::Number>().FloatValue(), -12.0f, 12.0f);
+    g_bitDither.update([&](BitDitherParams& p) { p.outputDb = value; });
     return Napi::Boolean::New(env, true);
 }
 
@@ -5859,33 +13712,27 @@ Napi::Value ResetBitDepthDither(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (g_engine) {
         std::lock_guard<std::mutex> lock(g_engine->getMutex());
-        g_bitDither.bitDepth = 16;
-        g_bitDither.dither = DITHER_TPDF;
-        g_bitDither.shaping = SHAPE_OFF;
-        g_bitDither.downsampleFactor = 1;
-        g_bitDither.mix = 100.0f;
-        g_bitDither.outputDb = 0.0f;
-        g_bitDitherState.holdCounter = 0;
-        g_bitDitherState.holdL = g_bitDitherState.holdR = 0.0f;
-        g_bitDitherState.errL = g_bitDitherState.errR = 0.0f;
+        g_bitDither.update([](BitDitherParams& p) {
+            p.bitDepth = 16;
+            p.dither = DITHER_TPDF;
+            p.shaping = SHAPE_OFF;
+            p.downsampleFactor = 1;
+            p.mix = 100.0f;
+            p.outputDb = 0.0f;
+        });
+        g_bitDitherReset.fetch_add(1, std::memory_order_release);
     }
     return Napi::Boolean::New(env, true);
 }
 
 void UpdateDynamicEQOnDSP() {
-    if (g_engine && g_engine->getAurivoDSP()) {
-        printf("[AUDIO] UpdateDynamicEQ: en=%d, f=%.1f, q=%.1f, thr=%.1f, g=%.1f\n",
-               g_dynamicEq.enabled, g_dynamicEq.frequency, g_dynamicEq.q, g_dynamicEq.threshold, g_dynamicEq.targetGain);
-        set_dynamic_eq_params(g_engine->getAurivoDSP(), 
-                              g_dynamicEq.enabled ? 1 : 0,
-                              g_dynamicEq.frequency, 
-                              g_dynamicEq.q, 
-                              g_dynamicEq.threshold, 
-                              g_dynamicEq.targetGain, 
-                              g_dynamicEq.range, 
-                              g_dynamicEq.attackMs, 
-                              g_dynamicEq.releaseMs);
-    }
+    AURIVO_LOG_DEBUG("[AUDIO] UpdateDynamicEQ: en=%d, f=%.1f, q=%.1f, thr=%.1f, g=%.1f",
+           g_dynamicEq.enabled, g_dynamicEq.frequency, g_dynamicEq.q, g_dynamicEq.threshold, g_dynamicEq.targetGain);
+    publishMasterDsp([](MasterDspParams& p) {
+        p.dynamicEq.assign(g_dynamicEq.enabled, {g_dynamicEq.frequency, g_dynamicEq.q, g_dynamicEq.threshold,
+                                                 g_dynamicEq.targetGain, g_dynamicEq.range,
+                                                 g_dynamicEq.attackMs, g_dynamicEq.releaseMs});
+    });
 }
 
 Napi::Value EnableDynamicEQ(const Napi::CallbackInfo& info) {
@@ -5893,7 +13740,7 @@ Napi::Value EnableDynamicEQ(const Napi::CallbackInfo& info) {
     if (info.Length() < 1 || !info[0].IsBoolean()) return Napi::Boolean::New(env, false);
     g_dynamicEq.enabled = info[0].As<Napi::Boolean>().Value();
     UpdateDynamicEQOnDSP();
-    printf("[DYNAMIC EQ] %s\n", g_dynamicEq.enabled ? "Etkin" : "Devre dışı");
+    AURIVO_LOG_INFO("[DYNAMIC EQ] %s", g_dynamicEq.enabled ? "Etkin" : "Devre dışı");
     return Napi::Boolean::New(env, true);
 }
 
@@ -5909,7 +13756,7 @@ Napi::Value SetDynamicEQGain(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
     float val = info[0].As<Napi::Number>().FloatValue();
-    printf("[NAPI] SetGain: %.1f\n", val);
+    AURIVO_LOG_DEBUG("[NAPI] SetGain: %.1f", val);
     g_dynamicEq.targetGain = clampf(val, -24.0f, 24.0f);
     UpdateDynamicEQOnDSP();
     return Napi::Boolean::New(env, true);
@@ -5927,7 +13774,7 @@ Napi::Value SetDynamicEQThreshold(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     if (info.Length() < 1 || !info[0].IsNumber()) return Napi::Boolean::New(env, false);
     float val = info[0].As<Napi::Number>().FloatValue();
-    printf("[NAPI] SetThreshold: %.1f\n", val);
+    AURIVO_LOG_DEBUG("[NAPI] SetThreshold: %.1f", val);
     g_dynamicEq.threshold = clampf(val, -80.0f, 0.0f);
     UpdateDynamicEQOnDSP();
     return Napi::Boolean::New(env, true);
@@ -5961,12 +13808,27 @@ Napi::Value SetDynamicEQRange(const Napi::CallbackInfo& info) {
 // MODULE INITIALIZATION
 // ============================================
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    // Native loglar arka plan thread'inde yazılır; ortam kapanırken kuyruk boşaltılır
+    AurivoLog::start();
+    napi_add_env_cleanup_hook(env, [](void*) { AurivoLog::stop(); }, nullptr);
+
     // Core functions
     exports.Set("initAudio", Napi::Function::New(env, InitAudio));
     exports.Set("initialize", Napi::Function::New(env, Initialize));  // Legacy
     exports.Set("cleanup", Napi::Function::New(env, Cleanup));
     exports.Set("loadFile", Napi::Function::New(env, LoadFile));
     exports.Set("crossfadeTo", Napi::Function::New(env, CrossfadeTo));
+    exports.Set("loadFileAsync", Napi::Function::New(env, LoadFileAsync));
+    exports.Set("crossfadeToAsync", Napi::Function::New(env, CrossfadeToAsync));
+    exports.Set("preloadNext", Napi::Function::New(env, PreloadNext));
+    exports.Set("cancelPreload", Napi::Function::New(env, CancelPreload));
+    exports.Set("playNext", Napi::Function::New(env, PlayNext));
+    exports.Set("getPreloadState", Napi::Function::New(env, GetPreloadState));
+    exports.Set("setCrossfadeCurve", Napi::Function::New(env, SetCrossfadeCurve));
+    exports.Set("getMixerStats", Napi::Function::New(env, GetMixerStats));
+    exports.Set("setLatencyProfile", Napi::Function::New(env, SetLatencyProfile));
+    exports.Set("getLatencyInfo", Napi::Function::New(env, GetLatencyInfo));
+    exports.Set("setBitTransparent", Napi::Function::New(env, SetBitTransparent));
     
     // Playback
     exports.Set("play", Napi::Function::New(env, Play));
@@ -5995,6 +13857,14 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("setEQBand", Napi::Function::New(env, SetEQBand));
     exports.Set("getEQBand", Napi::Function::New(env, GetEQBand));
     exports.Set("setEQBands", Napi::Function::New(env, SetEQBands));
+    exports.Set("applyParamBatch", Napi::Function::New(env, ApplyParamBatch));
+    exports.Set("paramIds", CreateParamIds(env));
+    exports.Set("getMeters", Napi::Function::New(env, GetMeters));
+    exports.Set("resetMeterCounters", Napi::Function::New(env, ResetMeterCounters));
+    exports.Set("getDspStats", Napi::Function::New(env, GetDspStats));
+    exports.Set("resetDspStats", Napi::Function::New(env, ResetDspStats));
+    exports.Set("setDspStatsOptions", Napi::Function::New(env, SetDspStatsOptions));
+    exports.Set("meterFields", CreateMeterFields(env));
     exports.Set("resetEQ", Napi::Function::New(env, ResetEQ));
     exports.Set("getEQFrequencies", Napi::Function::New(env, GetEQFrequencies));
     
@@ -6009,13 +13879,22 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("setAutoGainAttack", Napi::Function::New(env, SetAutoGainAttack));
     exports.Set("setAutoGainRelease", Napi::Function::New(env, SetAutoGainRelease));
     exports.Set("setAutoGainMode", Napi::Function::New(env, SetAutoGainMode));
-    exports.Set("updateAutoGain", Napi::Function::New(env, UpdateAutoGain));
     exports.Set("normalizeAudio", Napi::Function::New(env, NormalizeAudio));
     exports.Set("resetAutoGain", Napi::Function::New(env, ResetAutoGain));
     exports.Set("getAutoGainStats", Napi::Function::New(env, GetAutoGainStats));
     exports.Set("getPeakLevel", Napi::Function::New(env, GetPeakLevel));
     exports.Set("getRmsLevel", Napi::Function::New(env, GetRmsLevel));
     exports.Set("getAutoGainReduction", Napi::Function::New(env, GetAutoGainReduction));
+    exports.Set("getLoudness", Napi::Function::New(env, GetLoudness));
+    exports.Set("scanLoudness", Napi::Function::New(env, ScanLoudness));
+    exports.Set("cancelLoudnessScan", Napi::Function::New(env, CancelLoudnessScan));
+    exports.Set("setReplayGain", Napi::Function::New(env, SetReplayGain));
+    exports.Set("getReplayGainInfo", Napi::Function::New(env, GetReplayGainInfo));
+    exports.Set("setCacheDirectory", Napi::Function::New(env, SetCacheDirectory));
+    exports.Set("getWaveformOverview", Napi::Function::New(env, GetWaveformOverview));
+    exports.Set("renderFile", Napi::Function::New(env, RenderFile));
+    exports.Set("renderFiles", Napi::Function::New(env, RenderFiles));
+    exports.Set("cancelRender", Napi::Function::New(env, CancelRender));
     exports.Set("isClipping", Napi::Function::New(env, IsClipping));
     exports.Set("getClippingCount", Napi::Function::New(env, GetClippingCount));
     exports.Set("resetClippingCount", Napi::Function::New(env, ResetClippingCount));
@@ -6041,6 +13920,19 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("getPCMData", Napi::Function::New(env, GetPCMData));
     exports.Set("getSpectrumBands", Napi::Function::New(env, GetSpectrumBands));
     exports.Set("getChannelLevels", Napi::Function::New(env, GetChannelLevels));
+    exports.Set("createAnalysisBuffer", Napi::Function::New(env, CreateAnalysisBuffer));
+    exports.Set("updateAnalysisBuffer", Napi::Function::New(env, UpdateAnalysisBuffer));
+    exports.Set("releaseAnalysisBuffer", Napi::Function::New(env, ReleaseAnalysisBuffer));
+    exports.Set("attachVisualizerFd", Napi::Function::New(env, AttachVisualizerFd));
+    exports.Set("detachVisualizerFd", Napi::Function::New(env, DetachVisualizerFd));
+    exports.Set("getVisualizerFeedStats", Napi::Function::New(env, GetVisualizerFeedStats));
+    exports.Set("createVisualizerShm", Napi::Function::New(env, CreateVisualizerShm));
+    exports.Set("closeVisualizerShm", Napi::Function::New(env, CloseVisualizerShm));
+    exports.Set("getVisualizerShmStats", Napi::Function::New(env, GetVisualizerShmStats));
+    exports.Set("getEngineStats", Napi::Function::New(env, GetEngineStats));
+    exports.Set("setAnalysisDecoderEnabled", Napi::Function::New(env, SetAnalysisDecoderEnabled));
+    exports.Set("setBusMode", Napi::Function::New(env, SetBusMode));
+    exports.Set("getBusMode", Napi::Function::New(env, GetBusMode));
     
     // Balance Control
     exports.Set("setBalance", Napi::Function::New(env, SetBalance));
@@ -6165,6 +14057,10 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("SetStereoMonoLow", Napi::Function::New(env, SetStereoMonoLow));
     exports.Set("GetStereoPhase", Napi::Function::New(env, GetStereoPhase));
     exports.Set("ResetStereoWidener", Napi::Function::New(env, ResetStereoWidener));
+    exports.Set("setCorrelationWindow", Napi::Function::New(env, SetCorrelationWindow));
+    exports.Set("getCorrelation", Napi::Function::New(env, GetCorrelation));
+    exports.Set("setGoniometer", Napi::Function::New(env, SetGoniometer));
+    exports.Set("readGoniometer", Napi::Function::New(env, ReadGoniometer));
 
     // Echo individual controls
     exports.Set("EnableEchoEffect", Napi::Function::New(env, EnableEchoEffect));
@@ -6189,6 +14085,7 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("SetConvReverbPreDelay", Napi::Function::New(env, SetConvReverbPreDelay));
     exports.Set("SetConvReverbRoomType", Napi::Function::New(env, SetConvReverbRoomType));
     exports.Set("GetIRPresets", Napi::Function::New(env, GetIRPresets));
+    exports.Set("GetConvolutionInfo", Napi::Function::New(env, GetConvolutionInfo));
     exports.Set("ResetConvolutionReverb", Napi::Function::New(env, ResetConvolutionReverb));
 
     // Crossfeed (Headphone Enhancement)
@@ -6222,3 +14119,175 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
 }
 
 NODE_API_MODULE(aurivo_audio, Init)
+
+#elif !defined(AURIVO_NO_RENDER_MAIN) // AURIVO_RENDER_CLI
+
+// ============================================
+// KOMUT SATIRI RENDER ARACI (aurivo_render)
+// ============================================
+// Electron olmadan toplu dışa aktarım ve DSP performans ölçümü. MasterDSP
+// varsayılan ayarlarla (ya da verilen EQ/ton ile) kurulur, true-peak limiter
+// açıktır. Her dosya için gerçek zaman katsayısı yazdırılır.
+
+static void printRenderUsage() {
+    printf("Usage: aurivo_render [options] <input> <output.wav> [<input> <output.wav> ...]\n"
+           "  -j, --threads N       worker threads (default: cores - 1)\n"
+           "  --bits 16|24|32       output format (32 = float, default 24)\n"
+           "  --no-dither           disable TPDF dither on integer output\n"
+           "  --preamp dB           gain before the DSP chain\n"
+           "  --eq g1,g2,...        EQ band gains in dB (up to %d bands)\n"
+           "  --tone bass,mid,treble\n"
+           "  --width percent       stereo width (100 = unchanged)\n"
+           "  --ceiling dBTP        true-peak limiter ceiling (default -1.0)\n"
+           "  --no-limiter          disable the true-peak limiter\n"
+           "  --agc dBFS            auto gain towards a target level (RMS, last 3 s)\n"
+           "  --reverb IR           convolution reverb: IR file or builtin:<id> (e.g. builtin:concert-hall)\n"
+           "  --reverb-mix percent  reverb wet level (default 30)\n"
+           "  --no-dsp              bypass MasterDSP, AGC included (decode + limiter only)\n", NUM_EQ_BANDS);
+}
+
+// "a,b,c" -> en fazla maxCount değer
+static int parseFloatList(const char* text, float* out, int maxCount) {
+    int count = 0;
+    const char* p = text;
+    while (*p && count < maxCount) {
+        char* end = nullptr;
+        const float v = strtof(p, &end);
+        if (end == p) break;
+        out[count++] = v;
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return count;
+}
+
+static void loadRenderPlugins() {
+#ifdef _WIN32
+    static const char* plugins[] = { "bass_aac.dll", "bassflac.dll", "bassape.dll", "basswv.dll" };
+#elif defined(__APPLE__)
+    static const char* plugins[] = { "libbass_aac.dylib", "libbassflac.dylib", "libbassape.dylib", "libbasswv.dylib" };
+#else
+    static const char* plugins[] = { "libbass_aac.so", "libbassflac.so", "libbassape.so", "libbasswv.so" };
+#endif
+    for (const char* name : plugins) BASS_PluginLoad(name, 0);
+}
+
+int main(int argc, char** argv) {
+    OfflineRenderer::Options options;
+    OfflineRenderer::Chain chain;
+    chain.limiter.enabled = true;
+    chain.limiter.ceiling = -1.0f;
+
+    float eq[NUM_EQ_BANDS] = {};
+    float tone[3] = { 0.0f, 0.0f, 0.0f };
+    float width = 100.0f;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if ((arg == "-j" || arg == "--threads") && hasValue) {
+            options.threads = atoi(argv[++i]);
+        } else if (arg == "--bits" && hasValue) {
+            options.bitDepth = atoi(argv[++i]);
+        } else if (arg == "--no-dither") {
+            options.dither = false;
+        } else if (arg == "--preamp" && hasValue) {
+            chain.preampDb = clampf(strtof(argv[++i], nullptr), -24.0f, 24.0f);
+        } else if (arg == "--eq" && hasValue) {
+            parseFloatList(argv[++i], eq, NUM_EQ_BANDS);
+        } else if (arg == "--tone" && hasValue) {
+            parseFloatList(argv[++i], tone, 3);
+        } else if (arg == "--width" && hasValue) {
+            width = clampf(strtof(argv[++i], nullptr), 0.0f, 200.0f);
+        } else if (arg == "--ceiling" && hasValue) {
+            chain.limiter.ceiling = clampf(strtof(argv[++i], nullptr), -12.0f, 0.0f);
+        } else if (arg == "--no-limiter") {
+            chain.limiter.enabled = false;
+        } else if (arg == "--agc" && hasValue) {
+            chain.autoGain.enabled = true;
+            chain.autoGain.targetLevel = clampf(strtof(argv[++i], nullptr), -30.0f, -3.0f);
+        } else if (arg == "--reverb" && hasValue) {
+            chain.convolution = true;
+            chain.ir.path = argv[++i];
+            const int preset = builtinIrIndex(chain.ir.path, -1);
+            if (preset >= 0) {
+                chain.ir.preset = preset;
+                chain.ir.roomSize = IR_PRESETS[preset].roomSize;
+                chain.ir.decay = IR_PRESETS[preset].decay;
+                chain.ir.damping = IR_PRESETS[preset].damping;
+            }
+        } else if (arg == "--reverb-mix" && hasValue) {
+            chain.convWet = clampf(strtof(argv[++i], nullptr), 0.0f, 100.0f) / 100.0f;
+        } else if (arg == "--no-dsp") {
+            chain.dspEnabled = false;
+        } else if (arg == "-h" || arg == "--help") {
+            printRenderUsage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            printRenderUsage();
+            return 2;
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.empty() || paths.size() % 2 != 0) {
+        printRenderUsage();
+        return 2;
+    }
+
+    std::vector<OfflineRenderer::Job> jobs;
+    for (size_t i = 0; i < paths.size(); i += 2) {
+        OfflineRenderer::Job job;
+        job.input = paths[i];
+        job.output = paths[i + 1];
+        jobs.push_back(std::move(job));
+    }
+
+    chain.configure = [&](void* dsp, float rate) {
+        (void)rate;
+        set_dsp_enabled(dsp, 1);
+        set_eq_bands(dsp, eq, NUM_EQ_BANDS);
+        set_tone_params(dsp, tone[0], tone[1], tone[2]);
+        set_stereo_width(dsp, width / 100.0f);
+    };
+
+    // Decode-only kanallar için "ses yok" cihazı yeterli
+    if (!BASS_Init(0, FALLBACK_SAMPLE_RATE, 0, nullptr, nullptr) && BASS_ErrorGetCode() != BASS_ERROR_ALREADY) {
+        fprintf(stderr, "BASS_Init failed (error %d)\n", BASS_ErrorGetCode());
+        return 1;
+    }
+    // Motor tanılama logları ([RENDER] ...) için; araç çıktısı doğrudan stdout'a yazılır
+    AurivoLog::start();
+    loadRenderPlugins();
+
+    int failed = 0;
+    OfflineRenderer renderer;
+    renderer.start(std::move(jobs), std::move(chain), options,
+                   [](const OfflineRenderer::Result& r, size_t done, size_t total) {
+                       if (r.ok) {
+                           std::string stages;
+                           for (const std::string& s : r.stages) stages += (stages.empty() ? "" : " > ") + s;
+                           printf("[%zu/%zu] %s: %.1f s @ %u Hz, %.2f s, %.1fx realtime, peak %.2f dBTP [%s]\n",
+                                  done, total, r.output.c_str(), r.duration, r.sampleRate, r.seconds,
+                                  r.realtimeFactor(), linearTodB(r.truePeak), stages.empty() ? "decode" : stages.c_str());
+                           for (const std::string& s : r.skipped) {
+                               fprintf(stderr, "[%zu/%zu] %s: '%s' was not applied\n", done, total, r.output.c_str(), s.c_str());
+                           }
+                       } else {
+                           fprintf(stderr, "[%zu/%zu] %s: %s (BASS error %d)\n",
+                                   done, total, r.input.c_str(), r.message.c_str(), r.error);
+                       }
+                   },
+                   [&failed](std::vector<OfflineRenderer::Result>& results, bool) {
+                       for (const OfflineRenderer::Result& r : results) {
+                           if (!r.ok) ++failed;
+                       }
+                   });
+    renderer.wait();
+    BASS_Free();
+    AurivoLog::stop();
+    return failed == 0 ? 0 : 1;
+}
+
+#endif // AURIVO_RENDER_CLI
@@ -5,6 +5,8 @@
 #include <cstdio>
 #include <cstdint>
 
+#include "aurivo_log.h"
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -13,7 +15,10 @@
 namespace AurivoDSP {
 
 static const int NUM_BANDS = 32;
-static float gSampleRate = 48000.0f;
+// Katsayı hesapları bu değeri okur. MasterDSP örnekleri farklı hızlarda
+// çalışabildiği için thread başına tutulur; C-API her çağrıda örneğin kendi
+// hızını bağlar (bkz. BoundDSP), audio ve UI thread'leri birbirini bozmaz.
+static thread_local float gSampleRate = 48000.0f;
 static const float MIN_EQ_FREQ = 20.0f;
 static const float MAX_EQ_FREQ = 20000.0f;
 static const float NOISE_GATE_DB = -60.0f;
@@ -23,51 +28,6 @@ static inline float clampf(float value, float min_value, float max_value) {
   return std::max(min_value, std::min(value, max_value));
 }
 
-// Windowed Sinc Resampler (Fixed 44.1k -> 48k for Monitor)
-struct Resampler {
-  float bufferL[256], bufferR[256];
-  int writePos;
-  double phase;
-  double ratio;
-
-  Resampler() : writePos(0), phase(0.0), ratio(48000.0 / 44100.0) {
-    std::fill(bufferL, bufferL + 256, 0.0f);
-    std::fill(bufferR, bufferR + 256, 0.0f);
-  }
-
-  void push(float L, float R) {
-    bufferL[writePos] = L;
-    bufferR[writePos] = R;
-    writePos = (writePos + 1) % 256;
-  }
-
-  void process(float *inL, float *inR, int inFrames, float *out,
-               int &outFrames) {
-    double step = 1.0 / ratio;
-    int outIdx = 0;
-    while (phase < inFrames) {
-      int i = (int)phase;
-      double f = phase - i;
-
-      float L, R;
-      if (i + 1 < inFrames) {
-        L = inL[i] * (1.0f - (float)f) + inL[i + 1] * (float)f;
-        R = inR[i] * (1.0f - (float)f) + inR[i + 1] * (float)f;
-      } else {
-        L = inL[i];
-        R = inR[i];
-      }
-
-      out[outIdx * 2] = L;
-      out[outIdx * 2 + 1] = R;
-      outIdx++;
-      phase += step;
-    }
-    phase -= inFrames;
-    outFrames = outIdx;
-  }
-};
-
 static std::array<float, NUM_BANDS> makeCenterFrequencies() {
   std::array<float, NUM_BANDS> freqs{};
   float log_min = std::log10(MIN_EQ_FREQ);
@@ -318,6 +278,12 @@ struct SimpleCompressor {
         }
         return input * makeup;
     }
+
+    // Current gain reduction in dB (positive), from the envelope
+    float reductionDb() const {
+        if (!enabled || envelope <= threshold || envelope <= 1e-6f) return 0.0f;
+        return (1.0f - 1.0f / ratio) * 20.0f * std::log10(envelope / threshold);
+    }
 };
 
 struct SimpleGate {
@@ -373,6 +339,11 @@ struct SimpleLimiter {
         }
         return input;
     }
+
+    float reductionDb() const {
+        if (!enabled || envelope <= ceiling || envelope <= 1e-6f) return 0.0f;
+        return 20.0f * std::log10(envelope / ceiling);
+    }
 };
 
 struct SimpleEcho {
@@ -770,7 +741,7 @@ private:
           // Debug
           static int debugCounter = 0;
           if (enabled && ++debugCounter > 10000) {
-              printf("[DYNAMIC EQ] env=%.4f thr=%.4f dynGain=%.2f dB over=%.2f\n", 
+              AURIVO_LOG_AT(AurivoLog::LEVEL_DEBUG, 1, "[DYNAMIC EQ] env=%.4f thr=%.4f dynGain=%.2f dB over=%.2f", 
                      env, thrLin, smoothedGainDb, over);
               debugCounter = 0;
           }
@@ -805,12 +776,12 @@ private:
   bool signalFrozen;
   bool forceMute;
   float monitorGateThreshold;
-  Resampler monitorResampler;
+  float sampleRate;
 
 public:
   MasterDSP()
       : targetPreGain(1.0f), currentPreGain(1.0f), activeBandCount(0),
-        webLowPassFreq(8000.0f), bassBoostEnabled(false) {
+        webLowPassFreq(8000.0f), bassBoostEnabled(false), sampleRate(gSampleRate) {
     filtersLeft.resize(NUM_BANDS);
     filtersRight.resize(NUM_BANDS);
     for (int i = 0; i < NUM_BANDS; ++i) {
@@ -886,13 +857,19 @@ public:
   }
 
   void setSampleRate(float sr) {
-    float clamped = clampf(sr, 8000.0f, 192000.0f);
-    if (std::abs(clamped - gSampleRate) < 1.0f)
+    float clamped = clampf(sr, 8000.0f, 384000.0f);
+    if (std::abs(clamped - sampleRate) < 1.0f)
       return;
+    sampleRate = clamped;
     gSampleRate = clamped;
     needsRebuild = true;
   }
 
+  float getSampleRate() const { return sampleRate; }
+
+  // Filtre geçmişi bir sonraki processBuffer'da temizlenir (çıkış yeniden açılışı)
+  void requestReset() { needsRebuild = true; }
+
   // ... [Standard Angolla Setters]
   void updateTargets() {
     float max_boost = 0.0f;
@@ -921,6 +898,13 @@ public:
     updateTargets();
   }
 
+  // Toplu güncelleme: kazançları yaz, hedefleri commitEQGains() ile bir kez hesapla
+  void stageEQGain(int band, float db) {
+    if (band >= 0 && band < NUM_BANDS) gains[band] = db;
+  }
+
+  void commitEQGains() { updateTargets(); }
+
   void setDSPEnabled(bool enabled) { dspEnabled = enabled; }
   void setToneParams(float bass, float mid, float treble) {
     targetTone[0] = bass; targetTone[1] = mid; targetTone[2] = treble;
@@ -962,7 +946,15 @@ public:
         }
     }
     
-    void setEchoParams(bool enabled, float delay, float feedback, float mix) {
+    // Dynamics state at the end of the last processed block (call from the audio thread).
+  // Reductions in dB (positive, worst channel), gate gain 0..1 (1 = open).
+  void getDynamicsState(float *compressorGrDb, float *gateGain, float *limiterGrDb) const {
+        if (compressorGrDb) *compressorGrDb = std::max(compressorL.reductionDb(), compressorR.reductionDb());
+        if (gateGain) *gateGain = gateL.enabled ? std::min(gateL.envelope, gateR.envelope) : 1.0f;
+        if (limiterGrDb) *limiterGrDb = std::max(limiterL.reductionDb(), limiterR.reductionDb());
+  }
+
+  void setEchoParams(bool enabled, float delay, float feedback, float mix) {
         echoL.enabled = enabled; echoR.enabled = enabled;
         if (enabled) {
             echoL.setParams(delay, feedback, mix);
@@ -1000,7 +992,7 @@ public:
   }
   
   void setDynamicEQParams(bool enabled, float freq, float q, float thr, float gain, float rng, float atk, float rel) {
-      printf("[DSP] setDynamicEq: en=%d, f=%.1f, q=%.1f, thr=%.1f, g=%.1f, r=%.1f, a=%.1f, rel=%.1f\n",
+      AURIVO_LOG_DEBUG("[DSP] setDynamicEq: en=%d, f=%.1f, q=%.1f, thr=%.1f, g=%.1f, r=%.1f, a=%.1f, rel=%.1f",
              enabled, freq, q, thr, gain, rng, atk, rel);
       dynamicEQ.setParams(enabled, freq, q, thr, gain, rng, atk, rel);
   }
@@ -1246,6 +1238,18 @@ public:
 
 } // namespace AurivoDSP
 
+namespace AurivoDSP {
+// Çağrı süresince örneğin hızını bu thread'in gSampleRate'ine bağlar
+class BoundDSP {
+public:
+  explicit BoundDSP(void *dsp) : m_dsp(static_cast<MasterDSP *>(dsp)) { gSampleRate = m_dsp->getSampleRate(); }
+  MasterDSP *operator->() const { return m_dsp; }
+
+private:
+  MasterDSP *m_dsp;
+};
+} // namespace AurivoDSP
+
 // ==================================================================================
 // C-INTERFACE
 // ==================================================================================
@@ -1253,47 +1257,53 @@ extern "C" {
 void *create_dsp() { return new AurivoDSP::MasterDSP(); }
 void destroy_dsp(void *dsp) { delete static_cast<AurivoDSP::MasterDSP *>(dsp); }
 void process_dsp(void *dsp, float *buffer, int numFrames, int channels) {
-  if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->processBuffer(buffer, numFrames, channels);
+  if (dsp) AurivoDSP::BoundDSP(dsp)->processBuffer(buffer, numFrames, channels);
 }
-void set_eq_band(void *dsp, int band, float gain) { if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setEQGain(band, gain); }
-void set_eq_bands(void *dsp, const float *gains, int numBands) { if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setEQGains(gains, numBands); }
-void set_tone_params(void *dsp, float bass, float mid, float treble) { if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setToneParams(bass, mid, treble); }
-void set_stereo_width(void *dsp, float width) { if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setStereoWidth(width); }
-void set_master_toggle(void *dsp, int active) { if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setMasterToggle(active != 0); }
-void set_dsp_enabled(void *dsp, int enabled) { if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setDSPEnabled(enabled != 0); }
-void set_sample_rate(void *dsp, float sample_rate) { if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setSampleRate(sample_rate); }
+void set_eq_band(void *dsp, int band, float gain) { if (dsp) AurivoDSP::BoundDSP(dsp)->setEQGain(band, gain); }
+void set_eq_bands(void *dsp, const float *gains, int numBands) { if (dsp) AurivoDSP::BoundDSP(dsp)->setEQGains(gains, numBands); }
+void stage_eq_band(void *dsp, int band, float gain) { if (dsp) AurivoDSP::BoundDSP(dsp)->stageEQGain(band, gain); }
+void commit_eq_bands(void *dsp) { if (dsp) AurivoDSP::BoundDSP(dsp)->commitEQGains(); }
+void set_tone_params(void *dsp, float bass, float mid, float treble) { if (dsp) AurivoDSP::BoundDSP(dsp)->setToneParams(bass, mid, treble); }
+void set_stereo_width(void *dsp, float width) { if (dsp) AurivoDSP::BoundDSP(dsp)->setStereoWidth(width); }
+void set_master_toggle(void *dsp, int active) { if (dsp) AurivoDSP::BoundDSP(dsp)->setMasterToggle(active != 0); }
+void set_dsp_enabled(void *dsp, int enabled) { if (dsp) AurivoDSP::BoundDSP(dsp)->setDSPEnabled(enabled != 0); }
+void set_sample_rate(void *dsp, float sample_rate) { if (dsp) AurivoDSP::BoundDSP(dsp)->setSampleRate(sample_rate); }
 // New wrappers
 void set_compressor_params(void *dsp, int enabled, float thresh, float ratio, float att, float rel, float makeup) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setCompressorParams(enabled != 0, thresh, ratio, att, rel, makeup);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setCompressorParams(enabled != 0, thresh, ratio, att, rel, makeup);
 }
 void set_gate_params(void *dsp, int enabled, float thresh, float att, float rel) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setGateParams(enabled != 0, thresh, att, rel);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setGateParams(enabled != 0, thresh, att, rel);
 }
 void set_limiter_params(void *dsp, int enabled, float ceiling, float rel) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setLimiterParams(enabled != 0, ceiling, rel);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setLimiterParams(enabled != 0, ceiling, rel);
 }
 void set_echo_params(void *dsp, int enabled, float delay, float feedback, float mix) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setEchoParams(enabled != 0, delay, feedback, mix);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setEchoParams(enabled != 0, delay, feedback, mix);
 }
 void set_bass_boost(void *dsp, int enabled, float gain, float freq) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setBassBoost(enabled != 0, gain, freq);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setBassBoost(enabled != 0, gain, freq);
 }
 void set_peq_band(void *dsp, int band, int enabled, float freq, float gain, float Q) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setPEQBand(band, enabled != 0, freq, gain, Q);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setPEQBand(band, enabled != 0, freq, gain, Q);
 }
 void set_peq_filter_type(void *dsp, int band, int filterType) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setPEQFilterType(band, filterType);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setPEQFilterType(band, filterType);
 }
 void get_peq_band(void *dsp, int band, float* freq, float* gain, float* Q, int* filterType) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->getPEQBand(band, freq, gain, Q, filterType);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->getPEQBand(band, freq, gain, Q, filterType);
 }
 void set_crossfeed_params(void *dsp, int enabled, float level, float delay, float lowCut, float highCut) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setCrossfeedParams(enabled != 0, level, delay, lowCut, highCut);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setCrossfeedParams(enabled != 0, level, delay, lowCut, highCut);
 }
 void set_bass_mono_params(void *dsp, int enabled, float cutoff, float slope, float width) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setBassMonoParams(enabled != 0, cutoff, slope, width);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setBassMonoParams(enabled != 0, cutoff, slope, width);
 }
 void set_dynamic_eq_params(void *dsp, int enabled, float freq, float q, float thr, float gain, float rng, float atk, float rel) {
-    if (dsp) static_cast<AurivoDSP::MasterDSP *>(dsp)->setDynamicEQParams(enabled != 0, freq, q, thr, gain, rng, atk, rel);
+    if (dsp) AurivoDSP::BoundDSP(dsp)->setDynamicEQParams(enabled != 0, freq, q, thr, gain, rng, atk, rel);
+}
+void get_dynamics_state(void *dsp, float *compressorGrDb, float *gateGain, float *limiterGrDb) {
+    if (dsp) AurivoDSP::BoundDSP(dsp)->getDynamicsState(compressorGrDb, gateGain, limiterGrDb);
 }
+void reset_dsp_state(void *dsp) { if (dsp) AurivoDSP::BoundDSP(dsp)->requestReset(); }
 }
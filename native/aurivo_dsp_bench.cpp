@@ -0,0 +1,439 @@
+// ============================================
+// AURIVO DSP BENCHMARK - process_dsp mikro ölçümleri
+// Headless: BASS / Node gerekmez, yalnızca aurivo_dsp.cpp
+// ============================================
+//
+// Every configuration (one effect stage at a time, plus the full chain) is
+// measured separately for each sample rate and block size. Reported per run:
+// ns/frame (median and best of the repeats), realtime factor and, on Linux
+// when perf events are available, hardware cache misses. Output is JSON so
+// results can be diffed across commits:
+//
+//   aurivo_dsp_bench --label $(git rev-parse --short HEAD) --out bench-$(git rev-parse --short HEAD).json
+//   aurivo_dsp_bench --config eq_32 --rates 48000 --blocks 256,1024
+//   aurivo_dsp_bench --wav recording.wav      (recorded buffer instead of synthetic)
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define AURIVO_HAS_SSE 1
+#else
+#define AURIVO_HAS_SSE 0
+#endif
+
+#include "aurivo_dsp_tools.h"
+
+using namespace AurivoDspTools;
+
+// ============================================
+// CONFIGURATIONS
+// ============================================
+// Smart mode (set_master_toggle) is on by default in MasterDSP; every stage
+// is measured with it off so the numbers isolate that stage, and "smart"
+// measures the smart bass/tone logic alone.
+
+struct BenchConfig {
+    const char* name;
+    const char* description;
+    std::function<void(void* dsp)> setup;
+};
+
+static void setupEq32(void* dsp) {
+    float gains[NUM_EQ_BANDS];
+    for (int b = 0; b < NUM_EQ_BANDS; ++b) gains[b] = (b % 2 == 0) ? 3.0f : -2.5f;
+    set_eq_bands(dsp, gains, NUM_EQ_BANDS);
+}
+
+static void setupPeq(void* dsp) {
+    static const float freqs[NUM_PEQ_BANDS] = { 80.0f, 250.0f, 1000.0f, 3000.0f, 6000.0f, 12000.0f };
+    for (int b = 0; b < NUM_PEQ_BANDS; ++b) set_peq_band(dsp, b, 1, freqs[b], (b % 2 == 0) ? 4.0f : -3.0f, 1.0f);
+}
+
+static void setupDynamics(void* dsp) {
+    set_compressor_params(dsp, 1, -24.0f, 4.0f, 10.0f, 120.0f, 6.0f);
+    set_gate_params(dsp, 1, -60.0f, 2.0f, 100.0f);
+    set_limiter_params(dsp, 1, -1.0f, 50.0f);
+}
+
+static std::vector<BenchConfig> makeConfigs() {
+    std::vector<BenchConfig> configs;
+    configs.push_back({ "bypass", "set_dsp_enabled(0)", [](void* dsp) { set_dsp_enabled(dsp, 0); } });
+    configs.push_back({ "baseline", "DSP on, every stage off", [](void*) {} });
+    configs.push_back({ "smart", "smart mode on", [](void* dsp) { set_master_toggle(dsp, 1); } });
+    configs.push_back({ "eq_single", "one EQ band active", [](void* dsp) {
+        float gains[NUM_EQ_BANDS] = {};
+        gains[12] = 4.0f;
+        set_eq_bands(dsp, gains, NUM_EQ_BANDS);
+    } });
+    configs.push_back({ "eq_32", "all 32 EQ bands active", setupEq32 });
+    configs.push_back({ "tone", "bass/mid/treble", [](void* dsp) { set_tone_params(dsp, 4.0f, -2.0f, 3.0f); } });
+    configs.push_back({ "peq", "6 parametric bands", setupPeq });
+    configs.push_back({ "dynamics", "compressor + gate + limiter", setupDynamics });
+    configs.push_back({ "crossfeed", "headphone crossfeed", [](void* dsp) {
+        set_crossfeed_params(dsp, 1, 30.0f, 0.3f, 700.0f, 4000.0f);
+    } });
+    configs.push_back({ "bass_mono", "bass mono 120 Hz / 24 dB", [](void* dsp) {
+        set_bass_mono_params(dsp, 1, 120.0f, 24.0f, 100.0f);
+    } });
+    configs.push_back({ "dynamic_eq", "dynamic EQ 3.5 kHz", [](void* dsp) {
+        set_dynamic_eq_params(dsp, 1, 3500.0f, 2.0f, -40.0f, -6.0f, 12.0f, 5.0f, 100.0f);
+    } });
+    configs.push_back({ "echo", "echo 250 ms", [](void* dsp) { set_echo_params(dsp, 1, 250.0f, 0.4f, 0.3f); } });
+    configs.push_back({ "full", "every stage + smart mode", [](void* dsp) {
+        set_master_toggle(dsp, 1);
+        setupEq32(dsp);
+        set_tone_params(dsp, 4.0f, -2.0f, 3.0f);
+        setupPeq(dsp);
+        setupDynamics(dsp);
+        set_crossfeed_params(dsp, 1, 30.0f, 0.3f, 700.0f, 4000.0f);
+        set_bass_mono_params(dsp, 1, 120.0f, 24.0f, 100.0f);
+        set_dynamic_eq_params(dsp, 1, 3500.0f, 2.0f, -40.0f, -6.0f, 12.0f, 5.0f, 100.0f);
+        set_echo_params(dsp, 1, 250.0f, 0.4f, 0.3f);
+    } });
+    return configs;
+}
+
+// ============================================
+// CACHE MISS COUNTER (Linux perf events)
+// ============================================
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+
+    ~CacheMissCounter() {
+#if defined(__linux__)
+        if (m_fd >= 0) close(m_fd);
+#endif
+    }
+
+    bool available() const { return m_fd >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        if (m_fd < 0) return;
+        ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    // -1: unavailable
+    long long stop() {
+#if defined(__linux__)
+        if (m_fd < 0) return -1;
+        ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long count = 0;
+        if (read(m_fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) return -1;
+        return count;
+#else
+        return -1;
+#endif
+    }
+
+private:
+    int m_fd = -1;
+};
+
+// ============================================
+// MEASUREMENT
+// ============================================
+
+struct BenchResult {
+    std::string config;
+    float rate = 0.0f;
+    int block = 0;
+    uint64_t frames = 0;
+    double nsPerFrameMedian = 0.0;
+    double nsPerFrameBest = 0.0;
+    double realtimeFactor = 0.0;
+    long long cacheMisses = -1;     // median run, -1 = unavailable
+    bool finite = true;             // output free of NaN/Inf
+};
+
+struct BenchOptions {
+    std::vector<float> rates = { 44100.0f, 48000.0f, 96000.0f };
+    std::vector<int> blocks = { 64, 256, 1024, 4096 };
+    double seconds = 5.0;           // audio per repeat
+    int repeats = 5;
+    std::string configFilter;       // comma list, empty = all
+    std::string wavPath;
+    std::string outPath = "aurivo_dsp_bench.json";   // "-" = stdout (DSP debug logs also go there)
+    std::string label;
+};
+
+static BenchResult runOne(const BenchConfig& config, float rate, int block, const std::vector<float>& source,
+                          const BenchOptions& options, CacheMissCounter& counter) {
+    BenchResult r;
+    r.config = config.name;
+    r.rate = rate;
+    r.block = block;
+
+    void* dsp = create_dsp();
+    // Flat EQ/tone, otherwise the constructor's +1 dB defaults hide the EQ cost
+    resetToNeutral(dsp, rate, false);
+    config.setup(dsp);
+
+    const size_t sourceFrames = source.size() / 2;
+    const uint64_t framesPerRepeat = std::max<uint64_t>((uint64_t)block, (uint64_t)(options.seconds * rate));
+    std::vector<float> buffer((size_t)block * 2);
+    size_t cursor = 0;
+
+    auto processFrames = [&](uint64_t total) {
+        for (uint64_t done = 0; done < total; done += (uint64_t)block) {
+            // Fresh input each block (like a real callback); copy cost is part of every config
+            for (int i = 0; i < block; ++i) {
+                buffer[(size_t)i * 2] = source[cursor * 2];
+                buffer[(size_t)i * 2 + 1] = source[cursor * 2 + 1];
+                if (++cursor == sourceFrames) cursor = 0;
+            }
+            process_dsp(dsp, buffer.data(), block, 2);
+        }
+    };
+
+    // Warm-up: coefficient rebuild, parameter smoothing, caches
+    processFrames((uint64_t)(rate * 0.5));
+
+    std::vector<double> ns;
+    std::vector<long long> misses;
+    for (int rep = 0; rep < options.repeats; ++rep) {
+        counter.start();
+        const auto t0 = std::chrono::steady_clock::now();
+        processFrames(framesPerRepeat);
+        const auto t1 = std::chrono::steady_clock::now();
+        misses.push_back(counter.stop());
+        ns.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    }
+    for (float v : buffer) {
+        if (!std::isfinite(v)) r.finite = false;
+    }
+    destroy_dsp(dsp);
+
+    const uint64_t framesRun = ((framesPerRepeat + (uint64_t)block - 1) / (uint64_t)block) * (uint64_t)block;
+    std::vector<size_t> order(ns.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return ns[a] < ns[b]; });
+    const size_t median = order[order.size() / 2];
+
+    r.frames = framesRun;
+    r.nsPerFrameMedian = ns[median] / (double)framesRun;
+    r.nsPerFrameBest = ns[order[0]] / (double)framesRun;
+    r.realtimeFactor = r.nsPerFrameMedian > 0.0 ? 1e9 / (r.nsPerFrameMedian * rate) : 0.0;
+    r.cacheMisses = misses[median];
+    return r;
+}
+
+// ============================================
+// JSON OUTPUT
+// ============================================
+
+static std::string jsonEscape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((unsigned char)c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", (unsigned char)c);
+            out += buf;
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+static void writeJson(FILE* f, const BenchOptions& options, const std::vector<BenchConfig>& configs,
+                      const std::vector<BenchResult>& results, bool perfAvailable) {
+#if defined(__clang__)
+    const std::string compiler = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    const std::string compiler = std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    const std::string compiler = "msvc " + std::to_string(_MSC_VER);
+#else
+    const std::string compiler = "unknown";
+#endif
+    const long long timestamp = (long long)std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"schema\": 1,\n");
+    fprintf(f, "  \"label\": \"%s\",\n", jsonEscape(options.label).c_str());
+    fprintf(f, "  \"timestamp\": %lld,\n", timestamp);
+    fprintf(f, "  \"compiler\": \"%s\",\n", jsonEscape(compiler).c_str());
+    fprintf(f, "  \"signal\": \"%s\",\n", options.wavPath.empty() ? "synthetic" : jsonEscape(options.wavPath).c_str());
+    fprintf(f, "  \"secondsPerRepeat\": %.3f,\n", options.seconds);
+    fprintf(f, "  \"repeats\": %d,\n", options.repeats);
+    fprintf(f, "  \"cacheMissesAvailable\": %s,\n", perfAvailable ? "true" : "false");
+    fprintf(f, "  \"configs\": {");
+    for (size_t i = 0; i < configs.size(); ++i) {
+        fprintf(f, "%s\n    \"%s\": \"%s\"", i ? "," : "", configs[i].name, jsonEscape(configs[i].description).c_str());
+    }
+    fprintf(f, "\n  },\n");
+    fprintf(f, "  \"results\": [");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        fprintf(f, "%s\n    { \"config\": \"%s\", \"rate\": %.0f, \"block\": %d, \"frames\": %llu, "
+                   "\"nsPerFrame\": %.3f, \"nsPerFrameBest\": %.3f, \"realtimeFactor\": %.1f, ",
+                i ? "," : "", r.config.c_str(), r.rate, r.block, (unsigned long long)r.frames,
+                r.nsPerFrameMedian, r.nsPerFrameBest, r.realtimeFactor);
+        if (r.cacheMisses >= 0) {
+            fprintf(f, "\"cacheMisses\": %lld, \"cacheMissesPerKFrame\": %.3f, ",
+                    r.cacheMisses, 1000.0 * (double)r.cacheMisses / (double)r.frames);
+        } else {
+            fprintf(f, "\"cacheMisses\": null, \"cacheMissesPerKFrame\": null, ");
+        }
+        fprintf(f, "\"finite\": %s }", r.finite ? "true" : "false");
+    }
+    fprintf(f, "\n  ]\n}\n");
+}
+
+// ============================================
+// MAIN
+// ============================================
+
+static void printUsage() {
+    fprintf(stderr,
+            "Usage: aurivo_dsp_bench [options]\n"
+            "  --config a,b,...     configurations to run (default: all)\n"
+            "  --rates 44100,...    sample rates (default 44100,48000,96000)\n"
+            "  --blocks 64,...      block sizes in frames (default 64,256,1024,4096)\n"
+            "  --seconds S          audio seconds per repeat (default 5)\n"
+            "  --repeats N          repeats per configuration, median reported (default 5)\n"
+            "  --wav path.wav       recorded buffer instead of the synthetic signal\n"
+            "  --label text         stored in the JSON (e.g. commit id)\n"
+            "  --out path.json      JSON output (default aurivo_dsp_bench.json, - = stdout)\n"
+            "  --list               list configurations\n");
+}
+
+static std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> out;
+    size_t start = 0;
+    while (start <= text.size()) {
+        const size_t comma = text.find(',', start);
+        const std::string item = text.substr(start, comma == std::string::npos ? std::string::npos : comma - start);
+        if (!item.empty()) out.push_back(item);
+        if (comma == std::string::npos) break;
+        start = comma + 1;
+    }
+    return out;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    const std::vector<BenchConfig> allConfigs = makeConfigs();
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--config" && hasValue) {
+            options.configFilter = argv[++i];
+        } else if (arg == "--rates" && hasValue) {
+            options.rates.clear();
+            for (const std::string& v : splitList(argv[++i])) options.rates.push_back(std::max(8000.0f, strtof(v.c_str(), nullptr)));
+        } else if (arg == "--blocks" && hasValue) {
+            options.blocks.clear();
+            for (const std::string& v : splitList(argv[++i])) options.blocks.push_back(std::max(1, atoi(v.c_str())));
+        } else if (arg == "--seconds" && hasValue) {
+            options.seconds = std::max(0.1, strtod(argv[++i], nullptr));
+        } else if (arg == "--repeats" && hasValue) {
+            options.repeats = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--wav" && hasValue) {
+            options.wavPath = argv[++i];
+        } else if (arg == "--label" && hasValue) {
+            options.label = argv[++i];
+        } else if (arg == "--out" && hasValue) {
+            options.outPath = argv[++i];
+        } else if (arg == "--list") {
+            for (const BenchConfig& c : allConfigs) printf("%-12s %s\n", c.name, c.description);
+            return 0;
+        } else {
+            printUsage();
+            return arg == "-h" || arg == "--help" ? 0 : 2;
+        }
+    }
+
+    std::vector<BenchConfig> configs;
+    const std::vector<std::string> wanted = splitList(options.configFilter);
+    for (const BenchConfig& c : allConfigs) {
+        if (wanted.empty() || std::find(wanted.begin(), wanted.end(), c.name) != wanted.end()) configs.push_back(c);
+    }
+    if (configs.empty() || options.rates.empty() || options.blocks.empty()) {
+        fprintf(stderr, "Nothing to run (see --list)\n");
+        return 2;
+    }
+
+    std::vector<float> recorded;
+    if (!options.wavPath.empty()) {
+        std::string error;
+        uint32_t wavRate = 0;   // the recording is used as sample data at every benchmarked rate
+        if (!loadWav(options.wavPath, recorded, wavRate, error)) {
+            fprintf(stderr, "%s: %s\n", options.wavPath.c_str(), error.c_str());
+            return 1;
+        }
+    }
+
+#if AURIVO_HAS_SSE
+    // Audio thread'leriyle aynı: denormaller sıfıra (FTZ/DAZ)
+    _mm_setcsr(_mm_getcsr() | 0x8040);
+#endif
+
+    CacheMissCounter counter;
+    std::vector<BenchResult> results;
+    for (float rate : options.rates) {
+        const std::vector<float> source = recorded.empty() ? makeBenchSignal(rate, (int)(rate * 8.0f)) : recorded;
+        for (const BenchConfig& config : configs) {
+            for (int block : options.blocks) {
+                const BenchResult r = runOne(config, rate, block, source, options, counter);
+                fprintf(stderr, "%-12s %6.0f Hz %5d  %8.2f ns/frame  %8.1fx realtime%s\n",
+                        r.config.c_str(), r.rate, r.block, r.nsPerFrameMedian, r.realtimeFactor,
+                        r.finite ? "" : "  NON-FINITE OUTPUT");
+                results.push_back(r);
+            }
+        }
+    }
+
+    FILE* out = stdout;
+    if (options.outPath != "-") {
+        out = fopen(options.outPath.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "cannot write %s\n", options.outPath.c_str());
+            return 1;
+        }
+    }
+    writeJson(out, options, configs, results, counter.available());
+    if (out != stdout) fclose(out);
+
+    bool finite = true;
+    for (const BenchResult& r : results) finite = finite && r.finite;
+    return finite ? 0 : 1;
+}
@@ -0,0 +1,904 @@
+// ============================================
+// AURIVO DSP GOLDEN - process_dsp çıktı regresyon testi
+// Headless: BASS / Node / ses kartı gerekmez, yalnızca aurivo_dsp.cpp
+// ============================================
+//
+// Renders fixed, deterministic test signals (log sweep, pink noise, impulses,
+// transients, a synthetic music clip and optional --clip recordings) through a
+// matrix of DSP presets and compares the output against references recorded
+// from a known-good build. Each preset has its own budget:
+//
+//   maxAbs    largest sample difference, dBFS
+//   null      null-test depth, rms(out - ref) relative to rms(ref), dB
+//   spectral  worst 1/3-octave band energy deviation, dB (bands within 60 dB
+//             of the loudest band)
+//
+// Linear presets must null deeply; dynamics/smart presets get looser budgets
+// because a tiny rounding change can move an envelope across a threshold.
+// Bypass must stay bit-exact. Typical use around a kernel rewrite:
+//
+//   aurivo_dsp_golden --record golden/      (on the known-good commit)
+//   aurivo_dsp_golden --check golden/       (after the change; exit 1 on failure)
+//
+// References are raw little-endian float32 files (<preset>__<signal>__<rate>.agld).
+// The rendered inputs are stored next to them (input__<signal>__<rate>.agld) and
+// --check replays those, so compiler/libm differences in the signal generators
+// never show up as DSP regressions.
+//
+// Full references are too large to commit, so the repository carries a
+// checksum manifest instead (dsp_golden/reference.txt, --record-sums /
+// --check-sums). Each case stores the output hash plus features whose drift
+// the same budgets bound: per-channel peak, RMS, 100 ms segment RMS and
+// 1/3-octave band energies. A hash match passes outright. Otherwise
+// |d peak| and |d segment rms| <= maxAbs, |d rms| <= null x rms(ref) and
+// band drift <= spectral, each implied by the sample-domain budget. The
+// manifest covers the synthetic signals at every rate plus the committed
+// dsp_golden/clips (16-bit, same input everywhere). A case with no entry
+// fails the check.
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define AURIVO_HAS_SSE 1
+#else
+#define AURIVO_HAS_SSE 0
+#endif
+
+#include "aurivo_dsp_tools.h"
+
+using namespace AurivoDspTools;
+
+// ============================================
+// PRESETS & BUDGETS
+// ============================================
+
+struct Limits {
+    double maxAbsDb;      // max |out - ref| allowed, dBFS
+    double nullDb;        // null depth required, dB (more negative = stricter)
+    double spectralDb;    // max band deviation, dB
+};
+
+struct Budget {
+    bool bitExact;        // pass-through presets (bypass): output == input
+    Limits base;          // up to 48 kHz
+    Limits highRate;      // above 48 kHz
+};
+
+// Budgets are the spread between FMA-contracted and plain builds (the
+// rounding change a SIMD rewrite introduces) plus ~8 dB / 2x margin; a 4%
+// Q change on the graphic EQ already fails eq_32. The EQ-type stages run
+// float biquads whose low-band poles sit close to DC, so their roundoff
+// noise is large and grows with the sample rate, hence the separate
+// high-rate limits. Measured over the synthetic signals and the committed
+// clips; band-limited clips (pad) put quiet 1/3-octave bands close to that
+// roundoff floor, which sets the spectral limits of full and width.
+static const Budget BUDGET_EXACT = { true, { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 } };
+
+struct GoldenPreset {
+    const char* name;
+    const char* description;
+    Budget budget;
+    bool smart;                               // smart mode (MasterDSP default) on
+    std::function<void(void* dsp)> setup;
+};
+
+static void setupEq32(void* dsp) {
+    float gains[NUM_EQ_BANDS];
+    for (int b = 0; b < NUM_EQ_BANDS; ++b) gains[b] = (b % 2 == 0) ? 3.0f : -2.5f;
+    set_eq_bands(dsp, gains, NUM_EQ_BANDS);
+}
+
+static void setupPeq(void* dsp) {
+    static const float freqs[NUM_PEQ_BANDS] = { 80.0f, 250.0f, 1000.0f, 3000.0f, 6000.0f, 12000.0f };
+    for (int b = 0; b < NUM_PEQ_BANDS; ++b) set_peq_band(dsp, b, 1, freqs[b], (b % 2 == 0) ? 4.0f : -3.0f, 1.0f);
+    set_peq_filter_type(dsp, 0, 1);                        // low shelf
+    set_peq_filter_type(dsp, NUM_PEQ_BANDS - 1, 2);        // high shelf
+}
+
+static void setupDynamics(void* dsp) {
+    set_compressor_params(dsp, 1, -24.0f, 4.0f, 10.0f, 120.0f, 6.0f);
+    set_gate_params(dsp, 1, -60.0f, 2.0f, 100.0f);
+    set_limiter_params(dsp, 1, -1.0f, 50.0f);
+}
+
+static std::vector<GoldenPreset> makePresets() {
+    std::vector<GoldenPreset> p;
+    p.push_back({ "bypass", "set_dsp_enabled(0), must be bit-exact", BUDGET_EXACT, false,
+                  [](void* dsp) { set_dsp_enabled(dsp, 0); } });
+    p.push_back({ "flat", "DSP on, every stage off",
+                  { false, { -130.0, -130.0, 0.01 }, { -130.0, -130.0, 0.01 } }, false, [](void*) {} });
+    p.push_back({ "eq_32", "all 32 EQ bands +3/-2.5 dB",
+                  { false, { -45.0, -45.0, 0.20 }, { -20.0, -15.0, 0.90 } }, false, setupEq32 });
+    p.push_back({ "eq_extreme", "EQ groups of 8 bands at +12/-12 dB",
+                  { false, { -15.0, -35.0, 0.15 }, { -10.0, -20.0, 0.85 } }, false, [](void* dsp) {
+        float gains[NUM_EQ_BANDS];
+        for (int b = 0; b < NUM_EQ_BANDS; ++b) gains[b] = ((b / 8) % 2 == 0) ? 12.0f : -12.0f;
+        set_eq_bands(dsp, gains, NUM_EQ_BANDS);
+    } });
+    p.push_back({ "tone", "bass +4, mid -2, treble +3 (smart mode only)",
+                  { false, { -55.0, -50.0, 0.03 }, { -55.0, -50.0, 0.03 } }, true,
+                  [](void* dsp) { set_tone_params(dsp, 4.0f, -2.0f, 3.0f); } });
+    p.push_back({ "peq", "6 parametric bands incl. shelves",
+                  { false, { -40.0, -40.0, 0.06 }, { -40.0, -40.0, 0.06 } }, false, setupPeq });
+    p.push_back({ "bass_boost", "bass boost +6 dB at 80 Hz",
+                  { false, { -55.0, -55.0, 0.02 }, { -55.0, -55.0, 0.03 } }, false,
+                  [](void* dsp) { set_bass_boost(dsp, 1, 6.0f, 80.0f); } });
+    p.push_back({ "width", "stereo width 1.6 (smart mode only)",
+                  { false, { -70.0, -75.0, 0.03 }, { -65.0, -65.0, 0.03 } }, true,
+                  [](void* dsp) { set_stereo_width(dsp, 1.6f); } });
+    p.push_back({ "crossfeed", "headphone crossfeed",
+                  { false, { -125.0, -130.0, 0.01 }, { -120.0, -130.0, 0.01 } }, false,
+                  [](void* dsp) { set_crossfeed_params(dsp, 1, 30.0f, 0.3f, 700.0f, 4000.0f); } });
+    p.push_back({ "bass_mono", "bass mono 120 Hz / 24 dB",
+                  { false, { -70.0, -75.0, 0.01 }, { -65.0, -65.0, 0.03 } }, false,
+                  [](void* dsp) { set_bass_mono_params(dsp, 1, 120.0f, 24.0f, 100.0f); } });
+    p.push_back({ "echo", "echo 250 ms, feedback 0.4",
+                  { false, { -105.0, -100.0, 0.01 }, { -100.0, -90.0, 0.01 } }, false,
+                  [](void* dsp) { set_echo_params(dsp, 1, 250.0f, 0.4f, 0.3f); } });
+    p.push_back({ "compressor", "compressor -24 dB 4:1",
+                  { false, { -100.0, -110.0, 0.01 }, { -90.0, -105.0, 0.01 } }, false,
+                  [](void* dsp) { set_compressor_params(dsp, 1, -24.0f, 4.0f, 10.0f, 120.0f, 6.0f); } });
+    p.push_back({ "gate", "gate -45 dB",
+                  { false, { -125.0, -130.0, 0.01 }, { -125.0, -120.0, 0.01 } }, false,
+                  [](void* dsp) { set_gate_params(dsp, 1, -45.0f, 2.0f, 100.0f); } });
+    p.push_back({ "limiter", "limiter -3 dB ceiling",
+                  { false, { -110.0, -125.0, 0.01 }, { -105.0, -120.0, 0.01 } }, false,
+                  [](void* dsp) { set_limiter_params(dsp, 1, -3.0f, 50.0f); } });
+    p.push_back({ "dynamic_eq", "dynamic EQ 3.5 kHz",
+                  { false, { -100.0, -105.0, 0.01 }, { -100.0, -100.0, 0.01 } }, false,
+                  [](void* dsp) { set_dynamic_eq_params(dsp, 1, 3500.0f, 2.0f, -40.0f, -6.0f, 12.0f, 5.0f, 100.0f); } });
+    p.push_back({ "smart", "engine default: smart mode on, flat EQ",
+                  { false, { -75.0, -75.0, 0.01 }, { -65.0, -70.0, 0.03 } }, true, [](void*) {} });
+    p.push_back({ "full", "every stage + smart mode",
+                  { false, { -45.0, -45.0, 0.40 }, { -20.0, -15.0, 0.75 } }, true, [](void* dsp) {
+        setupEq32(dsp);
+        set_tone_params(dsp, 4.0f, -2.0f, 3.0f);
+        setupPeq(dsp);
+        set_stereo_width(dsp, 1.2f);
+        setupDynamics(dsp);
+        set_crossfeed_params(dsp, 1, 30.0f, 0.3f, 700.0f, 4000.0f);
+        set_bass_mono_params(dsp, 1, 120.0f, 24.0f, 100.0f);
+        set_dynamic_eq_params(dsp, 1, 3500.0f, 2.0f, -40.0f, -6.0f, 12.0f, 5.0f, 100.0f);
+        set_echo_params(dsp, 1, 250.0f, 0.4f, 0.3f);
+    } });
+    return p;
+}
+
+// ============================================
+// SIGNALS
+// ============================================
+
+struct GoldenSignal {
+    std::string name;
+    uint32_t rate = 0;          // 0 = synthesized at every --rates entry
+    std::vector<float> samples; // recordings only
+    std::function<std::vector<float>(float rate)> make;
+};
+
+static std::vector<GoldenSignal> makeSignals() {
+    std::vector<GoldenSignal> signals(5);
+    signals[0].name = "sweep";
+    signals[0].make = [](float rate) { return makeSweep(rate, (int)(rate * 2.0f)); };
+    signals[1].name = "pink";
+    signals[1].make = [](float rate) { return makePinkNoise(rate, (int)(rate * 1.5f)); };
+    signals[2].name = "impulse";
+    signals[2].make = [](float rate) { return makeImpulses(rate, (int)(rate * 1.0f)); };
+    signals[3].name = "transient";
+    signals[3].make = [](float rate) { return makeTransients(rate, (int)(rate * 1.8f)); };
+    signals[4].name = "music";
+    signals[4].make = [](float rate) { return makeMusicClip(rate, (int)(rate * 2.0f)); };
+    return signals;
+}
+
+static std::string clipName(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    std::string base = slash == std::string::npos ? path : path.substr(slash + 1);
+    const size_t dot = base.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) base = base.substr(0, dot);
+    for (char& c : base) {
+        if (!isalnum((unsigned char)c) && c != '-') c = '_';
+    }
+    return "clip_" + base;
+}
+
+// ============================================
+// RENDER
+// ============================================
+
+static void processBlocks(void* dsp, std::vector<float>& buffer, int block) {
+    const int frames = (int)(buffer.size() / 2);
+    for (int pos = 0; pos < frames; pos += block) {
+        process_dsp(dsp, buffer.data() + (size_t)pos * 2, std::min(block, frames - pos), 2);
+    }
+}
+
+static std::vector<float> render(const GoldenPreset& preset, float rate, int block, const std::vector<float>& input) {
+    void* dsp = create_dsp();
+    resetToNeutral(dsp, rate, preset.smart);
+    preset.setup(dsp);
+
+    // Pre-roll: MasterDSP ramps from its constructor state (+1 dB EQ/tone,
+    // smart mode fading) and snaps each ramp once it is under a threshold;
+    // the block where that happens moves with rounding. Settle first so the
+    // references describe the steady-state chain. Quiet pink noise, because
+    // silent blocks are zeroed by the input gate before any smoothing runs.
+    std::vector<float> preroll = makePinkNoise(rate, (int)rate);
+    for (float& v : preroll) v *= 0.05f;
+    processBlocks(dsp, preroll, block);
+
+    std::vector<float> out = input;
+    processBlocks(dsp, out, block);
+    destroy_dsp(dsp);
+    return out;
+}
+
+static uint64_t fnv1a(const std::vector<float>& data) {
+    uint64_t h = 1469598103934665603ull;
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data.data());
+    for (size_t i = 0; i < data.size() * sizeof(float); ++i) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// ============================================
+// REFERENCE FILES
+// ============================================
+// Header: "AGLD", u32 version, u32 rate, u32 channels, u32 block, u32 reserved,
+// u64 frames, u64 input hash; then frames * channels float32.
+
+static const uint32_t GOLDEN_VERSION = 1;
+
+struct GoldenFile {
+    uint32_t rate = 0;
+    uint32_t channels = 2;
+    uint32_t block = 0;
+    uint64_t inputHash = 0;
+    std::vector<float> samples;
+};
+
+static bool writeGolden(const std::string& path, const GoldenFile& g) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    const uint32_t reserved = 0;
+    const uint64_t frames = g.samples.size() / g.channels;
+    bool ok = fwrite("AGLD", 1, 4, f) == 4;
+    ok = ok && fwrite(&GOLDEN_VERSION, 4, 1, f) == 1 && fwrite(&g.rate, 4, 1, f) == 1;
+    ok = ok && fwrite(&g.channels, 4, 1, f) == 1 && fwrite(&g.block, 4, 1, f) == 1;
+    ok = ok && fwrite(&reserved, 4, 1, f) == 1 && fwrite(&frames, 8, 1, f) == 1 && fwrite(&g.inputHash, 8, 1, f) == 1;
+    ok = ok && fwrite(g.samples.data(), sizeof(float), g.samples.size(), f) == g.samples.size();
+    return fclose(f) == 0 && ok;
+}
+
+static bool readGolden(const std::string& path, GoldenFile& g, std::string& error) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) {
+        error = "missing";
+        return false;
+    }
+    char magic[4];
+    uint32_t version = 0, reserved = 0;
+    uint64_t frames = 0;
+    bool ok = fread(magic, 1, 4, f) == 4 && memcmp(magic, "AGLD", 4) == 0;
+    ok = ok && fread(&version, 4, 1, f) == 1 && version == GOLDEN_VERSION;
+    ok = ok && fread(&g.rate, 4, 1, f) == 1 && fread(&g.channels, 4, 1, f) == 1 && fread(&g.block, 4, 1, f) == 1;
+    ok = ok && fread(&reserved, 4, 1, f) == 1 && fread(&frames, 8, 1, f) == 1 && fread(&g.inputHash, 8, 1, f) == 1;
+    ok = ok && g.channels == 2 && g.block > 0 && frames < (1ull << 32);
+    if (ok) {
+        g.samples.resize((size_t)frames * g.channels);
+        ok = fread(g.samples.data(), sizeof(float), g.samples.size(), f) == g.samples.size();
+    }
+    fclose(f);
+    if (!ok) error = "corrupt or wrong version";
+    return ok;
+}
+
+// ============================================
+// COMPARISON
+// ============================================
+
+static void fft(std::vector<std::complex<double>>& x) {
+    const size_t n = x.size();
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(x[i], x[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const double angle = -2.0 * M_PI / (double)len;
+        const std::complex<double> wlen(std::cos(angle), std::sin(angle));
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < len / 2; ++k) {
+                const std::complex<double> u = x[i + k];
+                const std::complex<double> v = x[i + k + len / 2] * w;
+                x[i + k] = u + v;
+                x[i + k + len / 2] = u - v;
+                w *= wlen;
+            }
+        }
+    }
+}
+
+// Welch-averaged energy per 1/3-octave band (dB) of one channel
+static std::vector<double> bandEnergiesDb(const std::vector<float>& s, int channel, float rate) {
+    const size_t frames = s.size() / 2;
+    size_t n = 4096;
+    while (n > 256 && n > frames) n >>= 1;
+    std::vector<double> power(n / 2 + 1, 0.0);
+    std::vector<std::complex<double>> buf(n);
+    for (size_t start = 0; start + n <= frames; start += n / 2) {
+        for (size_t i = 0; i < n; ++i) {
+            const double w = 0.5 - 0.5 * std::cos(2.0 * M_PI * (double)i / (double)n);
+            buf[i] = std::complex<double>(w * s[(start + i) * 2 + channel], 0.0);
+        }
+        fft(buf);
+        for (size_t k = 0; k <= n / 2; ++k) power[k] += std::norm(buf[k]);
+    }
+
+    std::vector<double> bands;
+    const double binHz = rate / (double)n;
+    for (int b = -17; ; ++b) {                              // 1 kHz * 2^(b/3), from ~20 Hz
+        const double fc = 1000.0 * std::pow(2.0, b / 3.0);
+        const double lo = fc * std::pow(2.0, -1.0 / 6.0), hi = fc * std::pow(2.0, 1.0 / 6.0);
+        if (lo >= rate * 0.5) break;
+        const size_t k0 = (size_t)std::ceil(lo / binHz), k1 = std::min(n / 2, (size_t)std::ceil(hi / binHz));
+        if (k0 >= k1) continue;                             // narrower than a bin
+        double e = 0.0;
+        for (size_t k = k0; k < k1; ++k) e += power[k];
+        bands.push_back(10.0 * std::log10(e + 1e-30));
+    }
+    return bands;
+}
+
+struct Comparison {
+    bool finite = true;
+    bool exact = true;
+    double maxAbsDb = -std::numeric_limits<double>::infinity();
+    double nullDb = -std::numeric_limits<double>::infinity();
+    double spectralDb = 0.0;
+};
+
+static double toDb(double v) {
+    return v > 0.0 ? 20.0 * std::log10(v) : -std::numeric_limits<double>::infinity();
+}
+
+static Comparison compare(const std::vector<float>& out, const std::vector<float>& ref, float rate) {
+    Comparison c;
+    double maxAbs = 0.0, diffEnergy = 0.0, refEnergy = 0.0;
+    for (size_t i = 0; i < out.size(); ++i) {
+        if (!std::isfinite(out[i])) {
+            c.finite = false;
+            continue;
+        }
+        if (out[i] != ref[i]) c.exact = false;
+        const double d = (double)out[i] - (double)ref[i];
+        maxAbs = std::max(maxAbs, std::fabs(d));
+        diffEnergy += d * d;
+        refEnergy += (double)ref[i] * ref[i];
+    }
+    if (!c.finite) return c;
+    c.maxAbsDb = toDb(maxAbs);
+    c.nullDb = refEnergy > 0.0 ? 10.0 * std::log10(diffEnergy / refEnergy + 1e-300) : toDb(std::sqrt(diffEnergy));
+    if (diffEnergy == 0.0) c.nullDb = -std::numeric_limits<double>::infinity();
+
+    for (int ch = 0; ch < 2 && !c.exact; ++ch) {
+        const std::vector<double> a = bandEnergiesDb(out, ch, rate);
+        const std::vector<double> b = bandEnergiesDb(ref, ch, rate);
+        const double loudest = b.empty() ? 0.0 : *std::max_element(b.begin(), b.end());
+        for (size_t i = 0; i < std::min(a.size(), b.size()); ++i) {
+            if (b[i] < loudest - 60.0) continue;
+            c.spectralDb = std::max(c.spectralDb, std::fabs(a[i] - b[i]));
+        }
+    }
+    return c;
+}
+
+static const Limits& limitsFor(const Budget& budget, float rate) {
+    return rate > 48000.0f ? budget.highRate : budget.base;
+}
+
+static bool withinBudget(const Comparison& c, const Budget& budget, float rate, double loosenDb) {
+    if (!c.finite) return false;
+    if (budget.bitExact) return c.exact;
+    const Limits& l = limitsFor(budget, rate);
+    return c.maxAbsDb <= l.maxAbsDb + loosenDb && c.nullDb <= l.nullDb + loosenDb &&
+           c.spectralDb <= l.spectralDb * std::pow(10.0, loosenDb / 20.0);
+}
+
+static std::string fmtDb(double v) {
+    if (std::isinf(v)) return "-inf";
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.1f", v);
+    return buf;
+}
+
+// ============================================
+// CHECKSUM MANIFEST
+// ============================================
+// Text, one case per line:
+//   <preset> <signal> <rate> <block> <frames> <inputHash> <outputHash>
+//   peak L R rms L R seg <n> L R ... bands <n> L R ...
+// Linear values %.9g, band energies dB %.4f. '#' lines are comments.
+
+static const char* SUMS_HEADER = "# aurivo_dsp_golden checksums v1";
+static const int SEGMENT_MS = 100;
+
+struct CaseSums {
+    std::string preset;
+    std::string signal;
+    uint32_t rate = 0;
+    uint32_t block = 0;
+    uint64_t frames = 0;
+    uint64_t inputHash = 0;
+    uint64_t outputHash = 0;
+    double peak[2] = { 0.0, 0.0 };
+    double rms[2] = { 0.0, 0.0 };
+    std::vector<double> segments;        // L/R interleaved segment RMS
+    std::vector<double> bands;           // L/R interleaved band energies, dB
+
+    std::string key() const { return preset + " " + signal + " " + std::to_string(rate); }
+};
+
+static CaseSums summarize(const std::vector<float>& out, float rate) {
+    CaseSums c;
+    c.frames = out.size() / 2;
+    c.outputHash = fnv1a(out);
+    const size_t segFrames = std::max<size_t>(1, (size_t)(rate * SEGMENT_MS / 1000.0f));
+    double total[2] = { 0.0, 0.0 };
+    for (size_t start = 0; start < c.frames; start += segFrames) {
+        const size_t end = std::min<size_t>(c.frames, start + segFrames);
+        double e[2] = { 0.0, 0.0 };
+        for (size_t i = start; i < end; ++i) {
+            for (int ch = 0; ch < 2; ++ch) {
+                const double v = out[i * 2 + ch];
+                e[ch] += v * v;
+                c.peak[ch] = std::max(c.peak[ch], std::fabs(v));
+            }
+        }
+        for (int ch = 0; ch < 2; ++ch) {
+            c.segments.push_back(std::sqrt(e[ch] / (double)(end - start)));
+            total[ch] += e[ch];
+        }
+    }
+    for (int ch = 0; ch < 2; ++ch) c.rms[ch] = c.frames ? std::sqrt(total[ch] / (double)c.frames) : 0.0;
+    const std::vector<double> l = bandEnergiesDb(out, 0, rate);
+    const std::vector<double> r = bandEnergiesDb(out, 1, rate);
+    for (size_t i = 0; i < std::min(l.size(), r.size()); ++i) {
+        c.bands.push_back(l[i]);
+        c.bands.push_back(r[i]);
+    }
+    return c;
+}
+
+static bool writeSums(const std::string& path, const std::vector<CaseSums>& cases) {
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) return false;
+    fprintf(f, "%s\n# regenerate: cmake --build . --target record_dsp_golden (see aurivo_dsp_golden.cpp)\n", SUMS_HEADER);
+    for (const CaseSums& c : cases) {
+        fprintf(f, "%s %s %u %u %llu %016llx %016llx\n", c.preset.c_str(), c.signal.c_str(), c.rate, c.block,
+                (unsigned long long)c.frames, (unsigned long long)c.inputHash, (unsigned long long)c.outputHash);
+        fprintf(f, "  peak %.9g %.9g rms %.9g %.9g seg %zu", c.peak[0], c.peak[1], c.rms[0], c.rms[1], c.segments.size() / 2);
+        for (double v : c.segments) fprintf(f, " %.9g", v);
+        fprintf(f, " bands %zu", c.bands.size() / 2);
+        for (double v : c.bands) fprintf(f, " %.4f", v);
+        fprintf(f, "\n");
+    }
+    return fclose(f) == 0;
+}
+
+static bool readSums(const std::string& path, std::vector<CaseSums>& cases, std::string& error) {
+    FILE* f = fopen(path.c_str(), "r");
+    if (!f) {
+        error = "missing";
+        return false;
+    }
+    char line[256];
+    bool ok = fgets(line, sizeof(line), f) && strncmp(line, SUMS_HEADER, strlen(SUMS_HEADER)) == 0;
+    if (!ok) error = "not a checksum manifest (or wrong version)";
+    while (ok) {
+        int ch = fgetc(f);
+        while (ch == '#' || isspace(ch)) {
+            if (ch == '#') {
+                while (ch != EOF && ch != '\n') ch = fgetc(f);
+            }
+            ch = fgetc(f);
+        }
+        if (ch == EOF) break;
+        ungetc(ch, f);
+
+        CaseSums c;
+        char preset[64], signal[128];
+        unsigned long long frames = 0, inHash = 0, outHash = 0;
+        size_t segs = 0, bands = 0;
+        ok = fscanf(f, "%63s %127s %u %u %llu %llx %llx", preset, signal, &c.rate, &c.block, &frames, &inHash, &outHash) == 7;
+        ok = ok && fscanf(f, " peak %lf %lf rms %lf %lf seg %zu", &c.peak[0], &c.peak[1], &c.rms[0], &c.rms[1], &segs) == 5;
+        ok = ok && segs < (1u << 20);
+        c.segments.resize(segs * 2);
+        for (size_t i = 0; ok && i < c.segments.size(); ++i) ok = fscanf(f, "%lf", &c.segments[i]) == 1;
+        ok = ok && fscanf(f, " bands %zu", &bands) == 1 && bands < 1024;
+        c.bands.resize(bands * 2);
+        for (size_t i = 0; ok && i < c.bands.size(); ++i) ok = fscanf(f, "%lf", &c.bands[i]) == 1;
+        if (!ok) {
+            error = "malformed entry after " + (cases.empty() ? std::string("header") : cases.back().key());
+            break;
+        }
+        c.preset = preset;
+        c.signal = signal;
+        c.frames = frames;
+        c.inputHash = inHash;
+        c.outputHash = outHash;
+        cases.push_back(c);
+    }
+    fclose(f);
+    return ok;
+}
+
+struct SumsComparison {
+    bool exact = false;
+    double peakDb = -std::numeric_limits<double>::infinity();     // worst |d peak|, dBFS
+    double segmentDb = -std::numeric_limits<double>::infinity();  // worst |d segment rms|, dBFS
+    double levelDb = -std::numeric_limits<double>::infinity();    // worst |d rms| / rms(ref), dB
+    double spectralDb = 0.0;
+};
+
+// Rounding of the %.9g text, so an unchanged output never fails
+static double textSlack(double v) { return std::fabs(v) * 1e-8 + 1e-12; }
+
+static SumsComparison compareSums(const CaseSums& out, const CaseSums& ref) {
+    SumsComparison c;
+    c.exact = out.outputHash == ref.outputHash;
+    double peak = 0.0, seg = 0.0;
+    for (int ch = 0; ch < 2; ++ch) {
+        peak = std::max(peak, std::max(0.0, std::fabs(out.peak[ch] - ref.peak[ch]) - textSlack(ref.peak[ch])));
+    }
+    for (size_t i = 0; i < std::min(out.segments.size(), ref.segments.size()); ++i) {
+        seg = std::max(seg, std::max(0.0, std::fabs(out.segments[i] - ref.segments[i]) - textSlack(ref.segments[i])));
+    }
+    c.peakDb = toDb(peak);
+    c.segmentDb = toDb(seg);
+    // Per channel |d rms| <= rms(out - ref) <= null * sqrt(rmsL^2 + rmsR^2)
+    const double refLevel = std::sqrt(ref.rms[0] * ref.rms[0] + ref.rms[1] * ref.rms[1]);
+    double level = 0.0;
+    for (int ch = 0; ch < 2; ++ch) {
+        level = std::max(level, std::max(0.0, std::fabs(out.rms[ch] - ref.rms[ch]) - textSlack(ref.rms[ch])));
+    }
+    c.levelDb = refLevel > 0.0 ? toDb(level / refLevel) : toDb(level);
+
+    for (int ch = 0; ch < 2; ++ch) {
+        double loudest = -std::numeric_limits<double>::infinity();
+        for (size_t i = ch; i < ref.bands.size(); i += 2) loudest = std::max(loudest, ref.bands[i]);
+        for (size_t i = ch; i < std::min(out.bands.size(), ref.bands.size()); i += 2) {
+            if (ref.bands[i] < loudest - 60.0) continue;
+            c.spectralDb = std::max(c.spectralDb, std::max(0.0, std::fabs(out.bands[i] - ref.bands[i]) - 1e-4));
+        }
+    }
+    return c;
+}
+
+// ============================================
+// MAIN
+// ============================================
+
+struct GoldenOptions {
+    bool record = false;
+    bool sums = false;              // path is a checksum manifest, not a reference directory
+    std::string path;
+    std::vector<float> rates = { 44100.0f, 96000.0f };
+    bool ratesGiven = false;
+    int block = 512;
+    double loosenDb = 0.0;
+    std::string presetFilter;       // comma list, empty = all
+    std::string signalFilter;
+    std::vector<std::string> clips;
+};
+
+static void printUsage() {
+    fprintf(stderr,
+            "Usage: aurivo_dsp_golden (--record DIR | --check DIR | --record-sums FILE | --check-sums FILE) [options]\n"
+            "  --record DIR         render every preset/signal and store references in DIR\n"
+            "  --check DIR          render again and compare against DIR (exit 1 on failure)\n"
+            "  --record-sums FILE   write the checksum manifest (committed as dsp_golden/reference.txt)\n"
+            "  --check-sums FILE    compare against the manifest; a case without an entry fails\n"
+            "  --preset a,b,...     presets to run (default: all)\n"
+            "  --signal a,b,...     signals to run (default: all)\n"
+            "  --rates 44100,...    sample rates for synthetic signals (default 44100,96000)\n"
+            "  --block N            frames per process_dsp call when recording (default 512)\n"
+            "  --clip path.wav      add a recording as a signal at its own rate (repeatable)\n"
+            "  --loosen dB          widen every budget by dB (negative tightens)\n"
+            "  --list               list presets, budgets and signals\n");
+}
+
+static std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> out;
+    size_t start = 0;
+    while (start <= text.size()) {
+        const size_t comma = text.find(',', start);
+        const std::string item = text.substr(start, comma == std::string::npos ? std::string::npos : comma - start);
+        if (!item.empty()) out.push_back(item);
+        if (comma == std::string::npos) break;
+        start = comma + 1;
+    }
+    return out;
+}
+
+static bool selected(const std::vector<std::string>& wanted, const std::string& name) {
+    return wanted.empty() || std::find(wanted.begin(), wanted.end(), name) != wanted.end();
+}
+
+static bool withinSums(const SumsComparison& c, const Budget& budget, float rate, double loosenDb) {
+    if (c.exact) return true;
+    if (budget.bitExact) return false;
+    const Limits& l = limitsFor(budget, rate);
+    return c.peakDb <= l.maxAbsDb + loosenDb && c.segmentDb <= l.maxAbsDb + loosenDb &&
+           c.levelDb <= l.nullDb + loosenDb && c.spectralDb <= l.spectralDb * std::pow(10.0, loosenDb / 20.0);
+}
+
+static bool finiteSamples(const std::vector<float>& samples) {
+    for (float v : samples) {
+        if (!std::isfinite(v)) return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    GoldenOptions options;
+    const std::vector<GoldenPreset> presets = makePresets();
+    std::vector<GoldenSignal> signals = makeSignals();
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if ((arg == "--record" || arg == "--check" || arg == "--record-sums" || arg == "--check-sums") && hasValue) {
+            options.record = arg == "--record" || arg == "--record-sums";
+            options.sums = arg == "--record-sums" || arg == "--check-sums";
+            options.path = argv[++i];
+        } else if (arg == "--preset" && hasValue) {
+            options.presetFilter = argv[++i];
+        } else if (arg == "--signal" && hasValue) {
+            options.signalFilter = argv[++i];
+        } else if (arg == "--rates" && hasValue) {
+            options.rates.clear();
+            options.ratesGiven = true;
+            for (const std::string& v : splitList(argv[++i])) options.rates.push_back(std::max(8000.0f, strtof(v.c_str(), nullptr)));
+        } else if (arg == "--block" && hasValue) {
+            options.block = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--clip" && hasValue) {
+            options.clips.push_back(argv[++i]);
+        } else if (arg == "--loosen" && hasValue) {
+            options.loosenDb = strtod(argv[++i], nullptr);
+        } else if (arg == "--list") {
+            for (const GoldenPreset& p : presets) {
+                if (p.budget.bitExact) {
+                    printf("%-12s %-44s bit-exact\n", p.name, p.description);
+                } else {
+                    const Limits& b = p.budget.base;
+                    const Limits& h = p.budget.highRate;
+                    printf("%-12s %-44s maxAbs %.0f/%.0f dBFS, null %.0f/%.0f dB, spectral %.2f/%.2f dB\n", p.name,
+                           p.description, b.maxAbsDb, h.maxAbsDb, b.nullDb, h.nullDb, b.spectralDb, h.spectralDb);
+                }
+            }
+            printf("(budgets: up to 48 kHz / above)\nsignals:");
+            for (const GoldenSignal& s : signals) printf(" %s", s.name.c_str());
+            printf(" (+ --clip recordings)\n");
+            return 0;
+        } else {
+            printUsage();
+            return arg == "-h" || arg == "--help" ? 0 : 2;
+        }
+    }
+    if (options.path.empty()) {
+        printUsage();
+        return 2;
+    }
+
+    for (const std::string& path : options.clips) {
+        GoldenSignal clip;
+        std::string error;
+        clip.name = clipName(path);
+        if (!loadWav(path, clip.samples, clip.rate, error)) {
+            fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+            return 1;
+        }
+        signals.push_back(clip);
+    }
+
+    // Manifest: read up front for --check-sums, collected for --record-sums
+    std::vector<CaseSums> manifest;
+    if (options.sums && !options.record) {
+        std::string error;
+        if (!readSums(options.path, manifest, error)) {
+            fprintf(stderr, "%s: %s\n", options.path.c_str(), error.c_str());
+            return 1;
+        }
+    }
+    std::vector<bool> manifestUsed(manifest.size(), false);
+
+#if AURIVO_HAS_SSE
+    // Audio thread'leriyle aynı: denormaller sıfıra (FTZ/DAZ)
+    _mm_setcsr(_mm_getcsr() | 0x8040);
+#endif
+
+    const std::vector<std::string> wantedPresets = splitList(options.presetFilter);
+    const std::vector<std::string> wantedSignals = splitList(options.signalFilter);
+    int passed = 0, failed = 0, missing = 0, recorded = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+
+    for (const GoldenSignal& signal : signals) {
+        if (!selected(wantedSignals, signal.name)) continue;
+        std::vector<float> rates = options.rates;
+        if (signal.rate) rates.assign(1, (float)signal.rate);
+
+        for (float rate : rates) {
+            const std::string suffix = "__" + signal.name + "__" + std::to_string((int)rate) + ".agld";
+            const std::string inputPath = options.path + "/input" + suffix;
+            std::vector<float> input;
+            if (options.sums) {
+                // Manifest carries the input hash only; clips are 16-bit files
+                input = signal.make ? signal.make(rate) : signal.samples;
+            } else if (options.record) {
+                GoldenFile g;
+                g.rate = (uint32_t)rate;
+                g.block = (uint32_t)options.block;
+                g.samples = signal.make ? signal.make(rate) : signal.samples;
+                g.inputHash = fnv1a(g.samples);
+                if (!writeGolden(inputPath, g)) {
+                    fprintf(stderr, "cannot write %s\n", inputPath.c_str());
+                    return 1;
+                }
+                input.swap(g.samples);
+            } else {
+                GoldenFile g;
+                std::string error;
+                if (!readGolden(inputPath, g, error) || fnv1a(g.samples) != g.inputHash) {
+                    fprintf(stderr, "MISS  %-12s %-16s %6.0f  input %s\n", "*", signal.name.c_str(), rate,
+                            error.empty() ? "hash mismatch" : error.c_str());
+                    ++missing;
+                    continue;
+                }
+                input.swap(g.samples);
+            }
+            const uint64_t inputHash = fnv1a(input);
+
+            for (const GoldenPreset& preset : presets) {
+                if (!selected(wantedPresets, preset.name)) continue;
+                const std::string path = options.path + "/" + preset.name + suffix;
+
+                if (options.sums && options.record) {
+                    const std::vector<float> out = render(preset, rate, options.block, input);
+                    if (!finiteSamples(out)) {
+                        fprintf(stderr, "NON-FINITE %s/%s@%.0f, not recorded\n", preset.name, signal.name.c_str(), rate);
+                        ++failed;
+                        continue;
+                    }
+                    CaseSums c = summarize(out, rate);
+                    c.preset = preset.name;
+                    c.signal = signal.name;
+                    c.rate = (uint32_t)rate;
+                    c.block = (uint32_t)options.block;
+                    c.inputHash = inputHash;
+                    manifest.push_back(c);
+                    ++recorded;
+                    continue;
+                }
+
+                if (options.sums) {
+                    const std::string key = std::string(preset.name) + " " + signal.name + " " + std::to_string((uint32_t)rate);
+                    size_t entry = manifest.size();
+                    for (size_t m = 0; m < manifest.size(); ++m) {
+                        if (manifest[m].key() == key) { entry = m; break; }
+                    }
+                    if (entry == manifest.size()) {
+                        fprintf(stderr, "MISS  %-12s %-16s %6.0f  no entry in %s\n", preset.name, signal.name.c_str(), rate,
+                                options.path.c_str());
+                        ++missing;
+                        continue;
+                    }
+                    manifestUsed[entry] = true;
+                    const CaseSums& ref = manifest[entry];
+                    const std::vector<float> out = render(preset, rate, (int)ref.block, input);
+                    if (out.size() / 2 != ref.frames || !finiteSamples(out)) {
+                        fprintf(stderr, "FAIL  %-12s %-16s %6.0f  %s\n", preset.name, signal.name.c_str(), rate,
+                                finiteSamples(out) ? "length differs from the reference" : "NON-FINITE OUTPUT");
+                        ++failed;
+                        continue;
+                    }
+                    SumsComparison c = compareSums(summarize(out, rate), ref);
+                    // A bit-exact preset passes its input through; if the generators
+                    // drifted on this build, hold it to that instead of the old hash
+                    if (preset.budget.bitExact && ref.inputHash != inputHash) c.exact = fnv1a(out) == inputHash;
+                    const bool ok = withinSums(c, preset.budget, rate, options.loosenDb);
+                    ok ? ++passed : ++failed;
+                    char detail[160] = "hash match";
+                    if (!c.exact) {
+                        snprintf(detail, sizeof(detail), "peak %7s dBFS  seg %7s dBFS  level %7s dB  spectral %.3f dB",
+                                 fmtDb(c.peakDb).c_str(), fmtDb(c.segmentDb).c_str(), fmtDb(c.levelDb).c_str(), c.spectralDb);
+                    }
+                    fprintf(stderr, "%s  %-12s %-16s %6.0f  %s%s\n", ok ? "PASS" : "FAIL", preset.name, signal.name.c_str(),
+                            rate, detail, ref.inputHash != inputHash ? "  (input differs from the recording)" : "");
+                    continue;
+                }
+
+                if (options.record) {
+                    GoldenFile g;
+                    g.rate = (uint32_t)rate;
+                    g.block = (uint32_t)options.block;
+                    g.inputHash = inputHash;
+                    g.samples = render(preset, rate, options.block, input);
+                    if (!finiteSamples(g.samples)) {
+                        fprintf(stderr, "NON-FINITE %s/%s@%.0f, not recorded\n", preset.name, signal.name.c_str(), rate);
+                        ++failed;
+                        continue;
+                    }
+                    if (!writeGolden(path, g)) {
+                        fprintf(stderr, "cannot write %s\n", path.c_str());
+                        return 1;
+                    }
+                    ++recorded;
+                    continue;
+                }
+
+                GoldenFile ref;
+                std::string error;
+                if (!readGolden(path, ref, error)) {
+                    fprintf(stderr, "MISS  %-12s %-16s %6.0f  %s\n", preset.name, signal.name.c_str(), rate, error.c_str());
+                    ++missing;
+                    continue;
+                }
+                // Same block size as the recording: smoothing is per block
+                const std::vector<float> out = render(preset, rate, (int)ref.block, input);
+                if (out.size() != ref.samples.size()) {
+                    fprintf(stderr, "FAIL  %-12s %-16s %6.0f  length %zu != reference %zu\n", preset.name,
+                            signal.name.c_str(), rate, out.size() / 2, ref.samples.size() / 2);
+                    ++failed;
+                    continue;
+                }
+                const Comparison c = compare(out, ref.samples, rate);
+                const bool ok = withinBudget(c, preset.budget, rate, options.loosenDb);
+                ok ? ++passed : ++failed;
+                fprintf(stderr, "%s  %-12s %-16s %6.0f  maxAbs %7s dBFS  null %7s dB  spectral %.3f dB%s%s\n",
+                        ok ? "PASS" : "FAIL", preset.name, signal.name.c_str(), rate, fmtDb(c.maxAbsDb).c_str(),
+                        fmtDb(c.nullDb).c_str(), c.spectralDb, c.finite ? "" : "  NON-FINITE OUTPUT",
+                        ref.inputHash != inputHash ? "  (reference from another input)" : "");
+            }
+        }
+    }
+
+    // Unfiltered check: every manifest entry must have run (e.g. a clip left off)
+    if (options.sums && !options.record && wantedPresets.empty() && wantedSignals.empty() && !options.ratesGiven) {
+        for (size_t m = 0; m < manifest.size(); ++m) {
+            if (manifestUsed[m]) continue;
+            fprintf(stderr, "MISS  %-12s %-16s %6u  in %s but not rendered (signal not available?)\n",
+                    manifest[m].preset.c_str(), manifest[m].signal.c_str(), manifest[m].rate, options.path.c_str());
+            ++missing;
+        }
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    if (options.record) {
+        if (options.sums && recorded && !writeSums(options.path, manifest)) {
+            fprintf(stderr, "cannot write %s\n", options.path.c_str());
+            return 1;
+        }
+        fprintf(stderr, "%d references written to %s (%.1f s)%s\n", recorded, options.path.c_str(), seconds,
+                failed ? ", some outputs were non-finite" : "");
+        return failed || recorded == 0 ? 1 : 0;
+    }
+    fprintf(stderr, "%d passed, %d failed, %d missing (%.1f s)\n", passed, failed, missing, seconds);
+    return failed || missing || passed == 0 ? 1 : 0;
+}
@@ -0,0 +1,299 @@
+#pragma once
+
+// Shared helpers for the headless DSP tools (aurivo_dsp_bench, aurivo_dsp_golden):
+// the aurivo_dsp.cpp C API, deterministic test signals and a minimal WAV reader.
+// Signals are stereo interleaved float; everything here is reproducible
+// bit-for-bit from the same arguments.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Aurivo DSP C API (aurivo_dsp.cpp)
+extern "C" {
+    void* create_dsp();
+    void destroy_dsp(void* dsp);
+    void process_dsp(void* dsp, float* buffer, int numFrames, int channels);
+    void set_eq_bands(void* dsp, const float* gains, int numBands);
+    void set_tone_params(void* dsp, float bass, float mid, float treble);
+    void set_stereo_width(void* dsp, float width);
+    void set_master_toggle(void* dsp, int active);
+    void set_dsp_enabled(void* dsp, int enabled);
+    void set_sample_rate(void* dsp, float sample_rate);
+    void set_compressor_params(void *dsp, int enabled, float thresh, float ratio, float att, float rel, float makeup);
+    void set_gate_params(void *dsp, int enabled, float thresh, float att, float rel);
+    void set_limiter_params(void *dsp, int enabled, float ceiling, float rel);
+    void set_echo_params(void *dsp, int enabled, float delay, float feedback, float mix);
+    void set_bass_boost(void *dsp, int enabled, float gain, float freq);
+    void set_peq_band(void *dsp, int band, int enabled, float freq, float gain, float Q);
+    void set_peq_filter_type(void *dsp, int band, int filterType);
+    void set_crossfeed_params(void *dsp, int enabled, float level, float delay, float lowCut, float highCut);
+    void set_bass_mono_params(void *dsp, int enabled, float cutoff, float slope, float width);
+    void set_dynamic_eq_params(void *dsp, int enabled, float freq, float q, float thr, float gain, float rng, float atk, float rel);
+}
+
+namespace AurivoDspTools {
+
+static const int NUM_EQ_BANDS = 32;
+static const int NUM_PEQ_BANDS = 6;
+
+// Neutral start like the engine's initial MasterDSP block: the constructor
+// leaves every EQ band and the tone at +1 dB. Smart mode off unless asked.
+static inline void resetToNeutral(void* dsp, float rate, bool smart) {
+    const float flat[NUM_EQ_BANDS] = {};
+    set_sample_rate(dsp, rate);
+    set_dsp_enabled(dsp, 1);
+    set_master_toggle(dsp, smart ? 1 : 0);
+    set_eq_bands(dsp, flat, NUM_EQ_BANDS);
+    set_tone_params(dsp, 0.0f, 0.0f, 0.0f);
+}
+
+// ============================================
+// DETERMINISTIC SIGNALS
+// ============================================
+
+class Lcg {
+public:
+    explicit Lcg(uint32_t seed) : m_state(seed) {}
+    float next() {   // [-1, 1)
+        m_state = 1664525u * m_state + 1013904223u;
+        return (float)(m_state >> 8) / 8388608.0f - 1.0f;
+    }
+
+private:
+    uint32_t m_state;
+};
+
+// Paul Kellet's economy pink filter (-3 dB/oct within ~0.5 dB)
+class PinkFilter {
+public:
+    float process(float white) {
+        b0 = 0.99765f * b0 + white * 0.0990460f;
+        b1 = 0.96300f * b1 + white * 0.2965164f;
+        b2 = 0.57000f * b2 + white * 1.0526913f;
+        return (b0 + b1 + b2 + white * 0.1848f) * 0.11f;
+    }
+
+private:
+    float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f;
+};
+
+static inline void applyFades(std::vector<float>& s, float rate, float ms) {
+    const size_t frames = s.size() / 2;
+    const size_t n = std::min(frames / 2, (size_t)(rate * ms * 0.001f));
+    for (size_t i = 0; i < n; ++i) {
+        const float g = (float)i / (float)n;
+        for (int c = 0; c < 2; ++c) {
+            s[i * 2 + c] *= g;
+            s[(frames - 1 - i) * 2 + c] *= g;
+        }
+    }
+}
+
+// Music-like stereo: log sweep + two partials + pink-ish noise, with a slow
+// amplitude envelope so dynamics stages move (benchmark load signal).
+static inline std::vector<float> makeBenchSignal(float rate, int frames) {
+    std::vector<float> out((size_t)frames * 2);
+    Lcg rng(12345u);
+    float pinkL = 0.0f, pinkR = 0.0f;
+    double phase = 0.0;
+    const double f0 = 30.0, f1 = std::min(18000.0, rate * 0.45);
+    const double sweepSeconds = 4.0;
+    for (int i = 0; i < frames; ++i) {
+        const double t = (double)i / rate;
+        const double k = std::fmod(t, sweepSeconds) / sweepSeconds;
+        phase += 2.0 * M_PI * f0 * std::pow(f1 / f0, k) / rate;
+        const float n1 = rng.next();
+        const float n2 = rng.next();
+        pinkL = 0.97f * pinkL + 0.03f * n1;
+        pinkR = 0.97f * pinkR + 0.03f * n2;
+        const float env = 0.35f + 0.3f * (float)std::sin(2.0 * M_PI * 0.5 * t);
+        const float tone = (float)(0.5 * std::sin(phase) + 0.2 * std::sin(2.0 * M_PI * 110.0 * t));
+        out[(size_t)i * 2] = env * (tone + 2.0f * pinkL);
+        out[(size_t)i * 2 + 1] = env * (0.9f * tone + 2.0f * pinkR);
+    }
+    return out;
+}
+
+// Log sine sweep 20 Hz -> 0.45 * rate, -6 dBFS, right channel 90° shifted
+static inline std::vector<float> makeSweep(float rate, int frames) {
+    std::vector<float> out((size_t)frames * 2);
+    const double f0 = 20.0, f1 = rate * 0.45;
+    const double duration = (double)frames / rate;
+    const double k = std::log(f1 / f0);
+    for (int i = 0; i < frames; ++i) {
+        const double t = (double)i / rate;
+        const double phase = 2.0 * M_PI * f0 * duration / k * (std::exp(t / duration * k) - 1.0);
+        out[(size_t)i * 2] = (float)(0.5 * std::sin(phase));
+        out[(size_t)i * 2 + 1] = (float)(0.5 * std::cos(phase));
+    }
+    applyFades(out, rate, 10.0f);
+    return out;
+}
+
+// Decorrelated stereo pink noise around -15 dBFS RMS
+static inline std::vector<float> makePinkNoise(float rate, int frames) {
+    std::vector<float> out((size_t)frames * 2);
+    Lcg rng(0xC0FFEEu);
+    PinkFilter pl, pr;
+    for (int i = 0; i < frames; ++i) {
+        out[(size_t)i * 2] = 0.5f * pl.process(rng.next());
+        out[(size_t)i * 2 + 1] = 0.5f * pr.process(rng.next());
+    }
+    applyFades(out, rate, 10.0f);
+    return out;
+}
+
+// Unit impulses every 250 ms: left, right, both (filter impulse responses)
+static inline std::vector<float> makeImpulses(float rate, int frames) {
+    std::vector<float> out((size_t)frames * 2, 0.0f);
+    const int spacing = std::max(1, (int)(rate * 0.25f));
+    for (int i = spacing / 4, n = 0; i < frames; i += spacing, ++n) {
+        if (n % 3 != 1) out[(size_t)i * 2] = 0.9f;
+        if (n % 3 != 0) out[(size_t)i * 2 + 1] = 0.9f;
+    }
+    return out;
+}
+
+// Drum-like noise bursts (1 ms attack, 60 ms decay) over a tone that steps
+// from -40 to -6 dBFS halfway: exercises attack/release of the dynamics
+static inline std::vector<float> makeTransients(float rate, int frames) {
+    std::vector<float> out((size_t)frames * 2);
+    Lcg rng(0xBEEFu);
+    const int period = std::max(1, (int)(rate * 0.3f));
+    const float attack = rate * 0.001f;
+    const float decay = std::exp(-1.0f / (rate * 0.06f));
+    float env = 0.0f;
+    for (int i = 0; i < frames; ++i) {
+        const int pos = i % period;
+        if (pos == 0) env = 0.0f;
+        env = (pos < attack) ? (float)pos / attack : env * decay;
+        const float level = (i < frames / 2) ? 0.01f : 0.5f;
+        const float tone = level * (float)std::sin(2.0 * M_PI * 220.0 * i / rate);
+        const float burst = 0.8f * env;
+        out[(size_t)i * 2] = tone + burst * rng.next();
+        out[(size_t)i * 2 + 1] = tone + burst * rng.next();
+    }
+    return out;
+}
+
+// Short synthetic "music clip": bass line, triad pad, kick and hi-hat at
+// 120 BPM. Stands in for bundled recordings (add real ones with --clip).
+static inline std::vector<float> makeMusicClip(float rate, int frames) {
+    std::vector<float> out((size_t)frames * 2);
+    static const float roots[4] = { 55.0f, 43.65f, 49.0f, 41.2f };   // A1 F1 G1 E1
+    const int beat = std::max(1, (int)(rate * 0.5f));
+    Lcg rng(0x5EEDu);
+    float hatPrev = 0.0f;
+    for (int i = 0; i < frames; ++i) {
+        const double t = (double)i / rate;
+        const int bar = (i / (beat * 4)) % 4;
+        const int pos = i % beat;
+        const double root = roots[bar];
+        const double ts = (double)pos / rate;
+
+        const float bass = 0.30f * (float)std::sin(2.0 * M_PI * root * t) * (float)std::exp(-ts * 3.0);
+        float pad = 0.0f;
+        static const float ratios[3] = { 4.0f, 5.04f, 6.0f };            // triad two octaves up
+        for (int v = 0; v < 3; ++v) {
+            const double f = root * ratios[v];
+            pad += (float)(std::sin(2.0 * M_PI * f * t) + 0.3 * std::sin(4.0 * M_PI * f * t));
+        }
+        pad *= 0.06f;
+        const double kickPhase = 2.0 * M_PI * (50.0 * ts + 60.0 * (1.0 - std::exp(-ts * 30.0)) / 30.0);
+        const float kick = 0.6f * (float)std::sin(kickPhase) * (float)std::exp(-ts * 12.0);
+        const int half = beat / 2;
+        const double th = (double)(i % half) / rate;
+        const float white = rng.next();
+        const float hat = 0.15f * (white - hatPrev) * (float)std::exp(-th * 60.0);   // first difference = high-pass
+        hatPrev = white;
+
+        out[(size_t)i * 2] = bass + kick + 1.1f * pad + hat;
+        out[(size_t)i * 2 + 1] = bass + kick + 0.9f * pad - 0.7f * hat;
+    }
+    applyFades(out, rate, 5.0f);
+    return out;
+}
+
+// ============================================
+// WAV READER
+// ============================================
+
+static inline uint32_t readLE(const unsigned char* p, int bytes) {
+    uint32_t v = 0;
+    for (int i = 0; i < bytes; ++i) v |= (uint32_t)p[i] << (8 * i);
+    return v;
+}
+
+// Minimal RIFF/WAVE reader: 16/24-bit PCM or 32-bit float, any channel
+// count (first two kept, mono duplicated). rate receives the file's rate.
+static inline bool loadWav(const std::string& path, std::vector<float>& out, uint32_t& rate, std::string& error) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<unsigned char> data;
+    unsigned char chunk[4096];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + got);
+    fclose(f);
+
+    if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 || memcmp(data.data() + 8, "WAVE", 4) != 0) {
+        error = "not a RIFF/WAVE file";
+        return false;
+    }
+    int format = 0, channels = 0, bits = 0;
+    size_t pos = 12;
+    while (pos + 8 <= data.size()) {
+        const uint32_t size = readLE(&data[pos + 4], 4);
+        const unsigned char* body = &data[pos + 8];
+        if (memcmp(&data[pos], "fmt ", 4) == 0 && size >= 16) {
+            format = (int)readLE(body, 2);
+            channels = (int)readLE(body + 2, 2);
+            rate = readLE(body + 4, 4);
+            bits = (int)readLE(body + 14, 2);
+            if (format == 0xFFFE && size >= 26) format = (int)readLE(body + 24, 2);   // WAVE_FORMAT_EXTENSIBLE
+        } else if (memcmp(&data[pos], "data", 4) == 0 && channels > 0) {
+            const int bytes = bits / 8;
+            const bool pcm = format == 1 && (bits == 16 || bits == 24);
+            const bool flt = format == 3 && bits == 32;
+            if (!pcm && !flt) {
+                error = "unsupported WAV format (16/24-bit PCM or 32-bit float)";
+                return false;
+            }
+            const size_t available = std::min<size_t>(size, data.size() - (pos + 8));
+            const size_t frames = available / ((size_t)bytes * channels);
+            out.resize(frames * 2);
+            for (size_t i = 0; i < frames; ++i) {
+                for (int c = 0; c < 2; ++c) {
+                    const unsigned char* s = body + (i * channels + std::min(c, channels - 1)) * bytes;
+                    float v;
+                    if (flt) {
+                        memcpy(&v, s, sizeof(v));
+                    } else if (bits == 16) {
+                        v = (float)(int16_t)readLE(s, 2) / 32768.0f;
+                    } else {
+                        v = (float)((int32_t)(readLE(s, 3) << 8) >> 8) / 8388608.0f;
+                    }
+                    out[i * 2 + c] = v;
+                }
+            }
+            if (frames == 0) error = "empty data chunk";
+            return frames > 0;
+        }
+        pos += 8 + size + (size & 1);
+    }
+    error = "no data chunk";
+    return false;
+}
+
+} // namespace AurivoDspTools
@@ -0,0 +1,201 @@
+// ============================================
+// AURIVO ENGINE STRESS - gapless geçiş / yükleme yarışı
+// Headless: BASS "ses yok" cihazı, Node / ses kartı gerekmez
+// ============================================
+//
+// Drives the real engine (aurivo_audio.cpp built without the N-API layer) so
+// that the mixer's gapless advance and a new load race each other:
+//
+//   control thread   loadFile(A) + play, preloadNext(B, gapless), then a new
+//                    loadFile right around the end of A, while the mixer may
+//                    be switching to B on the audio thread
+//   noise thread     preloadNext / cancelPreload / latency profile changes
+//                    (output reopen), master-bus mode and tape / dither
+//                    toggles at random moments
+//   lock thread      keeps taking the engine mutex
+//
+// AURIVO_ENGINE_STRESS also delays the reclaimer's onMixerAdvanced by a few
+// ms, so a load regularly commits between the mixer switching chains and the
+// engine hearing about it (the window is microseconds in production).
+//
+// A chain that is freed twice or used after the reclaimer released it shows
+// up as a crash (the harness is built with AddressSanitizer where the compiler
+// supports it). Exit 1 if no gapless advance happened at all, i.e. the race
+// was never exercised, or if the callback profiler recorded no output blocks.
+//
+//   aurivo_engine_stress [--iterations N] [--dir tmpdir]
+
+#define AURIVO_RENDER_CLI
+#define AURIVO_NO_RENDER_MAIN
+#define AURIVO_ENGINE_STRESS
+#include "aurivo_audio.cpp"
+
+#include <random>
+#include <thread>
+
+#if defined(__SANITIZE_ADDRESS__)
+// libbass_fx kendi içinde malloc'la ayırıp delete[] ile bırakıyor (bizim kodumuz değil)
+extern "C" const char* __asan_default_options() { return "alloc_dealloc_mismatch=0"; }
+#endif
+
+namespace {
+
+constexpr int TRACK_RATE = 44100;     // cihaz hızından farklı: resampler da çalışır
+constexpr int TRACK_MS = 80;         // kısa parçalar: her saniye birkaç geçiş
+constexpr int NUM_TRACKS = 4;
+
+bool writeSineWav(const std::string& path, double freq, int ms) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    const uint32_t frames = (uint32_t)((int64_t)TRACK_RATE * ms / 1000);
+    const uint32_t dataBytes = frames * 2 * sizeof(int16_t);
+    const uint32_t riffBytes = 36 + dataBytes;
+    const uint16_t fmtTag = 1, channels = 2, blockAlign = 4, bits = 16;
+    const uint32_t fmtBytes = 16, rate = TRACK_RATE, byteRate = TRACK_RATE * 4;
+    fwrite("RIFF", 1, 4, f);
+    fwrite(&riffBytes, 4, 1, f);
+    fwrite("WAVEfmt ", 1, 8, f);
+    fwrite(&fmtBytes, 4, 1, f);
+    fwrite(&fmtTag, 2, 1, f);
+    fwrite(&channels, 2, 1, f);
+    fwrite(&rate, 4, 1, f);
+    fwrite(&byteRate, 4, 1, f);
+    fwrite(&blockAlign, 2, 1, f);
+    fwrite(&bits, 2, 1, f);
+    fwrite("data", 1, 4, f);
+    fwrite(&dataBytes, 4, 1, f);
+    for (uint32_t i = 0; i < frames; ++i) {
+        const int16_t s = (int16_t)(8000.0 * std::sin(2.0 * M_PI * freq * i / TRACK_RATE));
+        const int16_t frame[2] = { s, s };
+        fwrite(frame, sizeof(frame), 1, f);
+    }
+    const bool ok = ferror(f) == 0;
+    fclose(f);
+    return ok;
+}
+
+bool waitPreloadReady(AurivoAudioEngine& engine, int timeoutMs) {
+    for (int waited = 0; waited < timeoutMs; waited += 2) {
+        const int state = engine.getPreloadInfo().state;
+        if (state == AurivoAudioEngine::PRELOAD_READY) return true;
+        if (state == AurivoAudioEngine::PRELOAD_FAILED || state == AurivoAudioEngine::PRELOAD_IDLE) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int iterations = 500;
+    std::string dir = "/tmp";
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--dir" && i + 1 < argc) {
+            dir = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: aurivo_engine_stress [--iterations N] [--dir tmpdir]\n");
+            return 2;
+        }
+    }
+
+    std::vector<std::string> tracks;
+    for (int i = 0; i < NUM_TRACKS; ++i) {
+        const std::string path = dir + "/aurivo_stress_" + std::to_string(i) + ".wav";
+        if (!writeSineWav(path, 220.0 * (i + 1), TRACK_MS)) {
+            fprintf(stderr, "Cannot write %s\n", path.c_str());
+            return 1;
+        }
+        tracks.push_back(path);
+    }
+
+    AurivoLog::start();
+    int failed = 0;
+    {
+        AurivoAudioEngine engine;
+        if (!engine.initialize(0)) {
+            fprintf(stderr, "Engine initialize failed (BASS error %d)\n", BASS_ErrorGetCode());
+            AurivoLog::stop();
+            return 1;
+        }
+        engine.configureDspStats(true, true, 80.0, 10);
+
+        std::atomic<bool> stopNoise{false};
+        std::thread noise([&]() {
+            std::mt19937 rng(7);
+            while (!stopNoise.load()) {
+                switch (rng() % 6) {
+                    case 0: engine.preloadNext(tracks[rng() % NUM_TRACKS], true); break;
+                    case 1: engine.cancelPreload(); break;
+                    case 2: engine.setLatencyProfile(AurivoAudioEngine::LATENCY_PROFILES_MS[rng() % AurivoAudioEngine::NUM_LATENCY_PROFILES]); break;
+                    case 3: engine.setBusMode(rng() % 2 != 0); break;
+                    case 4: {
+                        // Tape/dither DSP'leri zincirlere ya da bus'a bağlanır/sökülür
+                        std::lock_guard<std::mutex> lock(engine.getMutex());
+                        const bool on = rng() % 2 != 0;
+                        g_tapeSat.update([&](TapeSatParams& p) { p.enabled = on; });
+                        g_bitDither.update([&](BitDitherParams& p) { p.enabled = !on; });
+                        engine.refreshColorFxLocked();
+                        break;
+                    }
+                    default: engine.play(); break;   // bitmiş çıkışı yeniden açar
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(5 + rng() % 40));
+            }
+        });
+
+        std::thread contend([&]() {
+            while (!stopNoise.load()) {
+                engine.getPreloadInfo();
+                std::this_thread::yield();
+            }
+        });
+
+        std::mt19937 rng(1);
+        for (int it = 0; it < iterations; ++it) {
+            const std::string& current = tracks[it % NUM_TRACKS];
+            const std::string& next = tracks[(it + 1) % NUM_TRACKS];
+            if (!engine.loadFile(current)) {
+                ++failed;
+                continue;
+            }
+            engine.play();
+            if (engine.preloadNext(next, true)) waitPreloadReady(engine, 500);
+            g_stressAdvanceDelayUs = (int)(rng() % 20000);
+
+            // Parça sonunun çevresinde yeni yükleme: gapless geçişle yarışır
+            std::this_thread::sleep_for(std::chrono::milliseconds(TRACK_MS / 2 + (int)(rng() % TRACK_MS)));
+            if (rng() % 2) {
+                engine.crossfadeToFile(tracks[rng() % NUM_TRACKS], 20 + (int)(rng() % 60));
+            }
+        }
+
+        stopNoise = true;
+        noise.join();
+        contend.join();
+
+        const CrossfadeMixer::Stats stats = engine.getMixerStats();
+        const uint64_t advances = engine.getPreloadInfo().autoAdvances;
+        printf("iterations %d, load failures %d, gapless advances %llu (mixer %llu), retired %llu, forced %llu\n",
+               iterations, failed, (unsigned long long)advances, (unsigned long long)stats.advances,
+               (unsigned long long)stats.retired, (unsigned long long)stats.forcedRetires);
+        CallbackProfiler::Stats profile;
+        engine.getDspStats(profile);
+        printf("profiler blocks %llu, mixer stage %llu, max load %.2f\n", (unsigned long long)profile.blocks,
+               (unsigned long long)profile.stages[CallbackProfiler::STAGE_MIXER].calls, profile.maxLoad);
+        if (profile.blocks == 0 || profile.stages[CallbackProfiler::STAGE_MIXER].calls == 0) {
+            fprintf(stderr, "The callback profiler recorded no output blocks\n");
+            failed = std::max(failed, 1);
+        }
+        if (stats.advances == 0) {
+            fprintf(stderr, "No gapless advance happened; the race was not exercised\n");
+            failed = std::max(failed, 1);
+        }
+    }   // ~AurivoAudioEngine: reclaimer durur, BASS_Free
+    AurivoLog::stop();
+
+    for (const std::string& path : tracks) remove(path.c_str());
+    return failed == 0 ? 0 : 1;
+}
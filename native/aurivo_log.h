@@ -0,0 +1,470 @@
+#pragma once
+
+// Asynchronous native logger. Call sites never touch stdio: they encode the
+// format-string pointer and the raw argument values into a fixed-size record
+// of a preallocated lock-free ring (bounded MPMC queue, one sequence number per
+// cell). A background thread formats and writes the records. Audio threads
+// never lock, allocate or block here. When the ring is full, the record is
+// dropped and counted.
+//
+//   AURIVO_LOG_INFO("[ENGINE] Output device rate: %u Hz", rate);
+//   AURIVO_LOG_AT(AurivoLog::LEVEL_DEBUG, 1, "[DSP CALLBACK] %d frames", n);
+//
+// - Levels: debug < info < warn < error. Runtime threshold defaults to info,
+//   AURIVO_LOG_LEVEL=debug|info|warn|error|off overrides it at start().
+// - Each call site has its own rate limit (messages per second, default
+//   AURIVO_LOG_DEFAULT_RATE). Suppressed messages are counted and reported
+//   with the next message from the same site.
+// - AURIVO_LOG_STRIP_DEBUG removes debug call sites at compile time
+//   (arguments are still type-checked, no code or strings are emitted).
+// - Formats must be string literals; printf conversions are supported
+//   (length modifiers are ignored, integers are stored as 64-bit). Strings are
+//   copied into the record and truncated when the payload is full.
+// - Warnings and errors go to stderr, everything else to stdout.
+// - start()/stop() are reference counted. Records written before start()
+//   wait in the ring; after the last stop() they are no longer flushed.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#ifndef AURIVO_LOG_DEFAULT_RATE
+#define AURIVO_LOG_DEFAULT_RATE 20
+#endif
+
+namespace AurivoLog {
+
+enum Level {
+    LEVEL_DEBUG = 0,
+    LEVEL_INFO,
+    LEVEL_WARN,
+    LEVEL_ERROR,
+    LEVEL_OFF
+};
+
+#ifdef AURIVO_LOG_STRIP_DEBUG
+constexpr int kCompiledMinLevel = LEVEL_INFO;
+#else
+constexpr int kCompiledMinLevel = LEVEL_DEBUG;
+#endif
+
+static const size_t RING_SIZE = 1024;           // power of two
+static const size_t RECORD_BYTES = 256;
+static const int FLUSH_INTERVAL_MS = 20;
+
+// Per-call-site limiter: at most perSecond messages per one-second window.
+// Constant-initialized, so the function-local static needs no init guard.
+class RateLimit {
+public:
+    constexpr explicit RateLimit(uint32_t perSecond) : m_perSecond(perSecond), m_window(0), m_count(0), m_suppressed(0) {}
+
+    // true: emit now; suppressedOut = messages dropped since the last emitted one
+    bool admit(uint32_t& suppressedOut) {
+        suppressedOut = 0;
+        if (m_perSecond == 0) return true;
+        const uint32_t window = (uint32_t)std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count() + 1;
+        uint32_t seen = m_window.load(std::memory_order_relaxed);
+        if (seen != window && m_window.compare_exchange_strong(seen, window, std::memory_order_relaxed)) {
+            m_count.store(0, std::memory_order_relaxed);
+        }
+        if (m_count.fetch_add(1, std::memory_order_relaxed) >= m_perSecond) {
+            m_suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        suppressedOut = m_suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    const uint32_t m_perSecond;
+    std::atomic<uint32_t> m_window;
+    std::atomic<uint32_t> m_count;
+    std::atomic<uint32_t> m_suppressed;
+};
+
+struct Record {
+    enum { HEADER_BYTES = sizeof(const char*) + 8 };
+    enum { PAYLOAD_BYTES = RECORD_BYTES - sizeof(std::atomic<size_t>) - HEADER_BYTES };
+
+    const char* format;
+    uint8_t level;
+    uint8_t truncated;
+    uint16_t used;
+    uint32_t suppressed;
+    unsigned char payload[PAYLOAD_BYTES];
+};
+
+// Argument encoding: tag byte + value ('s': uint8 length + bytes)
+enum ArgTag : unsigned char {
+    ARG_INT = 'i',
+    ARG_UINT = 'u',
+    ARG_DOUBLE = 'd',
+    ARG_STRING = 's',
+    ARG_POINTER = 'p'
+};
+
+class Encoder {
+public:
+    explicit Encoder(Record& r) : m_record(r) {}
+
+    void putInt(int64_t v) { putScalar(ARG_INT, &v, sizeof(v)); }
+    void putUInt(uint64_t v) { putScalar(ARG_UINT, &v, sizeof(v)); }
+    void putDouble(double v) { putScalar(ARG_DOUBLE, &v, sizeof(v)); }
+    void putPointer(const void* p) {
+        const uint64_t v = (uint64_t)(uintptr_t)p;
+        putScalar(ARG_POINTER, &v, sizeof(v));
+    }
+    void putString(const char* s, size_t len) {
+        const size_t space = Record::PAYLOAD_BYTES - m_record.used;
+        if (space < 2) {
+            m_record.truncated = 1;
+            return;
+        }
+        size_t n = std::min<size_t>(std::min<size_t>(len, 255), space - 2);
+        if (n < len) m_record.truncated = 1;
+        m_record.payload[m_record.used++] = ARG_STRING;
+        m_record.payload[m_record.used++] = (unsigned char)n;
+        memcpy(m_record.payload + m_record.used, s, n);
+        m_record.used = (uint16_t)(m_record.used + n);
+    }
+
+    template <typename T>
+    void put(const T& v) {
+        typedef typename std::decay<T>::type D;
+        if constexpr (std::is_same<D, bool>::value) {
+            putInt(v ? 1 : 0);
+        } else if constexpr (std::is_enum<D>::value) {
+            putInt((int64_t)v);
+        } else if constexpr (std::is_integral<D>::value && std::is_signed<D>::value) {
+            putInt((int64_t)v);
+        } else if constexpr (std::is_integral<D>::value) {
+            putUInt((uint64_t)v);
+        } else if constexpr (std::is_floating_point<D>::value) {
+            putDouble((double)v);
+        } else if constexpr (std::is_array<T>::value) {
+            putString(v, strlen(v));
+        } else if constexpr (std::is_convertible<D, const char*>::value) {
+            const char* s = v ? (const char*)v : "(null)";
+            putString(s, strlen(s));
+        } else {
+            static_assert(std::is_pointer<D>::value, "unsupported log argument type");
+            putPointer((const void*)v);
+        }
+    }
+
+private:
+    void putScalar(ArgTag tag, const void* value, size_t size) {
+        if (m_record.used + 1 + size > Record::PAYLOAD_BYTES) {
+            m_record.truncated = 1;
+            return;
+        }
+        m_record.payload[m_record.used++] = tag;
+        memcpy(m_record.payload + m_record.used, value, size);
+        m_record.used = (uint16_t)(m_record.used + size);
+    }
+
+    Record& m_record;
+};
+
+// Background-thread side: printf-style rendering from the encoded arguments
+class Decoder {
+public:
+    explicit Decoder(const Record& r) : m_record(r), m_pos(0) {}
+
+    bool next(unsigned char& tag, int64_t& i, double& d, const char*& s, size_t& len) {
+        if (m_pos >= m_record.used) return false;
+        tag = m_record.payload[m_pos++];
+        if (tag == ARG_STRING) {
+            len = m_record.payload[m_pos++];
+            s = (const char*)m_record.payload + m_pos;
+            m_pos += len;
+            return true;
+        }
+        if (tag == ARG_DOUBLE) {
+            memcpy(&d, m_record.payload + m_pos, sizeof(d));
+            i = (int64_t)d;
+        } else {
+            memcpy(&i, m_record.payload + m_pos, sizeof(i));
+            d = (tag == ARG_UINT) ? (double)(uint64_t)i : (double)i;
+        }
+        m_pos += 8;
+        return true;
+    }
+
+private:
+    const Record& m_record;
+    size_t m_pos;
+};
+
+inline void appendFormatted(std::string& out, const char* spec, ...)
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((format(printf, 2, 3)))
+#endif
+    ;
+
+inline void appendFormatted(std::string& out, const char* spec, ...) {
+    char buf[512];
+    va_list args;
+    va_start(args, spec);
+    const int n = vsnprintf(buf, sizeof(buf), spec, args);
+    va_end(args);
+    if (n > 0) out.append(buf, std::min<size_t>((size_t)n, sizeof(buf) - 1));
+}
+
+inline void render(const Record& r, std::string& out) {
+    Decoder args(r);
+    const char* p = r.format;
+    while (*p) {
+        if (*p != '%') {
+            const char* start = p;
+            while (*p && *p != '%') ++p;
+            out.append(start, (size_t)(p - start));
+            continue;
+        }
+        if (p[1] == '%') {
+            out.push_back('%');
+            p += 2;
+            continue;
+        }
+
+        // %[flags][width][.precision][length]conversion
+        std::string spec = "%";
+        ++p;
+        while (*p && strchr("-+ #0", *p)) spec.push_back(*p++);
+        while (*p && ((*p >= '0' && *p <= '9') || *p == '.')) spec.push_back(*p++);
+        while (*p && strchr("hlLqjzt", *p)) ++p;
+        const char conv = *p;
+        if (!conv) break;
+        ++p;
+
+        unsigned char tag = 0;
+        int64_t i = 0;
+        double d = 0.0;
+        const char* s = nullptr;
+        size_t len = 0;
+        if (!args.next(tag, i, d, s, len)) {
+            out += "<?>";
+            continue;
+        }
+        if (conv == 's') {
+            if (tag == ARG_STRING) {
+                spec += 's';
+                const std::string value(s, len);
+                appendFormatted(out, spec.c_str(), value.c_str());
+            } else {
+                out += "<?>";
+            }
+        } else if (tag == ARG_STRING) {
+            out += "<?>";
+        } else if (strchr("diouxX", conv)) {
+            spec += "ll";
+            spec += conv;
+            if (conv == 'd' || conv == 'i') appendFormatted(out, spec.c_str(), (long long)i);
+            else appendFormatted(out, spec.c_str(), (unsigned long long)i);
+        } else if (strchr("fFeEgGaA", conv)) {
+            spec += conv;
+            appendFormatted(out, spec.c_str(), d);
+        } else if (conv == 'c') {
+            out.push_back((char)i);
+        } else if (conv == 'p') {
+            appendFormatted(out, "%p", (void*)(uintptr_t)i);
+        } else {
+            out += "<?>";
+        }
+    }
+    if (r.truncated) out += " [...]";
+    if (r.suppressed) appendFormatted(out, " (+%u suppressed)", (unsigned)r.suppressed);
+    out.push_back('\n');
+}
+
+class Logger {
+public:
+    Logger() {
+        for (size_t i = 0; i < RING_SIZE; ++i) m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    ~Logger() {
+        std::lock_guard<std::mutex> lock(m_lifecycle);
+        if (m_thread.joinable()) {
+            m_stop.store(true, std::memory_order_relaxed);
+            m_wake.notify_all();
+            m_thread.join();
+        }
+    }
+
+    static Logger& instance() {
+        static Logger logger;
+        return logger;
+    }
+
+    bool enabled(int level) const { return level >= m_level.load(std::memory_order_relaxed); }
+    void setLevel(int level) { m_level.store(std::max(0, std::min(level, (int)LEVEL_OFF)), std::memory_order_relaxed); }
+    int level() const { return m_level.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    // Any thread (audio thread included): claim a cell, encode, publish
+    template <typename... Args>
+    void write(int level, uint32_t suppressed, const char* format, const Args&... args) {
+        size_t pos = m_enqueue.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & (RING_SIZE - 1)];
+            const size_t seq = cell->seq.load(std::memory_order_acquire);
+            const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = m_enqueue.load(std::memory_order_relaxed);
+            }
+        }
+
+        Record& r = cell->record;
+        r.format = format;
+        r.level = (uint8_t)level;
+        r.truncated = 0;
+        r.used = 0;
+        r.suppressed = suppressed;
+        Encoder encoder(r);
+        (encoder.put(args), ...);
+        cell->seq.store(pos + 1, std::memory_order_release);
+    }
+
+    void start() {
+        std::lock_guard<std::mutex> lock(m_lifecycle);
+        if (m_users++ > 0) return;
+        if (const char* env = getenv("AURIVO_LOG_LEVEL")) {
+            static const char* names[] = { "debug", "info", "warn", "error", "off" };
+            for (int i = 0; i <= LEVEL_OFF; ++i) {
+                if (strcmp(env, names[i]) == 0) setLevel(i);
+            }
+        }
+        m_stop.store(false, std::memory_order_relaxed);
+        m_thread = std::thread([this]() { run(); });
+    }
+
+    // Flushes everything queued before returning
+    void stop() {
+        std::lock_guard<std::mutex> lock(m_lifecycle);
+        if (m_users == 0 || --m_users > 0) return;
+        m_stop.store(true, std::memory_order_relaxed);
+        m_wake.notify_all();
+        if (m_thread.joinable()) m_thread.join();
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        Record record;
+    };
+
+    // Consumer (single thread)
+    bool drain(std::string& out, std::string& err) {
+        bool any = false;
+        for (;;) {
+            Cell& cell = m_cells[m_dequeue & (RING_SIZE - 1)];
+            if (cell.seq.load(std::memory_order_acquire) != m_dequeue + 1) break;
+            render(cell.record, cell.record.level >= LEVEL_WARN ? err : out);
+            cell.seq.store(m_dequeue + RING_SIZE, std::memory_order_release);
+            ++m_dequeue;
+            any = true;
+        }
+        const uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+        if (dropped != m_reportedDropped) {
+            appendFormatted(err, "[LOG] %llu messages dropped (queue full)\n",
+                            (unsigned long long)(dropped - m_reportedDropped));
+            m_reportedDropped = dropped;
+            any = true;
+        }
+        return any;
+    }
+
+    void flush(std::string& out, std::string& err) {
+        if (!out.empty()) {
+            fwrite(out.data(), 1, out.size(), stdout);
+            fflush(stdout);
+            out.clear();
+        }
+        if (!err.empty()) {
+            fwrite(err.data(), 1, err.size(), stderr);
+            fflush(stderr);
+            err.clear();
+        }
+    }
+
+    void run() {
+        std::string out;
+        std::string err;
+        out.reserve(RECORD_BYTES * 16);
+        err.reserve(RECORD_BYTES * 4);
+        for (;;) {
+            const bool stopping = m_stop.load(std::memory_order_relaxed);
+            if (drain(out, err)) flush(out, err);
+            if (stopping) break;
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wake.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS),
+                            [this]() { return m_stop.load(std::memory_order_relaxed); });
+        }
+    }
+
+    Cell m_cells[RING_SIZE];
+    alignas(64) std::atomic<size_t> m_enqueue{0};
+    alignas(64) size_t m_dequeue = 0;
+    uint64_t m_reportedDropped = 0;
+    std::atomic<uint64_t> m_dropped{0};
+    std::atomic<int> m_level{LEVEL_INFO};
+    std::atomic<bool> m_stop{false};
+
+    std::mutex m_lifecycle;
+    int m_users = 0;
+    std::thread m_thread;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+};
+
+inline void start() { Logger::instance().start(); }
+inline void stop() { Logger::instance().stop(); }
+inline void setLevel(int level) { Logger::instance().setLevel(level); }
+
+// printf format checking for call sites (never called)
+inline void checkFormat(const char*, ...)
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((format(printf, 1, 2)))
+#endif
+    ;
+inline void checkFormat(const char*, ...) {}
+
+} // namespace AurivoLog
+
+#define AURIVO_LOG_AT(level, perSecond, fmt, ...)                                                  \
+    do {                                                                                           \
+        if constexpr ((level) >= ::AurivoLog::kCompiledMinLevel) {                                 \
+            if (false) ::AurivoLog::checkFormat(fmt, ##__VA_ARGS__);                               \
+            ::AurivoLog::Logger& aurivoLogger_ = ::AurivoLog::Logger::instance();                  \
+            if (aurivoLogger_.enabled(level)) {                                                    \
+                static ::AurivoLog::RateLimit aurivoLogSite_(perSecond);                           \
+                uint32_t aurivoLogSuppressed_ = 0;                                                 \
+                if (aurivoLogSite_.admit(aurivoLogSuppressed_)) {                                  \
+                    aurivoLogger_.write(level, aurivoLogSuppressed_, "" fmt, ##__VA_ARGS__);       \
+                }                                                                                  \
+            }                                                                                      \
+        }                                                                                          \
+    } while (0)
+
+#define AURIVO_LOG_DEBUG(fmt, ...) AURIVO_LOG_AT(::AurivoLog::LEVEL_DEBUG, AURIVO_LOG_DEFAULT_RATE, fmt, ##__VA_ARGS__)
+#define AURIVO_LOG_INFO(fmt, ...) AURIVO_LOG_AT(::AurivoLog::LEVEL_INFO, AURIVO_LOG_DEFAULT_RATE, fmt, ##__VA_ARGS__)
+#define AURIVO_LOG_WARN(fmt, ...) AURIVO_LOG_AT(::AurivoLog::LEVEL_WARN, AURIVO_LOG_DEFAULT_RATE, fmt, ##__VA_ARGS__)
+#define AURIVO_LOG_ERROR(fmt, ...) AURIVO_LOG_AT(::AurivoLog::LEVEL_ERROR, AURIVO_LOG_DEFAULT_RATE, fmt, ##__VA_ARGS__)
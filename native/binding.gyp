@@ -23,6 +23,7 @@
                         "-lbassape",
                         "-lbassflac",
                         "-lbasswv",
+                        "-lrt",
                         "-Wl,-rpath,'$$ORIGIN'",
                         "-Wl,-rpath,'$$ORIGIN/..'",
                         "-Wl,-rpath,'$$ORIGIN/../libs/linux'",
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Writes the short clips aurivo_dsp_golden checks against dsp_golden/reference.txt.
+
+The clips are committed; this script only documents how they were made and
+regenerates them if a clip is ever added. Rerunning it is not needed for a
+check, and a regenerated clip needs `cmake --build . --target
+record_dsp_golden` afterwards (the references hash their input).
+
+  pluck  44.1 kHz  Karplus-Strong arpeggio, notes panned across the field
+  drums  48 kHz    kick / snare / hats, peaks just under 0 dBFS (dynamics,
+                   true-peak overs)
+  pad    44.1 kHz  detuned saw pad with an anti-phase low end (crossfeed,
+                   bass mono, width)
+
+Stored as 16-bit PCM, so the input is the same on every platform.
+Standard library only.
+"""
+
+import math
+import os
+import random
+import struct
+import wave
+
+SECONDS = 1.2
+OUT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "clips")
+
+
+def write_wav(name, rate, left, right):
+    peak = max(max(abs(v) for v in left), max(abs(v) for v in right), 1e-9)
+    frames = bytearray()
+    for l, r in zip(left, right):
+        frames += struct.pack("<hh", int(round(max(-1.0, min(1.0, l)) * 32767)),
+                              int(round(max(-1.0, min(1.0, r)) * 32767)))
+    path = os.path.join(OUT_DIR, name + ".wav")
+    with wave.open(path, "wb") as w:
+        w.setnchannels(2)
+        w.setsampwidth(2)
+        w.setframerate(rate)
+        w.writeframes(bytes(frames))
+    print("%s: %d frames @ %d Hz, peak %.2f dBFS" % (path, len(left), rate, 20 * math.log10(peak)))
+
+
+def normalize(left, right, peak_db):
+    peak = max(max(abs(v) for v in left), max(abs(v) for v in right), 1e-9)
+    g = 10 ** (peak_db / 20) / peak
+    return [v * g for v in left], [v * g for v in right]
+
+
+def pluck(rng):
+    rate = 44100
+    n = int(SECONDS * rate)
+    left = [0.0] * n
+    right = [0.0] * n
+    notes = [261.63, 329.63, 392.00, 523.25, 659.25, 392.00]
+    for i, freq in enumerate(notes):
+        start = int(i * 0.18 * rate)
+        period = int(rate / freq)
+        line = [rng.uniform(-1.0, 1.0) for _ in range(period)]
+        pan = i / (len(notes) - 1)
+        gl, gr = math.cos(pan * math.pi / 2), math.sin(pan * math.pi / 2)
+        for k in range(n - start):
+            v = line[k % period]
+            nxt = line[(k + 1) % period]
+            line[k % period] = 0.996 * 0.5 * (v + nxt)
+            left[start + k] += v * gl
+            right[start + k] += v * gr
+    return rate, normalize(left, right, -3.0)
+
+
+def drums(rng):
+    rate = 48000
+    n = int(SECONDS * rate)
+    left = [0.0] * n
+    right = [0.0] * n
+    step = int(0.15 * rate)
+    for s in range(n // step):
+        start = s * step
+        length = min(n - start, int(0.25 * rate))
+        if s % 4 == 0:      # kick: 150 -> 50 Hz sweep
+            phase = 0.0
+            for k in range(length):
+                t = k / rate
+                phase += 2 * math.pi * (50 + 100 * math.exp(-t * 30)) / rate
+                v = math.sin(phase) * math.exp(-t * 9)
+                left[start + k] += v
+                right[start + k] += v
+        elif s % 4 == 2:    # snare: tone + noise
+            for k in range(length):
+                t = k / rate
+                tone = math.sin(2 * math.pi * 180 * t) * math.exp(-t * 25)
+                noise = rng.uniform(-1.0, 1.0) * math.exp(-t * 18)
+                left[start + k] += 0.5 * tone + 0.6 * noise
+                right[start + k] += 0.5 * tone + 0.55 * noise
+        # hats on every step: high-passed noise, slightly right
+        prev = 0.0
+        for k in range(min(length, int(0.04 * rate))):
+            x = rng.uniform(-1.0, 1.0)
+            v = (x - prev) * 0.3 * math.exp(-k / rate * 90)
+            prev = x
+            left[start + k] += 0.6 * v
+            right[start + k] += v
+    return rate, normalize(left, right, -0.3)
+
+
+def pad(rng):
+    rate = 44100
+    n = int(SECONDS * rate)
+    left = [0.0] * n
+    right = [0.0] * n
+    voices = [(220.0, -0.004), (220.0, 0.005), (277.18, 0.003), (329.63, -0.002)]
+    phases = [rng.random() for _ in voices]
+    lpl = lpr = 0.0
+    alpha = 1 - math.exp(-2 * math.pi * 2500 / rate)
+    for k in range(n):
+        t = k / rate
+        l = r = 0.0
+        for j, (freq, detune) in enumerate(voices):
+            phases[j] = (phases[j] + freq * (1 + detune) / rate) % 1.0
+            saw = 2 * phases[j] - 1
+            if j % 2 == 0:
+                l += saw
+            else:
+                r += saw
+        lpl += alpha * (l - lpl)
+        lpr += alpha * (r - lpr)
+        bass = 0.8 * math.sin(2 * math.pi * 55 * t)
+        wobble = 0.3 * math.sin(2 * math.pi * 70 * t)     # anti-phase low end
+        env = min(1.0, t / 0.05) * min(1.0, (SECONDS - t) / 0.1)
+        left[k] = env * (0.4 * lpl + bass + wobble)
+        right[k] = env * (0.4 * lpr + bass - wobble)
+    return rate, normalize(left, right, -6.0)
+
+
+def main():
+    os.makedirs(OUT_DIR, exist_ok=True)
+    for name, make in (("pluck", pluck), ("drums", drums), ("pad", pad)):
+        rate, (left, right) = make(random.Random(name))
+        write_wav(name, rate, left, right)
+
+
+if __name__ == "__main__":
+    main()
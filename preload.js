@@ -214,6 +214,7 @@ const createIPCAudioAPI = () => {
             setPreDelay: (ms) => ipcRenderer.invoke('audio:setConvReverbPreDelay', ms),
             setRoomType: (type) => ipcRenderer.invoke('audio:setConvReverbRoomType', type),
             getPresets: () => ipcRenderer.invoke('audio:getIRPresets'),
+            getInfo: () => ipcRenderer.invoke('audio:getConvolutionInfo'),
             reset: () => ipcRenderer.invoke('audio:resetConvolutionReverb')
         },
         crossfeed: {
@@ -245,12 +246,12 @@ const createIPCAudioAPI = () => {
             setAttack: (ms) => ipcRenderer.invoke('audio:setAutoGainAttack', ms),
             setRelease: (ms) => ipcRenderer.invoke('audio:setAutoGainRelease', ms),
             setMode: (mode) => ipcRenderer.invoke('audio:setAutoGainMode', mode),
-            update: () => ipcRenderer.invoke('audio:updateAutoGain'),
             normalize: (targetDB) => ipcRenderer.invoke('audio:normalizeAudio', targetDB),
             reset: () => ipcRenderer.invoke('audio:resetAutoGain'),
             getStats: () => ipcRenderer.invoke('audio:getAutoGainStats'),
             getPeakLevel: () => ipcRenderer.invoke('audio:getPeakLevel'),
-            getReduction: () => ipcRenderer.invoke('audio:getGainReduction')
+            getReduction: () => ipcRenderer.invoke('audio:getGainReduction'),
+            getLoudness: () => ipcRenderer.invoke('audio:getLoudness')
         }
     };
 };
@@ -313,6 +314,52 @@ const createAudioAPI = () => {
             ipcRenderer.on(ipcChannel, (_, ...args) => callback(...args));
         },
 
+        // Toplu parametre güncelleme: [paramId, value, ...] (bkz. getParamIds)
+        applyParamBatch: (ops) => ipcRenderer.invoke('audio:applyParamBatch', ops),
+        getParamIds: () => ipcRenderer.invoke('audio:getParamIds'),
+        // Tüm metreler tek çağrıda: Float32Array, indeksler getMeterFields()
+        getMeters: () => ipcRenderer.invoke('audio:getMeters'),
+        getMeterFields: () => ipcRenderer.invoke('audio:getMeterFields'),
+        resetMeterCounters: () => ipcRenderer.invoke('audio:resetMeterCounters'),
+        // DSP callback profili
+        getDspStats: () => ipcRenderer.invoke('audio:getDspStats'),
+        resetDspStats: () => ipcRenderer.invoke('audio:resetDspStats'),
+        setDspStatsOptions: (options) => ipcRenderer.invoke('audio:setDspStatsOptions', options),
+        // Stereo korelasyon ve goniometre ([m, s, ...] Float32Array, son okumadan beri)
+        setCorrelationWindow: (ms) => ipcRenderer.invoke('audio:setCorrelationWindow', ms),
+        getCorrelation: () => ipcRenderer.invoke('audio:getCorrelation'),
+        setGoniometer: (enabled, decimation) => ipcRenderer.invoke('audio:setGoniometer', enabled, decimation),
+        readGoniometer: () => ipcRenderer.invoke('audio:readGoniometer'),
+
+        // Gapless preload: sıradaki parça önceden açılır ve buffer'lanır
+        preloadNext: (filepath, options) => ipcRenderer.invoke('audio:preloadNext', filepath, options),
+        cancelPreload: () => ipcRenderer.invoke('audio:cancelPreload'),
+        playNext: (crossfadeMs = 0) => ipcRenderer.invoke('audio:playNext', crossfadeMs),
+        getPreloadState: () => ipcRenderer.invoke('audio:getPreloadState'),
+
+        // Crossfade mikseri: eğri ('equal-power' | 'linear' | 's-curve') ve durum
+        setCrossfadeCurve: (curve) => ipcRenderer.invoke('audio:setCrossfadeCurve', curve),
+        getMixerStats: () => ipcRenderer.invoke('audio:getMixerStats'),
+        // Çıkış gecikmesi: profil (40/100/250/500 ms) ve cihaz/buffer/underrun raporu
+        setLatencyProfile: (ms) => ipcRenderer.invoke('audio:setLatencyProfile', ms),
+        getLatencyInfo: () => ipcRenderer.invoke('audio:getLatencyInfo'),
+        // Kütüphane loudness taraması (ilerleme: on('loudnessScanProgress', cb)) ve ReplayGain
+        scanLoudness: (paths, options) => ipcRenderer.invoke('audio:scanLoudness', paths, options),
+        cancelLoudnessScan: () => ipcRenderer.invoke('audio:cancelLoudnessScan'),
+        setReplayGain: (options) => ipcRenderer.invoke('audio:setReplayGain', options),
+        getReplayGainInfo: () => ipcRenderer.invoke('audio:getReplayGainInfo'),
+        // Seek bar waveform'u: { min, max, rms } Float32Array, range = { start, end } saniye
+        getWaveformOverview: (filePath, width, range) => ipcRenderer.invoke('audio:getWaveformOverview', filePath, width, range),
+        // Offline render -> WAV (toplu ilerleme: on('renderProgress', cb))
+        renderFile: (input, output, options) => ipcRenderer.invoke('audio:renderFile', input, output, options),
+        renderFiles: (jobs, options) => ipcRenderer.invoke('audio:renderFiles', jobs, options),
+        cancelRender: () => ipcRenderer.invoke('audio:cancelRender'),
+        // Bit-transparent: cihazı parçanın örnekleme hızına geçir
+        setBitTransparent: (enabled) => ipcRenderer.invoke('audio:setBitTransparent', enabled),
+        // Master-bus: FX zinciri parça başına değil, mix üzerinde bir kez
+        setBusMode: (enabled) => ipcRenderer.invoke('audio:setBusMode', enabled),
+        getBusMode: () => ipcRenderer.invoke('audio:getBusMode'),
+
         // 32-Band Equalizer
         eq: {
             setBand: (index, gain) => ipcRenderer.invoke('audio:setEQBand', index, gain),
@@ -343,12 +390,12 @@ const createAudioAPI = () => {
             setAttack: (ms) => ipcRenderer.invoke('audio:setAutoGainAttack', ms),
             setRelease: (ms) => ipcRenderer.invoke('audio:setAutoGainRelease', ms),
             setMode: (mode) => ipcRenderer.invoke('audio:setAutoGainMode', mode),
-            update: () => ipcRenderer.invoke('audio:updateAutoGain'),
             normalize: (targetDB) => ipcRenderer.invoke('audio:normalizeAudio', targetDB),
             reset: () => ipcRenderer.invoke('audio:resetAutoGain'),
             getStats: () => ipcRenderer.invoke('audio:getAutoGainStats'),
             getPeakLevel: () => ipcRenderer.invoke('audio:getPeakLevel'),
-            getReduction: () => ipcRenderer.invoke('audio:getGainReduction')
+            getReduction: () => ipcRenderer.invoke('audio:getGainReduction'),
+            getLoudness: () => ipcRenderer.invoke('audio:getLoudness')
         },
 
         // True Peak Limiter + Meter
@@ -529,6 +576,7 @@ const createAudioAPI = () => {
             setPreDelay: (ms) => ipcRenderer.invoke('audio:setConvReverbPreDelay', ms),
             setRoomType: (type) => ipcRenderer.invoke('audio:setConvReverbRoomType', type),
             getPresets: () => ipcRenderer.invoke('audio:getIRPresets'),
+            getInfo: () => ipcRenderer.invoke('audio:getConvolutionInfo'),
             reset: () => ipcRenderer.invoke('audio:resetConvolutionReverb')
         },
 
@@ -6004,12 +6004,17 @@ async function playIndex(index) {
         if (result && result.error) {
             console.log('🔥 BASS Audio Engine hatası:', result.error);
         }
+        if (result && result.superseded) {
+            // Daha yeni bir playIndex isteği yüklemeyi devraldı; HTML5'e düşme
+            return;
+        }
         if (result === true || (result && result.success)) {
             window.aurivo.audio.setVolume((state.volume || 0) / 100);
             console.log('🎵 window.aurivo.audio.play() çağrılıyor...');
             window.aurivo.audio.play();
             console.log('🎵 play() çağrıldı, ses çıkması gerekiyor');
             startNativePositionUpdates();
+            preloadUpcomingNativeTrack();
         } else {
             console.warn('[PLAYINDEX] Native audio load failed, falling back to HTML5:', result);
             // Keep the app usable even when the native engine can't decode the file.
@@ -6106,6 +6111,7 @@ async function startNativeTransitionToIndex(index, ms) {
             // UI update: yeni parça ana parça gibi görünsün
             state.currentIndex = index;
             state.isPlaying = true;
+            preloadUpcomingNativeTrack();
             updatePlayPauseIcon(true);
             elements.nowPlayingLabel.textContent = `${uiT('nowPlaying.prefix', 'Now Playing')}: ${toItem.name}`;
             renderPlaylist();
@@ -6180,6 +6186,7 @@ async function startNativeTransitionToIndex(index, ms) {
         // Yeni dosyayı yükle
         const result = await window.aurivo.audio.loadFile(toItem.path);
         console.log('[CROSSFADE] native loadFile result:', result);
+        if (result && result.superseded) return;
         if (!(result === true || (result && result.success))) {
             console.error('[CROSSFADE] Native transition: loadFile failed', result);
             await recoverOldTrack();
@@ -6697,6 +6704,19 @@ function computeNextIndex() {
     return nextIdx;
 }
 
+// Sıradaki parçayı native engine'de önceden aç + buffer'la; geçişte
+// loadFile/crossfadeTo aynı yol için hazır zinciri devralır (I/O yok).
+// Shuffle'da sıradaki parça önceden bilinmediği için atlanır.
+function preloadUpcomingNativeTrack() {
+    if (!useNativeAudio || state.isShuffle) return;
+    if (typeof window.aurivo?.audio?.preloadNext !== 'function') return;
+    const nextIndex = computeNextIndex();
+    if (nextIndex < 0 || nextIndex === state.currentIndex) return;
+    const nextItem = state.playlist[nextIndex];
+    if (!nextItem?.path) return;
+    window.aurivo.audio.preloadNext(nextItem.path).catch(() => { /* yoksay */ });
+}
+
 // Önceki index'i hesapla
 function computePrevIndex() {
     if (state.playlist.length <= 0) return -1;
@@ -14,7 +14,6 @@ const SFX = {
     knobInstances: {},  // Map of "effectName_paramName" -> ColorKnob instance
     barAnalyzer: null,
     eqResponse: null,
-    autoGainInterval: null,  // Auto Gain periyodik güncelleme timer'ı
     suppressEq32SliderEvents: false,
     eq32PersistTimer: null,
     eq32PersistInFlight: false,
@@ -3223,6 +3222,56 @@ function updateEffectParam(effectName, param, value) {
 // ============================================
 // APPLY & RESET EFFECTS
 // ============================================
+let cachedParamIds = null;
+
+async function applyEq32Batch(ipcAudio, settings) {
+    if (typeof ipcAudio.applyParamBatch !== 'function') return false;
+    try {
+        if (!cachedParamIds) cachedParamIds = await ipcAudio.getParamIds?.();
+        const ids = cachedParamIds;
+        if (!ids) return false;
+
+        const ops = [];
+        normalize32Bands(settings.bands).forEach((v, i) => ops.push(ids.EQ_BAND_0 + i, v));
+        if (Number.isFinite(settings.balance)) ops.push(ids.BALANCE, settings.balance);
+        if (Number.isFinite(settings.bass)) ops.push(ids.TONE_BASS, settings.bass);
+        if (Number.isFinite(settings.mid)) ops.push(ids.TONE_MID, settings.mid);
+        if (Number.isFinite(settings.treble)) ops.push(ids.TONE_TREBLE, settings.treble);
+        if (Number.isFinite(settings.stereoExpander)) ops.push(ids.STEREO_EXPANDER, settings.stereoExpander);
+
+        const result = await ipcAudio.applyParamBatch(Float32Array.from(ops));
+        return !!result?.success;
+    } catch (e) {
+        console.warn('[SFX] applyParamBatch başarısız, tek tek uygulanıyor:', e?.message || e);
+        return false;
+    }
+}
+
+function applyEq32Individually(ipcAudio, settings) {
+    // 32-Band EQ bantlarını uygula
+    if (ipcAudio.eq) {
+        const gains = normalize32Bands(settings.bands);
+        if (typeof ipcAudio.eq.setAllBands === 'function') {
+            ipcAudio.eq.setAllBands(gains);
+        } else {
+            gains.forEach((val, i) => {
+                ipcAudio.eq.setBand(i, val);
+            });
+        }
+    }
+    // Balance uygula
+    if (ipcAudio.balance) {
+        ipcAudio.balance.set(settings.balance);
+    }
+    // Aurivo Module (Bass, Mid, Treble, Stereo)
+    if (ipcAudio.module) {
+        ipcAudio.module.setBass(settings.bass);
+        ipcAudio.module.setMid(settings.mid);
+        ipcAudio.module.setTreble(settings.treble);
+        ipcAudio.module.setStereoExpander(settings.stereoExpander);
+    }
+}
+
 function applyEffect(effectName) {
     const settings = getSettings(effectName);
     const ipcAudio = window.aurivo?.ipcAudio;
@@ -3241,28 +3290,11 @@ function applyEffect(effectName) {
 
     switch (effectName) {
         case 'eq32':
-            // 32-Band EQ bantlarını uygula
-            if (ipcAudio.eq) {
-                const gains = normalize32Bands(settings.bands);
-                if (typeof ipcAudio.eq.setAllBands === 'function') {
-                    ipcAudio.eq.setAllBands(gains);
-                } else {
-                    gains.forEach((val, i) => {
-                        ipcAudio.eq.setBand(i, val);
-                    });
-                }
-            }
-            // Balance uygula
-            if (ipcAudio.balance) {
-                ipcAudio.balance.set(settings.balance);
-            }
-            // Aurivo Module (Bass, Mid, Treble, Stereo)
-            if (ipcAudio.module) {
-                ipcAudio.module.setBass(settings.bass);
-                ipcAudio.module.setMid(settings.mid);
-                ipcAudio.module.setTreble(settings.treble);
-                ipcAudio.module.setStereoExpander(settings.stereoExpander);
-            }
+            // Preset tek native çağrıyla (bantlar + balance + ton + stereo) aynı
+            // DSP bloğunda uygulanır; batch API yoksa tek tek setter'lara düş
+            applyEq32Batch(ipcAudio, settings).then((ok) => {
+                if (!ok) applyEq32Individually(ipcAudio, settings);
+            });
             break;
 
         case 'peq':
@@ -3550,12 +3582,8 @@ function applyEffect(effectName) {
         case 'autogain':
             console.log('[AUTO GAIN UI] Applying autogain, settings:', settings);
 
-            // Önceki timer'ı temizle
-            if (SFX.autoGainInterval) {
-                clearInterval(SFX.autoGainInterval);
-                SFX.autoGainInterval = null;
-            }
-
+            // Seviye ölçümü ve kazanç native audio thread'de (EBU R128 metresi);
+            // burada yalnızca parametreler gönderilir, periyodik update yok.
             if (ipcAudio.autoGain) {
                 // Enable/Disable
                 if (typeof ipcAudio.autoGain.setEnabled === 'function') {
@@ -3574,20 +3602,10 @@ function applyEffect(effectName) {
                         ipcAudio.autoGain.setMaxGain(settings.maxGain);
                     }
 
-                    // Periyodik güncelleme başlat (her 100ms)
-                    SFX.autoGainInterval = setInterval(() => {
-                        if (ipcAudio.autoGain && typeof ipcAudio.autoGain.update === 'function') {
-                            ipcAudio.autoGain.update();
-                        }
-                    }, 100);
-
-                    console.log('[AUTO GAIN] Timer started - Target:', settings.targetLevel, 'MaxGain:', settings.maxGain);
+                    console.log('[AUTO GAIN] Enabled - Target:', settings.targetLevel, 'MaxGain:', settings.maxGain);
                 } else {
-                    // Devre dışı bırakıldığında volume'u sıfırla
-                    if (typeof ipcAudio.autoGain.reset === 'function') {
-                        ipcAudio.autoGain.reset();
-                    }
-                    console.log('[AUTO GAIN] Disabled and reset');
+                    // Kazanç native tarafta release ile 0 dB'e döner
+                    console.log('[AUTO GAIN] Disabled');
                 }
             } else {
                 console.warn('[AUTO GAIN UI] ipcAudio.autoGain is undefined!');
@@ -3949,13 +3967,6 @@ function resetEffect(effectName) {
         console.log('🔄 PEQ sıfırlandı (6 bant)');
     } else if (effectName === 'autogain') {
         // Auto Gain Özel Sıfırlama
-
-        // Timer'ı temizle
-        if (SFX.autoGainInterval) {
-            clearInterval(SFX.autoGainInterval);
-            SFX.autoGainInterval = null;
-        }
-
         const defaults = {
             enabled: false,
             targetLevel: -14,
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cctype>
@@ -47,6 +48,8 @@
 
 #ifndef _WIN32
 #include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #endif
 
@@ -630,6 +633,13 @@ static fs::path getPresetPickerSettingsPath() {
     return getVisualizerConfigDir() / "preset_picker.cfg";
 }
 
+static std::string getPcmShmName(int argc, char* argv[]) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--pcm-shm") return argv[i + 1];
+    }
+    return std::string();
+}
+
 static std::string getPresetsPath(int argc, char* argv[]) {
     for (int i = 1; i < argc - 1; i++) {
         if (std::string(argv[i]) == "--presets") {
@@ -830,7 +840,16 @@ struct AppState {
 
     // Ses beslemesi: SADECE stdin üzerinden uygulama PCM'i (Electron float32 interleaved pipe eder).
     std::vector<uint8_t> pcmInBuf;
+    size_t pcmInPos = 0;  // pcmInBuf içinde ayrıştırılmamış verinin başı
     std::vector<float> pcmTmp;
+
+    // İsteğe bağlı: paylaşımlı bellek PCM ring'i (--pcm-shm). Açılamazsa stdin v2 kullanılır.
+    const uint8_t* pcmShmBase = nullptr;
+    size_t pcmShmBytes = 0;
+    uint64_t pcmShmReadFrames = 0;
+#ifdef _WIN32
+    HANDLE pcmShmMapping = nullptr;
+#endif
     uint64_t lastPcmMs = 0;
     unsigned int pmMaxSamplesPerChannel = 0;
     bool audioStale = true;
@@ -1101,23 +1120,34 @@ static void pumpPcmFromStdin() {
     }
 #endif
 
-    // Mümkün olduğunca çok tam paketi ayrıştır.
+    // Paylaşımlı bellek açık: Electron onayı (consumerAttached) görene kadar
+    // stdin'e de yazar. Pipe dolmasın diye okunur, çift beslememek için atılır.
+    if (g.pcmShmBase) {
+        g.pcmInBuf.clear();
+        g.pcmInPos = 0;
+        return;
+    }
+
+    // Mümkün olduğunca çok tam paketi ayrıştır. Tüketilen baytlar her pakette
+    // silinmez; okuma ofseti ilerler ve tampon döngü sonunda bir kez sıkıştırılır.
     for (;;) {
-        if (g.pcmInBuf.size() < 8) return;
-        const uint8_t* p = g.pcmInBuf.data();
+        const size_t avail = g.pcmInBuf.size() - g.pcmInPos;
+        if (avail < 8) break;
+        const uint8_t* p = g.pcmInBuf.data() + g.pcmInPos;
         uint32_t channels = readU32LE(p + 0);
         uint32_t countPerChannel = readU32LE(p + 4);
 
         // Desync / suistimal önlemek için temel doğrulama.
         if (!((channels == 1) || (channels == 2)) || countPerChannel == 0 || countPerChannel > 65536) {
             g.pcmInBuf.clear();
+            g.pcmInPos = 0;
             return;
         }
 
         const size_t floatCount = (size_t)channels * (size_t)countPerChannel;
         const size_t payloadBytes = floatCount * sizeof(float);
         const size_t packetBytes = 8 + payloadBytes;
-        if (g.pcmInBuf.size() < packetBytes) return;
+        if (avail < packetBytes) break;
 
         // Yükü hizalı float tamponuna kopyala.
         g.pcmTmp.resize(floatCount);
@@ -1142,8 +1172,167 @@ static void pumpPcmFromStdin() {
         }
 
         // Paketi tüket.
-        g.pcmInBuf.erase(g.pcmInBuf.begin(), g.pcmInBuf.begin() + (ptrdiff_t)packetBytes);
+        g.pcmInPos += packetBytes;
+    }
+
+    if (g.pcmInPos == g.pcmInBuf.size()) {
+        g.pcmInBuf.clear();
+        g.pcmInPos = 0;
+    } else if (g.pcmInPos > 0) {
+        g.pcmInBuf.erase(g.pcmInBuf.begin(), g.pcmInBuf.begin() + (ptrdiff_t)g.pcmInPos);
+        g.pcmInPos = 0;
+    }
+}
+
+// ============================================
+// Paylaşımlı bellek PCM ring'i (--pcm-shm <isim>)
+// ============================================
+// Aurivo ses motoru (native/aurivo_audio.cpp, PcmShmRing) post-DSP stereo
+// sample'ları buraya yazar; yalnızca son okumadan bu yana gelen frame'leri
+// projectM'e besleriz. Düzen motor tarafıyla aynı olmalı.
+// Bölge okuma-yazma map edilir ama tek yazdığımız alan consumerAttached'dır:
+// düzen doğrulanınca 1, kapanırken 0 (uyuşmayan düzende hiç dokunulmaz).
+// Electron bayrağı motorun getVisualizerShmStats'ından okur ve stdin PCM
+// beslemesini ancak 1 olunca durdurur; map başarısızsa stdin yedeği kesilmez.
+static const uint32_t PCM_SHM_MAGIC = 0x52505541;  // "AUPR"
+static const uint32_t PCM_SHM_VERSION = 2;
+
+struct PcmShmHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t channels;
+    uint32_t capacityFrames;
+    uint32_t dataOffset;
+    std::atomic<uint32_t> sampleRate;
+    std::atomic<uint32_t> latencyFrames;
+    std::atomic<uint32_t> producerAlive;
+    alignas(64) std::atomic<uint64_t> writeFrames;
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> writeTimeNs;
+    std::atomic<uint32_t> consumerAttached;
+};
+
+static PcmShmHeader* pcmShmHeader() {
+    return reinterpret_cast<PcmShmHeader*>(const_cast<uint8_t*>(g.pcmShmBase));
+}
+
+static void closePcmShm() {
+    if (!g.pcmShmBase) return;
+    pcmShmHeader()->consumerAttached.store(0, std::memory_order_release);
+#ifdef _WIN32
+    UnmapViewOfFile(g.pcmShmBase);
+    if (g.pcmShmMapping) CloseHandle(g.pcmShmMapping);
+    g.pcmShmMapping = nullptr;
+#else
+    munmap((void*)g.pcmShmBase, g.pcmShmBytes);
+#endif
+    g.pcmShmBase = nullptr;
+    g.pcmShmBytes = 0;
+}
+
+static bool openPcmShm(const std::string& name) {
+    const void* base = nullptr;
+    size_t bytes = 0;
+#ifdef _WIN32
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_READ | FILE_MAP_WRITE, FALSE, name.c_str());
+    if (!mapping) {
+        std::cerr << "[Audio] OpenFileMapping failed for " << name << std::endl;
+        return false;
+    }
+    base = MapViewOfFile(mapping, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, 0);
+    if (!base) {
+        CloseHandle(mapping);
+        std::cerr << "[Audio] MapViewOfFile failed for " << name << std::endl;
+        return false;
+    }
+    MEMORY_BASIC_INFORMATION mbi{};
+    VirtualQuery(base, &mbi, sizeof(mbi));
+    bytes = (size_t)mbi.RegionSize;
+    g.pcmShmMapping = mapping;
+#else
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        std::cerr << "[Audio] shm_open failed for " << name << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(PcmShmHeader)) {
+        ::close(fd);
+        std::cerr << "[Audio] shm region too small: " << name << std::endl;
+        return false;
+    }
+    bytes = (size_t)st.st_size;
+    void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        std::cerr << "[Audio] mmap failed for " << name << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    base = p;
+#endif
+    g.pcmShmBase = static_cast<const uint8_t*>(base);
+    g.pcmShmBytes = bytes;
+
+    // Motorla düzen uyuşmuyorsa kullanma (eski/yeni sürüm karışımı)
+    PcmShmHeader* h = pcmShmHeader();
+    const uint32_t cap = h->capacityFrames;
+    const bool valid = bytes >= sizeof(PcmShmHeader) && h->magic == PCM_SHM_MAGIC && h->version == PCM_SHM_VERSION &&
+                       h->channels == 2 && cap != 0 && (cap & (cap - 1)) == 0 &&
+                       (size_t)h->dataOffset + (size_t)cap * 2 * sizeof(float) <= bytes;
+    if (!valid) {
+        std::cerr << "[Audio] shm layout mismatch: " << name << std::endl;
+        g.pcmShmBase = nullptr;   // bayrağa dokunmadan (başka sürümün düzeni) unmap et
+        g.pcmShmBytes = 0;
+#ifdef _WIN32
+        UnmapViewOfFile(base);
+        CloseHandle(g.pcmShmMapping);
+        g.pcmShmMapping = nullptr;
+#else
+        munmap(const_cast<void*>(base), bytes);
+#endif
+        return false;
+    }
+    g.pcmShmReadFrames = 0;
+    h->consumerAttached.store(1, std::memory_order_release);
+    return true;
+}
+
+static void pumpPcmFromShm() {
+    if (!g.pcmShmBase || !g.pm) return;
+    const PcmShmHeader* h = reinterpret_cast<const PcmShmHeader*>(g.pcmShmBase);
+    if (h->producerAlive.load(std::memory_order_acquire) == 0) return;
+
+    const uint64_t cap = h->capacityFrames;
+    const uint64_t w = h->writeFrames.load(std::memory_order_acquire);
+    const uint64_t latency = std::min<uint64_t>(h->latencyFrames.load(std::memory_order_relaxed), cap / 2);
+    if (w <= latency) return;
+
+    // Duyulan konuma hizala: üretici çalma buffer'ını önden doldurur.
+    const uint64_t end = w - latency;
+    if (end <= g.pcmShmReadFrames) return;
+
+    const uint64_t maxN = g.pmMaxSamplesPerChannel > 0 ? g.pmMaxSamplesPerChannel : 2048;
+    uint64_t start = g.pcmShmReadFrames;
+    if (end - start > maxN) start = end - maxN;
+    const size_t n = (size_t)(end - start);
+
+    const float* data = reinterpret_cast<const float*>(g.pcmShmBase + h->dataOffset);
+    g.pcmTmp.resize(n * 2);
+    const size_t idx = (size_t)(start & (cap - 1));
+    const size_t first = std::min(n, (size_t)cap - idx);
+    std::memcpy(g.pcmTmp.data(), data + idx * 2, first * 2 * sizeof(float));
+    if (first < n) {
+        std::memcpy(g.pcmTmp.data() + first * 2, data, (n - first) * 2 * sizeof(float));
     }
+
+    // Kopyalarken üretici bu bölgeyi ezdiyse (bir blok pay ile) bu kareyi atla.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t w2 = h->writeFrames.load(std::memory_order_relaxed);
+    g.pcmShmReadFrames = end;
+    if (w2 - start > cap - cap / 4) return;
+
+    projectm_pcm_add_float(g.pm, g.pcmTmp.data(), (unsigned int)n, PROJECTM_STEREO);
+    g.lastPcmMs = nowMs();
 }
 
 static void updateDrawable() {
@@ -2441,6 +2630,7 @@ static bool initImGui() {
 
 static void shutdownAll() {
     std::cout << "[Shutdown] begin" << std::endl;
+    closePcmShm();
     if (g.pm) {
         projectm_destroy(g.pm);
         g.pm = nullptr;
@@ -2544,7 +2734,15 @@ int main(int argc, char* argv[]) {
         if (std::string(dbg) == "1") g.debugOverlay = true;
     }
 
-    // Ses giriş politikası: SADECE stdin üzerinden uygulama PCM'i. yakalama yok, yedek yok.
+    // Ses giriş politikası: SADECE uygulama PCM'i (paylaşımlı bellek veya stdin). yakalama yok.
+    const std::string pcmShmName = getPcmShmName(argc, argv);
+    if (!pcmShmName.empty()) {
+        if (openPcmShm(pcmShmName)) {
+            std::cout << "[Audio] ✓ projectM input = aurivo_pcm (shared memory " << pcmShmName << ")" << std::endl;
+        } else {
+            std::cout << "[Audio] shared memory unavailable; falling back to stdin" << std::endl;
+        }
+    }
     if (!initStdinNonBlocking()) {
         std::cerr << "[Audio] stdin non-blocking setup failed; PCM feed may stutter." << std::endl;
     } else {
@@ -2573,6 +2771,7 @@ int main(int argc, char* argv[]) {
         SDL_GL_MakeCurrent(g.window, g.gl);
 
         // Gelen PCM'i (bloklamadan) al ve projectM'e besle.
+        if (g.pcmShmBase) pumpPcmFromShm();
         pumpPcmFromStdin();
         feedSilenceIfStale(frameStartMs);
         while (SDL_PollEvent(&e)) {